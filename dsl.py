@@ -234,6 +234,9 @@ DSL_ODE_POST_OCCURRENCE_CHECK = 1
 DSL_ODE_ANY_SOURCE = None
 DSL_ODE_ANY_CLASS = int('7FFFFFFF',16)
 
+DSL_ODE_COMPOSITE_OPERATOR_AND = 0
+DSL_ODE_COMPOSITE_OPERATOR_OR = 1
+
 DSL_TILER_SHOW_ALL_SOURCES = None
 
 # Copied from x.h
@@ -277,10 +280,15 @@ DSL_RECORDING_EVENT_END   = 1
 DSL_EVENT_FILE_FORMAT_TEXT   = 0
 DSL_EVENT_FILE_FORMAT_CSV    = 1
 DSL_EVENT_FILE_FORMAT_MOTC   = 2
+DSL_EVENT_FILE_FORMAT_BINARY = 3
 
 DSL_WRITE_MODE_APPEND   = 0
 DSL_WRITE_MODE_TRUNCATE = 1
 
+DSL_FILE_SYNC_POLICY_NONE      = 0
+DSL_FILE_SYNC_POLICY_ON_ROTATE = 1
+DSL_FILE_SYNC_POLICY_ON_WRITE  = 2
+
 DSL_METRIC_OBJECT_CLASS                     = 0
 DSL_METRIC_OBJECT_TRACKING_ID               = 1
 DSL_METRIC_OBJECT_LOCATION                  = 2
@@ -414,6 +422,41 @@ class dsl_threshold_value(Structure):
         ('threshold', c_uint),
         ('value', c_uint)]
 
+class dsl_ode_latency_stats(Structure):
+    _fields_ = [
+        ('count', c_uint64),
+        ('p50', c_uint64),
+        ('p99', c_uint64),
+        ('max', c_uint64)]
+
+class dsl_ode_trigger_stats(Structure):
+    _fields_ = [
+        ('pre_process_frame', dsl_ode_latency_stats),
+        ('check_for_occurrence', dsl_ode_latency_stats),
+        ('post_process_frame', dsl_ode_latency_stats),
+        ('handle_occurrence', dsl_ode_latency_stats),
+        ('occurrences', c_uint64),
+        ('occurrences_per_sec', c_double)]
+
+class dsl_ode_batch_object(Structure):
+    _fields_ = [
+        ('class_id', c_uint),
+        ('inference_component_id', c_uint),
+        ('tracking_id', c_uint64),
+        ('left', c_float),
+        ('top', c_float),
+        ('width', c_float),
+        ('height', c_float),
+        ('inference_confidence', c_float),
+        ('tracker_confidence', c_float)]
+
+class dsl_pph_ode_stats(Structure):
+    _fields_ = [
+        ('batch', dsl_ode_latency_stats),
+        ('frames', c_uint64),
+        ('occurrences', c_uint64),
+        ('occurrences_per_sec', c_double)]
+
 ##
 ## Pointer Typedefs
 ##
@@ -429,6 +472,8 @@ DSL_LONG_P = POINTER(c_long)
 DSL_DOUBLE_P = POINTER(c_double)
 DSL_FLOAT_P = POINTER(c_float)
 DSL_RTSP_CONNECTION_DATA_P = POINTER(dsl_rtsp_connection_data)
+DSL_ODE_TRIGGER_STATS_P = POINTER(dsl_ode_trigger_stats)
+DSL_PPH_ODE_STATS_P = POINTER(dsl_pph_ode_stats)
 
 ##
 ## Callback Typedefs
@@ -442,6 +487,10 @@ DSL_ODE_HANDLE_OCCURRENCE = \
 DSL_ODE_MONITOR_OCCURRENCE = \
     CFUNCTYPE(None, POINTER(dsl_ode_occurrence_info), c_void_p)
 
+# dsl_ode_monitor_occurrence_batch_cb
+DSL_ODE_MONITOR_OCCURRENCE_BATCH = \
+    CFUNCTYPE(None, POINTER(dsl_ode_occurrence_info), c_uint, c_void_p)
+
 # dsl_ode_check_for_occurrence_cb
 DSL_ODE_CHECK_FOR_OCCURRENCE = \
     CFUNCTYPE(c_bool, c_void_p, c_void_p, c_void_p, c_void_p)
@@ -450,6 +499,11 @@ DSL_ODE_CHECK_FOR_OCCURRENCE = \
 DSL_ODE_POST_PROCESS_FRAME = \
     CFUNCTYPE(c_bool, c_void_p, c_void_p, c_void_p)
 
+# dsl_ode_check_for_occurrences_cb
+DSL_ODE_CHECK_FOR_OCCURRENCES = \
+    CFUNCTYPE(c_bool, c_void_p, c_void_p, POINTER(dsl_ode_batch_object), 
+        c_uint, DSL_UINT64_P, c_void_p)
+
 # dsl_ode_enabled_state_change_listener_cb
 DSL_ODE_ENABLED_STATE_CHANGE_LISTENER = \
     CFUNCTYPE(None, c_bool, c_void_p)
@@ -1038,6 +1092,20 @@ def dsl_ode_action_capture_mailer_remove(name, mailer):
     result = _dsl.dsl_ode_action_capture_mailer_remove(name, mailer)
     return int(result)
 
+##
+## dsl_ode_action_capture_queue_stats_get()
+##
+_dsl.dsl_ode_action_capture_queue_stats_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint64)]
+_dsl.dsl_ode_action_capture_queue_stats_get.restype = c_uint
+def dsl_ode_action_capture_queue_stats_get(name):
+    global _dsl
+    queue_depth = c_uint(0)
+    dropped = c_uint64(0)
+    result =_dsl.dsl_ode_action_capture_queue_stats_get(name, 
+        DSL_UINT_P(queue_depth), DSL_UINT64_P(dropped))
+    return int(result), queue_depth.value, dropped.value
+
 ##
 ## dsl_ode_action_label_customize_new()
 ##
@@ -1123,6 +1191,51 @@ def dsl_ode_action_file_new(name, file_path, mode, format, force_flush):
     result =_dsl.dsl_ode_action_file_new(name, file_path, mode, format, force_flush)
     return int(result)
 
+##
+## dsl_ode_action_file_rotation_get()
+##
+_dsl.dsl_ode_action_file_rotation_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_ode_action_file_rotation_get.restype = c_uint
+def dsl_ode_action_file_rotation_get(name):
+    global _dsl
+    max_size = c_uint(0)
+    max_age = c_uint(0)
+    result =_dsl.dsl_ode_action_file_rotation_get(name, 
+        DSL_UINT_P(max_size), DSL_UINT_P(max_age))
+    return int(result), max_size.value, max_age.value
+
+##
+## dsl_ode_action_file_rotation_set()
+##
+_dsl.dsl_ode_action_file_rotation_set.argtypes = [c_wchar_p, c_uint, c_uint]
+_dsl.dsl_ode_action_file_rotation_set.restype = c_uint
+def dsl_ode_action_file_rotation_set(name, max_size, max_age):
+    global _dsl
+    result =_dsl.dsl_ode_action_file_rotation_set(name, max_size, max_age)
+    return int(result)
+
+##
+## dsl_ode_action_file_sync_policy_get()
+##
+_dsl.dsl_ode_action_file_sync_policy_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_ode_action_file_sync_policy_get.restype = c_uint
+def dsl_ode_action_file_sync_policy_get(name):
+    global _dsl
+    policy = c_uint(0)
+    result =_dsl.dsl_ode_action_file_sync_policy_get(name, DSL_UINT_P(policy))
+    return int(result), policy.value
+
+##
+## dsl_ode_action_file_sync_policy_set()
+##
+_dsl.dsl_ode_action_file_sync_policy_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_ode_action_file_sync_policy_set.restype = c_uint
+def dsl_ode_action_file_sync_policy_set(name, policy):
+    global _dsl
+    result =_dsl.dsl_ode_action_file_sync_policy_set(name, policy)
+    return int(result)
+
 ##
 ## dsl_ode_action_fill_frame_new()
 ##
@@ -1237,6 +1350,23 @@ def dsl_ode_action_monitor_new(name, client_monitor, client_data):
     result = _dsl.dsl_ode_action_monitor_new(name, c_client_monitor, c_client_data)
     return int(result)
 
+##
+## dsl_ode_action_monitor_batch_new()
+##
+_dsl.dsl_ode_action_monitor_batch_new.argtypes = [c_wchar_p, 
+    DSL_ODE_MONITOR_OCCURRENCE_BATCH, c_uint, c_uint, c_void_p]
+_dsl.dsl_ode_action_monitor_batch_new.restype = c_uint
+def dsl_ode_action_monitor_batch_new(name, client_monitor, 
+    max_size, window, client_data):
+    global _dsl
+    c_client_monitor= DSL_ODE_MONITOR_OCCURRENCE_BATCH(client_monitor)
+    callbacks.append(c_client_monitor)
+    c_client_data=cast(pointer(py_object(client_data)), c_void_p)
+    clientdata.append(c_client_data)
+    result = _dsl.dsl_ode_action_monitor_batch_new(name, 
+        c_client_monitor, max_size, window, c_client_data)
+    return int(result)
+
 ##
 ## dsl_ode_action_object_remove_new()
 ##
@@ -1602,6 +1732,41 @@ def dsl_ode_action_enabled_state_change_listener_remove(client_listener):
     result = _dsl.dsl_ode_action_enabled_state_change_listener_remove(c_client_listener)
     return int(result)
 
+##
+## dsl_ode_action_async_enabled_get()
+##
+_dsl.dsl_ode_action_async_enabled_get.argtypes = [c_wchar_p, POINTER(c_bool)]
+_dsl.dsl_ode_action_async_enabled_get.restype = c_uint
+def dsl_ode_action_async_enabled_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    result =_dsl.dsl_ode_action_async_enabled_get(name, DSL_BOOL_P(enabled))
+    return int(result), enabled.value
+
+##
+## dsl_ode_action_async_enabled_set()
+##
+_dsl.dsl_ode_action_async_enabled_set.argtypes = [c_wchar_p, c_bool]
+_dsl.dsl_ode_action_async_enabled_set.restype = c_uint
+def dsl_ode_action_async_enabled_set(name, enabled):
+    global _dsl
+    result =_dsl.dsl_ode_action_async_enabled_set(name, enabled)
+    return int(result)
+
+##
+## dsl_ode_action_async_stats_get()
+##
+_dsl.dsl_ode_action_async_stats_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint64), POINTER(c_uint64)]
+_dsl.dsl_ode_action_async_stats_get.restype = c_uint
+def dsl_ode_action_async_stats_get(name):
+    global _dsl
+    queued = c_uint64(0)
+    dropped = c_uint64(0)
+    result =_dsl.dsl_ode_action_async_stats_get(name, 
+        DSL_UINT64_P(queued), DSL_UINT64_P(dropped))
+    return int(result), queued.value, dropped.value
+
 
 ##
 ## dsl_ode_action_delete()
@@ -1801,6 +1966,59 @@ def dsl_ode_trigger_custom_new(name,
         source, class_id, limit, checker_cb, processor_cb, c_client_data)
     return int(result)
 
+##
+## dsl_ode_trigger_custom_batch_new()
+##
+_dsl.dsl_ode_trigger_custom_batch_new.argtypes = [c_wchar_p, c_wchar_p, 
+    c_uint, c_uint, DSL_ODE_CHECK_FOR_OCCURRENCES, c_void_p]
+_dsl.dsl_ode_trigger_custom_batch_new.restype = c_uint
+def dsl_ode_trigger_custom_batch_new(name, 
+    source, class_id, limit, client_checker, client_data):
+    global _dsl
+    checker_cb = DSL_ODE_CHECK_FOR_OCCURRENCES(client_checker)
+    callbacks.append(checker_cb)
+    c_client_data=cast(pointer(py_object(client_data)), c_void_p)
+    clientdata.append(c_client_data)
+    result = _dsl.dsl_ode_trigger_custom_batch_new(name, 
+        source, class_id, limit, checker_cb, c_client_data)
+    return int(result)
+
+##
+## dsl_ode_trigger_composite_new()
+##
+_dsl.dsl_ode_trigger_composite_new.argtypes = [c_wchar_p, c_wchar_p, 
+    c_uint, c_uint, c_uint]
+_dsl.dsl_ode_trigger_composite_new.restype = c_uint
+def dsl_ode_trigger_composite_new(name, 
+    source, class_id, limit, composite_operator):
+    global _dsl
+    result = _dsl.dsl_ode_trigger_composite_new(name, 
+        source, class_id, limit, composite_operator)
+    return int(result)
+
+##
+## dsl_ode_trigger_composite_predicate_add()
+##
+_dsl.dsl_ode_trigger_composite_predicate_add.argtypes = [c_wchar_p, 
+    c_wchar_p, c_bool]
+_dsl.dsl_ode_trigger_composite_predicate_add.restype = c_uint
+def dsl_ode_trigger_composite_predicate_add(name, predicate, negate):
+    global _dsl
+    result = _dsl.dsl_ode_trigger_composite_predicate_add(name, 
+        predicate, negate)
+    return int(result)
+
+##
+## dsl_ode_trigger_composite_predicate_remove()
+##
+_dsl.dsl_ode_trigger_composite_predicate_remove.argtypes = [c_wchar_p, 
+    c_wchar_p]
+_dsl.dsl_ode_trigger_composite_predicate_remove.restype = c_uint
+def dsl_ode_trigger_composite_predicate_remove(name, predicate):
+    global _dsl
+    result = _dsl.dsl_ode_trigger_composite_predicate_remove(name, predicate)
+    return int(result)
+
 ##
 ## dsl_ode_trigger_intersection_new()
 ##
@@ -2490,6 +2708,83 @@ def dsl_ode_trigger_interval_set(name, interval):
     result =_dsl.dsl_ode_trigger_interval_set(name, interval)
     return int(result)
 
+##
+## dsl_ode_trigger_per_source_state_get()
+##
+_dsl.dsl_ode_trigger_per_source_state_get.argtypes = [c_wchar_p, POINTER(c_bool)]
+_dsl.dsl_ode_trigger_per_source_state_get.restype = c_uint
+def dsl_ode_trigger_per_source_state_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    result =_dsl.dsl_ode_trigger_per_source_state_get(name, DSL_BOOL_P(enabled))
+    return int(result), enabled.value
+
+##
+## dsl_ode_trigger_per_source_state_set()
+##
+_dsl.dsl_ode_trigger_per_source_state_set.argtypes = [c_wchar_p, c_bool]
+_dsl.dsl_ode_trigger_per_source_state_set.restype = c_uint
+def dsl_ode_trigger_per_source_state_set(name, enabled):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_per_source_state_set(name, enabled)
+    return int(result)
+
+##
+## dsl_ode_trigger_rate_limit_get()
+##
+_dsl.dsl_ode_trigger_rate_limit_get.argtypes = [c_wchar_p, 
+    DSL_FLOAT_P, DSL_UINT_P]
+_dsl.dsl_ode_trigger_rate_limit_get.restype = c_uint
+def dsl_ode_trigger_rate_limit_get(name):
+    global _dsl
+    rate = c_float(0)
+    burst = c_uint(0)
+    result =_dsl.dsl_ode_trigger_rate_limit_get(name, 
+        DSL_FLOAT_P(rate), DSL_UINT_P(burst))
+    return int(result), rate.value, burst.value
+
+##
+## dsl_ode_trigger_rate_limit_set()
+##
+_dsl.dsl_ode_trigger_rate_limit_set.argtypes = [c_wchar_p, c_float, c_uint]
+_dsl.dsl_ode_trigger_rate_limit_set.restype = c_uint
+def dsl_ode_trigger_rate_limit_set(name, rate, burst):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_rate_limit_set(name, rate, burst)
+    return int(result)
+
+##
+## dsl_ode_trigger_debounce_get()
+##
+_dsl.dsl_ode_trigger_debounce_get.argtypes = [c_wchar_p, DSL_UINT_P]
+_dsl.dsl_ode_trigger_debounce_get.restype = c_uint
+def dsl_ode_trigger_debounce_get(name):
+    global _dsl
+    window = c_uint(0)
+    result =_dsl.dsl_ode_trigger_debounce_get(name, DSL_UINT_P(window))
+    return int(result), window.value
+
+##
+## dsl_ode_trigger_debounce_set()
+##
+_dsl.dsl_ode_trigger_debounce_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_ode_trigger_debounce_set.restype = c_uint
+def dsl_ode_trigger_debounce_set(name, window):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_debounce_set(name, window)
+    return int(result)
+
+##
+## dsl_ode_trigger_stats_get()
+##
+_dsl.dsl_ode_trigger_stats_get.argtypes = [c_wchar_p, DSL_ODE_TRIGGER_STATS_P]
+_dsl.dsl_ode_trigger_stats_get.restype = c_uint
+def dsl_ode_trigger_stats_get(name):
+    global _dsl
+    stats = dsl_ode_trigger_stats()
+    result =_dsl.dsl_ode_trigger_stats_get(name, DSL_ODE_TRIGGER_STATS_P(stats))
+    return int(result), stats
+
 ##
 ## dsl_ode_trigger_action_add()
 ##
@@ -2792,6 +3087,51 @@ def dsl_ode_heat_mapper_legend_settings_set(name, enabled, location, width, heig
         enabled, location, width, height)
     return int(result)
 
+##
+## dsl_ode_heat_mapper_decay_get()
+##
+_dsl.dsl_ode_heat_mapper_decay_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_ode_heat_mapper_decay_get.restype = c_uint
+def dsl_ode_heat_mapper_decay_get(name):
+    global _dsl 
+    half_life = c_uint(0)
+    result = _dsl.dsl_ode_heat_mapper_decay_get(name, DSL_UINT_P(half_life))
+    return int(result), half_life.value 
+
+##
+## dsl_ode_heat_mapper_decay_set()
+##
+_dsl.dsl_ode_heat_mapper_decay_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_ode_heat_mapper_decay_set.restype = c_uint
+def dsl_ode_heat_mapper_decay_set(name, half_life):
+    global _dsl
+    result = _dsl.dsl_ode_heat_mapper_decay_set(name, half_life)
+    return int(result)
+
+##
+## dsl_ode_heat_mapper_window_get()
+##
+_dsl.dsl_ode_heat_mapper_window_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_ode_heat_mapper_window_get.restype = c_uint
+def dsl_ode_heat_mapper_window_get(name):
+    global _dsl 
+    interval = c_uint(0)
+    intervals = c_uint(0)
+    result = _dsl.dsl_ode_heat_mapper_window_get(name, 
+        DSL_UINT_P(interval), DSL_UINT_P(intervals))
+    return int(result), interval.value, intervals.value 
+
+##
+## dsl_ode_heat_mapper_window_set()
+##
+_dsl.dsl_ode_heat_mapper_window_set.argtypes = [c_wchar_p, c_uint, c_uint]
+_dsl.dsl_ode_heat_mapper_window_set.restype = c_uint
+def dsl_ode_heat_mapper_window_set(name, interval, intervals):
+    global _dsl
+    result = _dsl.dsl_ode_heat_mapper_window_set(name, interval, intervals)
+    return int(result)
+
 ##
 ## dsl_ode_heat_mapper_color_palette_get()
 ##
@@ -2997,6 +3337,62 @@ def dsl_pph_ode_display_meta_alloc_size_set(name, size):
     result =_dsl.dsl_pph_ode_display_meta_alloc_size_set(name, size)
     return int(result)
 
+##
+## dsl_pph_ode_parallel_mode_get()
+##
+_dsl.dsl_pph_ode_parallel_mode_get.argtypes = [c_wchar_p, 
+    POINTER(c_bool), POINTER(c_uint)]
+_dsl.dsl_pph_ode_parallel_mode_get.restype = c_uint
+def dsl_pph_ode_parallel_mode_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    max_workers = c_uint(0)
+    result =_dsl.dsl_pph_ode_parallel_mode_get(name, 
+        DSL_BOOL_P(enabled), DSL_UINT_P(max_workers))
+    return int(result), enabled.value, max_workers.value
+
+##
+## dsl_pph_ode_parallel_mode_set()
+##
+_dsl.dsl_pph_ode_parallel_mode_set.argtypes = [c_wchar_p, c_bool, c_uint]
+_dsl.dsl_pph_ode_parallel_mode_set.restype = c_uint
+def dsl_pph_ode_parallel_mode_set(name, enabled, max_workers):
+    global _dsl
+    result =_dsl.dsl_pph_ode_parallel_mode_set(name, enabled, max_workers)
+    return int(result)
+
+##
+## dsl_pph_ode_stats_enabled_get()
+##
+_dsl.dsl_pph_ode_stats_enabled_get.argtypes = [c_wchar_p, POINTER(c_bool)]
+_dsl.dsl_pph_ode_stats_enabled_get.restype = c_uint
+def dsl_pph_ode_stats_enabled_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    result =_dsl.dsl_pph_ode_stats_enabled_get(name, DSL_BOOL_P(enabled))
+    return int(result), enabled.value
+
+##
+## dsl_pph_ode_stats_enabled_set()
+##
+_dsl.dsl_pph_ode_stats_enabled_set.argtypes = [c_wchar_p, c_bool]
+_dsl.dsl_pph_ode_stats_enabled_set.restype = c_uint
+def dsl_pph_ode_stats_enabled_set(name, enabled):
+    global _dsl
+    result =_dsl.dsl_pph_ode_stats_enabled_set(name, enabled)
+    return int(result)
+
+##
+## dsl_pph_ode_stats_get()
+##
+_dsl.dsl_pph_ode_stats_get.argtypes = [c_wchar_p, DSL_PPH_ODE_STATS_P]
+_dsl.dsl_pph_ode_stats_get.restype = c_uint
+def dsl_pph_ode_stats_get(name):
+    global _dsl
+    stats = dsl_pph_ode_stats()
+    result =_dsl.dsl_pph_ode_stats_get(name, DSL_PPH_ODE_STATS_P(stats))
+    return int(result), stats
+
 ##
 ## dsl_pph_custom_new()
 ##
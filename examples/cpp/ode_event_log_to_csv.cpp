@@ -0,0 +1,74 @@
+
+/*
+The MIT License
+
+Copyright (c) 2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/* ------------------------------------------------------------------------------------
+ This example converts the segment files written by a Binary ODE File Action 
+ (DSL_EVENT_FILE_FORMAT_BINARY) to a single CSV file. Segments are read in 
+ order, starting with "<file_path>.000000", until no further segment is found.
+
+ Usage: ode_event_log_to_csv.out <file_path> <csv_file_path>
+*/
+
+#include <iostream>
+#include <fstream>
+
+#include "DslOdeEventLog.h"
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        std::cout << "Usage: " << argv[0] << " <file_path> <csv_file_path>" 
+            << std::endl;
+        return -1;
+    }
+    std::string filePath(argv[1]);
+
+    std::ofstream csvFile(argv[2], std::ofstream::out | std::ofstream::trunc);
+    if (!csvFile.is_open())
+    {
+        std::cout << "Failed to open '" << argv[2] << "'" << std::endl;
+        return -1;
+    }
+    DSL::OdeEventLogWriteCsvHeader(csvFile);
+    
+    uint64_t index(0), count(0);
+    while (true)
+    {
+        std::string segmentPath = DSL::OdeEventLogSegmentPath(filePath, index);
+        
+        DSL::OdeEventLogReader reader(segmentPath.c_str());
+        if (!reader.IsOpen())
+        {
+            break;
+        }
+        count += DSL::OdeEventLogWriteCsv(reader, csvFile);
+        index++;
+    }
+    std::cout << "Converted " << count << " events from " << index 
+        << " segment(s)" << std::endl;
+        
+    return (index) ? 0 : -1;
+}
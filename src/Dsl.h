@@ -44,6 +44,8 @@ THE SOFTWARE.
 #include <math.h>
 #include <fstream>
 #include <thread>
+#include <atomic>
+#include <functional>
 #include <chrono>
 #include <unordered_map>
 #include <typeinfo>
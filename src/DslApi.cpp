@@ -840,6 +840,20 @@ DslReturnType dsl_ode_action_capture_mailer_remove(const wchar_t* name,
 #endif
 }
 
+DslReturnType dsl_ode_action_capture_queue_stats_get(const wchar_t* name, 
+    uint* queue_depth, uint64_t* dropped)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(queue_depth);
+    RETURN_IF_PARAM_IS_NULL(dropped);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionCaptureQueueStatsGet(
+        cstrName.c_str(), queue_depth, dropped);
+}
+
 DslReturnType dsl_ode_action_label_customize_new(const wchar_t* name,  
     const uint* content_types, uint size)
 {
@@ -1110,6 +1124,57 @@ DslReturnType dsl_ode_action_file_new(const wchar_t* name,
         cstrFilePath.c_str(), mode, format, force_flush);
 }
 
+DslReturnType dsl_ode_action_file_rotation_get(const wchar_t* name, 
+    uint* max_size, uint* max_age)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(max_size);
+    RETURN_IF_PARAM_IS_NULL(max_age);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionFileRotationGet(
+        cstrName.c_str(), max_size, max_age);
+}
+
+DslReturnType dsl_ode_action_file_rotation_set(const wchar_t* name, 
+    uint max_size, uint max_age)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionFileRotationSet(
+        cstrName.c_str(), max_size, max_age);
+}
+
+DslReturnType dsl_ode_action_file_sync_policy_get(const wchar_t* name, 
+    uint* policy)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(policy);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionFileSyncPolicyGet(
+        cstrName.c_str(), policy);
+}
+
+DslReturnType dsl_ode_action_file_sync_policy_set(const wchar_t* name, 
+    uint policy)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionFileSyncPolicySet(
+        cstrName.c_str(), policy);
+}
+
 DslReturnType dsl_ode_action_monitor_new(const wchar_t* name, 
     dsl_ode_monitor_occurrence_cb client_monitor, void* client_data)
 {
@@ -1123,6 +1188,20 @@ DslReturnType dsl_ode_action_monitor_new(const wchar_t* name,
         client_monitor, client_data);
 }
 
+DslReturnType dsl_ode_action_monitor_batch_new(const wchar_t* name, 
+    dsl_ode_monitor_occurrence_batch_cb client_monitor, uint max_size, 
+    uint window, void* client_data)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(client_monitor);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionMonitorBatchNew(cstrName.c_str(),
+        client_monitor, max_size, window, client_data);
+}
+
 DslReturnType dsl_ode_action_object_remove_new(const wchar_t* name)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -1616,6 +1695,43 @@ DslReturnType dsl_ode_action_enabled_state_change_listener_remove(const wchar_t*
     return DSL::Services::GetServices()->OdeActionEnabledStateChangeListenerRemove(
         cstrName.c_str(), listener);
 }
+
+DslReturnType dsl_ode_action_async_enabled_get(const wchar_t* name, boolean* enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(enabled);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionAsyncEnabledGet(
+        cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_ode_action_async_enabled_set(const wchar_t* name, boolean enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionAsyncEnabledSet(
+        cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_ode_action_async_stats_get(const wchar_t* name, 
+    uint64_t* queued, uint64_t* dropped)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(queued);
+    RETURN_IF_PARAM_IS_NULL(dropped);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionAsyncStatsGet(
+        cstrName.c_str(), queued, dropped);
+}
     
 DslReturnType dsl_ode_action_delete(const wchar_t* name)
 {
@@ -1942,6 +2058,76 @@ DslReturnType dsl_ode_trigger_custom_new(const wchar_t* name, const wchar_t* sou
     return DSL::Services::GetServices()->OdeTriggerCustomNew(cstrName.c_str(), cstrSource.c_str(), 
         class_id, limit, client_checker, client_post_processor, client_data);
 }
+
+DslReturnType dsl_ode_trigger_custom_batch_new(const wchar_t* name, 
+    const wchar_t* source, uint class_id, uint limit, 
+    dsl_ode_check_for_occurrences_cb client_checker, void* client_data)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(client_checker);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    std::string cstrSource;
+    if (source)
+    {
+        std::wstring wstrSource(source);
+        cstrSource.assign(wstrSource.begin(), wstrSource.end());
+    }
+    return DSL::Services::GetServices()->OdeTriggerCustomBatchNew(
+        cstrName.c_str(), cstrSource.c_str(), class_id, limit, 
+        client_checker, client_data);
+}
+
+DslReturnType dsl_ode_trigger_composite_new(const wchar_t* name, 
+    const wchar_t* source, uint class_id, uint limit, uint composite_operator)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    std::string cstrSource;
+    if (source)
+    {
+        std::wstring wstrSource(source);
+        cstrSource.assign(wstrSource.begin(), wstrSource.end());
+    }
+    return DSL::Services::GetServices()->OdeTriggerCompositeNew(
+        cstrName.c_str(), cstrSource.c_str(), class_id, limit, 
+        composite_operator);
+}
+
+DslReturnType dsl_ode_trigger_composite_predicate_add(const wchar_t* name, 
+    const wchar_t* predicate, boolean negate)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(predicate);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrPredicate(predicate);
+    std::string cstrPredicate(wstrPredicate.begin(), wstrPredicate.end());
+
+    return DSL::Services::GetServices()->OdeTriggerCompositePredicateAdd(
+        cstrName.c_str(), cstrPredicate.c_str(), negate);
+}
+
+DslReturnType dsl_ode_trigger_composite_predicate_remove(const wchar_t* name, 
+    const wchar_t* predicate)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(predicate);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrPredicate(predicate);
+    std::string cstrPredicate(wstrPredicate.begin(), wstrPredicate.end());
+
+    return DSL::Services::GetServices()->OdeTriggerCompositePredicateRemove(
+        cstrName.c_str(), cstrPredicate.c_str());
+}
     
 DslReturnType dsl_ode_trigger_count_new(const wchar_t* name, const wchar_t* source, 
     uint class_id, uint limit, uint minimum, uint maximum)
@@ -2752,6 +2938,93 @@ DslReturnType dsl_ode_trigger_interval_set(const wchar_t* name, uint interval)
     return DSL::Services::GetServices()->OdeTriggerIntervalSet(cstrName.c_str(), interval);
 }
 
+DslReturnType dsl_ode_trigger_per_source_state_get(const wchar_t* name, 
+    boolean* enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(enabled);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerPerSourceStateGet(
+        cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_ode_trigger_per_source_state_set(const wchar_t* name, 
+    boolean enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerPerSourceStateSet(
+        cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_ode_trigger_rate_limit_get(const wchar_t* name, 
+    float* rate, uint* burst)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(rate);
+    RETURN_IF_PARAM_IS_NULL(burst);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerRateLimitGet(
+        cstrName.c_str(), rate, burst);
+}
+
+DslReturnType dsl_ode_trigger_rate_limit_set(const wchar_t* name, 
+    float rate, uint burst)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerRateLimitSet(
+        cstrName.c_str(), rate, burst);
+}
+
+DslReturnType dsl_ode_trigger_debounce_get(const wchar_t* name, uint* window)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(window);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerDebounceGet(
+        cstrName.c_str(), window);
+}
+
+DslReturnType dsl_ode_trigger_debounce_set(const wchar_t* name, uint window)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerDebounceSet(
+        cstrName.c_str(), window);
+}
+
+DslReturnType dsl_ode_trigger_stats_get(const wchar_t* name, 
+    dsl_ode_trigger_stats* stats)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(stats);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerStatsGet(
+        cstrName.c_str(), stats);
+}
+
 DslReturnType dsl_ode_trigger_action_add(const wchar_t* name, const wchar_t* action)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -3213,6 +3486,57 @@ DslReturnType dsl_ode_heat_mapper_legend_settings_set(const wchar_t* name,
         cstrName.c_str(), enabled, location, width, height);
 }
 
+DslReturnType dsl_ode_heat_mapper_decay_get(const wchar_t* name, 
+    uint* half_life)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(half_life);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeHeatMapperDecayGet(
+        cstrName.c_str(), half_life);
+}
+    
+DslReturnType dsl_ode_heat_mapper_decay_set(const wchar_t* name, 
+    uint half_life)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeHeatMapperDecaySet(
+        cstrName.c_str(), half_life);
+}
+    
+DslReturnType dsl_ode_heat_mapper_window_get(const wchar_t* name, 
+    uint* interval, uint* intervals)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(interval);
+    RETURN_IF_PARAM_IS_NULL(intervals);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeHeatMapperWindowGet(
+        cstrName.c_str(), interval, intervals);
+}
+    
+DslReturnType dsl_ode_heat_mapper_window_set(const wchar_t* name, 
+    uint interval, uint intervals)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeHeatMapperWindowSet(
+        cstrName.c_str(), interval, intervals);
+}
+
 DslReturnType dsl_ode_heat_mapper_metrics_clear(const wchar_t* name)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -3469,6 +3793,70 @@ DslReturnType dsl_pph_ode_display_meta_alloc_size_set(const wchar_t* name, uint
         cstrName.c_str(), size);
 }
 
+DslReturnType dsl_pph_ode_parallel_mode_get(const wchar_t* name, 
+    boolean* enabled, uint* max_workers)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(enabled);
+    RETURN_IF_PARAM_IS_NULL(max_workers);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeParallelModeGet(
+        cstrName.c_str(), enabled, max_workers);
+}
+
+DslReturnType dsl_pph_ode_parallel_mode_set(const wchar_t* name, 
+    boolean enabled, uint max_workers)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeParallelModeSet(
+        cstrName.c_str(), enabled, max_workers);
+}
+
+DslReturnType dsl_pph_ode_stats_enabled_get(const wchar_t* name, 
+    boolean* enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(enabled);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeStatsEnabledGet(
+        cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_pph_ode_stats_enabled_set(const wchar_t* name, 
+    boolean enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeStatsEnabledSet(
+        cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_pph_ode_stats_get(const wchar_t* name, 
+    dsl_pph_ode_stats* stats)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(stats);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeStatsGet(
+        cstrName.c_str(), stats);
+}
+
 DslReturnType dsl_pph_buffer_timeout_new(const wchar_t* name,
     uint timeout, dsl_pph_buffer_timeout_handler_cb handler, void* client_data)
 {
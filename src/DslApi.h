@@ -883,6 +883,12 @@ THE SOFTWARE.
 */
 #define DSL_ODE_TRACKED_OBJECT_MISSING_FROM_FRAME_MAX               100
 
+/**
+ * @brief Operators for combining the predicates of a Composite Trigger
+ */
+#define DSL_ODE_COMPOSITE_OPERATOR_AND                              0
+#define DSL_ODE_COMPOSITE_OPERATOR_OR                               1
+
 /**
  * @brief Unique class relational identifiers for Class A/B testing
  */
@@ -1050,6 +1056,7 @@ THE SOFTWARE.
 #define DSL_EVENT_FILE_FORMAT_TEXT                                  0
 #define DSL_EVENT_FILE_FORMAT_CSV                                   1
 #define DSL_EVENT_FILE_FORMAT_MOTC                                  2
+#define DSL_EVENT_FILE_FORMAT_BINARY                                3
 
 /**
  * @brief File Open/Write Mode Options when saving Event Data 
@@ -1059,6 +1066,15 @@ THE SOFTWARE.
 #define DSL_WRITE_MODE_APPEND                                       0
 #define DSL_WRITE_MODE_TRUNCATE                                     1
 
+/**
+ * @brief File Sync Policy Options when saving Event Data to file.
+ * NONE leaves syncing to the OS, ON_ROTATE syncs each file before it 
+ * is rotated or closed, ON_WRITE also syncs after each background write.
+ */
+#define DSL_FILE_SYNC_POLICY_NONE                                   0
+#define DSL_FILE_SYNC_POLICY_ON_ROTATE                              1
+#define DSL_FILE_SYNC_POLICY_ON_WRITE                               2
+
 /**
  * @brief Metric Content Options for Object Label customization
  * and Display Action string formatting
@@ -1580,6 +1596,158 @@ typedef struct _dsl_threshold_value
     
 } dsl_threshold_value;
 
+/**
+ * @struct _dsl_ode_latency_stats
+ * @brief latency statistics for a single ODE operation, all times in 
+ * nanoseconds. Percentiles are accurate to within 6.25%.
+ */
+typedef struct _dsl_ode_latency_stats
+{
+    /**
+     * @brief number of times the operation has been timed.
+     */
+    uint64_t count;
+
+    /**
+     * @brief median (50th percentile) latency.
+     */
+    uint64_t p50;
+
+    /**
+     * @brief 99th percentile latency.
+     */
+    uint64_t p99;
+
+    /**
+     * @brief maximum latency.
+     */
+    uint64_t max;
+
+} dsl_ode_latency_stats;
+
+/**
+ * @struct _dsl_ode_trigger_stats
+ * @brief ODE Trigger statistics, collected while stats are enabled for the
+ * parent ODE Pad Probe Handler.
+ */
+typedef struct _dsl_ode_trigger_stats
+{
+    /**
+     * @brief latency of each call to pre-process a frame.
+     */
+    dsl_ode_latency_stats pre_process_frame;
+
+    /**
+     * @brief latency of each call to check an object for occurrence.
+     */
+    dsl_ode_latency_stats check_for_occurrence;
+
+    /**
+     * @brief latency of each call to post-process a frame.
+     */
+    dsl_ode_latency_stats post_process_frame;
+
+    /**
+     * @brief latency of each call to an ODE Action to handle an occurrence.
+     */
+    dsl_ode_latency_stats handle_occurrence;
+
+    /**
+     * @brief number of ODE occurrences since the stats were enabled.
+     */
+    uint64_t occurrences;
+
+    /**
+     * @brief average ODE occurrences per second since the stats were enabled.
+     */
+    double occurrences_per_sec;
+
+} dsl_ode_trigger_stats;
+
+/**
+ * @struct _dsl_pph_ode_stats
+ * @brief ODE Pad Probe Handler statistics, collected while stats are enabled.
+ */
+typedef struct _dsl_pph_ode_stats
+{
+    /**
+     * @brief latency of each call to handle a batched buffer.
+     */
+    dsl_ode_latency_stats batch;
+
+    /**
+     * @brief number of frames processed since the stats were enabled.
+     */
+    uint64_t frames;
+
+    /**
+     * @brief total number of ODE occurrences, for all child ODE Triggers,
+     * since the stats were enabled.
+     */
+    uint64_t occurrences;
+
+    /**
+     * @brief average ODE occurrences per second since the stats were enabled.
+     */
+    double occurrences_per_sec;
+
+} dsl_pph_ode_stats;
+
+/**
+ * @struct _dsl_ode_batch_object
+ * @brief Packed object data for the Custom Batch ODE Trigger. The frame's
+ * objects are provided to the client as a contiguous array of this fixed 
+ * layout (40 bytes) so that they can be mapped to a numpy structured array.
+ */
+typedef struct _dsl_ode_batch_object
+{
+    /**
+     * @brief class id for the detected object.
+     */
+    uint class_id;
+    
+    /**
+     * @brief unique id of the inference component that generated the object.
+     */
+    uint inference_component_id;
+    
+    /**
+     * @brief unique tracking id as assigned by the multi-object-tracker (MOT).
+     */
+    uint64_t tracking_id;
+    
+    /**
+     * @brief the Object's bounding box left coordinate in pixels.
+     */
+    float left;
+    
+    /**
+     * @brief the Object's bounding box top coordinate in pixels.
+     */
+    float top;
+    
+    /**
+     * @brief the Object's bounding box width in pixels.
+     */
+    float width;
+    
+    /**
+     * @brief the Object's bounding box height in pixels.
+     */
+    float height;
+    
+    /**
+     * @brief inference confidence as calculated by the last detector.
+     */
+    float inference_confidence;
+    
+    /**
+     * @brief tracker confidence if current frame was not inferred on.
+     */
+    float tracker_confidence;
+
+} dsl_ode_batch_object;
+
 //------------------------------------------------------------------------------------
 
 /**
@@ -1610,6 +1778,18 @@ typedef void (*dsl_ode_handle_occurrence_cb)(uint64_t event_id, const wchar_t* t
 typedef void (*dsl_ode_monitor_occurrence_cb)(dsl_ode_occurrence_info* occurrence_info,
     void* client_data);    
 
+/**
+ * @brief Callback typedef for a client ODE occurrence batch monitor function. 
+ * Once registered by calling dsl_ode_action_monitor_batch_new, the function will 
+ * be called with all occurrences for a frame, or for a time window, at once.
+ * @param[in] occurrences array of occurrence information, valid for the 
+ * duration of the callback only.
+ * @param[in] count number of entries in the occurrences array.
+ * @param[in] client_data opaque pointer to client's user data
+ */    
+typedef void (*dsl_ode_monitor_occurrence_batch_cb)(dsl_ode_occurrence_info* occurrences,
+    uint count, void* client_data);    
+
 /**
  * @brief Callback typedef for a client ODE Custom Trigger check-for-occurrence function. Once 
  * registered, the function will be called on every object detected that meets the minimum
@@ -1637,6 +1817,27 @@ typedef boolean (*dsl_ode_check_for_occurrence_cb)(void* buffer,
  */
 typedef boolean (*dsl_ode_post_process_frame_cb)(void* buffer,
     void* frame_meta, void* client_data);
+
+/**
+ * @brief Callback typedef for a client ODE Custom Batch Trigger check-for-
+ * occurrences function. Once registered, the function will be called once 
+ * per frame with all objects in the frame that meet the minimum criteria
+ * for the Trigger. The client sets bit i of occurrences - word i/64, bit i%64 
+ * - for each objects[i] that is an ODE occurrence. All ODE Actions owned by 
+ * the Trigger are then invoked for each flagged object in array order.
+ * @param[in] buffer pointer to the frame buffer of type GstBuffer.
+ * @param[in] frame_meta pointer to the NvDsFrameMeta structure for the frame.
+ * @param[in] objects packed array of object data, valid for the duration of
+ * the callback only.
+ * @param[in] count number of objects in the array, always > 0.
+ * @param[out] occurrences zero initialized bitmask of (count+63)/64 words.
+ * @param[in] client_data opaque pointer to client's user data.
+ * @return true if one or more bits in occurrences have been set, false 
+ * otherwise.
+ */
+typedef boolean (*dsl_ode_check_for_occurrences_cb)(void* buffer,
+    void* frame_meta, const dsl_ode_batch_object* objects, uint count, 
+    uint64_t* occurrences, void* client_data);
     
 /**
  * @brief Callback typedef for a client listener function. Once added to an
@@ -2388,6 +2589,18 @@ DslReturnType dsl_ode_action_capture_mailer_add(const wchar_t* name,
 DslReturnType dsl_ode_action_capture_mailer_remove(const wchar_t* name, 
     const wchar_t* mailer);
 
+/**
+ * @brief Gets the current queue statistics for a named Capture Action. Captured
+ * images are encoded to JPEG files by a shared pool of worker threads, off of 
+ * the main loop. Images are dropped if the pool's queue is full.
+ * @param[in] name unique name of the Capture Action to query
+ * @param[out] queue_depth number of captured images waiting to be encoded.
+ * @param[out] dropped number of captured images dropped because the queue was full.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_capture_queue_stats_get(const wchar_t* name, 
+    uint* queue_depth, uint64_t* dropped);
+
 /**
  * @brief Creates a uniquely named ODE Custom Action
  * @param[in] name unique name for the ODE Custom Action 
@@ -2454,15 +2667,56 @@ DslReturnType dsl_ode_action_email_new(const wchar_t* name,
  * The file will be created if one does exists, or opened for append if found.
  * @param[in] mode file open/write mode, one of DSL_EVENT_FILE_MODE_* options
  * @param[in] format one of the DSL_EVENT_FILE_FORMAT_* options
- * @param[in] force_flush  if true, the action will schedule a flush to be performed 
- * by the idle thread. NOTE: although the flush event occurs in a background thread,
- * flushing is still a CPU intensive operation and should be used sparingly, when tailing
- * the file for runtime debugging as an example. Set to 0 to disable forced flushing, 
- * and to allow the operating system to more effectively handle the stream flushing.
+ * @param[in] force_flush if true, the action's background writer thread will be
+ * woken to write each event to file as it occurs, when tailing the file for runtime 
+ * debugging as an example. Set to 0 to disable forced flushing, and to allow the 
+ * writer thread to write events in larger blocks, at least once every second.
  * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_ODE_ACTION_RESULT otherwise.
  */
 DslReturnType dsl_ode_action_file_new(const wchar_t* name, 
     const wchar_t* file_path, uint mode, uint format, boolean force_flush);
+
+/**
+ * @brief Gets the current file rotation settings for a named File ODE Action.
+ * @param[in] name unique name of the File ODE Action to query.
+ * @param[out] max_size size in KB to rotate the file at, 0 if disabled.
+ * @param[out] max_age age in seconds to rotate the file at, 0 if disabled.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_file_rotation_get(const wchar_t* name, 
+    uint* max_size, uint* max_age);
+
+/**
+ * @brief Sets the file rotation settings for a named File ODE Action. When the
+ * current file reaches either limit, it is renamed to "<file_path>.<YYYYMMDD-HHMMSS>"
+ * and a new file is started at file_path. Disabled by default.
+ * @param[in] name unique name of the File ODE Action to update.
+ * @param[in] max_size size in KB to rotate the file at, 0 to disable.
+ * @param[in] max_age age in seconds to rotate the file at, 0 to disable.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_file_rotation_set(const wchar_t* name, 
+    uint max_size, uint max_age);
+
+/**
+ * @brief Gets the current sync policy for a named File ODE Action.
+ * @param[in] name unique name of the File ODE Action to query.
+ * @param[out] policy one of the DSL_FILE_SYNC_POLICY_* constants.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_file_sync_policy_get(const wchar_t* name, 
+    uint* policy);
+
+/**
+ * @brief Sets the sync policy for a named File ODE Action. Syncing is always
+ * performed by the Action's background writer thread. Default = 
+ * DSL_FILE_SYNC_POLICY_NONE.
+ * @param[in] name unique name of the File ODE Action to update.
+ * @param[in] policy one of the DSL_FILE_SYNC_POLICY_* constants.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_file_sync_policy_set(const wchar_t* name, 
+    uint policy);
     
 /**
  * @brief Creates a uniquely named Fill Frame ODE Action, that fills the entire
@@ -2680,6 +2934,22 @@ DslReturnType dsl_ode_action_message_meta_add_new(const wchar_t* name);
 DslReturnType dsl_ode_action_monitor_new(const wchar_t* name, 
     dsl_ode_monitor_occurrence_cb client_monitor, void* client_data);
 
+/**
+ * @brief Creates a uniquely named Monitor Batch ODE Action that calls the client
+ * once with an array of occurrences, rather than once for each occurrence.
+ * @param[in] name unique name for the Monitor Batch ODE Action. 
+ * @param[in] client_monitor function to call with each batch of occurrences. 
+ * @param[in] max_size maximum number of occurrences in a batch. A full batch
+ * is delivered immediately.
+ * @param[in] window time window in milliseconds to batch occurrences over.
+ * Set to 0 to deliver one batch for each frame.
+ * @param[in] client_data opaue pointer to client's user data, returned on callback.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_monitor_batch_new(const wchar_t* name, 
+    dsl_ode_monitor_occurrence_batch_cb client_monitor, uint max_size, 
+    uint window, void* client_data);
+
 /**
  * @brief Creates a uniquely named Remove Object ODE Action, that removes an
  * object's metadata from the current frame's metadata.
@@ -3011,6 +3281,38 @@ DslReturnType dsl_ode_action_enabled_state_change_listener_add(const wchar_t* na
  */
 DslReturnType dsl_ode_action_enabled_state_change_listener_remove(const wchar_t* name,
     dsl_ode_enabled_state_change_listener_cb listener);
+
+/**
+ * @brief Gets the current async enabled setting for a Custom, Email, File, Log, 
+ * Monitor, or Print ODE Action.
+ * @param[in] name unique name of the ODE Action to query
+ * @param[out] enabled true if the Action's occurrences are handled by the
+ * ODE Action Executor's worker threads, false if on the streaming thread.
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_async_enabled_get(const wchar_t* name, boolean* enabled);
+
+/**
+ * @brief Sets the async enabled setting for a Custom, Email, File, Log, 
+ * Monitor, or Print ODE Action. When enabled, each occurrence is queued with 
+ * a copy of its frame and object metadata and handled by a worker thread.
+ * Occurrences are dropped if the queue is full. Custom Actions are called 
+ * with a NULL buffer and display-meta when async.
+ * @param[in] name unique name of the ODE Action to update
+ * @param[in] enabled set to true to handle occurrences asynchronously.
+ * @return DSL_RESULT_SUCCESS on successful set, DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_async_enabled_set(const wchar_t* name, boolean enabled);
+
+/**
+ * @brief Gets the number of occurrences queued and dropped by an async ODE Action.
+ * @param[in] name unique name of the ODE Action to query
+ * @param[out] queued number of occurrences queued to the ODE Action Executor.
+ * @param[out] dropped number of occurrences dropped because the queue was full.
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_async_stats_get(const wchar_t* name, 
+    uint64_t* queued, uint64_t* dropped);
     
 /**
  * @brief Deletes an ODE Action of any type
@@ -3258,6 +3560,64 @@ DslReturnType dsl_ode_trigger_custom_new(const wchar_t* name, const wchar_t* sou
     uint class_id, uint limit, dsl_ode_check_for_occurrence_cb client_checker, 
     dsl_ode_post_process_frame_cb client_post_processor, void* client_data);
 
+/**
+ * @brief Custom Batch trigger that collects all Objects in a frame that meet 
+ * the Trigger's criteria and calls a client provided callback once per frame
+ * with a packed array of the objects. The client returns a bitmask of the 
+ * objects that are ODE occurrences, and the Trigger invokes all ODE Actions 
+ * for each of the flagged objects.
+ * @param[in] name unique name for the ODE Trigger
+ * @param[in] source unique source name filter for the ODE Trigger, NULL = ANY_SOURCE
+ * @param[in] class_id class id filter for this ODE Trigger
+ * @param[in] limit limits the number of ODE occurrences, a value of 0 = NO limit
+ * @param[in] client_checker client callback function to check the frame's 
+ * objects for occurrences.
+ * @param[in] client_data opaque client data returned to the client on callback
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_custom_batch_new(const wchar_t* name, 
+    const wchar_t* source, uint class_id, uint limit, 
+    dsl_ode_check_for_occurrences_cb client_checker, void* client_data);
+
+/**
+ * @brief Composite trigger that combines one or more ODE Triggers, used as 
+ * predicates only, with an AND/OR operator. Each Object that meets the 
+ * Composite's criteria is tested against all predicates in a single pass, with
+ * Area membership computed once per Object, and all ODE Actions are invoked 
+ * for each Object that satisfies the combined expression.
+ * @param[in] name unique name for the ODE Trigger
+ * @param[in] source unique source name filter for the ODE Trigger, NULL = ANY_SOURCE
+ * @param[in] class_id class id filter for this ODE Trigger
+ * @param[in] limit limits the number of ODE occurrences, a value of 0 = NO limit
+ * @param[in] composite_operator one of the DSL_ODE_COMPOSITE_OPERATOR constants.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_composite_new(const wchar_t* name, 
+    const wchar_t* source, uint class_id, uint limit, uint composite_operator);
+
+/**
+ * @brief Adds a named ODE Trigger as a predicate of a named Composite Trigger.
+ * The predicate's criteria, Areas, source and inference filters are used. 
+ * Distance Triggers test against the frame's Class B Objects, and Persistence
+ * Triggers test the Object's tracked duration. The predicate's own Actions and
+ * limits are not used.
+ * @param[in] name unique name of the Composite ODE Trigger to update
+ * @param[in] predicate unique name of the ODE Trigger to add as a predicate
+ * @param[in] negate if true, the predicate's result is inverted (NOT).
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_composite_predicate_add(const wchar_t* name, 
+    const wchar_t* predicate, boolean negate);
+
+/**
+ * @brief Removes a named ODE Trigger predicate from a named Composite Trigger.
+ * @param[in] name unique name of the Composite ODE Trigger to update
+ * @param[in] predicate unique name of the ODE Trigger to remove
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_composite_predicate_remove(const wchar_t* name, 
+    const wchar_t* predicate);
+
 /**
  * @brief Occurence trigger that checks for the occurrence of Objects within a frame for a 
  * specified source and object class_id.
@@ -3913,6 +4273,88 @@ DslReturnType dsl_ode_trigger_interval_get(const wchar_t* name, uint* interval);
  */
 DslReturnType dsl_ode_trigger_interval_set(const wchar_t* name, uint interval);
 
+/**
+ * @brief Gets the current per-source state setting for the named ODE Trigger.
+ * @param[in] name unique name of the ODE Trigger to query
+ * @param[out] enabled true if the Trigger's interval counter, frame count, and 
+ * event count are maintained for each source separately, false if shared by
+ * all sources. Default = false.
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_per_source_state_get(const wchar_t* name, 
+    boolean* enabled);
+
+/**
+ * @brief Sets the per-source state setting for the named ODE Trigger. When 
+ * enabled, the process interval, frame limit, and event limit apply to each
+ * source separately. Changing the setting clears the Trigger's counts.
+ * @param[in] name unique name of the ODE Trigger to update
+ * @param[in] enabled set to true to maintain state per source, false otherwise.
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_per_source_state_set(const wchar_t* name, 
+    boolean enabled);
+
+/**
+ * @brief Gets the current rate limit for the named ODE Trigger.
+ * @param[in] name unique name of the ODE Trigger to query
+ * @param[out] rate maximum sustained rate of events per second for each 
+ * source, 0 if disabled. Default = 0.
+ * @param[out] burst maximum number of events for each source that can be 
+ * triggered at once before the rate applies.
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_rate_limit_get(const wchar_t* name, 
+    float* rate, uint* burst);
+
+/**
+ * @brief Sets the rate limit for the named ODE Trigger. Each source has its
+ * own token-bucket of burst size, refilled at rate tokens per second. Events
+ * are suppressed, before any ODE Action is invoked, while the source's bucket 
+ * is empty. Suppressed events do not count towards the Trigger's event limit.
+ * @param[in] name unique name of the ODE Trigger to update
+ * @param[in] rate maximum sustained rate of events per second for each 
+ * source, 0 to disable.
+ * @param[in] burst maximum number of events for each source that can be 
+ * triggered at once before the rate applies. Must be > 0 if rate is set.
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_rate_limit_set(const wchar_t* name, 
+    float rate, uint burst);
+
+/**
+ * @brief Gets the current debounce window for the named ODE Trigger.
+ * @param[in] name unique name of the ODE Trigger to query
+ * @param[out] window minimum time between events for the same tracking id in 
+ * milliseconds, 0 if disabled. Default = 0.
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_debounce_get(const wchar_t* name, uint* window);
+
+/**
+ * @brief Sets the debounce window for the named ODE Trigger. Events for a 
+ * tracked object within the window of the object's previous event are 
+ * suppressed before any ODE Action is invoked. Frame level events and 
+ * untracked objects are not debounced. 
+ * @param[in] name unique name of the ODE Trigger to update
+ * @param[in] window minimum time between events for the same tracking id in 
+ * milliseconds, 0 to disable.
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_debounce_set(const wchar_t* name, uint window);
+
+/**
+ * @brief Gets the current latency and occurrence statistics for the named 
+ * ODE Trigger. Stats are collected while enabled for the Trigger's parent 
+ * ODE Pad Probe Handler, see dsl_pph_ode_stats_enabled_set. All values are 
+ * zero if stats have never been enabled.
+ * @param[in] name unique name of the ODE Trigger to query
+ * @param[out] stats current statistics for the named ODE Trigger.
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_stats_get(const wchar_t* name, 
+    dsl_ode_trigger_stats* stats);
+
 /**
  * @brief Adds a named ODE Action to a named ODE Trigger
  * @param[in] name unique name of the ODE Trigger to update
@@ -4214,6 +4656,58 @@ DslReturnType dsl_ode_heat_mapper_legend_settings_get(const wchar_t* name,
 DslReturnType dsl_ode_heat_mapper_legend_settings_set(const wchar_t* name, 
     boolean enabled, uint location, uint width, uint height);
 
+/**
+ * @brief Gets the current exponential-decay half-life for the named 
+ * ODE Heat-Mapper.
+ * @param[in] name unique name of the ODE Heat-Mapper to query.
+ * @param[out] half_life half-life in seconds, 0 if decay is disabled.
+ * @return DSL_RESULT_SUCCESS on successful query, 
+ * DSL_RESULT_ODE_HEAT_MAPPER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_heat_mapper_decay_get(const wchar_t* name, 
+    uint* half_life);
+
+/**
+ * @brief Sets the exponential-decay half-life for the named ODE Heat-Mapper.
+ * The heat-map's occurrence counts are halved every half_life seconds of 
+ * stream time. Enabling decay disables the sliding-window and clears the 
+ * current heat-map metrics. Disabled by default.
+ * @param[in] name unique name of the ODE Heat-Mapper to update.
+ * @param[in] half_life half-life in seconds, 0 to disable.
+ * @return DSL_RESULT_SUCCESS on successful update, 
+ * DSL_RESULT_ODE_HEAT_MAPPER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_heat_mapper_decay_set(const wchar_t* name, 
+    uint half_life);
+
+/**
+ * @brief Gets the current sliding-window settings for the named 
+ * ODE Heat-Mapper.
+ * @param[in] name unique name of the ODE Heat-Mapper to query.
+ * @param[out] interval length of each interval in seconds, 0 if disabled.
+ * @param[out] intervals number of intervals in the window.
+ * @return DSL_RESULT_SUCCESS on successful query, 
+ * DSL_RESULT_ODE_HEAT_MAPPER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_heat_mapper_window_get(const wchar_t* name, 
+    uint* interval, uint* intervals);
+
+/**
+ * @brief Sets the sliding-window settings for the named ODE Heat-Mapper.
+ * Only the occurrences from the last interval x intervals seconds of stream 
+ * time are counted. The oldest interval is dropped as each new interval 
+ * starts. Enabling the window disables decay and clears the current 
+ * heat-map metrics. Disabled by default.
+ * @param[in] name unique name of the ODE Heat-Mapper to update.
+ * @param[in] interval length of each interval in seconds, 0 to disable.
+ * @param[in] intervals number of intervals in the window, must be > 0 
+ * if interval > 0.
+ * @return DSL_RESULT_SUCCESS on successful update, 
+ * DSL_RESULT_ODE_HEAT_MAPPER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_heat_mapper_window_set(const wchar_t* name, 
+    uint interval, uint intervals);
+
 /**
  * @brief Calls on an ODE Heat-Mapper to clear its current heat-map metrics
  * returning the map to its initial all-zero state. 
@@ -4359,13 +4853,74 @@ DslReturnType dsl_pph_ode_display_meta_alloc_size_get(const wchar_t* name, uint*
  * @brief Sets the current setting for the number of Display Meta structures that
  * are allocated for each frame. Each structure can hold up to 16 display elements
  * for each display type (lines, arrows, rectangles, etc.). The default size is one.
- * Note: each allocation adds overhead to the processing of each frame. 
+ * Structures are acquired on demand, up to the max size, as display elements are
+ * added. Frames with no display elements carry no Display Meta. 
  * @param[in] name unique name of the ODE Handler to update.
  * @param[in] size number of Display Meta structures allocated per frame
  * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
  */
 DslReturnType dsl_pph_ode_display_meta_alloc_size_set(const wchar_t* name, uint size);
 
+/**
+ * @brief Gets the current parallel mode settings for the named ODE Handler.
+ * @param[in] name unique name of the ODE Handler to query.
+ * @param[out] enabled true if the frames of each batch are processed in parallel,
+ * false if processed one after another (default).
+ * @param[out] max_workers maximum number of threads, including the streaming 
+ * thread, used to process each batch. 0 = one thread per processor.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_parallel_mode_get(const wchar_t* name, 
+    boolean* enabled, uint* max_workers);
+
+/**
+ * @brief Sets the parallel mode settings for the named ODE Handler. When enabled,
+ * the frames of each batch are processed by a pool of worker threads, joined
+ * before the buffer is released. Frames that share an ODE Trigger, or an ODE Action
+ * that requires ordered execution (File, Monitor, Custom, Print, etc.), are 
+ * processed in batch order by the same thread. Only those Triggers that can 
+ * match a frame's source are processed for the frame.
+ * @param[in] name unique name of the ODE Handler to update.
+ * @param[in] enabled set to true to enable parallel mode, false to disable.
+ * @param[in] max_workers maximum number of threads, including the streaming 
+ * thread, used to process each batch. 0 = one thread per processor.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_parallel_mode_set(const wchar_t* name, 
+    boolean enabled, uint max_workers);
+
+/**
+ * @brief Gets the current stats enabled setting for the named ODE Handler.
+ * @param[in] name unique name of the ODE Handler to query.
+ * @param[out] enabled true if stats collection is enabled, false otherwise.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_stats_enabled_get(const wchar_t* name, 
+    boolean* enabled);
+
+/**
+ * @brief Sets the stats enabled setting for the named ODE Handler. When enabled,
+ * the ODE Handler and each of its ODE Triggers time every call made to handle
+ * a batch, pre-process a frame, check for occurrence, post-process a frame, 
+ * and handle an occurrence with an ODE Action. Enabling stats clears all
+ * previous stats. Stats collection is disabled by default.
+ * @param[in] name unique name of the ODE Handler to update.
+ * @param[in] enabled set to true to enable and clear stats, false to disable.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_stats_enabled_set(const wchar_t* name, 
+    boolean enabled);
+
+/**
+ * @brief Gets the current latency and occurrence statistics for the named 
+ * ODE Handler. Use dsl_ode_trigger_stats_get for the stats of each Trigger.
+ * @param[in] name unique name of the ODE Handler to query.
+ * @param[out] stats current statistics for the named ODE Handler.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_stats_get(const wchar_t* name, 
+    dsl_pph_ode_stats* stats);
+
 /**
  * @brief creates a new, uniquely named Custom pad-probe-handler to process a buffer
  * @param[in] name unique component name for the new Custom Handler
@@ -0,0 +1,206 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_BOUNDED_QUEUE_H
+#define _DSL_BOUNDED_QUEUE_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @class BoundedQueue
+     * @brief Fixed capacity, lock-free, multi-producer, multi-consumer FIFO 
+     * queue. Push and Pop never block or allocate. Push fails when the queue 
+     * is full so that the producer can count and drop the entry. Each slot 
+     * carries a sequence number that tells producers and consumers if it is 
+     * free or filled for the current lap around the ring.
+     */
+    template <typename T>
+    class BoundedQueue
+    {
+    public:
+    
+        /**
+         * @brief ctor for the BoundedQueue class
+         * @param[in] capacity maximum number of entries, rounded up to 
+         * the next power of two.
+         */
+        BoundedQueue(size_t capacity)
+            : m_enqueuePos(0)
+            , m_dequeuePos(0)
+        {
+            size_t size(2);
+            while (size < capacity)
+            {
+                size <<= 1;
+            }
+            m_cells = std::vector<Cell>(size);
+            m_mask = size - 1;
+            
+            for (size_t i = 0; i < size; i++)
+            {
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        };
+
+        /**
+         * @brief Gets the maximum number of entries the queue can hold.
+         */
+        size_t GetCapacity()
+        {
+            return m_mask + 1;
+        };
+        
+        /**
+         * @brief Gets the approximate number of entries in the queue. 
+         * Exact only when there are no concurrent Push or Pop calls.
+         */
+        size_t GetSize()
+        {
+            size_t enqueuePos = m_enqueuePos.load(std::memory_order_relaxed);
+            size_t dequeuePos = m_dequeuePos.load(std::memory_order_relaxed);
+            
+            return (enqueuePos > dequeuePos) ? enqueuePos - dequeuePos : 0;
+        };
+        
+        /**
+         * @brief Adds an entry to the back of the queue.
+         * @param[in] data entry to copy into the queue.
+         * @return true on success, false if the queue is full.
+         */
+        bool Push(const T& data)
+        {
+            Cell* pCell;
+            size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+            
+            while (true)
+            {
+                pCell = &m_cells[pos & m_mask];
+                size_t sequence = pCell->sequence.load(std::memory_order_acquire);
+                intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+                
+                // slot is free for this lap - try to claim it.
+                if (diff == 0)
+                {
+                    if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, 
+                        std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                // slot is still filled from the previous lap - full.
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                // another producer claimed the slot first.
+                else
+                {
+                    pos = m_enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+            pCell->data = data;
+            pCell->sequence.store(pos + 1, std::memory_order_release);
+            
+            return true;
+        };
+
+        /**
+         * @brief Removes the entry at the front of the queue.
+         * @param[out] data entry removed from the queue.
+         * @return true on success, false if the queue is empty.
+         */
+        bool Pop(T& data)
+        {
+            Cell* pCell;
+            size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+            
+            while (true)
+            {
+                pCell = &m_cells[pos & m_mask];
+                size_t sequence = pCell->sequence.load(std::memory_order_acquire);
+                intptr_t diff = (intptr_t)sequence - (intptr_t)(pos + 1);
+                
+                // slot is filled for this lap - try to claim it.
+                if (diff == 0)
+                {
+                    if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, 
+                        std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                // slot has not been filled yet - empty.
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                // another consumer claimed the slot first.
+                else
+                {
+                    pos = m_dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+            data = pCell->data;
+            
+            // free the slot for the producers' next lap.
+            pCell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+            
+            return true;
+        };
+        
+    private:
+    
+        struct Cell
+        {
+            std::atomic<size_t> sequence;
+            T data;
+        };
+        
+        /**
+         * @brief ring of cells, size is a power of two.
+         */
+        std::vector<Cell> m_cells;
+        
+        /**
+         * @brief size of m_cells - 1, used to map positions to cells.
+         */
+        size_t m_mask;
+        
+        /**
+         * @brief position of the next Push. Kept on a separate cache line
+         * from m_dequeuePos so producers and consumers don't contend.
+         */
+        alignas(64) std::atomic<size_t> m_enqueuePos;
+        
+        /**
+         * @brief position of the next Pop.
+         */
+        alignas(64) std::atomic<size_t> m_dequeuePos;
+    };
+}
+
+#endif // _DSL_BOUNDED_QUEUE_H
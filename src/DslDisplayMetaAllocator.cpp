@@ -0,0 +1,161 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2021, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslDisplayMetaAllocator.h"
+
+namespace DSL
+{
+    DisplayMetaAllocator::DisplayMetaAllocator(NvDsBatchMeta* pBatchMeta, 
+        uint maxSize, GMutex* pPoolMutex)
+        : m_pBatchMeta(pBatchMeta)
+        , m_maxSize(pBatchMeta ? maxSize : 0)
+        , m_pPoolMutex(pPoolMutex)
+        , m_cursors{0}
+    {
+        // no LOG_FUNC - constructed for every frame.
+    }
+
+    NvOSD_TextParams* DisplayMetaAllocator::AcquireLabel()
+    {
+        NvDsDisplayMeta* pDisplayMeta = GetAvailable(DSL_DISPLAY_META_LABELS);
+        
+        return (pDisplayMeta) 
+            ? &pDisplayMeta->text_params[pDisplayMeta->num_labels++] 
+            : NULL;
+    }
+
+    NvOSD_LineParams* DisplayMetaAllocator::AcquireLine()
+    {
+        NvDsDisplayMeta* pDisplayMeta = GetAvailable(DSL_DISPLAY_META_LINES);
+        
+        return (pDisplayMeta) 
+            ? &pDisplayMeta->line_params[pDisplayMeta->num_lines++] 
+            : NULL;
+    }
+
+    NvOSD_ArrowParams* DisplayMetaAllocator::AcquireArrow()
+    {
+        NvDsDisplayMeta* pDisplayMeta = GetAvailable(DSL_DISPLAY_META_ARROWS);
+        
+        return (pDisplayMeta) 
+            ? &pDisplayMeta->arrow_params[pDisplayMeta->num_arrows++] 
+            : NULL;
+    }
+
+    NvOSD_RectParams* DisplayMetaAllocator::AcquireRect()
+    {
+        NvDsDisplayMeta* pDisplayMeta = GetAvailable(DSL_DISPLAY_META_RECTS);
+        
+        return (pDisplayMeta) 
+            ? &pDisplayMeta->rect_params[pDisplayMeta->num_rects++] 
+            : NULL;
+    }
+
+    NvOSD_CircleParams* DisplayMetaAllocator::AcquireCircle()
+    {
+        NvDsDisplayMeta* pDisplayMeta = GetAvailable(DSL_DISPLAY_META_CIRCLES);
+        
+        return (pDisplayMeta) 
+            ? &pDisplayMeta->circle_params[pDisplayMeta->num_circles++] 
+            : NULL;
+    }
+    
+    NvDsDisplayMeta* DisplayMetaAllocator::GetFirst()
+    {
+        if (m_displayMeta.empty())
+        {
+            // acquires the first meta if enabled
+            GetAvailable(DSL_DISPLAY_META_LABELS);
+        }
+        return (m_displayMeta.empty()) ? NULL : m_displayMeta.front();
+    }
+    
+    void DisplayMetaAllocator::AddToFrame(NvDsFrameMeta* pFrameMeta)
+    {
+        for (const auto &ivec: m_displayMeta)
+        {
+            nvds_add_display_meta_to_frame(pFrameMeta, ivec);
+        }
+        m_displayMeta.clear();
+        for (auto &ivec: m_cursors)
+        {
+            ivec = 0;
+        }
+    }
+
+    NvDsDisplayMeta* DisplayMetaAllocator::GetAvailable(uint kind)
+    {
+        uint& cursor = m_cursors[kind];
+        
+        while (cursor < m_displayMeta.size())
+        {
+            if (GetCount(m_displayMeta[cursor], kind) < 
+                MAX_ELEMENTS_IN_DISPLAY_META)
+            {
+                return m_displayMeta[cursor];
+            }
+            cursor++;
+        }
+        if (m_displayMeta.size() >= m_maxSize)
+        {
+            return NULL;
+        }
+        
+        if (m_pPoolMutex)
+        {
+            g_mutex_lock(m_pPoolMutex);
+        }
+        NvDsDisplayMeta* pDisplayMeta = 
+            nvds_acquire_display_meta_from_pool(m_pBatchMeta);
+        if (m_pPoolMutex)
+        {
+            g_mutex_unlock(m_pPoolMutex);
+        }
+        
+        if (pDisplayMeta)
+        {
+            m_displayMeta.push_back(pDisplayMeta);
+        }
+        return pDisplayMeta;
+    }
+    
+    guint& DisplayMetaAllocator::GetCount(NvDsDisplayMeta* pDisplayMeta, 
+        uint kind)
+    {
+        switch (kind)
+        {
+        case DSL_DISPLAY_META_LINES :
+            return pDisplayMeta->num_lines;
+        case DSL_DISPLAY_META_ARROWS :
+            return pDisplayMeta->num_arrows;
+        case DSL_DISPLAY_META_RECTS :
+            return pDisplayMeta->num_rects;
+        case DSL_DISPLAY_META_CIRCLES :
+            return pDisplayMeta->num_circles;
+        default :
+            return pDisplayMeta->num_labels;
+        }
+    }
+}
@@ -0,0 +1,170 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2021, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_DISPLAY_META_ALLOCATOR_H
+#define _DSL_DISPLAY_META_ALLOCATOR_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @brief Display element kinds, one for each of the 
+     * NvDsDisplayMeta element arrays.
+     */
+    #define DSL_DISPLAY_META_LABELS                                     0
+    #define DSL_DISPLAY_META_LINES                                      1
+    #define DSL_DISPLAY_META_ARROWS                                     2
+    #define DSL_DISPLAY_META_RECTS                                      3
+    #define DSL_DISPLAY_META_CIRCLES                                    4
+    #define DSL_DISPLAY_META_KINDS                                      5
+
+    /**
+     * @class DisplayMetaAllocator
+     * @brief Acquires Display meta for a single frame on demand, up to
+     * a maximum number of NvDsDisplayMeta structures. Frames with nothing 
+     * to display acquire no meta. Each element kind keeps a cursor to the 
+     * first meta with a free slot so that each acquisition is O(1).
+     */
+    class DisplayMetaAllocator
+    {
+    public:
+    
+        /**
+         * @brief ctor for the DisplayMetaAllocator class
+         * @param[in] pBatchMeta batch meta to acquire the Display meta from.
+         * @param[in] maxSize maximum number of NvDsDisplayMeta structures 
+         * to acquire. Set to 0 to disable display meta.
+         * @param[in] pPoolMutex optional mutex to lock while acquiring meta
+         * from the batch-meta pool, required when frames of the same batch 
+         * are processed concurrently.
+         */
+        DisplayMetaAllocator(NvDsBatchMeta* pBatchMeta, uint maxSize,
+            GMutex* pPoolMutex = NULL);
+
+        /**
+         * @brief Gets the next free text slot, acquiring new meta if needed.
+         * @return text params to update, NULL if no slots are available.
+         */
+        NvOSD_TextParams* AcquireLabel();
+
+        /**
+         * @brief Gets the next free line slot, acquiring new meta if needed.
+         * @return line params to update, NULL if no slots are available.
+         */
+        NvOSD_LineParams* AcquireLine();
+
+        /**
+         * @brief Gets the next free arrow slot, acquiring new meta if needed.
+         * @return arrow params to update, NULL if no slots are available.
+         */
+        NvOSD_ArrowParams* AcquireArrow();
+
+        /**
+         * @brief Gets the next free rectangle slot, acquiring new meta if needed.
+         * @return rectangle params to update, NULL if no slots are available.
+         */
+        NvOSD_RectParams* AcquireRect();
+
+        /**
+         * @brief Gets the next free circle slot, acquiring new meta if needed.
+         * @return circle params to update, NULL if no slots are available.
+         */
+        NvOSD_CircleParams* AcquireCircle();
+        
+        /**
+         * @brief Gets the first Display meta for the frame, acquiring it 
+         * if needed. Used to pass Display meta to client callbacks.
+         * @return first Display meta or NULL if display meta is disabled.
+         */
+        NvDsDisplayMeta* GetFirst();
+        
+        /**
+         * @brief Returns true if Display meta can be acquired, i.e. the 
+         * max size is greater than 0.
+         */
+        bool IsEnabled()
+        {
+            return m_maxSize > 0;
+        };
+        
+        /**
+         * @brief Gets the number of NvDsDisplayMeta structures acquired.
+         */
+        uint GetSize()
+        {
+            return m_displayMeta.size();
+        };
+        
+        /**
+         * @brief Adds all acquired Display meta to a frame.
+         * @param[in] pFrameMeta frame to add the Display meta to.
+         */
+        void AddToFrame(NvDsFrameMeta* pFrameMeta);
+        
+    private:
+    
+        /**
+         * @brief Gets the first meta with a free slot for a given kind,
+         * acquiring new meta from the pool if all are full.
+         * @param[in] kind one of the DSL_DISPLAY_META_* constants.
+         * @return meta with a free slot, NULL if max size has been reached.
+         */
+        NvDsDisplayMeta* GetAvailable(uint kind);
+        
+        /**
+         * @brief Gets a reference to the element count for a given kind.
+         */
+        static guint& GetCount(NvDsDisplayMeta* pDisplayMeta, uint kind);
+    
+        /**
+         * @brief batch meta to acquire the Display meta from.
+         */
+        NvDsBatchMeta* m_pBatchMeta;
+        
+        /**
+         * @brief maximum number of NvDsDisplayMeta structures to acquire.
+         */
+        uint m_maxSize;
+        
+        /**
+         * @brief optional mutex to lock while acquiring meta from the pool.
+         */
+        GMutex* m_pPoolMutex;
+        
+        /**
+         * @brief Display meta acquired in order.
+         */
+        std::vector<NvDsDisplayMeta*> m_displayMeta;
+        
+        /**
+         * @brief index of the first meta with a free slot for each kind.
+         * Counts only increase while the frame is processed, so the 
+         * cursors only move forward.
+         */
+        uint m_cursors[DSL_DISPLAY_META_KINDS];
+    };
+}
+
+#endif // _DSL_DISPLAY_META_ALLOCATOR_H
@@ -145,7 +145,7 @@ namespace DSL
         g_mutex_unlock(&m_propertyMutex);        
     }
     
-    void DisplayType::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void DisplayType::AddMeta(DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
         LOG_FUNC();
@@ -423,32 +423,20 @@ namespace DSL
         return true;
     }
     
-    void RgbaText::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void RgbaText::AddMeta(DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
 
         // check to see if we're adding meta data - client can disable
         // by setting the PPH ODE display meta alloc size to 0.
-        // and ensure we have available space in the vector of meta structs.
-        NvDsDisplayMeta* pDisplayMeta(NULL);
-        for (const auto& ivec: displayMetaData)
+        if (m_shadowEnabled)
         {
-            if (ivec->num_labels < MAX_ELEMENTS_IN_DISPLAY_META)
+            NvOSD_TextParams *pTextParams = displayMetaData.AcquireLabel();
+            if (!pTextParams)
             {
-                pDisplayMeta = ivec;
-                break;
+                return;
             }
-        }
-        if (!pDisplayMeta)
-        {
-            return;
-        }
-        if (m_shadowEnabled)
-        {
-            NvOSD_TextParams *pTextParams = &pDisplayMeta->
-                text_params[pDisplayMeta->num_labels++];
-            
             
             pTextParams->x_offset = x_offset + m_shadowXOffset;
             pTextParams->y_offset = y_offset + m_shadowYOffset;
@@ -467,8 +455,11 @@ namespace DSL
                 MAX_DISPLAY_LEN, 0);
                 
         }
-        NvOSD_TextParams *pTextParams = &pDisplayMeta->
-            text_params[pDisplayMeta->num_labels++];
+        NvOSD_TextParams *pTextParams = displayMetaData.AcquireLabel();
+        if (!pTextParams)
+        {
+            return;
+        }
         
         Lock();
         // copy over our text params, display_text currently == NULL
@@ -501,24 +492,15 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void RgbaLine::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void RgbaLine::AddMeta(DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
 
         // check to see if we're adding meta data - client can disable
         // by setting the PPH ODE display meta alloc size to 0.
-        // and ensure we have available space in the vector of meta structs.
-        NvDsDisplayMeta* pDisplayMeta(NULL);
-        for (const auto& ivec: displayMetaData)
-        {
-            if (ivec->num_lines < MAX_ELEMENTS_IN_DISPLAY_META)
-            {
-                pDisplayMeta = ivec;
-                break;
-            }
-        }
-        if (!pDisplayMeta)
+        NvOSD_LineParams* pLineParams = displayMetaData.AcquireLine();
+        if (!pLineParams)
         {
             return;
         }
@@ -526,7 +508,7 @@ namespace DSL
         line_color = *m_pColor;
         m_pColor->Unlock();
 
-        pDisplayMeta->line_params[pDisplayMeta->num_lines++] = *this;
+        *pLineParams = *this;
     }
     
     // ********************************************************************
@@ -546,31 +528,22 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void RgbaArrow::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void RgbaArrow::AddMeta(DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
 
         // check to see if we're adding meta data - client can disable
         // by setting the PPH ODE display meta alloc size to 0.
-        // and ensure we have available space in the vector of meta structs.
-        NvDsDisplayMeta* pDisplayMeta(NULL);
-        for (const auto& ivec: displayMetaData)
-        {
-            if (ivec->num_arrows < MAX_ELEMENTS_IN_DISPLAY_META)
-            {
-                pDisplayMeta = ivec;
-                break;
-            }
-        }
-        if (!pDisplayMeta)
+        NvOSD_ArrowParams* pArrowParams = displayMetaData.AcquireArrow();
+        if (!pArrowParams)
         {
             return;
         }
         m_pColor->Lock();
         arrow_color = *m_pColor;
         m_pColor->Unlock();
-        pDisplayMeta->arrow_params[pDisplayMeta->num_arrows++] = *this;
+        *pArrowParams = *this;
     }
 
     // ********************************************************************
@@ -593,24 +566,15 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void RgbaRectangle::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void RgbaRectangle::AddMeta(DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
 
         // check to see if we're adding meta data - client can disable
         // by setting the PPH ODE display meta alloc size to 0.
-        // and ensure we have available space in the vector of meta structs.
-        NvDsDisplayMeta* pDisplayMeta(NULL);
-        for (const auto& ivec: displayMetaData)
-        {
-            if (ivec->num_rects < MAX_ELEMENTS_IN_DISPLAY_META)
-            {
-                pDisplayMeta = ivec;
-                break;
-            }
-        }
-        if (!pDisplayMeta)
+        NvOSD_RectParams* pRectParams = displayMetaData.AcquireRect();
+        if (!pRectParams)
         {
             return;
         }
@@ -622,7 +586,7 @@ namespace DSL
         bg_color = *m_pBgColor;
         m_pBgColor->Unlock();
         
-        pDisplayMeta->rect_params[pDisplayMeta->num_rects++] = *this;
+        *pRectParams = *this;
     }
     
     // ********************************************************************
@@ -648,7 +612,7 @@ namespace DSL
         g_free(coordinates);
     }
 
-    void RgbaPolygon::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void RgbaPolygon::AddMeta(DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
@@ -661,17 +625,8 @@ namespace DSL
         {
             // check to see if we're adding meta data - client can disable
             // by setting the PPH ODE display meta alloc size to 0.
-            // and ensure we have available space in the vector of meta structs.
-            NvDsDisplayMeta* pDisplayMeta(NULL);
-            for (const auto& ivec: displayMetaData)
-            {
-                if (ivec->num_lines < MAX_ELEMENTS_IN_DISPLAY_META)
-                {
-                    pDisplayMeta = ivec;
-                    break;
-                }
-            }
-            if (!pDisplayMeta)
+            NvOSD_LineParams* pLineParams = displayMetaData.AcquireLine();
+            if (!pLineParams)
             {
                 return;
             }
@@ -684,7 +639,7 @@ namespace DSL
                 border_width, 
                 color};
                 
-            pDisplayMeta->line_params[pDisplayMeta->num_lines++] = line;
+            *pLineParams = line;
         }
     }
 
@@ -696,13 +651,18 @@ namespace DSL
         : DisplayType(name)
         , dsl_multi_line_params{NULL, numCoordinates, lineWidth, *pColor}
         , m_pColor(pColor)
+        , m_capacity(numCoordinates)
     {
         LOG_FUNC();
         
         // allocate data for coordinates and copy over values
         this->coordinates = 
             (dsl_coordinate*) g_malloc0(numCoordinates*sizeof(dsl_coordinate));
-        memcpy(this->coordinates, coordinates, numCoordinates*sizeof(dsl_coordinate));
+        if (numCoordinates)
+        {
+            memcpy(this->coordinates, coordinates, 
+                numCoordinates*sizeof(dsl_coordinate));
+        }
     }
 
     RgbaMultiLine::~RgbaMultiLine()
@@ -712,7 +672,20 @@ namespace DSL
         g_free(coordinates);
     }
 
-    void RgbaMultiLine::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void RgbaMultiLine::SetNumCoordinates(uint numCoordinates)
+    {
+        // No function log - avoid overhead.
+        
+        if (numCoordinates > m_capacity)
+        {
+            coordinates = (dsl_coordinate*) g_realloc(coordinates,
+                numCoordinates*sizeof(dsl_coordinate));
+            m_capacity = numCoordinates;
+        }
+        num_coordinates = numCoordinates;
+    }
+
+    void RgbaMultiLine::AddMeta(DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
@@ -721,21 +694,12 @@ namespace DSL
         color = *m_pColor;
         m_pColor->Unlock();
 
-        for (uint i = 0; i < num_coordinates-1; i++)
+        for (uint i = 0; i+1 < num_coordinates; i++)
         {
             // check to see if we're adding meta data - client can disable
             // by setting the PPH ODE display meta alloc size to 0.
-            // and ensure we have available space in the vector of meta structs.
-            NvDsDisplayMeta* pDisplayMeta(NULL);
-            for (const auto& ivec: displayMetaData)
-            {
-                if (ivec->num_lines < MAX_ELEMENTS_IN_DISPLAY_META)
-                {
-                    pDisplayMeta = ivec;
-                    break;
-                }
-            }
-            if (!pDisplayMeta)
+            NvOSD_LineParams* pLineParams = displayMetaData.AcquireLine();
+            if (!pLineParams)
             {
                 return;
             }
@@ -747,7 +711,7 @@ namespace DSL
                 line_width, 
                 color};
                 
-            pDisplayMeta->line_params[pDisplayMeta->num_lines++] = line;
+            *pLineParams = line;
         }
     }
     // ********************************************************************
@@ -767,14 +731,15 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void RgbaCircle::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void RgbaCircle::AddMeta(DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
 
         // check to see if we're adding meta data - client can disable
         // by setting the PPH ODE display meta alloc size to 0.
-        if (displayMetaData.empty())
+        NvOSD_CircleParams* pCircleParams = displayMetaData.AcquireCircle();
+        if (!pCircleParams)
         {
             return;
         }
@@ -785,8 +750,7 @@ namespace DSL
         bg_color = *m_pBgColor;
         m_pBgColor->Unlock();
         
-        displayMetaData.at(0)->circle_params[
-            displayMetaData.at(0)->num_circles++] = *this;
+        *pCircleParams = *this;
     }
 
     // ********************************************************************
@@ -804,7 +768,7 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void SourceDimensions::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void SourceDimensions::AddMeta(DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
@@ -829,7 +793,7 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void SourceFrameRate::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void SourceFrameRate::AddMeta(DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
@@ -855,7 +819,7 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void SourceUniqueId::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void SourceUniqueId::AddMeta(DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
@@ -880,7 +844,7 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void SourceStreamId::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void SourceStreamId::AddMeta(DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
@@ -905,7 +869,7 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void SourceName::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void SourceName::AddMeta(DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
@@ -28,6 +28,7 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslApi.h"
 #include "DslBase.h"
+#include "DslDisplayMetaAllocator.h"
 #include "randomcolor.h"
 
 #define MAX_DISPLAY_LEN 64
@@ -168,7 +169,7 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        virtual void AddMeta(std::vector<NvDsDisplayMeta*>& 
+        virtual void AddMeta(DisplayMetaAllocator& 
             displayMetaData, NvDsFrameMeta* pFrameMeta);
             
     protected:
@@ -496,7 +497,7 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
         
         std::string m_text;
@@ -567,7 +568,7 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
             
     private:
@@ -607,7 +608,7 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
             
     private:
@@ -650,7 +651,7 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
             
     private:
@@ -723,7 +724,7 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -783,6 +784,15 @@ namespace DSL
 
         ~RgbaMultiLine();
 
+        /**
+         * @brief Sets the number of coordinates for this RGBA Multi-Line so that
+         * the coordinates can be updated in place. The coordinate array is only
+         * reallocated if grown beyond its current capacity. Coordinates beyond
+         * the current number are uninitialized.
+         * @param[in] numCoordinates new number of coordinates.
+         */
+        void SetNumCoordinates(uint numCoordinates);
+
         /**
          * @brief Adds the Display Type's meta to the provided displayMetaData
          * @param displayMetaData vector of allocated Display metadata to add 
@@ -790,7 +800,7 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -799,6 +809,11 @@ namespace DSL
          * @breif shared pointer to a RGBA Color Type for this RGBA Multi-Line
          */
         DSL_RGBA_COLOR_PTR m_pColor;
+        
+        /**
+         * @brief number of coordinates allocated.
+         */
+        uint m_capacity;
     };
 
     
@@ -830,7 +845,7 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -873,7 +888,7 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
         
     private:
@@ -916,7 +931,7 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
         
     private:
@@ -959,7 +974,7 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
         
     private:
@@ -1002,7 +1017,7 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
         
     private:
@@ -1045,7 +1060,7 @@ namespace DSL
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
         
     private:
@@ -0,0 +1,380 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "Dsl.h"
+#include "DslFileWriter.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#define DATE_BUFF_LENGTH 40
+
+namespace DSL
+{
+    FileWriter::FileWriter(const char* filePath, uint mode, 
+        const std::string& header, bool timestampHeader)
+        : m_filePath(filePath)
+        , m_header(header)
+        , m_timestampHeader(timestampHeader)
+        , m_headerSize(0)
+        , m_fd(-1)
+        , m_fileSize(0)
+        , m_openTime(0)
+        , m_rotateBase(0)
+        , m_maxSize(0)
+        , m_maxAge(0)
+        , m_syncPolicy(DSL_FILE_SYNC_POLICY_NONE)
+        , m_droppedBytes(0)
+        , m_writeRequested(false)
+        , m_syncRequested(0)
+        , m_syncCompleted(0)
+        , m_stop(false)
+        , m_pThread(NULL)
+    {
+        LOG_FUNC();
+        
+        if (!openFile(mode == DSL_WRITE_MODE_TRUNCATE))
+        {
+            LOG_ERROR("FileWriter failed to open file '" << m_filePath << "'");
+            throw std::exception();
+        }
+        // a timestamped header also marks each session appended to a file
+        if (m_timestampHeader and !m_headerSize)
+        {
+            writeHeader();
+        }
+        m_frontBuffer.reserve(DSL_FILE_WRITER_WRITE_SIZE*2);
+        m_backBuffer.reserve(DSL_FILE_WRITER_WRITE_SIZE*2);
+        
+        m_pThread = g_thread_new("file-writer", file_writer_thread, this);
+    }
+    
+    FileWriter::~FileWriter()
+    {
+        LOG_FUNC();
+        
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_writerMutex);
+            m_stop = true;
+            g_cond_signal(&m_writeCond);
+        }
+        g_thread_join(m_pThread);
+        
+        if (m_syncPolicy != DSL_FILE_SYNC_POLICY_NONE)
+        {
+            fsync(m_fd);
+        }
+        close(m_fd);
+        
+        if (m_droppedBytes)
+        {
+            LOG_WARN("FileWriter for file '" << m_filePath << "' dropped "
+                << m_droppedBytes << " bytes");
+        }
+    }
+    
+    bool FileWriter::Write(const std::string& data, bool forceWrite)
+    {
+        // No function log - avoid overhead.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_writerMutex);
+        
+        // Never wait on the writer thread - drop if it's too far behind.
+        if (m_frontBuffer.size() + data.size() > DSL_FILE_WRITER_MAX_PENDING_SIZE)
+        {
+            m_droppedBytes += data.size();
+            return false;
+        }
+        m_frontBuffer.append(data);
+        
+        if (!m_writeRequested and (forceWrite or 
+            m_frontBuffer.size() >= DSL_FILE_WRITER_WRITE_SIZE))
+        {
+            m_writeRequested = true;
+            g_cond_signal(&m_writeCond);
+        }
+        return true;
+    }
+    
+    void FileWriter::GetRotation(uint64_t* maxSize, uint* maxAge)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_writerMutex);
+        
+        *maxSize = m_maxSize;
+        *maxAge = m_maxAge;
+    }
+    
+    void FileWriter::SetRotation(uint64_t maxSize, uint maxAge)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_writerMutex);
+        
+        m_maxSize = maxSize;
+        m_maxAge = maxAge;
+    }
+    
+    uint FileWriter::GetSyncPolicy()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_writerMutex);
+        
+        return m_syncPolicy;
+    }
+    
+    void FileWriter::SetSyncPolicy(uint policy)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_writerMutex);
+        
+        m_syncPolicy = policy;
+    }
+    
+    uint64_t FileWriter::GetDroppedBytes()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_writerMutex);
+        
+        return m_droppedBytes;
+    }
+    
+    void FileWriter::Sync()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_writerMutex);
+        
+        uint64_t syncTarget = ++m_syncRequested;
+        m_writeRequested = true;
+        g_cond_signal(&m_writeCond);
+        
+        while (m_syncCompleted < syncTarget)
+        {
+            g_cond_wait(&m_syncCond, &m_writerMutex);
+        }
+    }
+    
+    void FileWriter::WriterThread()
+    {
+        while (true)
+        {
+            uint64_t syncTarget(0);
+            uint64_t maxSize(0);
+            uint maxAge(0);
+            uint syncPolicy(DSL_FILE_SYNC_POLICY_NONE);
+            bool stop(false);
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_writerMutex);
+                
+                gint64 endTime = g_get_monotonic_time() + 
+                    G_TIME_SPAN_MILLISECOND*DSL_FILE_WRITER_WRITE_INTERVAL_MS;
+                    
+                while (!m_stop and !m_writeRequested and 
+                    m_frontBuffer.size() < DSL_FILE_WRITER_WRITE_SIZE)
+                {
+                    if (!g_cond_wait_until(&m_writeCond, &m_writerMutex, endTime))
+                    {
+                        break;
+                    }
+                }
+                m_writeRequested = false;
+                
+                // back buffer is always empty here, swapping keeps the 
+                // capacity of both buffers so neither side reallocates.
+                m_frontBuffer.swap(m_backBuffer);
+                
+                syncTarget = m_syncRequested;
+                maxSize = m_maxSize;
+                maxAge = m_maxAge;
+                syncPolicy = m_syncPolicy;
+                stop = m_stop;
+            }
+            
+            if (m_backBuffer.size())
+            {
+                writeBuffer(m_backBuffer);
+                m_backBuffer.clear();
+                
+                if (syncPolicy == DSL_FILE_SYNC_POLICY_ON_WRITE)
+                {
+                    fdatasync(m_fd);
+                }
+            }
+            
+            // only rotate a file that holds more than its header
+            if (!stop and m_fileSize > m_headerSize and 
+                ((maxSize and (m_fileSize - m_rotateBase) >= maxSize) or (maxAge and 
+                    (g_get_monotonic_time() - m_openTime) >= 
+                        G_TIME_SPAN_SECOND*maxAge)))
+            {
+                if (syncPolicy != DSL_FILE_SYNC_POLICY_NONE)
+                {
+                    fsync(m_fd);
+                }
+                rotateFile();
+            }
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_writerMutex);
+                m_syncCompleted = syncTarget;
+                g_cond_broadcast(&m_syncCond);
+            }
+            if (stop)
+            {
+                break;
+            }
+        }
+    }
+    
+    bool FileWriter::openFile(bool truncate)
+    {
+        LOG_FUNC();
+        
+        int flags = O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC;
+        if (truncate)
+        {
+            flags |= O_TRUNC;
+        }
+        m_fd = open(m_filePath.c_str(), flags, 0644);
+        if (m_fd < 0)
+        {
+            return false;
+        }
+        struct stat fileStat;
+        m_fileSize = (fstat(m_fd, &fileStat) == 0) ? fileStat.st_size : 0;
+        m_openTime = g_get_monotonic_time();
+        m_rotateBase = 0;
+        m_headerSize = 0;
+        
+        // don't add the header if we're appending to an existing file
+        if (!m_fileSize)
+        {
+            writeHeader();
+        }
+        return true;
+    }
+    
+    void FileWriter::writeHeader()
+    {
+        LOG_FUNC();
+        
+        if (m_header.empty())
+        {
+            return;
+        }
+        uint64_t fileSize(m_fileSize);
+        
+        if (m_timestampHeader)
+        {
+            std::string header(m_header.size() + DATE_BUFF_LENGTH, '\0');
+            time_t seconds = time(NULL);
+            struct tm currentTm;
+            localtime_r(&seconds, &currentTm);
+            header.resize(strftime(&header[0], header.size(), 
+                m_header.c_str(), &currentTm));
+            writeBuffer(header);
+        }
+        else
+        {
+            writeBuffer(m_header);
+        }
+        m_headerSize += m_fileSize - fileSize;
+    }
+    
+    void FileWriter::rotateFile()
+    {
+        LOG_FUNC();
+        
+        char dateTime[DATE_BUFF_LENGTH] = {0};
+        time_t seconds = time(NULL);
+        struct tm currentTm;
+        localtime_r(&seconds, &currentTm);
+        strftime(dateTime, DATE_BUFF_LENGTH, "%Y%m%d-%H%M%S", &currentTm);
+        
+        std::string rotatedPath = m_filePath + "." + dateTime;
+        for (uint i = 1; access(rotatedPath.c_str(), F_OK) == 0; i++)
+        {
+            rotatedPath = m_filePath + "." + dateTime + "." + std::to_string(i);
+        }
+        
+        close(m_fd);
+        m_fd = -1;
+        
+        if (rename(m_filePath.c_str(), rotatedPath.c_str()))
+        {
+            LOG_ERROR("FileWriter failed to rename '" << m_filePath 
+                << "' to '" << rotatedPath << "' with errno = " << errno);
+            
+            // Keep the current contents - re-open for append and retry once
+            // the file has grown by the max size, or reached the max age, again.
+            if (!openFile(false))
+            {
+                LOG_ERROR("FileWriter failed to re-open file '" 
+                    << m_filePath << "'");
+            }
+            m_rotateBase = m_fileSize;
+            return;
+        }
+        LOG_INFO("FileWriter rotated '" << m_filePath 
+            << "' to '" << rotatedPath << "'");
+            
+        if (!openFile(true))
+        {
+            LOG_ERROR("FileWriter failed to open new file '" << m_filePath << "'");
+        }
+    }
+    
+    void FileWriter::writeBuffer(const std::string& buffer)
+    {
+        if (m_fd < 0)
+        {
+            return;
+        }
+        const char* pData = buffer.data();
+        size_t remaining = buffer.size();
+        
+        while (remaining)
+        {
+            ssize_t written = write(m_fd, pData, remaining);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                LOG_ERROR("FileWriter failed to write to file '" << m_filePath
+                    << "' with errno = " << errno);
+                return;
+            }
+            pData += written;
+            remaining -= written;
+            m_fileSize += written;
+        }
+    }
+
+    static gpointer file_writer_thread(gpointer pWriter)
+    {
+        static_cast<FileWriter*>(pWriter)->WriterThread();
+        
+        return NULL;
+    }
+}
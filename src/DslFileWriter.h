@@ -0,0 +1,330 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_FILE_WRITER_H
+#define _DSL_FILE_WRITER_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+
+namespace DSL
+{
+    /**
+     * @brief size of pending data that wakes the writer thread early.
+     */
+    #define DSL_FILE_WRITER_WRITE_SIZE                                  (64*1024)
+    
+    /**
+     * @brief maximum size of pending data. Data written while the writer 
+     * thread is this far behind is dropped rather than blocking the caller.
+     */
+    #define DSL_FILE_WRITER_MAX_PENDING_SIZE                            (16*1024*1024)
+    
+    /**
+     * @brief maximum time pending data waits to be written when not forced.
+     */
+    #define DSL_FILE_WRITER_WRITE_INTERVAL_MS                           1000
+    
+    /**
+     * @class FileFormatBuffer
+     * @brief Stream buffer that formats into a reusable string, so that 
+     * formatting with operator<< does not allocate once warmed up.
+     */
+    class FileFormatBuffer : public std::streambuf
+    {
+    public:
+    
+        FileFormatBuffer()
+            : m_ostream(this)
+        {};
+        
+        /**
+         * @brief Clears the buffer, keeping its capacity.
+         * @return output stream to format into the buffer with.
+         */
+        std::ostream& Begin()
+        {
+            m_buffer.clear();
+            m_ostream.clear();
+            return m_ostream;
+        };
+        
+        /**
+         * @brief Gets the formatted contents of the buffer.
+         */
+        const std::string& GetString()
+        {
+            return m_buffer;
+        };
+        
+    protected:
+    
+        int_type overflow(int_type ch)
+        {
+            if (ch != traits_type::eof())
+            {
+                m_buffer.push_back(traits_type::to_char_type(ch));
+            }
+            return ch;
+        };
+        
+        std::streamsize xsputn(const char* s, std::streamsize count)
+        {
+            m_buffer.append(s, count);
+            return count;
+        };
+        
+    private:
+    
+        std::string m_buffer;
+        
+        std::ostream m_ostream;
+    };
+    
+    /**
+     * @class FileWriter
+     * @brief Double-buffered file writer. Callers append to the front buffer 
+     * under a short lock and never wait on the disk. A dedicated thread swaps 
+     * the buffers and writes the back buffer to file in large writes, 
+     * rotating the file by size and age, and syncing per the sync policy.
+     */
+    class FileWriter
+    {
+    public:
+    
+        /**
+         * @brief ctor for the FileWriter class
+         * @param[in] filePath absolute or relative path to the output file.
+         * @param[in] mode open/write mode - DSL_WRITE_MODE_APPEND or 
+         * DSL_WRITE_MODE_TRUNCATE.
+         * @param[in] header header to write at the start of each new file. 
+         * Not written when appending to an existing, non-empty file.
+         * @param[in] timestampHeader if true, the header is a strftime format
+         * expanded with the local time when written, and is also written to 
+         * mark the start of each session appended to an existing file.
+         * @throws if the file can not be opened.
+         */
+        FileWriter(const char* filePath, uint mode, 
+            const std::string& header, bool timestampHeader);
+        
+        /**
+         * @brief dtor for the FileWriter class. Writes all pending data 
+         * and closes the file.
+         */
+        ~FileWriter();
+        
+        /**
+         * @brief Appends data to be written to file.
+         * @param[in] data data to write.
+         * @param[in] forceWrite if true, wakes the writer thread to write 
+         * the data now, rather than waiting for a full write or interval.
+         * @return false if the data was dropped because too much data is
+         * already pending, true otherwise.
+         */
+        bool Write(const std::string& data, bool forceWrite);
+        
+        /**
+         * @brief Gets the current file rotation settings.
+         * @param[out] maxSize size in bytes to rotate the file at, 0 if unset.
+         * @param[out] maxAge age in seconds to rotate the file at, 0 if unset.
+         */
+        void GetRotation(uint64_t* maxSize, uint* maxAge);
+        
+        /**
+         * @brief Sets the file rotation settings. When the current file 
+         * reaches either limit it is renamed with a timestamp suffix and a 
+         * new file is started.
+         * @param[in] maxSize size in bytes to rotate the file at, 0 to disable.
+         * @param[in] maxAge age in seconds to rotate the file at, 0 to disable.
+         */
+        void SetRotation(uint64_t maxSize, uint maxAge);
+        
+        /**
+         * @brief Gets the current sync policy.
+         * @return one of the DSL_FILE_SYNC_POLICY_* constants.
+         */
+        uint GetSyncPolicy();
+        
+        /**
+         * @brief Sets the sync policy.
+         * @param[in] policy one of the DSL_FILE_SYNC_POLICY_* constants.
+         */
+        void SetSyncPolicy(uint policy);
+        
+        /**
+         * @brief Gets the number of bytes dropped since creation.
+         */
+        uint64_t GetDroppedBytes();
+        
+        /**
+         * @brief Blocks until all data written before the call is in the file.
+         */
+        void Sync();
+        
+        /**
+         * @brief Writer thread function. ** To be called by the writer thread only **.
+         */
+        void WriterThread();
+        
+    private:
+    
+        /**
+         * @brief Opens the file at m_filePath and writes the header if new.
+         * @param[in] truncate true to truncate an existing file.
+         * @return true on success.
+         */
+        bool openFile(bool truncate);
+        
+        /**
+         * @brief Writes the header to the current file, expanding the 
+         * timestamp if set.
+         */
+        void writeHeader();
+        
+        /**
+         * @brief Renames the current file with a timestamp suffix and opens 
+         * a new file in its place. If the rename fails, the current file is
+         * re-opened for append and rotation is retried at the next threshold.
+         */
+        void rotateFile();
+        
+        /**
+         * @brief Writes a buffer to the current file in full.
+         */
+        void writeBuffer(const std::string& buffer);
+    
+        /**
+         * @brief relative or absolute path to the file to write to.
+         */
+        std::string m_filePath;
+        
+        /**
+         * @brief header written to the start of each new file.
+         */
+        std::string m_header;
+        
+        /**
+         * @brief if true, m_header is a strftime format.
+         */
+        bool m_timestampHeader;
+        
+        /**
+         * @brief size of the header written to the current file, 0 if none.
+         */
+        uint64_t m_headerSize;
+        
+        /**
+         * @brief file descriptor for the current file, -1 if not open.
+         */
+        int m_fd;
+        
+        /**
+         * @brief size of the current file in bytes.
+         */
+        uint64_t m_fileSize;
+        
+        /**
+         * @brief monotonic time the current file was opened, in microseconds.
+         */
+        gint64 m_openTime;
+        
+        /**
+         * @brief size of the current file at the last open or failed 
+         * rotation. The file is rotated once it has grown by the max size.
+         */
+        uint64_t m_rotateBase;
+        
+        /**
+         * @brief rotation size in bytes and age in seconds, 0 if unset.
+         */
+        uint64_t m_maxSize;
+        uint m_maxAge;
+        
+        /**
+         * @brief one of the DSL_FILE_SYNC_POLICY_* constants.
+         */
+        uint m_syncPolicy;
+        
+        /**
+         * @brief buffer appended to by callers.
+         */
+        std::string m_frontBuffer;
+        
+        /**
+         * @brief buffer written to file by the writer thread.
+         */
+        std::string m_backBuffer;
+        
+        /**
+         * @brief number of bytes dropped since creation.
+         */
+        uint64_t m_droppedBytes;
+        
+        /**
+         * @brief set to wake the writer thread to write now.
+         */
+        bool m_writeRequested;
+        
+        /**
+         * @brief running counts of sync requests and syncs completed.
+         */
+        uint64_t m_syncRequested;
+        uint64_t m_syncCompleted;
+        
+        /**
+         * @brief set on destruction to stop the writer thread.
+         */
+        bool m_stop;
+        
+        /**
+         * @brief mutex to protect the front buffer and all settings.
+         */
+        DslMutex m_writerMutex;
+        
+        /**
+         * @brief condition to wake the writer thread.
+         */
+        DslCond m_writeCond;
+        
+        /**
+         * @brief condition to signal completed syncs.
+         */
+        DslCond m_syncCond;
+        
+        /**
+         * @brief the writer thread.
+         */
+        GThread* m_pThread;
+    };
+
+    /**
+     * @brief Thread function to run a File Writer's writer loop.
+     * @param[in] pWriter pointer to the FileWriter to run.
+     * @return NULL always.
+     */
+    static gpointer file_writer_thread(gpointer pWriter);
+}
+
+#endif // _DSL_FILE_WRITER_H
@@ -0,0 +1,809 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2021, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_GEOMETRY_H
+#define _DSL_GEOMETRY_H
+
+#include "Dsl.h"
+#include <cfloat>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(BUILD_WITH_NEON) && (BUILD_WITH_NEON == true) && \
+    defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+/**
+ * @file DslGeometry.h
+ * @brief Header-only geometry kernels for the ODE hot path - point-in-polygon,
+ * point-to-segment distance, path intersection, bbox distance/overlap, and a
+ * uniform grid broad phase for pairwise bbox tests.
+ * Results match the equivalent GEOS predicates in DslGeosTypes.h, including 
+ * rounding of distances to whole pixels. Segment loops are vectorized with 
+ * AVX2 (when built with BUILD_WITH_AVX2:=true) or NEON (when built with 
+ * BUILD_WITH_NEON:=true on aarch64), with a scalar fallback. All arithmetic 
+ * is in double precision, which is exact for the orientation tests with 
+ * coordinates less than 2^26.
+ */
+namespace DSL
+{
+    /**
+     * @brief Point location values returned by GeometryPointLocation
+     */
+    #define DSL_GEOMETRY_EXTERIOR                                       0
+    #define DSL_GEOMETRY_BOUNDARY                                       1
+    #define DSL_GEOMETRY_INTERIOR                                       2
+
+    /**
+     * @class GeometryPath
+     * @file DslGeometry.h
+     * @brief Path of connected line segments stored as separate x and y 
+     * coordinate arrays so that consecutive segments can be loaded as vectors.
+     * A closed path (ring) repeats its first coordinate at the end.
+     */
+    class GeometryPath
+    {
+    public:
+    
+        /**
+         * @brief ctor for an empty GeometryPath.
+         */
+        GeometryPath()
+            : minX(0), minY(0), maxX(0), maxY(0)
+        {};
+        
+        /**
+         * @brief ctor for a GeometryPath from an array of coordinates.
+         * @param[in] coordinates array of coordinates defining the path.
+         * @param[in] numCoordinates number of coordinates in the array.
+         * @param[in] closed if true, the path is closed with a segment from
+         * the last coordinate to the first.
+         */
+        GeometryPath(const dsl_coordinate* coordinates, uint numCoordinates, 
+            bool closed)
+            : minX(0), minY(0), maxX(0), maxY(0)
+        {
+            uint size = (closed and numCoordinates) 
+                ? numCoordinates+1 : numCoordinates;
+            x.reserve(size);
+            y.reserve(size);
+            for (uint i = 0; i < size; i++)
+            {
+                Append(coordinates[i%numCoordinates].x, 
+                    coordinates[i%numCoordinates].y);
+            }
+        };
+        
+        /**
+         * @brief ctor for a single segment GeometryPath.
+         */
+        GeometryPath(double x1, double y1, double x2, double y2)
+            : minX(0), minY(0), maxX(0), maxY(0)
+        {
+            Append(x1, y1);
+            Append(x2, y2);
+        };
+        
+        /**
+         * @brief Appends a coordinate to the end of the path.
+         */
+        void Append(double xNew, double yNew)
+        {
+            if (x.empty())
+            {
+                minX = maxX = xNew;
+                minY = maxY = yNew;
+            }
+            minX = std::min(minX, xNew);
+            minY = std::min(minY, yNew);
+            maxX = std::max(maxX, xNew);
+            maxY = std::max(maxY, yNew);
+            x.push_back(xNew);
+            y.push_back(yNew);
+        };
+        
+        /**
+         * @brief Returns the number of line segments in the path.
+         */
+        uint GetNumSegments() const
+        {
+            return (x.size() > 1) ? x.size()-1 : 0;
+        };
+        
+        /**
+         * @brief x and y coordinates of the path's vertices.
+         */
+        std::vector<double> x, y;
+        
+        /**
+         * @brief bounding box of the path.
+         */
+        double minX, minY, maxX, maxY;
+    };
+
+    /**
+     * @struct GeometryScalarOps
+     * @brief Single lane vector operations used by the geometry kernels for 
+     * the scalar fallback and for the remainder of each vectorized loop.
+     */
+    struct GeometryScalarOps
+    {
+        typedef double VD;
+        typedef bool VM;
+        static const uint LANES = 1;
+        
+        static VD Load(const double* p) { return *p; };
+        static VD Set(double v) { return v; };
+        static VD Add(VD a, VD b) { return a + b; };
+        static VD Sub(VD a, VD b) { return a - b; };
+        static VD Mul(VD a, VD b) { return a * b; };
+        static VD Div(VD a, VD b) { return a / b; };
+        static VD Min(VD a, VD b) { return std::min(a, b); };
+        static VD Max(VD a, VD b) { return std::max(a, b); };
+        static VM Gt(VD a, VD b) { return a > b; };
+        static VM Lt(VD a, VD b) { return a < b; };
+        static VM Ge(VD a, VD b) { return a >= b; };
+        static VM Le(VD a, VD b) { return a <= b; };
+        static VM Eq(VD a, VD b) { return a == b; };
+        static VM And(VM a, VM b) { return a and b; };
+        static VM Or(VM a, VM b) { return a or b; };
+        static VM Xor(VM a, VM b) { return a != b; };
+        static VM Not(VM a) { return !a; };
+        static VD Select(VM m, VD a, VD b) { return m ? a : b; };
+        static bool Any(VM m) { return m; };
+        static uint Count(VM m) { return m ? 1 : 0; };
+        static double ReduceMin(VD a) { return a; };
+    };
+
+#if defined(__AVX2__)
+    /**
+     * @struct GeometrySimdOps
+     * @brief AVX2 vector operations, four doubles per vector.
+     */
+    struct GeometrySimdOps
+    {
+        typedef __m256d VD;
+        typedef __m256d VM;
+        static const uint LANES = 4;
+        
+        static VD Load(const double* p) { return _mm256_loadu_pd(p); };
+        static VD Set(double v) { return _mm256_set1_pd(v); };
+        static VD Add(VD a, VD b) { return _mm256_add_pd(a, b); };
+        static VD Sub(VD a, VD b) { return _mm256_sub_pd(a, b); };
+        static VD Mul(VD a, VD b) { return _mm256_mul_pd(a, b); };
+        static VD Div(VD a, VD b) { return _mm256_div_pd(a, b); };
+        static VD Min(VD a, VD b) { return _mm256_min_pd(a, b); };
+        static VD Max(VD a, VD b) { return _mm256_max_pd(a, b); };
+        static VM Gt(VD a, VD b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); };
+        static VM Lt(VD a, VD b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); };
+        static VM Ge(VD a, VD b) { return _mm256_cmp_pd(a, b, _CMP_GE_OQ); };
+        static VM Le(VD a, VD b) { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); };
+        static VM Eq(VD a, VD b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); };
+        static VM And(VM a, VM b) { return _mm256_and_pd(a, b); };
+        static VM Or(VM a, VM b) { return _mm256_or_pd(a, b); };
+        static VM Xor(VM a, VM b) { return _mm256_xor_pd(a, b); };
+        static VM Not(VM a) 
+        { 
+            return _mm256_xor_pd(a, _mm256_castsi256_pd(_mm256_set1_epi64x(-1))); 
+        };
+        static VD Select(VM m, VD a, VD b) { return _mm256_blendv_pd(b, a, m); };
+        static bool Any(VM m) { return _mm256_movemask_pd(m) != 0; };
+        static uint Count(VM m) 
+        { 
+            return __builtin_popcount(_mm256_movemask_pd(m)); 
+        };
+        static double ReduceMin(VD a) 
+        {
+            __m128d v = _mm_min_pd(_mm256_castpd256_pd128(a), 
+                _mm256_extractf128_pd(a, 1));
+            return _mm_cvtsd_f64(_mm_min_sd(v, _mm_unpackhi_pd(v, v)));
+        };
+    };
+    #define DSL_GEOMETRY_SIMD
+#elif defined(BUILD_WITH_NEON) && (BUILD_WITH_NEON == true) && \
+    defined(__ARM_NEON) && defined(__aarch64__)
+    /**
+     * @struct GeometrySimdOps
+     * @brief NEON vector operations, two doubles per vector.
+     */
+    struct GeometrySimdOps
+    {
+        typedef float64x2_t VD;
+        typedef uint64x2_t VM;
+        static const uint LANES = 2;
+        
+        static VD Load(const double* p) { return vld1q_f64(p); };
+        static VD Set(double v) { return vdupq_n_f64(v); };
+        static VD Add(VD a, VD b) { return vaddq_f64(a, b); };
+        static VD Sub(VD a, VD b) { return vsubq_f64(a, b); };
+        static VD Mul(VD a, VD b) { return vmulq_f64(a, b); };
+        static VD Div(VD a, VD b) { return vdivq_f64(a, b); };
+        static VD Min(VD a, VD b) { return vminq_f64(a, b); };
+        static VD Max(VD a, VD b) { return vmaxq_f64(a, b); };
+        static VM Gt(VD a, VD b) { return vcgtq_f64(a, b); };
+        static VM Lt(VD a, VD b) { return vcltq_f64(a, b); };
+        static VM Ge(VD a, VD b) { return vcgeq_f64(a, b); };
+        static VM Le(VD a, VD b) { return vcleq_f64(a, b); };
+        static VM Eq(VD a, VD b) { return vceqq_f64(a, b); };
+        static VM And(VM a, VM b) { return vandq_u64(a, b); };
+        static VM Or(VM a, VM b) { return vorrq_u64(a, b); };
+        static VM Xor(VM a, VM b) { return veorq_u64(a, b); };
+        static VM Not(VM a) 
+        { 
+            return vreinterpretq_u64_u32(vmvnq_u32(vreinterpretq_u32_u64(a))); 
+        };
+        static VD Select(VM m, VD a, VD b) { return vbslq_f64(m, a, b); };
+        static bool Any(VM m) 
+        { 
+            return (vgetq_lane_u64(m, 0) | vgetq_lane_u64(m, 1)) != 0; 
+        };
+        static uint Count(VM m) 
+        { 
+            return (vgetq_lane_u64(m, 0) ? 1 : 0) + (vgetq_lane_u64(m, 1) ? 1 : 0); 
+        };
+        static double ReduceMin(VD a) { return vminvq_f64(a); };
+    };
+    #define DSL_GEOMETRY_SIMD
+#endif
+
+    /**
+     * @brief Minimum squared distance from a point to the path's segments 
+     * [begin, end), in steps of Ops::LANES. Updates minDistanceSq.
+     * @return index of the first segment not processed.
+     */
+    template<typename Ops>
+    inline uint GeometryPointToSegmentsDistanceSq(const GeometryPath& path, 
+        uint begin, uint end, double px, double py, double& minDistanceSq)
+    {
+        typename Ops::VD vpx(Ops::Set(px)), vpy(Ops::Set(py));
+        typename Ops::VD vzero(Ops::Set(0.0)), vone(Ops::Set(1.0));
+        typename Ops::VD vmin(Ops::Set(minDistanceSq));
+        
+        uint i(begin);
+        for (; i + Ops::LANES <= end; i += Ops::LANES)
+        {
+            typename Ops::VD x1(Ops::Load(&path.x[i])), y1(Ops::Load(&path.y[i]));
+            typename Ops::VD dx(Ops::Sub(Ops::Load(&path.x[i+1]), x1));
+            typename Ops::VD dy(Ops::Sub(Ops::Load(&path.y[i+1]), y1));
+            typename Ops::VD ex(Ops::Sub(vpx, x1)), ey(Ops::Sub(vpy, y1));
+            
+            // projection of the point onto the segment, clamped to [0,1],
+            // 0 for zero length segments.
+            typename Ops::VD lengthSq(Ops::Add(Ops::Mul(dx, dx), Ops::Mul(dy, dy)));
+            typename Ops::VD t(Ops::Div(Ops::Add(Ops::Mul(ex, dx), 
+                Ops::Mul(ey, dy)), lengthSq));
+            t = Ops::Select(Ops::Gt(lengthSq, vzero), 
+                Ops::Max(vzero, Ops::Min(vone, t)), vzero);
+                
+            ex = Ops::Sub(ex, Ops::Mul(t, dx));
+            ey = Ops::Sub(ey, Ops::Mul(t, dy));
+            vmin = Ops::Min(vmin, Ops::Add(Ops::Mul(ex, ex), Ops::Mul(ey, ey)));
+        }
+        minDistanceSq = Ops::ReduceMin(vmin);
+        return i;
+    }
+
+    /**
+     * @brief Counts the path's segments [begin, end) that cross a horizontal
+     * ray from a point to +x, and tests if the point is on any segment.
+     * @return index of the first segment not processed.
+     */
+    template<typename Ops>
+    inline uint GeometryRayCrossings(const GeometryPath& path, 
+        uint begin, uint end, double px, double py, 
+        uint& crossings, bool& onBoundary)
+    {
+        typename Ops::VD vpx(Ops::Set(px)), vpy(Ops::Set(py));
+        typename Ops::VD vzero(Ops::Set(0.0));
+        
+        uint i(begin);
+        for (; i + Ops::LANES <= end; i += Ops::LANES)
+        {
+            typename Ops::VD x1(Ops::Load(&path.x[i])), y1(Ops::Load(&path.y[i]));
+            typename Ops::VD x2(Ops::Load(&path.x[i+1])), y2(Ops::Load(&path.y[i+1]));
+            
+            typename Ops::VD cross(Ops::Sub(
+                Ops::Mul(Ops::Sub(x2, x1), Ops::Sub(vpy, y1)),
+                Ops::Mul(Ops::Sub(vpx, x1), Ops::Sub(y2, y1))));
+            
+            // point is on the segment if collinear and within its bounds.
+            typename Ops::VM on(Ops::And(Ops::Eq(cross, vzero),
+                Ops::And(
+                    Ops::And(Ops::Ge(vpx, Ops::Min(x1, x2)), 
+                        Ops::Le(vpx, Ops::Max(x1, x2))),
+                    Ops::And(Ops::Ge(vpy, Ops::Min(y1, y2)), 
+                        Ops::Le(vpy, Ops::Max(y1, y2))))));
+            if (Ops::Any(on))
+            {
+                onBoundary = true;
+                return end;
+            }
+            
+            // the segment crosses the ray right of the point if the point
+            // is left of an upward segment or right of a downward segment.
+            typename Ops::VM spans(Ops::Xor(Ops::Gt(y1, vpy), Ops::Gt(y2, vpy)));
+            typename Ops::VM upward(Ops::Gt(y2, y1));
+            typename Ops::VM right(Ops::Or(
+                Ops::And(upward, Ops::Gt(cross, vzero)),
+                Ops::And(Ops::Not(upward), Ops::Lt(cross, vzero))));
+            crossings += Ops::Count(Ops::And(spans, right));
+        }
+        return i;
+    }
+
+    /**
+     * @brief Tests if a segment a1-a2 intersects, including touching, any 
+     * of the path's segments [begin, end), in steps of Ops::LANES.
+     * @return index of the first segment not processed, or end on intersection.
+     */
+    template<typename Ops>
+    inline uint GeometrySegmentIntersectsSegments(const GeometryPath& path, 
+        uint begin, uint end, double ax1, double ay1, double ax2, double ay2,
+        bool& intersects)
+    {
+        typename Ops::VD vax1(Ops::Set(ax1)), vay1(Ops::Set(ay1));
+        typename Ops::VD vax2(Ops::Set(ax2)), vay2(Ops::Set(ay2));
+        typename Ops::VD vfx(Ops::Set(ax2 - ax1)), vfy(Ops::Set(ay2 - ay1));
+        typename Ops::VD vaMinX(Ops::Set(std::min(ax1, ax2)));
+        typename Ops::VD vaMaxX(Ops::Set(std::max(ax1, ax2)));
+        typename Ops::VD vaMinY(Ops::Set(std::min(ay1, ay2)));
+        typename Ops::VD vaMaxY(Ops::Set(std::max(ay1, ay2)));
+        typename Ops::VD vzero(Ops::Set(0.0));
+        
+        uint i(begin);
+        for (; i + Ops::LANES <= end; i += Ops::LANES)
+        {
+            typename Ops::VD bx1(Ops::Load(&path.x[i])), by1(Ops::Load(&path.y[i]));
+            typename Ops::VD bx2(Ops::Load(&path.x[i+1])), by2(Ops::Load(&path.y[i+1]));
+            typename Ops::VD ex(Ops::Sub(bx2, bx1)), ey(Ops::Sub(by2, by1));
+            
+            // orientation of a1 and a2 relative to b, and b1 and b2 to a.
+            typename Ops::VD d1(Ops::Sub(Ops::Mul(ex, Ops::Sub(vay1, by1)), 
+                Ops::Mul(ey, Ops::Sub(vax1, bx1))));
+            typename Ops::VD d2(Ops::Sub(Ops::Mul(ex, Ops::Sub(vay2, by1)), 
+                Ops::Mul(ey, Ops::Sub(vax2, bx1))));
+            typename Ops::VD d3(Ops::Sub(Ops::Mul(vfx, Ops::Sub(by1, vay1)), 
+                Ops::Mul(vfy, Ops::Sub(bx1, vax1))));
+            typename Ops::VD d4(Ops::Sub(Ops::Mul(vfx, Ops::Sub(by2, vay1)), 
+                Ops::Mul(vfy, Ops::Sub(bx2, vax1))));
+                
+            // proper crossing - each segment straddles the other.
+            typename Ops::VM hit(Ops::And(
+                Ops::Or(Ops::And(Ops::Gt(d1, vzero), Ops::Lt(d2, vzero)),
+                    Ops::And(Ops::Lt(d1, vzero), Ops::Gt(d2, vzero))),
+                Ops::Or(Ops::And(Ops::Gt(d3, vzero), Ops::Lt(d4, vzero)),
+                    Ops::And(Ops::Lt(d3, vzero), Ops::Gt(d4, vzero)))));
+            
+            // touching - an end point is collinear with, and within the 
+            // bounds of, the other segment.
+            typename Ops::VD bMinX(Ops::Min(bx1, bx2)), bMaxX(Ops::Max(bx1, bx2));
+            typename Ops::VD bMinY(Ops::Min(by1, by2)), bMaxY(Ops::Max(by1, by2));
+            
+            hit = Ops::Or(hit, Ops::And(Ops::Eq(d1, vzero), Ops::And(
+                Ops::And(Ops::Ge(vax1, bMinX), Ops::Le(vax1, bMaxX)),
+                Ops::And(Ops::Ge(vay1, bMinY), Ops::Le(vay1, bMaxY)))));
+            hit = Ops::Or(hit, Ops::And(Ops::Eq(d2, vzero), Ops::And(
+                Ops::And(Ops::Ge(vax2, bMinX), Ops::Le(vax2, bMaxX)),
+                Ops::And(Ops::Ge(vay2, bMinY), Ops::Le(vay2, bMaxY)))));
+            hit = Ops::Or(hit, Ops::And(Ops::Eq(d3, vzero), Ops::And(
+                Ops::And(Ops::Ge(bx1, vaMinX), Ops::Le(bx1, vaMaxX)),
+                Ops::And(Ops::Ge(by1, vaMinY), Ops::Le(by1, vaMaxY)))));
+            hit = Ops::Or(hit, Ops::And(Ops::Eq(d4, vzero), Ops::And(
+                Ops::And(Ops::Ge(bx2, vaMinX), Ops::Le(bx2, vaMaxX)),
+                Ops::And(Ops::Ge(by2, vaMinY), Ops::Le(by2, vaMaxY)))));
+                
+            if (Ops::Any(hit))
+            {
+                intersects = true;
+                return end;
+            }
+        }
+        return i;
+    }
+
+    /**
+     * @brief Gets the distance from a point to a path, as per GEOSDistance.
+     * @param[in] path path to measure the distance to.
+     * @param[in] px x coordinate of the point.
+     * @param[in] py y coordinate of the point.
+     * @return distance rounded to the nearest pixel, as per the GeosTypes.
+     */
+    inline uint GeometryPointToPathDistance(const GeometryPath& path, 
+        double px, double py)
+    {
+        uint numSegments(path.GetNumSegments());
+        if (!numSegments)
+        {
+            return (path.x.empty()) ? 0 : (uint)round(sqrt(
+                (px-path.x[0])*(px-path.x[0]) + (py-path.y[0])*(py-path.y[0])));
+        }
+        double minDistanceSq(DBL_MAX);
+        uint i(0);
+#ifdef DSL_GEOMETRY_SIMD
+        i = GeometryPointToSegmentsDistanceSq<GeometrySimdOps>(path, 
+            i, numSegments, px, py, minDistanceSq);
+#endif
+        GeometryPointToSegmentsDistanceSq<GeometryScalarOps>(path, 
+            i, numSegments, px, py, minDistanceSq);
+            
+        return (uint)round(sqrt(minDistanceSq));
+    }
+    
+    /**
+     * @brief Gets the location of a point relative to a closed path (ring).
+     * @param[in] ring closed path to test.
+     * @param[in] px x coordinate of the point.
+     * @param[in] py y coordinate of the point.
+     * @return one of the DSL_GEOMETRY_* location values. A point on the 
+     * boundary is not contained, as per GEOSContains.
+     */
+    inline uint GeometryPointLocation(const GeometryPath& ring, 
+        double px, double py)
+    {
+        if (px < ring.minX or px > ring.maxX or py < ring.minY or py > ring.maxY)
+        {
+            return DSL_GEOMETRY_EXTERIOR;
+        }
+        uint numSegments(ring.GetNumSegments());
+        uint crossings(0);
+        bool onBoundary(false);
+        uint i(0);
+#ifdef DSL_GEOMETRY_SIMD
+        i = GeometryRayCrossings<GeometrySimdOps>(ring, 
+            i, numSegments, px, py, crossings, onBoundary);
+#endif
+        GeometryRayCrossings<GeometryScalarOps>(ring, 
+            i, numSegments, px, py, crossings, onBoundary);
+            
+        if (onBoundary)
+        {
+            return DSL_GEOMETRY_BOUNDARY;
+        }
+        return (crossings % 2) ? DSL_GEOMETRY_INTERIOR : DSL_GEOMETRY_EXTERIOR;
+    }
+    
+    /**
+     * @brief Tests if a segment intersects, including touching, a path.
+     * @return true if the segment intersects the path, as per GEOSIntersects.
+     */
+    inline bool GeometrySegmentIntersectsPath(const GeometryPath& path, 
+        double x1, double y1, double x2, double y2)
+    {
+        if (std::max(x1, x2) < path.minX or std::min(x1, x2) > path.maxX or
+            std::max(y1, y2) < path.minY or std::min(y1, y2) > path.maxY)
+        {
+            return false;
+        }
+        uint numSegments(path.GetNumSegments());
+        bool intersects(false);
+        uint i(0);
+#ifdef DSL_GEOMETRY_SIMD
+        i = GeometrySegmentIntersectsSegments<GeometrySimdOps>(path, 
+            i, numSegments, x1, y1, x2, y2, intersects);
+#endif
+        GeometrySegmentIntersectsSegments<GeometryScalarOps>(path, 
+            i, numSegments, x1, y1, x2, y2, intersects);
+            
+        return intersects;
+    }
+    
+    /**
+     * @brief Tests if two paths intersect, including touching.
+     * @return true if the paths intersect, as per GEOSIntersects.
+     */
+    inline bool GeometryPathIntersectsPath(const GeometryPath& pathA, 
+        const GeometryPath& pathB)
+    {
+        if (pathA.maxX < pathB.minX or pathA.minX > pathB.maxX or
+            pathA.maxY < pathB.minY or pathA.minY > pathB.maxY)
+        {
+            return false;
+        }
+        // vectorize over the longer of the two paths
+        const GeometryPath& outer = (pathA.GetNumSegments() <= 
+            pathB.GetNumSegments()) ? pathA : pathB;
+        const GeometryPath& inner = (&outer == &pathA) ? pathB : pathA;
+        
+        for (uint i = 0; i < outer.GetNumSegments(); i++)
+        {
+            if (GeometrySegmentIntersectsPath(inner, 
+                outer.x[i], outer.y[i], outer.x[i+1], outer.y[i+1]))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    /**
+     * @brief Gets the distance between two points.
+     * @return distance rounded to the nearest pixel, as per GeosPoint.
+     */
+    inline uint GeometryPointDistance(double x1, double y1, double x2, double y2)
+    {
+        return (uint)round(sqrt((x2-x1)*(x2-x1) + (y2-y1)*(y2-y1)));
+    }
+    
+    /**
+     * @brief Gets the distance between two rectangles, 0 if they intersect.
+     * @return distance rounded to the nearest pixel, as per GeosRectangle.
+     */
+    inline uint GeometryRectDistance(const NvOSD_RectParams& rectA, 
+        const NvOSD_RectParams& rectB)
+    {
+        double dx = std::max(0.0, std::max(
+            double(rectA.left) - double(rectB.left + rectB.width),
+            double(rectB.left) - double(rectA.left + rectA.width)));
+        double dy = std::max(0.0, std::max(
+            double(rectA.top) - double(rectB.top + rectB.height),
+            double(rectB.top) - double(rectA.top + rectA.height)));
+        
+        return (uint)round(sqrt(dx*dx + dy*dy));
+    }
+    
+    /**
+     * @brief Tests if two rectangles overlap - their interiors intersect and 
+     * neither contains the other.
+     * @return true if the rectangles overlap, as per GEOSOverlaps.
+     */
+    inline bool GeometryRectsOverlap(const NvOSD_RectParams& rectA, 
+        const NvOSD_RectParams& rectB)
+    {
+        double aRight(double(rectA.left + rectA.width));
+        double aBottom(double(rectA.top + rectA.height));
+        double bRight(double(rectB.left + rectB.width));
+        double bBottom(double(rectB.top + rectB.height));
+        
+        bool interiorsIntersect = (rectA.left < bRight and rectB.left < aRight and
+            rectA.top < bBottom and rectB.top < aBottom);
+            
+        bool aContainsB = (rectB.left >= rectA.left and bRight <= aRight and
+            rectB.top >= rectA.top and bBottom <= aBottom);
+        bool bContainsA = (rectA.left >= rectB.left and aRight <= bRight and
+            rectA.top >= rectB.top and aBottom <= bBottom);
+        
+        return (interiorsIntersect and !aContainsB and !bContainsA);
+    }
+    
+    /**
+     * @struct GeometryBox
+     * @brief Axis aligned bounding box, used by the GeometryGrid.
+     */
+    struct GeometryBox
+    {
+        double minX, minY, maxX, maxY;
+    };
+    
+    /**
+     * @brief Tests if two bounding boxes intersect, including touching.
+     */
+    inline bool GeometryBoxesIntersect(const GeometryBox& boxA, 
+        const GeometryBox& boxB)
+    {
+        return (boxA.minX <= boxB.maxX and boxB.minX <= boxA.maxX and
+            boxA.minY <= boxB.maxY and boxB.minY <= boxA.maxY);
+    }
+    
+    /**
+     * @class GeometryGrid
+     * @file DslGeometry.h
+     * @brief Uniform grid broad phase over a set of bounding boxes. The grid 
+     * is rebuilt once per frame, with each box indexed in every cell it spans, 
+     * and queried for the boxes that intersect a given box. Cells are stored 
+     * contiguously (counting sort), and all storage is reused between builds.
+     */
+    class GeometryGrid
+    {
+    public:
+    
+        GeometryGrid()
+            : m_cols(0)
+            , m_rows(0)
+            , m_cellSize(1)
+            , m_originX(0)
+            , m_originY(0)
+            , m_stamp(0)
+        {};
+        
+        /**
+         * @brief Builds the grid for a set of boxes. The cell size is the 
+         * larger of the average box dimension and the size that gives one cell
+         * per box over the extent of all boxes, with the number of cells 
+         * limited to a small multiple of the number of boxes.
+         * @param[in] boxes boxes to index, copied into the grid.
+         */
+        void Build(const std::vector<GeometryBox>& boxes)
+        {
+            m_boxes = boxes;
+            m_cols = m_rows = 0;
+            if (m_boxes.empty())
+            {
+                return;
+            }
+            GeometryBox extent = m_boxes[0];
+            double sumDims(0);
+            for (const auto& box: m_boxes)
+            {
+                extent.minX = std::min(extent.minX, box.minX);
+                extent.minY = std::min(extent.minY, box.minY);
+                extent.maxX = std::max(extent.maxX, box.maxX);
+                extent.maxY = std::max(extent.maxY, box.maxY);
+                sumDims += std::max(box.maxX - box.minX, box.maxY - box.minY);
+            }
+            double width(extent.maxX - extent.minX);
+            double height(extent.maxY - extent.minY);
+            
+            m_originX = extent.minX;
+            m_originY = extent.minY;
+            m_cellSize = std::max({1.0, sumDims/m_boxes.size(),
+                sqrt(width*height/m_boxes.size())});
+                
+            size_t maxCells = 4*m_boxes.size() + 16;
+            while ((floor(width/m_cellSize) + 1)*(floor(height/m_cellSize) + 1) 
+                > maxCells)
+            {
+                m_cellSize *= 2;
+            }
+            m_cols = (uint)(width/m_cellSize) + 1;
+            m_rows = (uint)(height/m_cellSize) + 1;
+
+            // count the boxes in each cell, then convert the counts to the 
+            // start of each cell's range of indices.
+            m_cellStarts.assign((size_t)m_cols*m_rows + 1, 0);
+            for (const auto& box: m_boxes)
+            {
+                forEachCell(box, [&](size_t cell){m_cellStarts[cell+1]++;});
+            }
+            for (size_t cell = 1; cell < m_cellStarts.size(); cell++)
+            {
+                m_cellStarts[cell] += m_cellStarts[cell-1];
+            }
+            m_cellIndices.resize(m_cellStarts.back());
+            m_cellFill.assign(m_cellStarts.begin(), m_cellStarts.end()-1);
+            for (uint i = 0; i < m_boxes.size(); i++)
+            {
+                forEachCell(m_boxes[i], 
+                    [&](size_t cell){m_cellIndices[m_cellFill[cell]++] = i;});
+            }
+            m_stamps.assign(m_boxes.size(), m_stamp);
+        };
+        
+        /**
+         * @brief Gets the indices of all boxes that intersect a given box.
+         * @param[in] box box to query.
+         * @param[out] indices cleared and filled with the indices, in 
+         * ascending order, of all intersecting boxes.
+         */
+        void Query(const GeometryBox& box, std::vector<uint>& indices)
+        {
+            indices.clear();
+            if (m_boxes.empty())
+            {
+                return;
+            }
+            // a box may be indexed in many cells, so each query stamps the
+            // boxes it has tested to avoid testing and adding them twice.
+            if (++m_stamp == 0)
+            {
+                m_stamps.assign(m_boxes.size(), 0);
+                m_stamp = 1;
+            }
+            forEachCell(box, [&](size_t cell)
+            {
+                for (uint i = m_cellStarts[cell]; i < m_cellStarts[cell+1]; i++)
+                {
+                    uint index = m_cellIndices[i];
+                    if (m_stamps[index] != m_stamp)
+                    {
+                        m_stamps[index] = m_stamp;
+                        if (GeometryBoxesIntersect(box, m_boxes[index]))
+                        {
+                            indices.push_back(index);
+                        }
+                    }
+                }
+            });
+            std::sort(indices.begin(), indices.end());
+        };
+        
+    private:
+    
+        /**
+         * @brief Calls a function for each cell a box spans, clamped to the
+         * grid. Boxes outside of the grid span only the nearest edge cells.
+         */
+        template<typename Function>
+        void forEachCell(const GeometryBox& box, Function function)
+        {
+            uint col0 = getCell(box.minX, m_originX, m_cols);
+            uint col1 = getCell(box.maxX, m_originX, m_cols);
+            uint row0 = getCell(box.minY, m_originY, m_rows);
+            uint row1 = getCell(box.maxY, m_originY, m_rows);
+            
+            for (uint row = row0; row <= row1; row++)
+            {
+                for (uint col = col0; col <= col1; col++)
+                {
+                    function((size_t)row*m_cols + col);
+                }
+            }
+        };
+        
+        uint getCell(double value, double origin, uint numCells)
+        {
+            double cell = floor((value - origin)/m_cellSize);
+            
+            return (cell < 0) ? 0 : (cell >= numCells) ? numCells-1 : (uint)cell;
+        };
+        
+        /**
+         * @brief number of columns and rows in the grid.
+         */
+        uint m_cols, m_rows;
+        
+        /**
+         * @brief width and height of each cell.
+         */
+        double m_cellSize;
+        
+        /**
+         * @brief coordinates of the top-left corner of the first cell.
+         */
+        double m_originX, m_originY;
+        
+        /**
+         * @brief boxes indexed by the grid.
+         */
+        std::vector<GeometryBox> m_boxes;
+        
+        /**
+         * @brief start of each cell's range in m_cellIndices, with an extra
+         * entry for the end of the last cell.
+         */
+        std::vector<uint> m_cellStarts;
+        
+        /**
+         * @brief next free position for each cell while building.
+         */
+        std::vector<uint> m_cellFill;
+        
+        /**
+         * @brief box indices for all cells, stored contiguously by cell.
+         */
+        std::vector<uint> m_cellIndices;
+        
+        /**
+         * @brief query stamp for each box, used to avoid duplicates.
+         */
+        std::vector<uint> m_stamps;
+        
+        /**
+         * @brief current query stamp.
+         */
+        uint m_stamp;
+    };
+}
+
+#endif // _DSL_GEOMETRY_H
@@ -458,6 +458,51 @@ namespace DSL
 
     //******************************************************************************
     
+    PreparedPolygon::PreparedPolygon(const dsl_polygon_params& polygon)
+        : m_geosPolygon(polygon)
+        , m_ring(polygon.coordinates, polygon.num_coordinates, true)
+        , m_edges(polygon.coordinates, polygon.num_coordinates, false)
+    {
+        // Don't log function entry/exit
+    }
+    
+    bool PreparedPolygon::IsOutsideBounds(const NvOSD_RectParams& rectangle)
+    {
+        // Don't log function entry/exit
+        
+        return (rectangle.left + rectangle.width < m_ring.minX or
+            rectangle.left > m_ring.maxX or
+            rectangle.top + rectangle.height < m_ring.minY or
+            rectangle.top > m_ring.maxY);
+    }
+    
+    bool PreparedPolygon::IsOutsideBounds(uint x, uint y, uint margin)
+    {
+        // Don't log function entry/exit
+        
+        return (double(x) + margin < m_ring.minX or 
+            double(x) > m_ring.maxX + margin or
+            double(y) + margin < m_ring.minY or 
+            double(y) > m_ring.maxY + margin);
+    }
+    
+    bool PreparedPolygon::IsNearEdge(uint x, uint y, uint distance)
+    {
+        // Don't log function entry/exit
+        
+        return (m_edges.GetNumSegments() and 
+            GeometryPointToPathDistance(m_edges, x, y) <= distance);
+    }
+    
+    bool PreparedPolygon::Contains(uint x, uint y)
+    {
+        // Don't log function entry/exit
+        
+        return (GeometryPointLocation(m_ring, x, y) == DSL_GEOMETRY_INTERIOR);
+    }
+
+    //******************************************************************************
+    
     GeosMultiLine::GeosMultiLine(const dsl_multi_line_params& multiLine)
         : m_pGeosMultiLine(NULL)
     {
@@ -27,6 +27,7 @@ THE SOFTWARE.
 
 #include "Dsl.h"
 #include "DslDisplayTypes.h"
+#include "DslGeometry.h"
 
 namespace DSL
 {
@@ -223,6 +224,81 @@ namespace DSL
 
     };
 
+    /**
+     * @class PreparedPolygon
+     * @file DslGeosTypes.h
+     * @brief Implements a pre-computed Polygon - edge paths, bounding box, and 
+     * GEOS Polygon - built once for a DSL Polygon Structure and reused for 
+     * each test. Point and path tests use the DslGeometry.h kernels; GEOS is 
+     * only used for Polygon-to-Polygon tests.
+     */
+    class PreparedPolygon
+    {
+    public: 
+
+        /**
+         * @brief ctor for the PreparedPolygon class
+         * @param[in] polygon reference to a DSL Polygon Structure.
+         */
+        PreparedPolygon(const dsl_polygon_params& polygon);
+
+        /**
+         * @brief function to determine if a rectangle is clearly outside of
+         * the Polygon's bounding box, i.e. the rectangle can neither overlap 
+         * nor contain the Polygon.
+         * @param[in] rectangle rectangle to test.
+         * @return true if the rectangle is outside of the bounding box.
+         */
+        bool IsOutsideBounds(const NvOSD_RectParams& rectangle);
+
+        /**
+         * @brief function to determine if a point is clearly outside of the
+         * Polygon's bounding box expanded by a given margin.
+         * @param[in] x x coordinate of the point to test.
+         * @param[in] y y coordinate of the point to test.
+         * @param[in] margin distance to expand the bounding box by in pixels.
+         * @return true if the point is outside of the expanded bounding box.
+         */
+        bool IsOutsideBounds(uint x, uint y, uint margin);
+
+        /**
+         * @brief function to determine if a point is within a given distance
+         * of the Polygon's edges, first-to-last coordinate, excluding the 
+         * closing edge from last-to-first, as used for line-width tests. 
+         * The distance is rounded as per GeosLine::Distance.
+         * @param[in] x x coordinate of the point.
+         * @param[in] y y coordinate of the point.
+         * @param[in] distance max distance from an edge in pixels.
+         * @return true if the point is within distance of an edge. 
+         */
+        bool IsNearEdge(uint x, uint y, uint distance);
+
+        /**
+         * @brief function to determine if the Polygon contains a point.
+         * As with GeosPolygon::Contains, points on the border are not contained.
+         * @param[in] x x coordinate of the point to test.
+         * @param[in] y y coordinate of the point to test.
+         * @return true if the polygon contains the point, false otherwise
+         */
+        bool Contains(uint x, uint y);
+        
+        /**
+         * @brief GEOS Polygon for Polygon-to-Polygon tests, built once.
+         */
+        GeosPolygon m_geosPolygon;
+        
+        /**
+         * @brief closed path of the Polygon's coordinates, i.e. its boundary.
+         */
+        GeometryPath m_ring;
+        
+        /**
+         * @brief open path of the Polygon's coordinates, excluding the closing
+         * edge, used for line-width tests.
+         */
+        GeometryPath m_edges;
+    };
+
     /**
      * @class GeosMultiLine
      * @file DslGeosTypes.h
@@ -0,0 +1,262 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#include "Dsl.h"
+#include "DslJpegEncoderPool.h"
+
+#if (BUILD_WITH_FFMPEG == true) || (BUILD_WITH_OPENCV == true)
+#include "DslAvFile.h"
+#endif
+
+namespace DSL
+{
+    JpegEncoderPool* JpegEncoderPool::GetPool()
+    {
+        static JpegEncoderPool pool(DSL_JPEG_ENCODER_POOL_WORKERS,
+            DSL_JPEG_ENCODER_POOL_QUEUE_SIZE);
+        
+        return &pool;
+    }
+    
+    JpegEncoderPool::JpegEncoderPool(uint numWorkers, uint queueSize)
+        : m_queue(queueSize)
+        , m_queued(0)
+        , m_completed(0)
+        , m_dropped(0)
+        , m_failed(0)
+        , m_flushing(0)
+        , m_stop(false)
+    {
+        LOG_FUNC();
+        
+        for (uint i = 0; i < numWorkers; i++)
+        {
+            m_workers.push_back(std::unique_ptr<JpegEncoderPoolWorker>(
+                new JpegEncoderPoolWorker(this)));
+        }
+        for (const auto &ivec: m_workers)
+        {
+            ivec->pThread = g_thread_new("jpeg-encoder-pool", 
+                jpeg_encoder_pool_thread, ivec.get());
+        }
+    }
+    
+    JpegEncoderPool::~JpegEncoderPool()
+    {
+        LOG_FUNC();
+        
+        m_stop = true;
+        for (const auto &ivec: m_workers)
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&ivec->mutex);
+            g_cond_signal(&ivec->wakeCond);
+        }
+        for (const auto &ivec: m_workers)
+        {
+            g_thread_join(ivec->pThread);
+        }
+    }
+    
+    bool JpegEncoderPool::Queue(JpegEncodeJob* pJob)
+    {
+        LOG_FUNC();
+        
+        if (!m_queue.Push(pJob))
+        {
+            m_dropped++;
+            return false;
+        }
+        m_queued++;
+        
+        // Pairs with the fence in WorkerThread - either a worker sees the 
+        // new job, or we see that it is sleeping and wake it. The flag is
+        // cleared on wake so that a burst is spread over all sleeping workers.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (const auto &ivec: m_workers)
+        {
+            bool sleeping(true);
+            if (ivec->sleeping.compare_exchange_strong(sleeping, false))
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&ivec->mutex);
+                g_cond_signal(&ivec->wakeCond);
+                break;
+            }
+        }
+        return true;
+    }
+    
+    void JpegEncoderPool::Flush()
+    {
+        LOG_FUNC();
+        
+        uint64_t target = m_queued;
+        
+        m_flushing++;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_flushMutex);
+            while (m_completed < target)
+            {
+                g_cond_wait(&m_completedCond, &m_flushMutex);
+            }
+        }
+        m_flushing--;
+    }
+    
+    uint JpegEncoderPool::GetQueueDepth()
+    {
+        LOG_FUNC();
+        
+        uint64_t completed = m_completed;
+        uint64_t queued = m_queued;
+        
+        return (queued > completed) ? queued - completed : 0;
+    }
+    
+    uint64_t JpegEncoderPool::GetDropped()
+    {
+        LOG_FUNC();
+        
+        return m_dropped;
+    }
+    
+    uint64_t JpegEncoderPool::GetEncoded()
+    {
+        LOG_FUNC();
+        
+        return m_completed - m_failed;
+    }
+    
+    uint64_t JpegEncoderPool::GetFailed()
+    {
+        LOG_FUNC();
+        
+        return m_failed;
+    }
+    
+    void JpegEncoderPool::encodeJob(JpegEncoderPoolWorker* pWorker, 
+        JpegEncodeJob* pJob)
+    {
+        LOG_FUNC();
+
+#if (BUILD_WITH_FFMPEG == true) || (BUILD_WITH_OPENCV == true)
+        // Find the worker's encoder for this resolution, moving it to the
+        // front of the list as most recently used.
+        std::shared_ptr<AvJpgEncoder> pEncoder;
+        for (auto ilist = pWorker->encoders.begin(); 
+            ilist != pWorker->encoders.end(); ilist++)
+        {
+            if ((*ilist)->GetWidth() == pJob->width and 
+                (*ilist)->GetHeight() == pJob->height)
+            {
+                pEncoder = *ilist;
+                pWorker->encoders.erase(ilist);
+                break;
+            }
+        }
+        try
+        {
+            if (!pEncoder)
+            {
+                LOG_INFO("Creating new JPEG encoder for resolution " 
+                    << pJob->width << "x" << pJob->height);
+                pEncoder = std::shared_ptr<AvJpgEncoder>(
+                    new AvJpgEncoder(pJob->width, pJob->height));
+            }
+            pWorker->encoders.push_front(pEncoder);
+            if (pWorker->encoders.size() > DSL_JPEG_ENCODER_POOL_MAX_ENCODERS)
+            {
+                pWorker->encoders.pop_back();
+            }
+            pJob->succeeded = pEncoder->Encode(pJob->pImage, 
+                pJob->pitch, pJob->filespec.c_str());
+        }
+        catch(...)
+        {
+            LOG_ERROR("Failed to create JPEG encoder for resolution "
+                << pJob->width << "x" << pJob->height);
+            pJob->succeeded = false;
+        }
+#else
+        // No encoder built in - the job completes without writing a file. 
+        pJob->succeeded = true;
+#endif
+        if (!pJob->succeeded)
+        {
+            m_failed++;
+        }
+        pJob->HandleEncodeComplete();
+        delete pJob;
+        
+        m_completed++;
+        if (m_flushing)
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_flushMutex);
+            g_cond_broadcast(&m_completedCond);
+        }
+    }
+    
+    void JpegEncoderPool::WorkerThread(JpegEncoderPoolWorker* pWorker)
+    {
+        JpegEncodeJob* pJob(NULL);
+        
+        while (true)
+        {
+            while (m_queue.Pop(pJob))
+            {
+                encodeJob(pWorker, pJob);
+            }
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&pWorker->mutex);
+            
+            pWorker->sleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            
+            // Re-check once flagged as sleeping, as a producer that pushed 
+            // before seeing the flag will not signal.
+            if (m_queue.GetSize())
+            {
+                pWorker->sleeping = false;
+                continue;
+            }
+            if (m_stop)
+            {
+                break;
+            }
+            g_cond_wait(&pWorker->wakeCond, &pWorker->mutex);
+            pWorker->sleeping = false;
+        }
+        // Free the encoders on the thread that used them.
+        pWorker->encoders.clear();
+    }
+
+    static gpointer jpeg_encoder_pool_thread(gpointer pWorker)
+    {
+        JpegEncoderPoolWorker* pPoolWorker = 
+            static_cast<JpegEncoderPoolWorker*>(pWorker);
+        pPoolWorker->pPool->WorkerThread(pPoolWorker);
+        
+        return NULL;
+    }
+}
@@ -0,0 +1,265 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_JPEG_ENCODER_POOL_H
+#define _DSL_JPEG_ENCODER_POOL_H
+
+#include "Dsl.h"
+#include "DslBoundedQueue.h"
+
+namespace DSL
+{
+    /**
+     * @brief number of worker threads encoding JPEG images.
+     */
+    #define DSL_JPEG_ENCODER_POOL_WORKERS                               2
+    
+    /**
+     * @brief maximum number of encode jobs pending for all workers. Jobs 
+     * queued when full are dropped and counted.
+     */
+    #define DSL_JPEG_ENCODER_POOL_QUEUE_SIZE                            64
+    
+    /**
+     * @brief maximum number of encoders, one per resolution, kept alive by 
+     * each worker. The least recently used encoder is freed when exceeded.
+     */
+    #define DSL_JPEG_ENCODER_POOL_MAX_ENCODERS                          4
+    
+    // forward declaration - see DslAvFile.h
+    class AvJpgEncoder;
+    
+    /**
+     * @struct JpegEncodeJob
+     * @brief Abstract RGBA image to be encoded to a JPEG file by the 
+     * JPEG Encoder Pool. The derived class owns the image memory, which 
+     * must remain valid until HandleEncodeComplete is called.
+     */
+    struct JpegEncodeJob
+    {
+        JpegEncodeJob(const uint8_t* pImage, uint width, uint height, 
+            uint pitch, const std::string& filespec)
+            : pImage(pImage)
+            , width(width)
+            , height(height)
+            , pitch(pitch)
+            , filespec(filespec)
+            , succeeded(false)
+        {};
+        
+        virtual ~JpegEncodeJob(){};
+        
+        /**
+         * @brief Called by the worker thread once the image has been 
+         * encoded, or has failed to encode. The job is deleted on return.
+         */
+        virtual void HandleEncodeComplete() = 0;
+        
+        /**
+         * @brief pointer to the first pixel of the RGBA image.
+         */
+        const uint8_t* pImage;
+        
+        /**
+         * @brief dimensions of the image in pixels.
+         */
+        uint width;
+        uint height;
+        
+        /**
+         * @brief size of each line of the image in bytes.
+         */
+        uint pitch;
+        
+        /**
+         * @brief path for the JPEG file to write.
+         */
+        std::string filespec;
+        
+        /**
+         * @brief set by the worker thread if the file was written successfully.
+         */
+        bool succeeded;
+    };
+    
+    class JpegEncoderPool;
+    
+    /**
+     * @struct JpegEncoderPoolWorker
+     * @brief Single worker thread of the JPEG Encoder Pool with its own 
+     * cache of long-lived encoders.
+     */
+    struct JpegEncoderPoolWorker
+    {
+        JpegEncoderPoolWorker(JpegEncoderPool* pParent)
+            : pPool(pParent)
+            , sleeping(false)
+            , pThread(NULL)
+        {};
+        
+        /**
+         * @brief pool that owns the worker.
+         */
+        JpegEncoderPool* pPool;
+        
+        /**
+         * @brief encoders owned by this worker, most recently used first.
+         */
+        std::list<std::shared_ptr<AvJpgEncoder>> encoders;
+        
+        /**
+         * @brief true while the worker is, or is about to be, waiting on
+         * wakeCond. Producers only take the worker's mutex to wake it.
+         */
+        std::atomic<bool> sleeping;
+        
+        /**
+         * @brief mutex and condition to wake the worker.
+         */
+        DslMutex mutex;
+        DslCond wakeCond;
+        
+        /**
+         * @brief the worker's thread.
+         */
+        GThread* pThread;
+    };
+    
+    /**
+     * @class JpegEncoderPool
+     * @brief Bounded pool of worker threads that encode RGBA images to JPEG
+     * files off of the main loop. Each worker keeps its encoder, with its 
+     * codec and scale contexts, alive per resolution. Queuing never waits 
+     * on a busy worker.
+     */
+    class JpegEncoderPool
+    {
+    public:
+    
+        /**
+         * @brief Gets the process-wide pool, starting its workers on first call.
+         */
+        static JpegEncoderPool* GetPool();
+        
+        /**
+         * @brief ctor for the JpegEncoderPool class.
+         * @param[in] numWorkers number of worker threads to start.
+         * @param[in] queueSize maximum number of jobs pending for all workers.
+         */
+        JpegEncoderPool(uint numWorkers, uint queueSize);
+        
+        ~JpegEncoderPool();
+        
+        /**
+         * @brief Queues a job to be encoded by a worker thread.
+         * @param[in] pJob job to queue. Ownership is taken on success only.
+         * @return true on success, false if the queue is full.
+         */
+        bool Queue(JpegEncodeJob* pJob);
+        
+        /**
+         * @brief Blocks until all jobs queued before the call have completed.
+         */
+        void Flush();
+        
+        /**
+         * @brief Gets the number of jobs queued or being encoded.
+         */
+        uint GetQueueDepth();
+        
+        /**
+         * @brief Gets the number of jobs dropped because the queue was full.
+         */
+        uint64_t GetDropped();
+        
+        /**
+         * @brief Gets the number of jobs encoded successfully.
+         */
+        uint64_t GetEncoded();
+        
+        /**
+         * @brief Gets the number of jobs that failed to encode.
+         */
+        uint64_t GetFailed();
+        
+        /**
+         * @brief Worker thread function. ** To be called by the worker threads only **.
+         * @param[in] pWorker the calling worker.
+         */
+        void WorkerThread(JpegEncoderPoolWorker* pWorker);
+        
+    private:
+    
+        /**
+         * @brief encodes a single job, notifies the job, and frees it.
+         */
+        void encodeJob(JpegEncoderPoolWorker* pWorker, JpegEncodeJob* pJob);
+        
+        /**
+         * @brief jobs pending for all workers.
+         */
+        BoundedQueue<JpegEncodeJob*> m_queue;
+        
+        /**
+         * @brief workers created on construction.
+         */
+        std::vector<std::unique_ptr<JpegEncoderPoolWorker>> m_workers;
+        
+        /**
+         * @brief running counts of jobs queued, completed, dropped, and failed.
+         */
+        std::atomic<uint64_t> m_queued;
+        std::atomic<uint64_t> m_completed;
+        std::atomic<uint64_t> m_dropped;
+        std::atomic<uint64_t> m_failed;
+        
+        /**
+         * @brief number of threads waiting in Flush.
+         */
+        std::atomic<uint> m_flushing;
+        
+        /**
+         * @brief mutex and condition to wait on the workers to complete
+         * all queued jobs.
+         */
+        DslMutex m_flushMutex;
+        DslCond m_completedCond;
+        
+        /**
+         * @brief set on destruction to stop all workers once the queue 
+         * is empty.
+         */
+        std::atomic<bool> m_stop;
+    };
+    
+    /**
+     * @brief Thread function to run a JPEG Encoder Pool's worker loop.
+     * @param[in] pWorker pointer to the JpegEncoderPoolWorker to run.
+     * @return NULL always.
+     */
+    static gpointer jpeg_encoder_pool_thread(gpointer pWorker);
+}
+
+#endif // _DSL_JPEG_ENCODER_POOL_H
@@ -25,13 +25,20 @@ THE SOFTWARE.
 #ifndef _DSL_LOG_H
 #define _DSL_LOG_H
 
-inline std::string methodName(const std::string& prettyFunction)
+#include <string_view>
+
+/**
+ * Returns the qualified name of a function, without return type and 
+ * parameters, from its __PRETTY_FUNCTION__. Evaluated at compile time 
+ * when used with __METHOD_NAME__.
+ */
+constexpr std::string_view methodName(std::string_view prettyFunction)
 {
-    size_t colons = prettyFunction.find("::");
-    size_t begin = prettyFunction.substr(0,colons).rfind(" ") + 1;
-    size_t end = prettyFunction.rfind("(") - begin;
+    size_t paren = prettyFunction.find('(');
+    size_t space = prettyFunction.rfind(' ', paren);
+    size_t begin = (space == std::string_view::npos) ? 0 : space + 1;
 
-    return prettyFunction.substr(begin,end) + "()";
+    return prettyFunction.substr(begin, paren - begin);
 }
 
 #define __METHOD_NAME__ methodName(__PRETTY_FUNCTION__)
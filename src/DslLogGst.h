@@ -33,22 +33,51 @@ namespace DSL
 {
 
 /**
- * Logs the Entry and Exit of a Function with the DEBUG level.
- * Add macro as the first statement to each function of interest.
- * Consider the intrussion/penalty of this call when adding.
+ * Returns true if messages at a given level will be emitted for the DSL 
+ * category. Checked before any formatting, so that disabled log statements 
+ * cost no more than a compare and, rarely, a function call.
  */
-#define LOG_FUNC() LogFunc lf(__METHOD_NAME__)
+#define LOG_LEVEL_ENABLED(level) \
+    (G_UNLIKELY((level) <= _gst_debug_min) and \
+        (level) <= gst_debug_category_get_threshold(GST_CAT_DSL))
 
 #define LOG(message, level) \
     do \
     { \
-        std::stringstream logMessage; \
-        logMessage  << " : " << message; \
-        GST_CAT_LEVEL_LOG(GST_CAT_DSL, level, NULL, logMessage.str().c_str(), NULL); \
+        if (LOG_LEVEL_ENABLED(level)) \
+        { \
+            std::stringstream logMessage; \
+            logMessage  << " : " << message; \
+            GST_CAT_LEVEL_LOG(GST_CAT_DSL, level, NULL, "%s", \
+                logMessage.str().c_str()); \
+        } \
     } while (0)
 
+/**
+ * Set BUILD_WITH_DEBUG_LOGS:=false in the Makefile to compile all DEBUG 
+ * level logging, including function entry and exit, out of the library.
+ */
+#if defined(BUILD_WITH_DEBUG_LOGS) && BUILD_WITH_DEBUG_LOGS == false
+
+#define LOG_FUNC()
+
+#define LOG_DEBUG(message) do {} while (0)
+
+#else
+
+/**
+ * Logs the Entry and Exit of a Function with the DEBUG level.
+ * Add macro as the first statement to each function of interest.
+ * The method name is computed at compile time.
+ */
+#define LOG_FUNC() \
+    static constexpr std::string_view logFuncMethodName = __METHOD_NAME__; \
+    LogFunc lf(logFuncMethodName)
+
 #define LOG_DEBUG(message) LOG(message, GST_LEVEL_DEBUG)
 
+#endif // BUILD_WITH_DEBUG_LOGS
+
 #define LOG_INFO(message) LOG(message, GST_LEVEL_INFO)
 
 #define LOG_WARN(message) LOG(message, GST_LEVEL_WARNING)
@@ -62,21 +91,38 @@ namespace DSL
     class LogFunc
     {
     public:
-        LogFunc(const std::string& method) 
+        LogFunc(std::string_view method) 
+            : m_method(method)
+            , m_enabled(LOG_LEVEL_ENABLED(GST_LEVEL_DEBUG))
         {
-            m_logMessage  << method;
-            GST_CAT_LEVEL_LOG(GST_CAT_DSL, GST_LEVEL_DEBUG, NULL, 
-                m_logMessage.str().c_str(), "");
+            if (m_enabled)
+            {
+                GST_CAT_LEVEL_LOG(GST_CAT_DSL, GST_LEVEL_DEBUG, NULL, 
+                    "%.*s()", (int)m_method.size(), m_method.data());
+            }
         };
         
         ~LogFunc()
         {
-            GST_CAT_LEVEL_LOG(GST_CAT_DSL, GST_LEVEL_DEBUG, NULL, 
-                m_logMessage.str().c_str(), "");
+            if (m_enabled)
+            {
+                GST_CAT_LEVEL_LOG(GST_CAT_DSL, GST_LEVEL_DEBUG, NULL, 
+                    "%.*s()", (int)m_method.size(), m_method.data());
+            }
         };
         
     private:
-        std::stringstream m_logMessage; 
+    
+        /**
+         * @brief qualified name of the function logged.
+         */
+        std::string_view m_method; 
+        
+        /**
+         * @brief true if DEBUG was enabled on entry, so that exit is 
+         * logged if and only if entry was.
+         */
+        bool m_enabled;
     };
 
 } // namespace 
@@ -43,7 +43,7 @@ namespace DSL
     }
 
     void OdeAccumulator::HandleOccurrences(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
     {
         for (const auto &imap: m_pOdeActionsIndexed)
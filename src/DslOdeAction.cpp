@@ -25,12 +25,10 @@ THE SOFTWARE.
 #include "DslServices.h"
 #include "DslOdeTrigger.h"
 #include "DslOdeAction.h"
+#include "DslOdeActionExecutor.h"
+#include "DslJpegEncoderPool.h"
 #include "DslDisplayTypes.h"
 
-#if (BUILD_WITH_FFMPEG == true) || (BUILD_WITH_OPENCV == true)
-#include "DslAvFile.h"
-#endif
-
 #define DATE_BUFF_LENGTH 40
 
 namespace DSL
@@ -89,7 +87,7 @@ namespace DSL
     }
 
     void AsyncOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -111,6 +109,100 @@ namespace DSL
         return false;
     }
 
+    // ********************************************************************
+
+    DeferrableOdeAction::DeferrableOdeAction(const char* name) 
+        : OdeAction(name)
+        , m_asyncEnabled(false)
+        , m_asyncQueued(0)
+        , m_asyncDropped(0)
+        , m_asyncDropping(false)
+    {
+        LOG_FUNC();
+    };
+    
+    DeferrableOdeAction::~DeferrableOdeAction()
+    {
+        LOG_FUNC();
+    }
+
+    void DeferrableOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        // No function log - avoid overhead.
+        
+        DSL_ODE_TRIGGER_PTR pTrigger 
+            = std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
+            
+        if (!m_asyncEnabled)
+        {
+            DoHandleOccurrence(pOdeTrigger, pTrigger->s_eventCount, 
+                pTrigger->m_occurrences, pBuffer, displayMetaData.GetFirst(), 
+                pFrameMeta, pObjectMeta);
+            return;
+        }
+        // The event id and occurrences must be captured now, as both will 
+        // have moved on by the time the occurrence is handled.
+        OdeDeferredOccurrence* pOccurrence = new OdeDeferredOccurrence(
+            std::static_pointer_cast<DeferrableOdeAction>(shared_from_this()),
+            pOdeTrigger, pTrigger->s_eventCount, pTrigger->m_occurrences,
+            pFrameMeta, pObjectMeta);
+            
+        if (OdeActionExecutor::GetExecutor()->Queue(pOccurrence))
+        {
+            m_asyncQueued++;
+            
+            // A successful queue ends the current run of dropped occurrences.
+            if (m_asyncDropping.load(std::memory_order_relaxed))
+            {
+                m_asyncDropping = false;
+            }
+            return;
+        }
+        delete pOccurrence;
+        m_asyncDropped++;
+        
+        // Only log the first of each run of dropped occurrences.
+        if (!m_asyncDropping.exchange(true))
+        {
+            LOG_WARN("ODE Action Executor queue full - dropping occurrences for '"
+                << GetName() << "', total dropped = " << m_asyncDropped);
+        }
+    }
+
+    void DeferrableOdeAction::HandleDeferredOccurrence(
+        OdeDeferredOccurrence& occurrence)
+    {
+        // No function log - avoid overhead.
+        
+        DoHandleOccurrence(occurrence.pOdeTrigger, occurrence.eventId,
+            occurrence.occurrences, NULL, NULL, &occurrence.frameMeta,
+            (occurrence.isObjectOccurrence) ? &occurrence.objectMeta : NULL);
+    }
+    
+    bool DeferrableOdeAction::GetAsyncEnabled()
+    {
+        LOG_FUNC();
+        
+        return m_asyncEnabled;
+    }
+    
+    void DeferrableOdeAction::SetAsyncEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        
+        m_asyncEnabled = enabled;
+    }
+    
+    void DeferrableOdeAction::GetAsyncStats(uint64_t* queued, uint64_t* dropped)
+    {
+        LOG_FUNC();
+        
+        *queued = m_asyncQueued;
+        *dropped = m_asyncDropped;
+    }
+
 
     // ********************************************************************
 
@@ -131,7 +223,7 @@ namespace DSL
     }
 
     void FormatBBoxOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -179,7 +271,7 @@ namespace DSL
     }
 
     void ScaleBBoxOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -264,7 +356,7 @@ namespace DSL
     }
 
     void StyleBBoxCornersOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -370,7 +462,7 @@ namespace DSL
     }
 
     void StyleBBoxCrosshairOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -438,7 +530,7 @@ namespace DSL
 
     CustomOdeAction::CustomOdeAction(const char* name, 
         dsl_ode_handle_occurrence_cb clientHandler, void* clientData)
-        : OdeAction(name)
+        : DeferrableOdeAction(name)
         , m_clientHandler(clientHandler)
         , m_clientData(clientData)
     {
@@ -450,9 +542,10 @@ namespace DSL
         LOG_FUNC();
     }
     
-    void CustomOdeAction::HandleOccurrence(DSL_BASE_PTR pBase, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
-        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    void CustomOdeAction::DoHandleOccurrence(DSL_BASE_PTR pBase, 
+        uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+        NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
@@ -462,14 +555,9 @@ namespace DSL
         }
         try
         {
-            NvDsDisplayMeta* pDisplayMeta(NULL);
-            if (displayMetaData.size())
-            {
-                pDisplayMeta = displayMetaData.at(0);
-            }
             DSL_ODE_TRIGGER_PTR pTrigger 
                 = std::dynamic_pointer_cast<OdeTrigger>(pBase);
-            m_clientHandler(pTrigger->s_eventCount, pTrigger->m_wName.c_str(), 
+            m_clientHandler(eventId, pTrigger->m_wName.c_str(), 
                 pBuffer, pDisplayMeta, pFrameMeta, pObjectMeta, m_clientData);
         }
         catch(...)
@@ -488,8 +576,46 @@ namespace DSL
     {
         CaptureOdeAction* pCaptureAction = (CaptureOdeAction*)client_data;
         
-        return pCaptureAction->convertCapturedImage();
+        return pCaptureAction->notifyEncodedImage();
     }
+    
+    /**
+     * @struct CaptureEncodeJob
+     * @brief JPEG Encode Job for a captured image. The job holds a reference
+     * to the mapped buffer-surface, and to the Action to notify, until the
+     * image has been encoded.
+     */
+    struct CaptureEncodeJob : public JpegEncodeJob
+    {
+        CaptureEncodeJob(std::shared_ptr<CaptureOdeAction> pAction,
+            std::shared_ptr<DslBufferSurface> pBufferSurface,
+            const std::string& filespec)
+            : JpegEncodeJob(
+                (uint8_t*)(&(*pBufferSurface))->surfaceList[0].mappedAddr.addr[0] +
+                    (&(*pBufferSurface))->surfaceList[0].planeParams.offset[0],
+                (&(*pBufferSurface))->surfaceList[0].width,
+                (&(*pBufferSurface))->surfaceList[0].height,
+                (&(*pBufferSurface))->surfaceList[0].planeParams.pitch[0],
+                filespec)
+            , pAction(pAction)
+            , pBufferSurface(pBufferSurface)
+        {};
+        
+        void HandleEncodeComplete()
+        {
+            pAction->queueEncodedImage(pBufferSurface, filespec, succeeded);
+        };
+        
+        /**
+         * @brief Capture Action to notify on encode complete.
+         */
+        std::shared_ptr<CaptureOdeAction> pAction;
+        
+        /**
+         * @brief mapped buffer-surface holding the image to encode.
+         */
+        std::shared_ptr<DslBufferSurface> pBufferSurface;
+    };
 
     CaptureOdeAction::CaptureOdeAction(const char* name, 
         uint captureType, const char* outdir)
@@ -498,6 +624,8 @@ namespace DSL
         , m_cudaDevicePropRead(false)
         , m_captureType(captureType)
         , m_outdir(outdir)
+        , m_pendingImages(0)
+        , m_droppedImages(0)
         , m_idleThreadFunctionId(0)
     {
         LOG_FUNC();
@@ -653,7 +781,7 @@ namespace DSL
     }
     
     void CaptureOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         HandleOccurrence(pBuffer, pFrameMeta, pObjectMeta);
@@ -777,13 +905,70 @@ namespace DSL
         queueCapturedImage(pBufferSurface);
     }
 
+    void CaptureOdeAction::GetQueueStats(uint* queueDepth, uint64_t* dropped)
+    {
+        LOG_FUNC();
+        
+        *queueDepth = m_pendingImages;
+        *dropped = m_droppedImages;
+    }
+
+    std::string CaptureOdeAction::getFileName(
+        std::shared_ptr<DslBufferSurface> pBufferSurface)
+    {
+        // Generate the image file name from the date-time string
+        std::ostringstream fileNameStream;
+        fileNameStream << GetName() << "_" 
+            << std::setw(5) << std::setfill('0') << pBufferSurface->GetUniqueId()
+            << "_" << pBufferSurface->GetDateTimeStr() << ".jpeg";
+            
+        return fileNameStream.str();
+    }
+
     void CaptureOdeAction::queueCapturedImage(
         std::shared_ptr<DslBufferSurface> pBufferSurface)
     {
         LOG_FUNC();
+        
+        // Generate the filespec from the output dir and file name
+        std::string filespec = m_outdir + "/" + getFileName(pBufferSurface);
+        
+        CaptureEncodeJob* pJob = new CaptureEncodeJob(
+            std::static_pointer_cast<CaptureOdeAction>(shared_from_this()),
+            pBufferSurface, filespec);
+
+        // Count as pending first, as the job may complete before Queue returns.
+        m_pendingImages++;
+        if (!JpegEncoderPool::GetPool()->Queue(pJob))
+        {
+            m_pendingImages--;
+            m_droppedImages++;
+            delete pJob;
+            LOG_WARN("JPEG Encoder Pool queue is full - ODE Capture Action '"
+                << GetName() << "' dropped image with id = " 
+                << pBufferSurface->GetUniqueId());
+        }
+    }
+
+    void CaptureOdeAction::queueEncodedImage(
+        std::shared_ptr<DslBufferSurface> pBufferSurface, 
+        const std::string& filespec, bool succeeded)
+    {
+        LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_captureQueueMutex);
         
-        m_pBufferSurfaces.push(pBufferSurface);
+        m_pendingImages--;
+        
+        if (!succeeded)
+        {
+            LOG_ERROR("ODE Capture Action '" << GetName() 
+                << "' failed to save JPEG Image with id = " 
+                << pBufferSurface->GetUniqueId());
+            return;
+        }
+        LOG_INFO("Saved JPEG Image with id = " << pBufferSurface->GetUniqueId());
+        
+        m_encodedImages.push(std::make_pair(pBufferSurface, filespec));
         
         if (!m_idleThreadFunctionId)
         {
@@ -792,18 +977,20 @@ namespace DSL
         }
     }
 
-    int CaptureOdeAction::convertCapturedImage()
+    int CaptureOdeAction::notifyEncodedImage()
     {
         LOG_FUNC();
         
-        // New shared pointer to assign to the image at the front of the queue.
+        // New shared pointer to assign to the image at the front of the queue,
+        // and the filespec of the JPEG file written by the Encoder Pool.
         std::shared_ptr<DslBufferSurface> pBufferSurface;
+        std::string filespec;
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_captureQueueMutex);
             
             // There should always be at least one image queued if this
             // thread is running - but need to check before dequing
-            if (!m_pBufferSurfaces.size())
+            if (!m_encodedImages.size())
             {
                 LOG_ERROR("Buffer-Surface queue is empty");
                 m_idleThreadFunctionId = 0;
@@ -811,38 +998,17 @@ namespace DSL
             }
             
             // Set the pointer to the head object and pop it off
-            pBufferSurface = m_pBufferSurfaces.front();
-            m_pBufferSurfaces.pop();
+            pBufferSurface = m_encodedImages.front().first;
+            filespec.swap(m_encodedImages.front().second);
+            m_encodedImages.pop();
         }
         
         // Get the dimensions and data size of the mono-surface
         uint bufferWidth = (&(*pBufferSurface))->surfaceList[0].width;
         uint bufferHeight = (&(*pBufferSurface))->surfaceList[0].height;
         
-        // Generate the image file name from the date-time string
-        std::ostringstream fileNameStream;
-        fileNameStream << GetName() << "_" 
-            << std::setw(5) << std::setfill('0') << pBufferSurface->GetUniqueId()
-            << "_" << pBufferSurface->GetDateTimeStr() << ".jpeg";
-            
-        // Generate the filespec from the output dir and file name
-        std::string filespec = m_outdir + "/" + 
-            fileNameStream.str();
-
-        // Try to convert and save the image to a JPEG file. 
-        try
-        {
-#if (BUILD_WITH_FFMPEG == true) || (BUILD_WITH_OPENCV == true)
-            AvJpgOutputFile avJpgOutFile(pBufferSurface, 
-                filespec.c_str());
-#endif                
-        }
-        catch(...)
-        {
-            m_idleThreadFunctionId = 0;
-            return FALSE;
-        }
-        LOG_INFO("Saved JPEG Image with id = " << pBufferSurface->GetUniqueId());
+        // The JPEG file name, without the output directory
+        std::string fileName = filespec.substr(filespec.rfind('/') + 1);
 
         // Create scope to lock the child-container mutex
         {
@@ -882,8 +1048,6 @@ namespace DSL
 
                 info.capture_id = pBufferSurface->GetUniqueId();
                 
-                std::string fileName = fileNameStream.str();
-                
                 // convert the filename and dirpath to wchar string types 
                 // i.e the client's format.
                 std::wstring wstrFilename(fileName.begin(), fileName.end());
@@ -917,7 +1081,7 @@ namespace DSL
                 body.push_back(std::string("Action     : " 
                     + GetName() + "<br>"));
                 body.push_back(std::string("File Name  : " 
-                    + fileNameStream.str() + "<br>"));
+                    + fileName + "<br>"));
                 body.push_back(std::string("Location   : " 
                     + m_outdir + "<br>"));
                 body.push_back(std::string("Capture Id : " 
@@ -944,7 +1108,7 @@ namespace DSL
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_captureQueueMutex);
 
         // If there are more buffer-surfaces to convert, return true to reschedule.
-        if (m_pBufferSurfaces.size())
+        if (m_encodedImages.size())
         {
             return TRUE;
         }
@@ -969,7 +1133,7 @@ namespace DSL
     }
     
     void DisableHandlerOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -1012,7 +1176,7 @@ namespace DSL
     }
 
     void CustomizeLabelOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-    GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+    GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
     NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -1096,35 +1260,20 @@ namespace DSL
     }
 
     void DisplayOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
-        if (m_enabled and displayMetaData.size())
+        if (m_enabled)
         {
-            DSL_ODE_TRIGGER_PTR pTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
-
             // check to see if we're adding meta data - client can disable
             // by setting the PPH ODE display meta alloc size to 0.
-            // and ensure we have available space in the vector of meta structs.
-            NvDsDisplayMeta* pDisplayMeta(NULL);
-            for (const auto& ivec: displayMetaData)
-            {
-                if (ivec->num_labels < MAX_ELEMENTS_IN_DISPLAY_META)
-                {
-                    pDisplayMeta = ivec;
-                    break;
-                }
-            }
-            if (!pDisplayMeta)
+            NvOSD_TextParams *pTextParams = displayMetaData.AcquireLabel();
+            if (!pTextParams)
             {
                 return;
             }
-            
-            NvOSD_TextParams *pTextParams = 
-                &displayMetaData.at(0)->text_params[pDisplayMeta->num_labels++];
             pTextParams->display_text = (gchar*) g_malloc0(MAX_DISPLAY_LEN);
             
             std::string text(m_formatString.c_str());
@@ -1188,8 +1337,6 @@ namespace DSL
             // Text background color
             pTextParams->set_bg_clr = m_hasBgColor;
             pTextParams->text_bg_clr = *m_pBgColor;
-            
-            nvds_add_display_meta_to_frame(pFrameMeta, displayMetaData.at(0));
         }
     }
     
@@ -1197,7 +1344,7 @@ namespace DSL
 
     EmailOdeAction::EmailOdeAction(const char* name, 
         DSL_BASE_PTR pMailer, const char* subject)
-        : OdeAction(name)
+        : DeferrableOdeAction(name)
         , m_pMailer(pMailer)
         , m_subject(subject)
     {
@@ -1209,9 +1356,10 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void EmailOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
-        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    void EmailOdeAction::DoHandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+        uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+        NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
@@ -1225,7 +1373,7 @@ namespace DSL
             body.push_back(std::string("Trigger Name        : " 
                 + pTrigger->GetName() + "<br>"));
             body.push_back(std::string("  Unique ODE Id     : " 
-                + std::to_string(pTrigger->s_eventCount) + "<br>"));
+                + std::to_string(eventId) + "<br>"));
             body.push_back(std::string("  NTP Timestamp     : " 
                 +  Ntp2Str(pFrameMeta->ntp_timestamp) + "<br>"));
             body.push_back(std::string("  Source Data       : ------------------------<br>"));
@@ -1251,7 +1399,7 @@ namespace DSL
                 +  std::to_string(pFrameMeta->source_frame_height) + "<br>"));
             body.push_back(std::string("  Object Data       : ------------------------<br>"));
             body.push_back(std::string("    Occurrences     : " 
-                +  std::to_string(pTrigger->m_occurrences) + "<br>"));
+                +  std::to_string(occurrences) + "<br>"));
 
             if (pObjectMeta)
             {
@@ -1367,47 +1515,88 @@ namespace DSL
 
     FileOdeAction::FileOdeAction(const char* name,
         const char* filePath, uint mode, bool forceFlush)
-        : OdeAction(name)
+        : DeferrableOdeAction(name)
         , m_filePath(filePath)
         , m_mode(mode)
         , m_forceFlush(forceFlush)
-        , m_flushThreadFunctionId(0)
     {
         LOG_FUNC();
     }
 
     FileOdeAction::~FileOdeAction()
+    {
+        LOG_FUNC();
+    }
+    
+    void FileOdeAction::openWriter(const std::string& header, 
+        bool timestampHeader)
     {
         LOG_FUNC();
         
-        if (!m_ostream.is_open())
+        try
         {
-            return;
+            m_pFileWriter = std::unique_ptr<FileWriter>(
+                new FileWriter(m_filePath.c_str(), m_mode, 
+                    header, timestampHeader));
         }
-        
-        if (m_flushThreadFunctionId)
+        catch(...) 
         {
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_ostreamMutex);
-            g_source_remove(m_flushThreadFunctionId);
+            LOG_ERROR("New FileOdeAction '" << GetName() << "' failed to open");
+            throw;
         }
-            
-        m_ostream.close();
     }
     
-    bool FileOdeAction::Flush()
+    void FileOdeAction::Flush()
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_ostreamMutex);
+        LOG_FUNC();
         
-        m_ostream.flush();
+        m_pFileWriter->Sync();
+    }
+    
+    void FileOdeAction::GetRotation(uint* maxSize, uint* maxAge)
+    {
+        LOG_FUNC();
         
-        // end the thread
-        m_flushThreadFunctionId = 0;
-        return false;
+        uint64_t maxSizeBytes(0);
+        m_pFileWriter->GetRotation(&maxSizeBytes, maxAge);
+        *maxSize = maxSizeBytes/1024;
     }
-
-    static gboolean FileActionFlush(gpointer pAction)
+    
+    void FileOdeAction::SetRotation(uint maxSize, uint maxAge)
+    {
+        LOG_FUNC();
+        
+        m_pFileWriter->SetRotation((uint64_t)maxSize*1024, maxAge);
+    }
+    
+    uint FileOdeAction::GetSyncPolicy()
+    {
+        LOG_FUNC();
+        
+        return m_pFileWriter->GetSyncPolicy();
+    }
+    
+    void FileOdeAction::SetSyncPolicy(uint policy)
+    {
+        LOG_FUNC();
+        
+        m_pFileWriter->SetSyncPolicy(policy);
+    }
+    
+    // One format buffer per thread - occurrences are formatted without 
+    // allocating or holding the File Writer's lock.
+    static thread_local FileFormatBuffer formatBuffer;
+    
+    std::ostream& FileOdeAction::beginFormat()
     {
-        return static_cast<FileOdeAction*>(pAction)->Flush();
+        // No function log - avoid overhead.
+        return formatBuffer.Begin();
+    }
+    
+    void FileOdeAction::endFormat()
+    {
+        // No function log - avoid overhead.
+        m_pFileWriter->Write(formatBuffer.GetString(), m_forceFlush);
     }
 
     FileTextOdeAction::FileTextOdeAction(const char* name,
@@ -1416,50 +1605,20 @@ namespace DSL
     {
         LOG_FUNC();
 
-        // determine if new or existing file
-        std::ifstream streamUriFile(filePath);
-        bool fileExists(streamUriFile.good());
-        
-        try
-        {
-            if (m_mode == DSL_WRITE_MODE_APPEND)
-            {
-                m_ostream.open(m_filePath, std::fstream::out | std::fstream::app);
-            }
-            else
-            {
-                m_ostream.open(m_filePath, std::fstream::out | std::fstream::trunc);
-            }
-        }
-        catch(...) 
-        {
-            LOG_ERROR("New FileTextOdeAction '" << name << "' failed to open");
-            throw;
-        }
+        // The header is timestamped by the File Writer, each time a new
+        // file is started on rotation.
+        std::string header;
+        header.append("-------------------------------------------------------------------\n");
+        header.append(" File opened: %a, %d %b %Y %H:%M:%S %z\n");
+        header.append("-------------------------------------------------------------------\n");
     
-        char dateTime[DATE_BUFF_LENGTH] = {0};
-        time_t seconds = time(NULL);
-        struct tm currentTm;
-        localtime_r(&seconds, &currentTm);
-
-        strftime(dateTime, DATE_BUFF_LENGTH, "%a, %d %b %Y %H:%M:%S %z", 
-            &currentTm);
-        std::string dateTimeStr(dateTime);
-        
-        m_ostream << "-------------------------------------------------------------------" << "\n";
-        m_ostream << " File opened: " << dateTimeStr.c_str() << "\n";
-        m_ostream << "-------------------------------------------------------------------" << "\n";
+        openWriter(header, true);
     }
 
     FileTextOdeAction::~FileTextOdeAction()
     {
         LOG_FUNC();
         
-        if (!m_ostream.is_open())
-        {
-            return;
-        }
-        
         char dateTime[DATE_BUFF_LENGTH] = {0};
         time_t seconds = time(NULL);
         struct tm currentTm;
@@ -1468,17 +1627,21 @@ namespace DSL
         strftime(dateTime, DATE_BUFF_LENGTH, "%a, %d %b %Y %H:%M:%S %z", &currentTm);
         std::string dateTimeStr(dateTime);
 
-        m_ostream << "-------------------------------------------------------------------" << "\n";
-        m_ostream << " File closed: " << dateTimeStr.c_str() << "\n";
-        m_ostream << "-------------------------------------------------------------------" << "\n";
+        std::ostream& ostream = beginFormat();
+        
+        ostream << "-------------------------------------------------------------------" << "\n";
+        ostream << " File closed: " << dateTimeStr.c_str() << "\n";
+        ostream << "-------------------------------------------------------------------" << "\n";
+        
+        endFormat();
     }
 
-    void FileTextOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
-        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    void FileTextOdeAction::DoHandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+        uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+        NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_ostreamMutex);
 
         if (!m_enabled)
         {
@@ -1487,104 +1650,102 @@ namespace DSL
         DSL_ODE_TRIGGER_PTR pTrigger = 
             std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
         
-        m_ostream << "Trigger Name        : " << pTrigger->GetName() << "\n";
-        m_ostream << "  Unique ODE Id     : " << pTrigger->s_eventCount << "\n";
-        m_ostream << "  NTP Timestamp     : " << Ntp2Str(pFrameMeta->ntp_timestamp) << "\n";
-        m_ostream << "  Source Data       : ------------------------" << "\n";
+        std::ostream& ostream = beginFormat();
+        
+        ostream << "Trigger Name        : " << pTrigger->GetName() << "\n";
+        ostream << "  Unique ODE Id     : " << eventId << "\n";
+        ostream << "  NTP Timestamp     : " << Ntp2Str(pFrameMeta->ntp_timestamp) << "\n";
+        ostream << "  Source Data       : ------------------------" << "\n";
         if (pFrameMeta->bInferDone)
         {
-            m_ostream << "    Inference       : Yes\n";
+            ostream << "    Inference       : Yes\n";
         }
         else
         {
-            m_ostream << "    Inference       : No\n";
+            ostream << "    Inference       : No\n";
         }
-        m_ostream << "    Source Id       : " << int_to_hex(pFrameMeta->source_id) << "\n";
-        m_ostream << "    Batch Id        : " << pFrameMeta->batch_id << "\n";
-        m_ostream << "    Pad Index       : " << pFrameMeta->pad_index << "\n";
-        m_ostream << "    Frame           : " << pFrameMeta->frame_num << "\n";
-        m_ostream << "    Width           : " << pFrameMeta->source_frame_width << "\n";
-        m_ostream << "    Height          : " << pFrameMeta->source_frame_height << "\n";
-        m_ostream << "  Object Data       : ------------------------" << "\n";
+        ostream << "    Source Id       : " << int_to_hex(pFrameMeta->source_id) << "\n";
+        ostream << "    Batch Id        : " << pFrameMeta->batch_id << "\n";
+        ostream << "    Pad Index       : " << pFrameMeta->pad_index << "\n";
+        ostream << "    Frame           : " << pFrameMeta->frame_num << "\n";
+        ostream << "    Width           : " << pFrameMeta->source_frame_width << "\n";
+        ostream << "    Height          : " << pFrameMeta->source_frame_height << "\n";
+        ostream << "  Object Data       : ------------------------" << "\n";
 
         if (pObjectMeta)
         {
-            m_ostream << "    Occurrences     : " << pTrigger->m_occurrences << "\n";
-            m_ostream << "    Obj ClassId     : " << pObjectMeta->class_id << "\n";
-            m_ostream << "    Infer Id        : " << pObjectMeta->unique_component_id << "\n";
-            m_ostream << "    Tracking Id     : " << pObjectMeta->object_id << "\n";
-            m_ostream << "    Label           : " << pObjectMeta->obj_label << "\n";
-            m_ostream << "    Persistence     : " << pObjectMeta->
+            ostream << "    Occurrences     : " << occurrences << "\n";
+            ostream << "    Obj ClassId     : " << pObjectMeta->class_id << "\n";
+            ostream << "    Infer Id        : " << pObjectMeta->unique_component_id << "\n";
+            ostream << "    Tracking Id     : " << pObjectMeta->object_id << "\n";
+            ostream << "    Label           : " << pObjectMeta->obj_label << "\n";
+            ostream << "    Persistence     : " << pObjectMeta->
                 misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] << "\n";
             if (pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_DIRECTION] == 
                 DSL_AREA_CROSS_DIRECTION_NONE)
             {
-                m_ostream << "    Direction In    : " << "No\n";
-                m_ostream << "    Direction Out   : " << "No\n";
+                ostream << "    Direction In    : " << "No\n";
+                ostream << "    Direction Out   : " << "No\n";
             }
             else if (pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_DIRECTION] == 
                 DSL_AREA_CROSS_DIRECTION_IN)
             {
-                m_ostream << "    Direction In    : " << "Yes\n";
-                m_ostream << "    Direction Out   : " << "No\n";
+                ostream << "    Direction In    : " << "Yes\n";
+                ostream << "    Direction Out   : " << "No\n";
             }
             else
             {
-                m_ostream << "    Direction In    : " << "No\n";
-                m_ostream << "    Direction Out   : " << "Yes\n";
+                ostream << "    Direction In    : " << "No\n";
+                ostream << "    Direction Out   : " << "Yes\n";
             }
                 
-            m_ostream << "    Infer Conf      : " << pObjectMeta->confidence << "\n";
-            m_ostream << "    Track Conf      : " << pObjectMeta->tracker_confidence << "\n";
-            m_ostream << "    Left            : " << lrint(pObjectMeta->rect_params.left) << "\n";
-            m_ostream << "    Top             : " << lrint(pObjectMeta->rect_params.top) << "\n";
-            m_ostream << "    Width           : " << lrint(pObjectMeta->rect_params.width) << "\n";
-            m_ostream << "    Height          : " << lrint(pObjectMeta->rect_params.height) << "\n";
+            ostream << "    Infer Conf      : " << pObjectMeta->confidence << "\n";
+            ostream << "    Track Conf      : " << pObjectMeta->tracker_confidence << "\n";
+            ostream << "    Left            : " << lrint(pObjectMeta->rect_params.left) << "\n";
+            ostream << "    Top             : " << lrint(pObjectMeta->rect_params.top) << "\n";
+            ostream << "    Width           : " << lrint(pObjectMeta->rect_params.width) << "\n";
+            ostream << "    Height          : " << lrint(pObjectMeta->rect_params.height) << "\n";
         }
         else
         {
             if (pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] == 
                 DSL_FRAME_INFO_OCCURRENCES)
             {
-                m_ostream << "    Occurrences     : " 
+                ostream << "    Occurrences     : " 
                     << pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] << "\n";
             }
             else if (pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] == 
                 DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN)
             {
-                m_ostream << "    Occurrences In  : " 
+                ostream << "    Occurrences In  : " 
                     << pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN] << "\n";
-                m_ostream << "    Occurrences Out : " 
+                ostream << "    Occurrences Out : " 
                     << pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_OUT] << "\n";
             }
         }
 
-        m_ostream << "  Criteria          : ------------------------" << "\n";
-        m_ostream << "    Class Id        : " << pTrigger->m_classId << "\n";
-        m_ostream << "    Min Infer Conf  : " << pTrigger->m_minConfidence << "\n";
-        m_ostream << "    Min Track Conf  : " << pTrigger->m_minTrackerConfidence << "\n";
-        m_ostream << "    Min Frame Count : " << pTrigger->m_minFrameCountN
+        ostream << "  Criteria          : ------------------------" << "\n";
+        ostream << "    Class Id        : " << pTrigger->m_classId << "\n";
+        ostream << "    Min Infer Conf  : " << pTrigger->m_minConfidence << "\n";
+        ostream << "    Min Track Conf  : " << pTrigger->m_minTrackerConfidence << "\n";
+        ostream << "    Min Frame Count : " << pTrigger->m_minFrameCountN
             << " out of " << pTrigger->m_minFrameCountD << "\n";
-        m_ostream << "    Min Width       : " << lrint(pTrigger->m_minWidth) << "\n";
-        m_ostream << "    Min Height      : " << lrint(pTrigger->m_minHeight) << "\n";
-        m_ostream << "    Max Width       : " << lrint(pTrigger->m_maxWidth) << "\n";
-        m_ostream << "    Max Height      : " << lrint(pTrigger->m_maxHeight) << "\n";
+        ostream << "    Min Width       : " << lrint(pTrigger->m_minWidth) << "\n";
+        ostream << "    Min Height      : " << lrint(pTrigger->m_minHeight) << "\n";
+        ostream << "    Max Width       : " << lrint(pTrigger->m_maxWidth) << "\n";
+        ostream << "    Max Height      : " << lrint(pTrigger->m_maxHeight) << "\n";
 
         if (pTrigger->m_inferDoneOnly)
         {
-            m_ostream << "    Inference   : Yes\n\n";
+            ostream << "    Inference   : Yes\n\n";
         }
         else
         {
-            m_ostream << "    Inference   : No\n\n";
+            ostream << "    Inference   : No\n\n";
         }
         
-        // If we're force flushing the stream and the flush
-        // handler is not currently added to the idle thread
-        if (m_forceFlush and !m_flushThreadFunctionId)
-        {
-            m_flushThreadFunctionId = g_idle_add(FileActionFlush, this);
-        }
+        // Hand the formatted occurrence to the background writer
+        endFormat();
     }
 
     FileCsvOdeAction::FileCsvOdeAction(const char* name,
@@ -1593,67 +1754,41 @@ namespace DSL
     {
         LOG_FUNC();
 
-        // determine if new or existing file
-        std::ifstream streamUriFile(filePath);
-        bool fileExists(streamUriFile.good());
-        
-        // add the CSV header by default (if format == CSV)
-        bool addCsvHeader(true);
-
-        try
-        {
-            if (m_mode == DSL_WRITE_MODE_APPEND)
-            {
-                m_ostream.open(m_filePath, std::fstream::out | std::fstream::app);
-                
-                // don't add the header if we're appending to an existing file
-                addCsvHeader = !fileExists;
-            }
-            else
-            {
-                m_ostream.open(m_filePath, std::fstream::out | std::fstream::trunc);
-            }
-        }
-        catch(...) 
-        {
-            LOG_ERROR("New FileCsvOdeAction '" << name << "' failed to open");
-            throw;
-        }
-    
-        if (addCsvHeader)
-        {
-            m_ostream << "Trigger Name,";
-            m_ostream << "Event Id,";
-            m_ostream << "NTP Timestamp,";
-            m_ostream << "Inference Done,";
-            m_ostream << "Source Id,";
-            m_ostream << "Batch Idx,";
-            m_ostream << "Pad Idx,";
-            m_ostream << "Frame,";
-            m_ostream << "Width,";
-            m_ostream << "Height,";
-            m_ostream << "Occurrences,";
-            m_ostream << "Class Id,";
-            m_ostream << "Object Id,";
-            m_ostream << "Label,";
-            m_ostream << "Persistence,";
-            m_ostream << "Direction In,";
-            m_ostream << "Direction Out,";
-            m_ostream << "Infer Conf,";
-            m_ostream << "Tracker Conf,";
-            m_ostream << "Left,";
-            m_ostream << "Top,";
-            m_ostream << "Width,";
-            m_ostream << "Height,";
-            m_ostream << "Class Id Filter,";
-            m_ostream << "Min Infer Conf,";
-            m_ostream << "Min Track Conf,";
-            m_ostream << "Min Width,";
-            m_ostream << "Min Height,";
-            m_ostream << "Max Width,";
-            m_ostream << "Max Height,";
-            m_ostream << "Inference Done Only\n";
-        }
+        // the CSV header is only added to new or truncated files
+        std::string csvHeader;
+        csvHeader.append("Trigger Name,");
+        csvHeader.append("Event Id,");
+        csvHeader.append("NTP Timestamp,");
+        csvHeader.append("Inference Done,");
+        csvHeader.append("Source Id,");
+        csvHeader.append("Batch Idx,");
+        csvHeader.append("Pad Idx,");
+        csvHeader.append("Frame,");
+        csvHeader.append("Width,");
+        csvHeader.append("Height,");
+        csvHeader.append("Occurrences,");
+        csvHeader.append("Class Id,");
+        csvHeader.append("Object Id,");
+        csvHeader.append("Label,");
+        csvHeader.append("Persistence,");
+        csvHeader.append("Direction In,");
+        csvHeader.append("Direction Out,");
+        csvHeader.append("Infer Conf,");
+        csvHeader.append("Tracker Conf,");
+        csvHeader.append("Left,");
+        csvHeader.append("Top,");
+        csvHeader.append("Width,");
+        csvHeader.append("Height,");
+        csvHeader.append("Class Id Filter,");
+        csvHeader.append("Min Infer Conf,");
+        csvHeader.append("Min Track Conf,");
+        csvHeader.append("Min Width,");
+        csvHeader.append("Min Height,");
+        csvHeader.append("Max Width,");
+        csvHeader.append("Max Height,");
+        csvHeader.append("Inference Done Only\n");
+
+        openWriter(csvHeader, false);
     }
 
     FileCsvOdeAction::~FileCsvOdeAction()
@@ -1661,12 +1796,12 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void FileCsvOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
-        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    void FileCsvOdeAction::DoHandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+        uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+        NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_ostreamMutex);
 
         if (!m_enabled)
         {
@@ -1675,87 +1810,85 @@ namespace DSL
         DSL_ODE_TRIGGER_PTR pTrigger = 
             std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
         
-        m_ostream << pTrigger->GetName() << ",";
-        m_ostream << pTrigger->s_eventCount << ",";
-        m_ostream << pFrameMeta->ntp_timestamp << ",";
+        std::ostream& ostream = beginFormat();
+        
+        ostream << pTrigger->GetName() << ",";
+        ostream << eventId << ",";
+        ostream << pFrameMeta->ntp_timestamp << ",";
         if (pFrameMeta->bInferDone)
         {
-            m_ostream << "Yes,";
+            ostream << "Yes,";
         }
         else
         {
-            m_ostream << "No,";
+            ostream << "No,";
         }
-        m_ostream << pFrameMeta->source_id << ",";
-        m_ostream << pFrameMeta->batch_id << ",";
-        m_ostream << pFrameMeta->pad_index << ",";
-        m_ostream << pFrameMeta->frame_num << ",";
-        m_ostream << pFrameMeta->source_frame_width << ",";
-        m_ostream << pFrameMeta->source_frame_height << ",";
-        m_ostream << pTrigger->m_occurrences << ",";
+        ostream << pFrameMeta->source_id << ",";
+        ostream << pFrameMeta->batch_id << ",";
+        ostream << pFrameMeta->pad_index << ",";
+        ostream << pFrameMeta->frame_num << ",";
+        ostream << pFrameMeta->source_frame_width << ",";
+        ostream << pFrameMeta->source_frame_height << ",";
+        ostream << occurrences << ",";
 
         if (pObjectMeta)
         {
-            m_ostream << pObjectMeta->class_id << ",";
-            m_ostream << pObjectMeta->unique_component_id << ",";
-            m_ostream << pObjectMeta->object_id << ",";
-            m_ostream << pObjectMeta->obj_label << ",";
-            m_ostream << pObjectMeta->confidence << ",";
-            m_ostream << pObjectMeta->tracker_confidence << ",";
-            m_ostream << pObjectMeta->
+            ostream << pObjectMeta->class_id << ",";
+            ostream << pObjectMeta->unique_component_id << ",";
+            ostream << pObjectMeta->object_id << ",";
+            ostream << pObjectMeta->obj_label << ",";
+            ostream << pObjectMeta->confidence << ",";
+            ostream << pObjectMeta->tracker_confidence << ",";
+            ostream << pObjectMeta->
                 misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] + ",";
             if (pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_DIRECTION] == 
                 DSL_AREA_CROSS_DIRECTION_NONE)
             {
-                m_ostream << "No,";
-                m_ostream << "No,";
+                ostream << "No,";
+                ostream << "No,";
             }
             else if (pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_DIRECTION] == 
                 DSL_AREA_CROSS_DIRECTION_IN)
             {
-                m_ostream << "Yes,";
-                m_ostream << "No,";
+                ostream << "Yes,";
+                ostream << "No,";
             }
             else
             {
-                m_ostream << "No,";
-                m_ostream << "Yes,";
+                ostream << "No,";
+                ostream << "Yes,";
             }
-            m_ostream << lrint(pObjectMeta->rect_params.left) << ",";
-            m_ostream << lrint(pObjectMeta->rect_params.top) << ",";
-            m_ostream << lrint(pObjectMeta->rect_params.width) << ",";
-            m_ostream << lrint(pObjectMeta->rect_params.height) << ",";
+            ostream << lrint(pObjectMeta->rect_params.left) << ",";
+            ostream << lrint(pObjectMeta->rect_params.top) << ",";
+            ostream << lrint(pObjectMeta->rect_params.width) << ",";
+            ostream << lrint(pObjectMeta->rect_params.height) << ",";
         }
         else
         {
-            m_ostream << "0,0,0,0,0,0,0";
+            ostream << "0,0,0,0,0,0,0";
             
-            m_ostream << "0,0,0,0,0";
+            ostream << "0,0,0,0,0";
         }
 
-        m_ostream << pTrigger->m_classId << ",";
-        m_ostream << lrint(pTrigger->m_minWidth) << ",";
-        m_ostream << lrint(pTrigger->m_minHeight) << ",";
-        m_ostream << lrint(pTrigger->m_maxWidth) << ",";
-        m_ostream << lrint(pTrigger->m_maxHeight) << ",";
-        m_ostream << pTrigger->m_minConfidence << ",";
-        m_ostream << pTrigger->m_minTrackerConfidence << ",";
+        ostream << pTrigger->m_classId << ",";
+        ostream << lrint(pTrigger->m_minWidth) << ",";
+        ostream << lrint(pTrigger->m_minHeight) << ",";
+        ostream << lrint(pTrigger->m_maxWidth) << ",";
+        ostream << lrint(pTrigger->m_maxHeight) << ",";
+        ostream << pTrigger->m_minConfidence << ",";
+        ostream << pTrigger->m_minTrackerConfidence << ",";
 
         if (pTrigger->m_inferDoneOnly)
         {
-            m_ostream << "Yes\n";
+            ostream << "Yes\n";
         }
         else
         {
-            m_ostream << "No\n";
+            ostream << "No\n";
         }
         
-        // If we're force flushing the stream and the flush
-        // handler is not currently added to the idle thread
-        if (m_forceFlush and !m_flushThreadFunctionId)
-        {
-            m_flushThreadFunctionId = g_idle_add(FileActionFlush, this);
-        }
+        // Hand the formatted occurrence to the background writer
+        endFormat();
     }
     
     FileMotcOdeAction::FileMotcOdeAction(const char* name,
@@ -1764,26 +1897,7 @@ namespace DSL
     {
         LOG_FUNC();
 
-        // determine if new or existing file
-        std::ifstream streamUriFile(filePath);
-        bool fileExists(streamUriFile.good());
-        
-        try
-        {
-            if (m_mode == DSL_WRITE_MODE_APPEND)
-            {
-                m_ostream.open(m_filePath, std::fstream::out | std::fstream::app);
-            }
-            else
-            {
-                m_ostream.open(m_filePath, std::fstream::out | std::fstream::trunc);
-            }
-        }
-        catch(...) 
-        {
-            LOG_ERROR("New FileMotcOdeAction '" << name << "' failed to open");
-            throw;
-        }
+        openWriter("", false);
     }
 
     FileMotcOdeAction::~FileMotcOdeAction()
@@ -1791,12 +1905,12 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void FileMotcOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
-        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    void FileMotcOdeAction::DoHandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+        uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+        NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_ostreamMutex);
 
         if (!m_enabled or !pObjectMeta)
         {
@@ -1805,48 +1919,394 @@ namespace DSL
         DSL_ODE_TRIGGER_PTR pTrigger = 
             std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
         
-        m_ostream << pFrameMeta->frame_num << ", ";
-        m_ostream << pObjectMeta->object_id << ", ";
-        m_ostream << pObjectMeta->rect_params.left << ", ";
-        m_ostream << pObjectMeta->rect_params.top << ", ";
-        m_ostream << pObjectMeta->rect_params.width << ", ";
-        m_ostream << pObjectMeta->rect_params.height << ", ";
-        m_ostream << pObjectMeta->tracker_confidence << ", ";
-        m_ostream << "-1, -1, -1" << std::endl;
-            
+        std::ostream& ostream = beginFormat();
         
-        // If we're force flushing the stream and the flush
-        // handler is not currently added to the idle thread
-        if (m_forceFlush and !m_flushThreadFunctionId)
-        {
-            m_flushThreadFunctionId = g_idle_add(FileActionFlush, this);
-        }
+        ostream << pFrameMeta->frame_num << ", ";
+        ostream << pObjectMeta->object_id << ", ";
+        ostream << pObjectMeta->rect_params.left << ", ";
+        ostream << pObjectMeta->rect_params.top << ", ";
+        ostream << pObjectMeta->rect_params.width << ", ";
+        ostream << pObjectMeta->rect_params.height << ", ";
+        ostream << pObjectMeta->tracker_confidence << ", ";
+        ostream << "-1, -1, -1\n";
+        
+        // Hand the formatted occurrence to the background writer
+        endFormat();
     }
     
     
-    // ********************************************************************
-
-    FillSurroundingsOdeAction::FillSurroundingsOdeAction(const char* name, 
-        DSL_RGBA_COLOR_PTR pColor)
-        : OdeAction(name)
-        , m_pColor(pColor)
+    FileBinaryOdeAction::FileBinaryOdeAction(const char* name,
+        const char* filePath, uint mode)
+        : DeferrableOdeAction(name)
+        , m_filePath(filePath)
+        , m_fd(-1)
+        , m_pSegment(NULL)
+        , m_segmentIndex(0)
+        , m_recordCount(0)
+        , m_maxRecords(DSL_ODE_EVENT_LOG_SEGMENT_SIZE/DSL_ODE_EVENT_LOG_RECORD_SIZE - 1)
+        , m_nextIndex(0)
+        , m_nextFd(-1)
+        , m_pNextSegment(NULL)
+        , m_nextFailed(false)
+        , m_retiredFd(-1)
+        , m_pRetiredSegment(NULL)
+        , m_retiredRecordCount(0)
+        , m_retiredIndex(0)
+        , m_stop(false)
+        , m_pThread(NULL)
     {
         LOG_FUNC();
-    }
-
-    FillSurroundingsOdeAction::~FillSurroundingsOdeAction()
-    {
+        
+        uint64_t index(0);
+        if (mode == DSL_WRITE_MODE_APPEND)
+        {
+            // start a new segment after the last existing segment
+            while (access(OdeEventLogSegmentPath(m_filePath, index).c_str(), 
+                F_OK) == 0)
+            {
+                index++;
+            }
+        }
+        else
+        {
+            // remove all segments of the previous log
+            for (uint64_t i = 0; 
+                unlink(OdeEventLogSegmentPath(m_filePath, i).c_str()) == 0; i++)
+            {
+            }
+        }
+        if (!createSegment(index, m_fd, m_pSegment))
+        {
+            LOG_ERROR("New FileBinaryOdeAction '" << name << "' failed to open");
+            throw std::exception();
+        }
+        m_segmentIndex = index;
+        m_nextIndex = index + 1;
+        
+        // the segment thread starts by pre-allocating the next segment.
+        m_pThread = g_thread_new("file-binary-segment", 
+            file_binary_segment_thread, this);
+    }
+
+    FileBinaryOdeAction::~FileBinaryOdeAction()
+    {
+        LOG_FUNC();
+        
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_segmentMutex);
+            m_stop = true;
+            g_cond_signal(&m_segmentCond);
+        }
+        g_thread_join(m_pThread);
+        
+        if (m_pRetiredSegment)
+        {
+            releaseSegment(m_retiredFd, m_pRetiredSegment, 
+                m_retiredRecordCount, m_retiredIndex);
+        }
+        // the unused, pre-allocated next segment is removed so that an
+        // appending log continues from the last segment written.
+        if (m_pNextSegment)
+        {
+            munmap(m_pNextSegment, DSL_ODE_EVENT_LOG_SEGMENT_SIZE);
+            close(m_nextFd);
+            unlink(OdeEventLogSegmentPath(m_filePath, m_nextIndex).c_str());
+        }
+        if (m_pSegment)
+        {
+            releaseSegment(m_fd, m_pSegment, m_recordCount, m_segmentIndex);
+        }
+    }
+    
+    bool FileBinaryOdeAction::createSegment(uint64_t index, 
+        int& fd, uint8_t*& pSegment)
+    {
+        LOG_FUNC();
+        
+        std::string segmentPath = OdeEventLogSegmentPath(m_filePath, index);
+        
+        fd = open(segmentPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 
+            0644);
+        if (fd < 0)
+        {
+            LOG_ERROR("Failed to create segment file '" << segmentPath 
+                << "' for FileBinaryOdeAction '" << GetName() << "'");
+            return false;
+        }
+        // Allocate all blocks up front, so that writing a record never 
+        // waits on the file system to allocate one. 
+        if (posix_fallocate(fd, 0, DSL_ODE_EVENT_LOG_SEGMENT_SIZE) and
+            ftruncate(fd, DSL_ODE_EVENT_LOG_SEGMENT_SIZE))
+        {
+            LOG_ERROR("Failed to allocate segment file '" << segmentPath 
+                << "' for FileBinaryOdeAction '" << GetName() << "'");
+            close(fd);
+            fd = -1;
+            return false;
+        }
+        void* pMapping = mmap(NULL, DSL_ODE_EVENT_LOG_SEGMENT_SIZE, 
+            PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (pMapping == MAP_FAILED)
+        {
+            LOG_ERROR("Failed to map segment file '" << segmentPath 
+                << "' for FileBinaryOdeAction '" << GetName() << "'");
+            close(fd);
+            fd = -1;
+            return false;
+        }
+        pSegment = (uint8_t*)pMapping;
+        
+        OdeEventLogHeader* pHeader = (OdeEventLogHeader*)pSegment;
+        memcpy(pHeader->magic, DSL_ODE_EVENT_LOG_MAGIC, sizeof(pHeader->magic));
+        pHeader->version = DSL_ODE_EVENT_LOG_VERSION;
+        pHeader->recordSize = DSL_ODE_EVENT_LOG_RECORD_SIZE;
+        pHeader->recordCount = 0;
+        pHeader->segmentIndex = index;
+        
+        LOG_INFO("FileBinaryOdeAction '" << GetName() 
+            << "' created segment file '" << segmentPath << "'");
+        return true;
+    }
+    
+    void FileBinaryOdeAction::releaseSegment(int fd, uint8_t* pSegment, 
+        uint64_t recordCount, uint64_t index)
+    {
+        LOG_FUNC();
+        
+        munmap(pSegment, DSL_ODE_EVENT_LOG_SEGMENT_SIZE);
+        
+        // release the unused, pre-allocated space
+        if (ftruncate(fd, (recordCount + 1)*DSL_ODE_EVENT_LOG_RECORD_SIZE))
+        {
+            LOG_ERROR("Failed to truncate segment " << index 
+                << " for FileBinaryOdeAction '" << GetName() << "'");
+        }
+        close(fd);
+    }
+    
+    bool FileBinaryOdeAction::nextSegment()
+    {
+        LOG_FUNC();
+        
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_segmentMutex);
+            
+            // only waits if the segment filled before the next was ready.
+            while (!m_pNextSegment and !m_nextFailed)
+            {
+                g_cond_wait(&m_nextReadyCond, &m_segmentMutex);
+            }
+            
+            // the previous retired segment was closed before the next segment
+            // was created, so the current segment can always be handed over.
+            m_retiredFd = m_fd;
+            m_pRetiredSegment = m_pSegment;
+            m_retiredRecordCount = m_recordCount;
+            m_retiredIndex = m_segmentIndex;
+            
+            m_fd = m_nextFd;
+            m_pSegment = m_pNextSegment;
+            m_nextFd = -1;
+            m_pNextSegment = NULL;
+            
+            m_segmentIndex = m_nextIndex++;
+            g_cond_signal(&m_segmentCond);
+        }
+        m_recordCount = 0;
+        
+        // string ids are defined per segment, so each can be read on its own.
+        m_stringIds.clear();
+        
+        return (m_pSegment != NULL);
+    }
+    
+    void FileBinaryOdeAction::SegmentThread()
+    {
+        while (true)
+        {
+            int retiredFd(-1);
+            uint8_t* pRetiredSegment(NULL);
+            uint64_t retiredRecordCount(0);
+            uint64_t retiredIndex(0);
+            uint64_t nextIndex(0);
+            bool createNext(false);
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_segmentMutex);
+                
+                while (!m_stop and !m_pRetiredSegment and 
+                    (m_pNextSegment or m_nextFailed))
+                {
+                    g_cond_wait(&m_segmentCond, &m_segmentMutex);
+                }
+                // any segments still open are released on destruction.
+                if (m_stop)
+                {
+                    break;
+                }
+                retiredFd = m_retiredFd;
+                pRetiredSegment = m_pRetiredSegment;
+                retiredRecordCount = m_retiredRecordCount;
+                retiredIndex = m_retiredIndex;
+                m_retiredFd = -1;
+                m_pRetiredSegment = NULL;
+                
+                createNext = (!m_pNextSegment and !m_nextFailed);
+                nextIndex = m_nextIndex;
+            }
+            if (pRetiredSegment)
+            {
+                releaseSegment(retiredFd, pRetiredSegment, 
+                    retiredRecordCount, retiredIndex);
+            }
+            if (createNext)
+            {
+                int fd(-1);
+                uint8_t* pSegment(NULL);
+                bool created = createSegment(nextIndex, fd, pSegment);
+                
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_segmentMutex);
+                m_nextFd = fd;
+                m_pNextSegment = pSegment;
+                m_nextFailed = !created;
+                g_cond_signal(&m_nextReadyCond);
+            }
+        }
+    }
+    
+    uint32_t FileBinaryOdeAction::getStringId(const char* str)
+    {
+        // No function log - avoid overhead.
+        if (!str or !*str)
+        {
+            return 0;
+        }
+        // strings are stored truncated, obj_label may not be null terminated.
+        m_stringKey.assign(str, strnlen(str, DSL_ODE_EVENT_LOG_MAX_STRING_LENGTH));
+        
+        auto ivec = m_stringIds.find(m_stringKey);
+        if (ivec != m_stringIds.end())
+        {
+            return ivec->second;
+        }
+        uint32_t stringId = m_stringIds.size() + 1;
+        m_stringIds[m_stringKey] = stringId;
+        
+        OdeEventLogStringRecord* pRecord = 
+            (OdeEventLogStringRecord*)nextRecord();
+        pRecord->type = DSL_ODE_EVENT_LOG_RECORD_STRING;
+        pRecord->length = m_stringKey.size();
+        pRecord->stringId = stringId;
+        memcpy(pRecord->text, m_stringKey.c_str(), pRecord->length);
+        
+        return stringId;
+    }
+    
+    uint8_t* FileBinaryOdeAction::nextRecord()
+    {
+        // No function log - avoid overhead.
+        return m_pSegment + (++m_recordCount)*DSL_ODE_EVENT_LOG_RECORD_SIZE;
+    }
+    
+    void FileBinaryOdeAction::commitRecords()
+    {
+        // No function log - avoid overhead.
+        // Pairs with the reader's acquire load - records are complete
+        // before the count that includes them is visible.
+        __atomic_store_n(&((OdeEventLogHeader*)m_pSegment)->recordCount, 
+            m_recordCount, __ATOMIC_RELEASE);
+    }
+
+    void FileBinaryOdeAction::DoHandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+        uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+        NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+
+        if (!m_enabled or !m_pSegment)
+        {
+            return;
+        }
+        // Each event needs at most three records - the event and two new 
+        // strings - which must all go to the same segment.
+        if (m_recordCount + 3 > m_maxRecords and !nextSegment())
+        {
+            return;
+        }
+        DSL_ODE_TRIGGER_PTR pTrigger = 
+            std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
+        
+        uint32_t triggerId = getStringId(pTrigger->GetCStrName());
+        uint32_t labelId = (pObjectMeta) ? getStringId(pObjectMeta->obj_label) : 0;
+        
+        OdeEventLogEventRecord* pRecord = (OdeEventLogEventRecord*)nextRecord();
+        
+        pRecord->type = DSL_ODE_EVENT_LOG_RECORD_EVENT;
+        pRecord->flags = (pFrameMeta->bInferDone) 
+            ? DSL_ODE_EVENT_LOG_FLAG_INFER_DONE : 0;
+        pRecord->triggerId = triggerId;
+        pRecord->eventId = eventId;
+        pRecord->ntpTimestamp = pFrameMeta->ntp_timestamp;
+        pRecord->occurrences = occurrences;
+        pRecord->sourceId = pFrameMeta->source_id;
+        pRecord->frameNum = pFrameMeta->frame_num;
+        pRecord->labelId = labelId;
+        
+        if (pObjectMeta)
+        {
+            pRecord->flags |= DSL_ODE_EVENT_LOG_FLAG_OBJECT |
+                ((pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_DIRECTION] 
+                    << DSL_ODE_EVENT_LOG_FLAG_DIRECTION_SHIFT) & 
+                        DSL_ODE_EVENT_LOG_FLAG_DIRECTION_MASK);
+            pRecord->trackingId = pObjectMeta->object_id;
+            pRecord->classId = pObjectMeta->class_id;
+            pRecord->left = pObjectMeta->rect_params.left;
+            pRecord->top = pObjectMeta->rect_params.top;
+            pRecord->width = pObjectMeta->rect_params.width;
+            pRecord->height = pObjectMeta->rect_params.height;
+            pRecord->inferConfidence = pObjectMeta->confidence;
+            pRecord->trackerConfidence = pObjectMeta->tracker_confidence;
+        }
+        else
+        {
+            pRecord->trackingId = 0;
+            pRecord->classId = -1;
+            pRecord->left = pRecord->top = pRecord->width = pRecord->height = 0;
+            pRecord->inferConfidence = pRecord->trackerConfidence = 0;
+        }
+        commitRecords();
+    }
+    
+    static gpointer file_binary_segment_thread(gpointer pAction)
+    {
+        static_cast<FileBinaryOdeAction*>(pAction)->SegmentThread();
+        
+        return NULL;
+    }
+    
+    // ********************************************************************
+
+    FillSurroundingsOdeAction::FillSurroundingsOdeAction(const char* name, 
+        DSL_RGBA_COLOR_PTR pColor)
+        : OdeAction(name)
+        , m_pColor(pColor)
+    {
+        LOG_FUNC();
+    }
+
+    FillSurroundingsOdeAction::~FillSurroundingsOdeAction()
+    {
         LOG_FUNC();
 
     }
 
     void FillSurroundingsOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        if (m_enabled and pObjectMeta and displayMetaData.size())
+        if (m_enabled and pObjectMeta and displayMetaData.IsEnabled())
         {
             
             uint x1(roundf(pObjectMeta->rect_params.left));
@@ -1910,12 +2370,12 @@ namespace DSL
     }
 
     void FillFrameOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
-        if (m_enabled and displayMetaData.size())
+        if (m_enabled and displayMetaData.IsEnabled())
         {
             NvOSD_RectParams rectParams{0};
             rectParams.left = 0;
@@ -1926,15 +2386,18 @@ namespace DSL
             rectParams.has_bg_color = true;
             rectParams.bg_color = *m_pColor;
             
-            displayMetaData.at(0)->rect_params[displayMetaData.at(0)->
-                num_rects++] = rectParams;
+            NvOSD_RectParams* pRectParams = displayMetaData.AcquireRect();
+            if (pRectParams)
+            {
+                *pRectParams = rectParams;
+            }
         }
     }
 
     // ********************************************************************
 
     LogOdeAction::LogOdeAction(const char* name)
-        : OdeAction(name)
+        : DeferrableOdeAction(name)
     {
         LOG_FUNC();
     }
@@ -1944,9 +2407,10 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void LogOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
-        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    void LogOdeAction::DoHandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+        uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+        NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
@@ -1956,7 +2420,7 @@ namespace DSL
                 std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
             
             LOG_INFO("Trigger Name        : " << pTrigger->GetName());
-            LOG_INFO("  Unique ODE Id     : " << pTrigger->s_eventCount);
+            LOG_INFO("  Unique ODE Id     : " << eventId);
             LOG_INFO("  NTP Timestamp     : " << Ntp2Str(pFrameMeta->ntp_timestamp));
             LOG_INFO("  Source Data       : ------------------------");
             
@@ -1978,7 +2442,7 @@ namespace DSL
             
             if (pObjectMeta)
             {
-                LOG_INFO("    Occurrences     : " << pTrigger->m_occurrences );
+                LOG_INFO("    Occurrences     : " << occurrences );
                 LOG_INFO("    Obj ClassId     : " << pObjectMeta->class_id);
                 LOG_INFO("    Infer Id        : " << pObjectMeta->unique_component_id);
                 LOG_INFO("    Tracking Id     : " << pObjectMeta->object_id);
@@ -2111,7 +2575,7 @@ namespace DSL
     }
 
     void MessageMetaAddOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2221,9 +2685,119 @@ namespace DSL
     
     // ********************************************************************
 
+    /**
+     * @brief Sets all members of an ODE occurrence info structure other than
+     * the client strings, i.e. the trigger name, label, and classifier labels.
+     */
+    static void set_occurrence_info(dsl_ode_occurrence_info* pInfo,
+        DSL_ODE_TRIGGER_PTR pTrigger, uint64_t eventId, 
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        // No function log - avoid overhead.
+        
+        *pInfo = {0};
+        
+        pInfo->unique_ode_id = eventId;
+        pInfo->ntp_timestamp = pFrameMeta->ntp_timestamp;
+        pInfo->source_info.inference_done = pFrameMeta->bInferDone;
+        pInfo->source_info.source_id = pFrameMeta->source_id;
+        pInfo->source_info.batch_id = pFrameMeta->batch_id;
+        pInfo->source_info.pad_index = pFrameMeta->pad_index;
+        pInfo->source_info.frame_num = pFrameMeta->frame_num;
+        pInfo->source_info.frame_width = pFrameMeta->source_frame_width;
+        pInfo->source_info.frame_height = pFrameMeta->source_frame_height;
+        
+        // true if the ODE occurrence information is for a specific object,
+        // false for frame-level multi-object events. (absence, new-high count, etc.). 
+        if (pObjectMeta)
+        {
+            // set the object-occurrence flag indicating that the 
+            // "info.object_info" structure is poplulated.
+            pInfo->is_object_occurrence = true;
+            
+            pInfo->object_info.class_id = pObjectMeta->class_id;
+            pInfo->object_info.inference_component_id = pObjectMeta->unique_component_id;
+            pInfo->object_info.tracking_id = pObjectMeta->object_id;
+
+            pInfo->object_info.persistence = pObjectMeta->
+                misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE];
+            pInfo->object_info.direction =  pObjectMeta->
+                misc_obj_info[DSL_OBJECT_INFO_DIRECTION];
+
+            pInfo->object_info.inference_confidence =  pObjectMeta->confidence;
+            pInfo->object_info.tracker_confidence =  pObjectMeta->tracker_confidence;
+            
+            pInfo->object_info.left = round(pObjectMeta->rect_params.left);
+            pInfo->object_info.top = round(pObjectMeta->rect_params.top);
+            pInfo->object_info.width = round(pObjectMeta->rect_params.width);
+            pInfo->object_info.height = round(pObjectMeta->rect_params.height);
+        }
+        else
+        {
+            pInfo->accumulative_info.occurrences_total = 
+                pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES];
+            pInfo->accumulative_info.occurrences_in = 
+                pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN];
+            pInfo->accumulative_info.occurrences_out =
+                pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_OUT];
+        }
+        
+        // Trigger criteria set for this ODE occurrence.
+        pInfo->criteria_info.class_id =  pTrigger->m_classId;
+        pInfo->criteria_info.inference_done_only = pTrigger->m_inferDoneOnly;
+        pInfo->criteria_info.inference_component_id = pTrigger->m_inferId;
+        pInfo->criteria_info.min_inference_confidence = pTrigger->m_minConfidence;
+        pInfo->criteria_info.min_tracker_confidence = pTrigger->m_minTrackerConfidence;
+        pInfo->criteria_info.min_width = pTrigger->m_minWidth;
+        pInfo->criteria_info.min_height = pTrigger->m_minHeight;
+        pInfo->criteria_info.max_width = pTrigger->m_maxWidth;
+        pInfo->criteria_info.max_height = pTrigger->m_maxHeight;
+        pInfo->criteria_info.interval = pTrigger->m_interval;
+    }
+    
+    /**
+     * @brief Appends all classifier labels for an object, space separated, 
+     * to a client string. Labels like licence plate numbers are found here.
+     */
+    static void append_classifier_labels(NvDsObjectMeta* pObjectMeta,
+        std::wstring& labels)
+    {
+        // No function log - avoid overhead.
+        
+        for (NvDsClassifierMetaList* pClassifierMetaList = 
+                pObjectMeta->classifier_meta_list; pClassifierMetaList; 
+                    pClassifierMetaList = pClassifierMetaList->next)
+        {
+            NvDsClassifierMeta* pClassifierMeta = 
+                (NvDsClassifierMeta*)(pClassifierMetaList->data);
+            if (pClassifierMeta != NULL)
+            {
+                for (NvDsLabelInfoList* pLabelInfoList = 
+                        pClassifierMeta->label_info_list; pLabelInfoList; 
+                            pLabelInfoList = pLabelInfoList->next)
+                {
+                    NvDsLabelInfo* pLabelInfo = 
+                        (NvDsLabelInfo*)(pLabelInfoList->data);
+                    if(pLabelInfo != NULL)
+                    {
+                        if (labels.size())
+                        {
+                            labels.push_back(L' ');
+                        }
+                        for (const char* pChar = pLabelInfo->result_label; 
+                            *pChar; pChar++)
+                        {
+                            labels.push_back(*pChar);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
     MonitorOdeAction::MonitorOdeAction(const char* name, 
         dsl_ode_monitor_occurrence_cb clientMonitor, void* clientData)
-        : OdeAction(name)
+        : DeferrableOdeAction(name)
         , m_clientMonitor(clientMonitor)
         , m_clientData(clientData)
     {
@@ -2235,9 +2809,10 @@ namespace DSL
         LOG_FUNC();
     }
     
-    void MonitorOdeAction::HandleOccurrence(DSL_BASE_PTR pBase, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
-        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    void MonitorOdeAction::DoHandleOccurrence(DSL_BASE_PTR pBase, 
+        uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+        NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
@@ -2250,113 +2825,31 @@ namespace DSL
             DSL_ODE_TRIGGER_PTR pTrigger 
                 = std::dynamic_pointer_cast<OdeTrigger>(pBase);
                 
-            dsl_ode_occurrence_info info{0};
+            dsl_ode_occurrence_info info;
+            set_occurrence_info(&info, pTrigger, eventId, pFrameMeta, pObjectMeta);
             
             // convert the Trigger Name to wchar string type (client format)
             std::wstring wstrTriggerName(pTrigger->GetName().begin(), 
                 pTrigger->GetName().end());
             info.trigger_name = wstrTriggerName.c_str();
-            info.unique_ode_id = pTrigger->s_eventCount;
-            info.ntp_timestamp = pFrameMeta->ntp_timestamp;
-            info.source_info.inference_done = pFrameMeta->bInferDone;
-            info.source_info.source_id = pFrameMeta->source_id;
-            info.source_info.batch_id = pFrameMeta->batch_id;
-            info.source_info.pad_index = pFrameMeta->pad_index;
-            info.source_info.frame_num = pFrameMeta->frame_num;
-            info.source_info.frame_width = pFrameMeta->source_frame_width;
-            info.source_info.frame_height = pFrameMeta->source_frame_height;
             
             // Automatic varaibles needs to be valid for call to the client callback
             // Create here at higher scope - in case it is used for Object metadata.
             std::wstring wstrLabel;
             std::wstring wstrClassifierLabels;
             
-            // true if the ODE occurrence information is for a specific object,
-            // false for frame-level multi-object events. (absence, new-high count, etc.). 
             if (pObjectMeta)
             {
-                // set the object-occurrence flag indicating that the 
-                // "info.object_info" structure is poplulated.
-                info.is_object_occurrence = true;
-                
-                info.object_info.class_id = pObjectMeta->class_id;
-                info.object_info.inference_component_id = pObjectMeta->unique_component_id;
-                info.object_info.tracking_id = pObjectMeta->object_id;
-
                 std::string strLabel(pObjectMeta->obj_label);
                 wstrLabel.assign(strLabel.begin(), strLabel.end());
                 info.object_info.label = wstrLabel.c_str();
 
-                info.object_info.persistence = pObjectMeta->
-                    misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE];
-                info.object_info.direction =  pObjectMeta->
-                    misc_obj_info[DSL_OBJECT_INFO_DIRECTION];
-
-                info.object_info.inference_confidence =  pObjectMeta->confidence;
-                info.object_info.tracker_confidence =  pObjectMeta->tracker_confidence;
-                
-                info.object_info.left = round(pObjectMeta->rect_params.left);
-                info.object_info.top = round(pObjectMeta->rect_params.top);
-                info.object_info.width = round(pObjectMeta->rect_params.width);
-                info.object_info.height = round(pObjectMeta->rect_params.height);
-
-                // look for classifier meta to find labels like licence plate numbers
                 if (pObjectMeta->classifier_meta_list)
                 {
-                    std::ostringstream labelStream;
-                    
-                    for (NvDsClassifierMetaList* pClassifierMetaList = 
-                            pObjectMeta->classifier_meta_list; pClassifierMetaList; 
-                                pClassifierMetaList = pClassifierMetaList->next)
-                    {
-                        NvDsClassifierMeta* pClassifierMeta = 
-                            (NvDsClassifierMeta*)(pClassifierMetaList->data);
-                        if (pClassifierMeta != NULL)
-                        {
-                            for (NvDsLabelInfoList* pLabelInfoList = 
-                                    pClassifierMeta->label_info_list; pLabelInfoList; 
-                                        pLabelInfoList = pLabelInfoList->next)
-                            {
-                                NvDsLabelInfo* pLabelInfo = 
-                                    (NvDsLabelInfo*)(pLabelInfoList->data);
-                                if(pLabelInfo != NULL)
-                                {
-                                    if (labelStream.str().size())
-                                    {
-                                        labelStream << " ";
-                                    }
-                                    labelStream << pLabelInfo->result_label;
-                                }
-                            }
-                        }
-                    }
-                    std::string classifierlabels(labelStream.str());
-                    wstrClassifierLabels.assign(classifierlabels.begin(), 
-                        classifierlabels.end());
+                    append_classifier_labels(pObjectMeta, wstrClassifierLabels);
                     info.object_info.classiferLabels = wstrClassifierLabels.c_str();
                 }
             }
-            else
-            {
-                info.accumulative_info.occurrences_total = 
-                    pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES];
-                info.accumulative_info.occurrences_in = 
-                    pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN];
-                info.accumulative_info.occurrences_out =
-                    pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_OUT];
-            }
-            
-            // Trigger criteria set for this ODE occurrence.
-            info.criteria_info.class_id =  pTrigger->m_classId;
-            info.criteria_info.inference_done_only = pTrigger->m_inferDoneOnly;
-            info.criteria_info.inference_component_id = pTrigger->m_inferId;
-            info.criteria_info.min_inference_confidence = pTrigger->m_minConfidence;
-            info.criteria_info.min_tracker_confidence = pTrigger->m_minTrackerConfidence;
-            info.criteria_info.min_width = pTrigger->m_minWidth;
-            info.criteria_info.min_height = pTrigger->m_minHeight;
-            info.criteria_info.max_width = pTrigger->m_maxWidth;
-            info.criteria_info.max_height = pTrigger->m_maxHeight;
-            info.criteria_info.interval = pTrigger->m_interval;
             
             // Call the Client's monitor callback with the info and client-data
             m_clientMonitor(&info, m_clientData);
@@ -2370,6 +2863,178 @@ namespace DSL
     
     // ********************************************************************
 
+    MonitorBatchOdeAction::MonitorBatchOdeAction(const char* name, 
+        dsl_ode_monitor_occurrence_batch_cb clientMonitor, 
+        uint maxSize, uint window, void* clientData)
+        : DeferrableOdeAction(name)
+        , m_clientMonitor(clientMonitor)
+        , m_maxSize(maxSize)
+        , m_window(window)
+        , m_clientData(clientData)
+        , m_occurrences(maxSize)
+        , m_classifierLabels(maxSize)
+        , m_count(0)
+        , m_lastSourceId(0)
+        , m_lastFrameNum(0)
+        , m_flushTimerId(0)
+    {
+        LOG_FUNC();
+    }
+
+    MonitorBatchOdeAction::~MonitorBatchOdeAction()
+    {
+        LOG_FUNC();
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (m_flushTimerId)
+        {
+            g_source_remove(m_flushTimerId);
+        }
+    }
+    
+    void MonitorBatchOdeAction::DoHandleOccurrence(DSL_BASE_PTR pBase, 
+        uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+        NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
+    {
+        // No function log - avoid overhead.
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (!m_enabled)
+        {
+            return;
+        }
+        // In per-frame mode, the first occurrence for a new frame completes
+        // the previous frame's batch.
+        if (m_count and !m_window and (pFrameMeta->source_id != m_lastSourceId
+            or pFrameMeta->frame_num != m_lastFrameNum))
+        {
+            deliverBatch();
+        }
+        m_lastSourceId = pFrameMeta->source_id;
+        m_lastFrameNum = pFrameMeta->frame_num;
+        m_lastAddTime = std::chrono::steady_clock::now();
+        
+        DSL_ODE_TRIGGER_PTR pTrigger 
+            = std::dynamic_pointer_cast<OdeTrigger>(pBase);
+        
+        dsl_ode_occurrence_info* pInfo = &m_occurrences[m_count];
+        set_occurrence_info(pInfo, pTrigger, eventId, pFrameMeta, pObjectMeta);
+        
+        pInfo->trigger_name = internString(pTrigger->GetName());
+        
+        if (pObjectMeta)
+        {
+            pInfo->object_info.label = internString(pObjectMeta->obj_label);
+            
+            if (pObjectMeta->classifier_meta_list)
+            {
+                m_classifierLabels[m_count].clear();
+                append_classifier_labels(pObjectMeta, m_classifierLabels[m_count]);
+                pInfo->object_info.classiferLabels = 
+                    m_classifierLabels[m_count].c_str();
+            }
+        }
+        if (++m_count == m_maxSize)
+        {
+            deliverBatch();
+        }
+        else if (!m_flushTimerId)
+        {
+            m_flushTimerId = g_timeout_add((m_window) 
+                ? m_window : DSL_ODE_ACTION_MONITOR_BATCH_IDLE_TIMEOUT_MS, 
+                monitor_batch_flush_handler, this);
+        }
+    }
+    
+    void MonitorBatchOdeAction::PostProcessFrame(NvDsFrameMeta* pFrameMeta)
+    {
+        // No function log - avoid overhead.
+        
+        // When async, the frame's occurrences may still be queued - the 
+        // flush timer completes the batch instead.
+        if (m_asyncEnabled)
+        {
+            return;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (m_count and !m_window and pFrameMeta->source_id == m_lastSourceId
+            and pFrameMeta->frame_num == m_lastFrameNum)
+        {
+            deliverBatch();
+        }
+    }
+    
+    void MonitorBatchOdeAction::Flush()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (m_count)
+        {
+            deliverBatch();
+        }
+    }
+    
+    int MonitorBatchOdeAction::HandleFlushTimeout()
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        // In per-frame mode, wait until the frame's occurrences stop arriving.
+        if (m_count and !m_window and (std::chrono::steady_clock::now() - 
+            m_lastAddTime) < std::chrono::milliseconds(
+                DSL_ODE_ACTION_MONITOR_BATCH_IDLE_TIMEOUT_MS))
+        {
+            return true;
+        }
+        if (m_count)
+        {
+            deliverBatch();
+        }
+        m_flushTimerId = 0;
+        return false;
+    }
+    
+    void MonitorBatchOdeAction::deliverBatch()
+    {
+        // No function log - avoid overhead.
+        
+        try
+        {
+            m_clientMonitor(&m_occurrences[0], m_count, m_clientData);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Monitor Batch ODE Action '" << GetName() 
+                << "' threw exception calling client callback");
+        }
+        m_count = 0;
+    }
+    
+    const wchar_t* MonitorBatchOdeAction::internString(const std::string& str)
+    {
+        // No function log - avoid overhead.
+        
+        auto ivec = m_internedStrings.find(str);
+        if (ivec == m_internedStrings.end())
+        {
+            ivec = m_internedStrings.emplace(str, 
+                std::wstring(str.begin(), str.end())).first;
+        }
+        return ivec->second.c_str();
+    }
+    
+    static int monitor_batch_flush_handler(gpointer pAction)
+    {
+        return static_cast<MonitorBatchOdeAction*>(pAction)->
+            HandleFlushTimeout();
+    }
+    
+    // ********************************************************************
+
     FormatLabelOdeAction::FormatLabelOdeAction(const char* name, 
         DSL_RGBA_FONT_PTR pFont, bool hasBgColor, DSL_RGBA_COLOR_PTR pBgColor)
         : OdeAction(name)
@@ -2387,7 +3052,7 @@ namespace DSL
     }
 
     void FormatLabelOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2428,7 +3093,7 @@ namespace DSL
     }
 
     void OffsetLabelOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2486,7 +3151,7 @@ namespace DSL
     }
 
     void SnapLabelToGridOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2521,7 +3186,7 @@ namespace DSL
     }
 
     void ConnectLabelToBBoxOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2647,12 +3312,12 @@ namespace DSL
     }
     
     void AddDisplayMetaOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
-        if (m_enabled and displayMetaData.size())
+        if (m_enabled and displayMetaData.IsEnabled())
         {
             for (const auto &ivec: m_pDisplayTypes)
             {
@@ -2675,7 +3340,7 @@ namespace DSL
     }
     
     void RemoveObjectOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2847,7 +3512,7 @@ namespace DSL
 
     PrintOdeAction::PrintOdeAction(const char* name,
         bool forceFlush)
-        : OdeAction(name)
+        : DeferrableOdeAction(name)
         , m_forceFlush(forceFlush)
         , m_flushThreadFunctionId(0)
     {
@@ -2865,9 +3530,10 @@ namespace DSL
         }
     }
 
-    void PrintOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
-        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    void PrintOdeAction::DoHandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+        uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+        NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
@@ -2879,7 +3545,7 @@ namespace DSL
             std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
         
         std::cout << "Trigger Name        : " << pTrigger->GetName() << "\n";
-        std::cout << "  Unique ODE Id     : " << pTrigger->s_eventCount << "\n";
+        std::cout << "  Unique ODE Id     : " << eventId << "\n";
         std::cout << "  NTP Timestamp     : " << Ntp2Str(pFrameMeta->ntp_timestamp) << "\n";
         std::cout << "  Source Data       : ------------------------" << "\n";
         if (pFrameMeta->bInferDone)
@@ -3025,7 +3691,7 @@ namespace DSL
     }
 
     void RedactOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3175,7 +3841,7 @@ namespace DSL
     }
     
     void ResetTriggerOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3204,7 +3870,7 @@ namespace DSL
     }
     
     void DisableTriggerOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3232,7 +3898,7 @@ namespace DSL
     }
     
     void EnableTriggerOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3260,7 +3926,7 @@ namespace DSL
     }
     
     void DisableActionOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3287,7 +3953,7 @@ namespace DSL
     }
     
     void EnableActionOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3316,7 +3982,7 @@ namespace DSL
     }
     
     void AddAreaOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3346,7 +4012,7 @@ namespace DSL
     }
     
     void RemoveAreaOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3377,7 +4043,7 @@ namespace DSL
     }
     
     void RecordSinkStartOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3406,7 +4072,7 @@ namespace DSL
     }
     
     void RecordSinkStopOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3438,7 +4104,7 @@ namespace DSL
     }
     
     void RecordTapStartOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3467,7 +4133,7 @@ namespace DSL
     }
     
     void RecordTapStopOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3497,7 +4163,7 @@ namespace DSL
     }
     
     void TilerShowSourceOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3561,7 +4227,7 @@ namespace DSL
     }
     
     void AddBranchToOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -3611,7 +4277,7 @@ namespace DSL
     }
     
     void MoveBranchToOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
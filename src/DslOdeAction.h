@@ -32,6 +32,8 @@ THE SOFTWARE.
 #include "DslDisplayTypes.h"
 #include "DslPlayerBintr.h"
 #include "DslMailer.h"
+#include "DslFileWriter.h"
+#include "DslOdeEventLog.h"
 
 namespace DSL
 {
@@ -167,6 +169,12 @@ namespace DSL
         std::shared_ptr<MonitorOdeAction>(new MonitorOdeAction(name, \
             clientMonitor, clientData))
 
+    #define DSL_ODE_ACTION_MONITOR_BATCH_PTR std::shared_ptr<MonitorBatchOdeAction>
+    #define DSL_ODE_ACTION_MONITOR_BATCH_NEW(name, \
+        clientMonitor, maxSize, window, clientData) \
+        std::shared_ptr<MonitorBatchOdeAction>(new MonitorBatchOdeAction(name, \
+            clientMonitor, maxSize, window, clientData))
+
     #define DSL_ODE_ACTION_OBJECT_REMOVE_PTR std::shared_ptr<RemoveObjectOdeAction>
     #define DSL_ODE_ACTION_OBJECT_REMOVE_NEW(name) \
         std::shared_ptr<RemoveObjectOdeAction>(new RemoveObjectOdeAction(name))
@@ -199,6 +207,8 @@ namespace DSL
     #define DSL_ODE_ACTION_PRINT_NEW(name, forceFlush) \
         std::shared_ptr<PrintOdeAction>(new PrintOdeAction(name, forceFlush))
 
+    #define DSL_ODE_ACTION_FILE_PTR std::shared_ptr<FileOdeAction>
+
     #define DSL_ODE_ACTION_FILE_TEXT_PTR std::shared_ptr<FileTextOdeAction>
     #define DSL_ODE_ACTION_FILE_TEXT_NEW(name, filePath, mode, forceFlush) \
         std::shared_ptr<FileTextOdeAction>(new FileTextOdeAction(name, \
@@ -214,6 +224,11 @@ namespace DSL
         std::shared_ptr<FileMotcOdeAction>(new FileMotcOdeAction(name, \
             filePath, mode, forceFlush))
         
+    #define DSL_ODE_ACTION_FILE_BINARY_PTR std::shared_ptr<FileBinaryOdeAction>
+    #define DSL_ODE_ACTION_FILE_BINARY_NEW(name, filePath, mode) \
+        std::shared_ptr<FileBinaryOdeAction>(new FileBinaryOdeAction(name, \
+            filePath, mode))
+        
     #define DSL_ODE_ACTION_REDACT_PTR std::shared_ptr<RedactOdeAction>
     #define DSL_ODE_ACTION_REDACT_NEW(name) \
         std::shared_ptr<RedactOdeAction>(new RedactOdeAction(name))
@@ -326,9 +341,43 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         virtual void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta) = 0;
         
+        /**
+         * @brief Returns whether this Action's occurrences must be handled 
+         * in batch order. The parent ODE Pad Probe Handler will serialize all
+         * frames that share an ordered Action when in parallel mode.
+         * @return false by default, true for Actions with external side effects.
+         */
+        virtual bool RequiresOrderedExecution(){return false;};
+        
+        /**
+         * @brief Returns whether this Action calls back into other ODE components,
+         * or updates the shared batch-meta pools, and must not be handled 
+         * concurrently with any other such Action. The parent ODE Pad Probe 
+         * Handler will serialize all frames that share any serial Action when
+         * in parallel mode.
+         * @return false by default, true for Actions that update other components
+         * or the batch-meta pools.
+         */
+        virtual bool RequiresSerialExecution(){return false;};
+        
+        /**
+         * @brief Returns whether this Action has work to complete at the end 
+         * of each frame, i.e. requires calls to PostProcessFrame.
+         * @return false by default.
+         */
+        virtual bool RequiresPostProcessFrame(){return false;};
+        
+        /**
+         * @brief Called by the parent ODE Pad Probe Handler, through each 
+         * parent Trigger, once all Triggers have post-processed a frame. 
+         * May be called more than once per frame if the Action is shared.
+         * @param[in] pFrameMeta pointer to the Frame Meta data just processed.
+         */
+        virtual void PostProcessFrame(NvDsFrameMeta* pFrameMeta){};
+        
     protected:
 
         std::string Ntp2Str(uint64_t ntp);
@@ -368,7 +417,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -392,6 +441,118 @@ namespace DSL
      */
     static int do_async_action(gpointer pAction);
     
+    // ********************************************************************
+    
+    // forward declaration - see DslOdeActionExecutor.h
+    struct OdeDeferredOccurrence;
+    
+    /**
+     * @class DeferrableOdeAction
+     * @brief Virtual class for an ODE Action with slow side effects - disk, 
+     * network, or client code - that can optionally be handled by the ODE 
+     * Action Executor's worker threads rather than the streaming thread. 
+     * When deferred, each occurrence is queued with an owned copy of its
+     * frame and object metadata, and dropped if the queue is full.
+     */
+    class DeferrableOdeAction : public OdeAction
+    {
+    public:
+    
+        /**
+         * @brief ctor for the DeferrableOdeAction virtual class
+         * @param[in] name unique name for the ODE Action
+         */
+        DeferrableOdeAction(const char* name);
+        
+        /**
+         * @brief dtor for the DeferrableOdeAction virtual class
+         */
+        ~DeferrableOdeAction();
+        
+        /**
+         * @brief Handles the ODE occurrence by calling DoHandleOccurrence 
+         * directly, or by queuing a copy of the occurrence if async is enabled.
+         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
+         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
+         * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
+         * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
+         * NULL if Frame level absence, total, min, max, etc. events.
+         */
+        void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+            
+        /**
+         * @brief Handles a queued occurrence. ** To be called by the 
+         * ODE Action Executor only **
+         * @param[in] occurrence owned copy of the occurrence to handle.
+         */
+        void HandleDeferredOccurrence(OdeDeferredOccurrence& occurrence);
+        
+        /**
+         * @brief Gets the current async enabled setting for this Action.
+         * @return true if occurrences are handled by the ODE Action Executor.
+         */
+        bool GetAsyncEnabled();
+        
+        /**
+         * @brief Sets the async enabled setting for this Action. Occurrences
+         * already queued are still handled when disabled.
+         * @param[in] enabled set to true to handle occurrences with the 
+         * ODE Action Executor, false to handle them on the streaming thread.
+         */
+        void SetAsyncEnabled(bool enabled);
+        
+        /**
+         * @brief Gets the number of occurrences queued and dropped since 
+         * async was first enabled.
+         * @param[out] queued number of occurrences queued successfully.
+         * @param[out] dropped number of occurrences dropped on queue overflow.
+         */
+        void GetAsyncStats(uint64_t* queued, uint64_t* dropped);
+        
+    protected:
+    
+        /**
+         * @brief Function to perform the Action, implemented by the derived 
+         * class. Called on the streaming thread, or on an ODE Action Executor
+         * thread if async is enabled.
+         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
+         * @param[in] eventId unique ODE occurrence id.
+         * @param[in] occurrences Trigger occurrences at the time of the event.
+         * @param[in] pBuffer pointer to the batched stream buffer that triggered 
+         * the event, NULL if async.
+         * @param[in] pDisplayMeta pointer to the frame's first Display Meta, 
+         * NULL if async.
+         * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
+         * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
+         * NULL if Frame level absence, total, min, max, etc. events.
+         */
+        virtual void DoHandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+            uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+            NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta) = 0;
+            
+        /**
+         * @brief true if occurrences are queued to the ODE Action Executor.
+         */
+        std::atomic<bool> m_asyncEnabled;
+        
+    private:
+    
+        /**
+         * @brief number of occurrences queued and dropped.
+         */
+        std::atomic<uint64_t> m_asyncQueued;
+        std::atomic<uint64_t> m_asyncDropped;
+        
+        /**
+         * @brief true while in a run of dropped occurrences, i.e. since the 
+         * last occurrence that was queued successfully. 
+         */
+        std::atomic<bool> m_asyncDropping;
+    };
+    
     // ********************************************************************
 
     /**
@@ -429,7 +590,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -488,7 +649,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -540,7 +701,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -611,7 +772,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -652,7 +813,7 @@ namespace DSL
      * @class CustomOdeAction
      * @brief Custom ODE Action class
      */
-    class CustomOdeAction : public OdeAction
+    class CustomOdeAction : public DeferrableOdeAction
     {
     public:
     
@@ -672,15 +833,28 @@ namespace DSL
 
         /**
          * @brief Handles the ODE occurrence by calling the client handler
-         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
          * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
+         * @param[in] eventId unique ODE occurrence id.
+         * @param[in] occurrences Trigger occurrences at the time of the event.
+         * @param[in] pBuffer pointer to the batched stream buffer that triggered 
+         * the event, NULL if async.
+         * @param[in] pDisplayMeta pointer to the frame's first Display Meta, 
+         * NULL if async.
          * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
          * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
          * NULL if Frame level absence, total, min, max, etc. events.
          */
-        void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
-            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        void DoHandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+            uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+            NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Overrides the base function - occurrences are passed to the client
+         * handler in batch order.
+         * @return true always.
+         */
+        bool RequiresOrderedExecution(){return true;};
         
     private:
     
@@ -731,7 +905,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -795,18 +969,40 @@ namespace DSL
          */
         void RemoveAllChildren();
                 
+        /**
+         * @brief Gets the current queue statistics for this CaptureOdeAction.
+         * @param[out] queueDepth number of captured images waiting to be
+         * encoded to JPEG file.
+         * @param[out] dropped number of captured images dropped because the
+         * JPEG Encoder Pool's queue was full.
+         */
+        void GetQueueStats(uint* queueDepth, uint64_t* dropped);
+        
         /**
          * @brief Queues a captured image that has been copied to a NvBufferSurface
-         * @param pBufferSurface shared pointer to DslBufferSurface to be queued.
+         * with the JPEG Encoder Pool to be converted to a JPEG image file.
+         * @param pBufferSurface shared pointer to a mapped DslBufferSurface 
+         * to be queued.
          */
         void queueCapturedImage(std::shared_ptr<DslBufferSurface> pBufferSurface);
         
         /**
-         * @brief implements an idle thread callback to initiate the conversion
-         * of the NvBufferSurface to a JPEG image file.
-         * Timer/tread will be restarted on next Image Capture
+         * @brief Queues an image that has been converted to a JPEG file by 
+         * the JPEG Encoder Pool for client notification by the idle thread.
+         * Called by the JPEG Encoder Pool's worker threads.
+         * @param pBufferSurface shared pointer to DslBufferSurface to be queued.
+         * @param filespec path to the JPEG file written by the Encoder Pool.
+         * @param succeeded true if the JPEG file was written successfully.
          */
-        int convertCapturedImage();
+        void queueEncodedImage(std::shared_ptr<DslBufferSurface> pBufferSurface,
+            const std::string& filespec, bool succeeded);
+        
+        /**
+         * @brief implements an idle thread callback to notify all Players, 
+         * Listeners, and Mailers of a JPEG image file written by the JPEG 
+         * Encoder Pool. Timer/tread will be restarted on next encoded Image.
+         */
+        int notifyEncodedImage();
 
     protected:
         
@@ -836,12 +1032,32 @@ namespace DSL
         std::string m_outdir;
 
         /**
-         * @brief Queue mono-NvBufferSurfaces waiting to be converted
-         * to a JPEG file by the idle thread callback. The callback
-         * intiates the conversion process by pushing each Surface
-         * into a Player with an App-Source and Multi-Image Sink. 
+         * @brief Gets the JPEG file name for a captured image.
+         * @param pBufferSurface shared pointer to DslBufferSurface to name.
+         * @return file name, without the output directory. 
+         */
+        std::string getFileName(std::shared_ptr<DslBufferSurface> pBufferSurface);
+        
+        /**
+         * @brief Queue of mono-NvBufferSurfaces, with their JPEG filespecs,
+         * that have been converted to a JPEG file by the JPEG Encoder Pool, 
+         * waiting for the idle thread callback to notify all Players, 
+         * Listeners, and Mailers. 
+         */
+        std::queue<std::pair<std::shared_ptr<DslBufferSurface>, 
+            std::string>> m_encodedImages;
+        
+        /**
+         * @brief number of captured images queued with the JPEG Encoder
+         * Pool that have yet to be encoded.
+         */
+        std::atomic<uint> m_pendingImages;
+        
+        /**
+         * @brief number of captured images dropped because the JPEG 
+         * Encoder Pool's queue was full.
          */
-        std::queue<std::shared_ptr<DslBufferSurface>> m_pBufferSurfaces;
+        std::atomic<uint64_t> m_droppedImages;
 
         /**
          * @brief gnome thread id for the idle thread to initiate image conversion.
@@ -962,7 +1178,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
     private:
@@ -1015,7 +1231,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
     private:
@@ -1084,8 +1300,15 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Overrides the base function - the Action calls back into 
+         * other ODE components.
+         * @return true always.
+         */
+        bool RequiresSerialExecution(){return true;};
             
     private:
     
@@ -1102,7 +1325,7 @@ namespace DSL
      * @class EmailOdeAction
      * @brief Email ODE Action class
      */
-    class EmailOdeAction : public OdeAction
+    class EmailOdeAction : public DeferrableOdeAction
     {
     public:
     
@@ -1123,14 +1346,26 @@ namespace DSL
         /**
          * @brief Handles the ODE occurrence by queuing and Email with SMTP API
          * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
-         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
+         * @param[in] eventId unique ODE occurrence id.
+         * @param[in] occurrences Trigger occurrences at the time of the event.
+         * @param[in] pBuffer pointer to the batched stream buffer that triggered 
+         * the event, NULL if async.
+         * @param[in] pDisplayMeta pointer to the frame's first Display Meta, 
+         * NULL if async.
          * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
          * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
          * NULL if Frame level absence, total, min, max, etc. events.
          */
-        void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
-            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        void DoHandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+            uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+            NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Overrides the base function - occurrences are emailed in batch order.
+         * @return true always.
+         */
+        bool RequiresOrderedExecution(){return true;};
             
     private:
     
@@ -1152,7 +1387,7 @@ namespace DSL
      * @class LogOdeAction
      * @brief Log Ode Action class
      */
-    class LogOdeAction : public OdeAction
+    class LogOdeAction : public DeferrableOdeAction
     {
     public:
     
@@ -1171,14 +1406,26 @@ namespace DSL
          * @brief Handles the ODE occurrence by adding/calling LOG_INFO 
          * with the ODE occurrence data.data
          * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event.
-         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event.
+         * @param[in] eventId unique ODE occurrence id.
+         * @param[in] occurrences Trigger occurrences at the time of the event.
+         * @param[in] pBuffer pointer to the batched stream buffer that triggered 
+         * the event, NULL if async.
+         * @param[in] pDisplayMeta pointer to the frame's first Display Meta, 
+         * NULL if async.
          * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event.
          * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
          * NULL if Frame level absence, total, min, max, etc. events.
          */
-        void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
-            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        void DoHandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+            uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+            NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Overrides the base function - occurrences are logged in batch order.
+         * @return true always.
+         */
+        bool RequiresOrderedExecution(){return true;};
 
     private:
     
@@ -1215,7 +1462,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
         /**
@@ -1233,6 +1480,13 @@ namespace DSL
          */
         void SetMetaType(uint metaType);
 
+        /**
+         * @brief Overrides the base function - user meta is acquired from
+         * the batch-meta pool.
+         * @return true always.
+         */
+        bool RequiresSerialExecution(){return true;};
+
     private:
     
         /**
@@ -1251,7 +1505,7 @@ namespace DSL
      * @class MonitorOdeAction
      * @brief Monitor ODE Action class
      */
-    class MonitorOdeAction : public OdeAction
+    class MonitorOdeAction : public DeferrableOdeAction
     {
     public:
     
@@ -1271,15 +1525,28 @@ namespace DSL
 
         /**
          * @brief Handles the ODE occurrence by calling the client handler
-         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
          * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
+         * @param[in] eventId unique ODE occurrence id.
+         * @param[in] occurrences Trigger occurrences at the time of the event.
+         * @param[in] pBuffer pointer to the batched stream buffer that triggered 
+         * the event, NULL if async.
+         * @param[in] pDisplayMeta pointer to the frame's first Display Meta, 
+         * NULL if async.
          * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
          * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
          * NULL if Frame level absence, total, min, max, etc. events.
          */
-        void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
-            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        void DoHandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+            uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+            NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Overrides the base function - occurrences are passed to the client
+         * monitor in batch order.
+         * @return true always.
+         */
+        bool RequiresOrderedExecution(){return true;};
         
     private:
     
@@ -1297,6 +1564,180 @@ namespace DSL
         
     // ********************************************************************
 
+    /**
+     * @brief time without a new occurrence after which a per-frame Monitor
+     * Batch is considered complete and is delivered by the flush timer.
+     */
+    #define DSL_ODE_ACTION_MONITOR_BATCH_IDLE_TIMEOUT_MS                40
+
+    /**
+     * @class MonitorBatchOdeAction
+     * @brief Monitor ODE Action class that delivers occurrences to the client 
+     * in batches. Occurrences are accumulated into a preallocated array for 
+     * each frame, or for a time window if set, and the client is called once 
+     * with the array and count. Trigger names and object labels are converted 
+     * to the client's string type once and reused for all occurrences.
+     */
+    class MonitorBatchOdeAction : public DeferrableOdeAction
+    {
+    public:
+    
+        /**
+         * @brief ctor for the Monitor Batch ODE Action class
+         * @param[in] name unique name for the ODE Action
+         * @param[in] clientMonitor client callback function to call with 
+         * each batch of occurrences.
+         * @param[in] maxSize maximum number of occurrences in a batch. The 
+         * batch is delivered early when full.
+         * @param[in] window time window in milliseconds to batch occurrences 
+         * over. Set to 0 to deliver one batch per frame.
+         * @param[in] clientData opaque pointer to client data t return on callback
+         */
+        MonitorBatchOdeAction(const char* name, 
+            dsl_ode_monitor_occurrence_batch_cb clientMonitor, 
+            uint maxSize, uint window, void* clientData);
+        
+        /**
+         * @brief dtor for the ODE Monitor Batch Action class
+         */
+        ~MonitorBatchOdeAction();
+
+        /**
+         * @brief Handles the ODE occurrence by adding it to the current batch,
+         * delivering the previous batch first if the frame has changed.
+         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
+         * @param[in] eventId unique ODE occurrence id.
+         * @param[in] occurrences Trigger occurrences at the time of the event.
+         * @param[in] pBuffer pointer to the batched stream buffer that triggered 
+         * the event, NULL if async.
+         * @param[in] pDisplayMeta pointer to the frame's first Display Meta, 
+         * NULL if async.
+         * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
+         * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
+         * NULL if Frame level absence, total, min, max, etc. events.
+         */
+        void DoHandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+            uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+            NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Overrides the base function - occurrences are passed to the client
+         * monitor in batch order.
+         * @return true always.
+         */
+        bool RequiresOrderedExecution(){return true;};
+        
+        /**
+         * @brief Overrides the base function - a per-frame batch is delivered
+         * at the end of its frame.
+         * @return true if in per-frame mode, false otherwise.
+         */
+        bool RequiresPostProcessFrame(){return !m_window;};
+        
+        /**
+         * @brief Delivers the current per-frame batch once its frame has been 
+         * processed, rather than waiting on the next frame or the flush timer.
+         * @param[in] pFrameMeta pointer to the Frame Meta data just processed.
+         */
+        void PostProcessFrame(NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief Delivers the current batch, if any, to the client.
+         */
+        void Flush();
+        
+        /**
+         * @brief Handles the flush timer. Delivers the current batch once
+         * complete. 
+         * @return true to keep waiting for the batch to complete, false to 
+         * end the timer.
+         */
+        int HandleFlushTimeout();
+        
+    private:
+    
+        /**
+         * @brief Delivers the current batch. The property mutex must be held.
+         */
+        void deliverBatch();
+        
+        /**
+         * @brief Gets the client string for a given string, converting it
+         * on first use only. 
+         * @param[in] str string to look up.
+         * @return pointer to the converted string, valid for the life of
+         * the Action.
+         */
+        const wchar_t* internString(const std::string& str);
+    
+        /**
+         * @brief Client Callback function to call with each batch
+         */
+        dsl_ode_monitor_occurrence_batch_cb m_clientMonitor;
+        
+        /**
+         * @brief maximum number of occurrences in a batch.
+         */
+        uint m_maxSize;
+        
+        /**
+         * @brief time window to batch occurrences over in ms, 0 for per-frame.
+         */
+        uint m_window;
+        
+        /**
+         * @brief pointer to client's data returned on callback
+         */ 
+        void* m_clientData;
+        
+        /**
+         * @brief preallocated occurrence info, one for each entry in the batch.
+         */
+        std::vector<dsl_ode_occurrence_info> m_occurrences;
+        
+        /**
+         * @brief classifier labels for each entry in the batch. Buffers are
+         * reused from batch to batch.
+         */
+        std::vector<std::wstring> m_classifierLabels;
+        
+        /**
+         * @brief number of occurrences in the current batch.
+         */
+        uint m_count;
+        
+        /**
+         * @brief source id and frame number of the last occurrence added.
+         */
+        uint m_lastSourceId;
+        uint64_t m_lastFrameNum;
+        
+        /**
+         * @brief time the last occurrence was added.
+         */
+        std::chrono::steady_clock::time_point m_lastAddTime;
+        
+        /**
+         * @brief converted trigger names and labels keyed by their original.
+         */
+        std::unordered_map<std::string, std::wstring> m_internedStrings;
+        
+        /**
+         * @brief g_timeout_add event source for the flush timer, 0 if not running.
+         */
+        uint m_flushTimerId;
+    };
+
+    /**
+     * @brief timer callback function to flush a Monitor Batch ODE Action.
+     * @param[in] pAction pointer to the Monitor Batch ODE Action.
+     * @return true to continue the timer, false to end.
+     */
+    static int monitor_batch_flush_handler(gpointer pAction);
+        
+    // ********************************************************************
+
     /**
      * @class FillFrameOdeAction
      * @brief Fill ODE Action class
@@ -1327,7 +1768,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
     private:
@@ -1372,7 +1813,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
     private:
@@ -1421,7 +1862,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
     private:
@@ -1465,7 +1906,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -1523,7 +1964,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -1576,7 +2017,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -1629,7 +2070,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -1682,8 +2123,15 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Overrides the base function - removed objects are released
+         * to the batch-meta pool.
+         * @return true always.
+         */
+        bool RequiresSerialExecution(){return true;};
     };
         
     // ********************************************************************
@@ -1896,7 +2344,7 @@ namespace DSL
      * @class PrintOdeAction
      * @brief Print ODE Action class
      */
-    class PrintOdeAction : public OdeAction
+    class PrintOdeAction : public DeferrableOdeAction
     {
     public:
     
@@ -1915,14 +2363,26 @@ namespace DSL
          * @brief Handles the ODE occurrence by printing the  
          * the occurrence data to the console
          * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
-         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
+         * @param[in] eventId unique ODE occurrence id.
+         * @param[in] occurrences Trigger occurrences at the time of the event.
+         * @param[in] pBuffer pointer to the batched stream buffer that triggered 
+         * the event, NULL if async.
+         * @param[in] pDisplayMeta pointer to the frame's first Display Meta, 
+         * NULL if async.
          * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
          * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
          * NULL if Frame level absence, total, min, max, etc. events.
          */
-        void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
-            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        void DoHandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+            uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+            NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Overrides the base function - occurrences are printed in batch order.
+         * @return true always.
+         */
+        bool RequiresOrderedExecution(){return true;};
 
         /**
          * @brief Flushes the stdout buffer. ** To be called by the idle thread only **.
@@ -1961,7 +2421,7 @@ namespace DSL
      * @class FileOdeAction
      * @brief File ODE Action class
      */
-    class FileOdeAction : public OdeAction
+    class FileOdeAction : public DeferrableOdeAction
     {
     public:
     
@@ -1980,13 +2440,68 @@ namespace DSL
         ~FileOdeAction();
         
         /**
-         * @brief Flushes the ostream buffer. ** To be called by the idle thread only **.
-         * @return false to unschedule always - single flush operation.
+         * @brief Blocks until all occurrences handled before the call 
+         * have been written to file.
          */
-        bool Flush();
+        void Flush();
+        
+        /**
+         * @brief Gets the current file rotation settings.
+         * @param[out] maxSize size in KB to rotate the file at, 0 if unset.
+         * @param[out] maxAge age in seconds to rotate the file at, 0 if unset.
+         */
+        void GetRotation(uint* maxSize, uint* maxAge);
+        
+        /**
+         * @brief Sets the file rotation settings.
+         * @param[in] maxSize size in KB to rotate the file at, 0 to disable.
+         * @param[in] maxAge age in seconds to rotate the file at, 0 to disable.
+         */
+        void SetRotation(uint maxSize, uint maxAge);
+        
+        /**
+         * @brief Gets the current sync policy.
+         * @return one of the DSL_FILE_SYNC_POLICY_* constants.
+         */
+        uint GetSyncPolicy();
+        
+        /**
+         * @brief Sets the sync policy.
+         * @param[in] policy one of the DSL_FILE_SYNC_POLICY_* constants.
+         */
+        void SetSyncPolicy(uint policy);
+
+        /**
+         * @brief Overrides the base function - occurrences are written to 
+         * file in batch order.
+         * @return true always.
+         */
+        bool RequiresOrderedExecution(){return true;};
 
     protected:
     
+        /**
+         * @brief Opens the File Writer for the Action's file. To be called
+         * by the derived class ctor.
+         * @param[in] header header to write at the start of each new file.
+         * @param[in] timestampHeader if true, the header is a strftime format
+         * expanded with the local time when written.
+         * @throws if the file can not be opened.
+         */
+        void openWriter(const std::string& header, bool timestampHeader);
+        
+        /**
+         * @brief Gets the calling thread's format buffer, cleared and ready 
+         * to format a single occurrence into.
+         * @return output stream to format into.
+         */
+        std::ostream& beginFormat();
+        
+        /**
+         * @brief Hands the calling thread's format buffer to the File Writer.
+         */
+        void endFormat();
+    
         /**
          * @brief relative or absolute path to the file to write to
          */ 
@@ -1999,33 +2514,16 @@ namespace DSL
         uint m_mode;
         
         /**
-         * @brief output stream for all file writes
+         * @brief background writer for all file writes
          */
-        std::fstream m_ostream;
+        std::unique_ptr<FileWriter> m_pFileWriter;
         
         /**
-         * @brief flag to enable/disable forced stream buffer flushing
+         * @brief flag to enable/disable forced writes per occurrence
          */
         bool m_forceFlush;
-    
-        /**
-         * @brief gnome thread id for the background thread to flush
-         */
-        uint m_flushThreadFunctionId;
-
-        /**
-         * @brief mutex to protect mutual access to comms data
-         */
-        DslMutex m_ostreamMutex;
     };
 
-    /**
-     * @brief Idle Thread Function to flush the ostream buffer
-     * @param pAction pointer to the File Action to call flush
-     * @return false to unschedule always
-     */
-    static gboolean FileActionFlush(gpointer pAction);
-
     /**
      * @class FileTextOdeAction
      * @brief Text File ODE Action class
@@ -2051,14 +2549,20 @@ namespace DSL
         /**
          * @brief Handles the ODE occurrence by writing the occurrence data to file
          * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
-         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
+         * @param[in] eventId unique ODE occurrence id.
+         * @param[in] occurrences Trigger occurrences at the time of the event.
+         * @param[in] pBuffer pointer to the batched stream buffer that triggered 
+         * the event, NULL if async.
+         * @param[in] pDisplayMeta pointer to the frame's first Display Meta, 
+         * NULL if async.
          * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
          * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
          * NULL if Frame level absence, total, min, max, etc. events.
          */
-        void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
-            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        void DoHandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+            uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+            NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta);
     
     };
 
@@ -2087,14 +2591,20 @@ namespace DSL
         /**
          * @brief Handles the ODE occurrence by writing the occurrence data to file
          * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
-         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
+         * @param[in] eventId unique ODE occurrence id.
+         * @param[in] occurrences Trigger occurrences at the time of the event.
+         * @param[in] pBuffer pointer to the batched stream buffer that triggered 
+         * the event, NULL if async.
+         * @param[in] pDisplayMeta pointer to the frame's first Display Meta, 
+         * NULL if async.
          * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
          * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
          * NULL if Frame level absence, total, min, max, etc. events.
          */
-        void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
-            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        void DoHandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+            uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+            NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta);
     
     };
 
@@ -2123,17 +2633,232 @@ namespace DSL
         /**
          * @brief Handles the ODE occurrence by writing the occurrence data to file.
          * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event.
-         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event.
+         * @param[in] eventId unique ODE occurrence id.
+         * @param[in] occurrences Trigger occurrences at the time of the event.
+         * @param[in] pBuffer pointer to the batched stream buffer that triggered 
+         * the event, NULL if async.
+         * @param[in] pDisplayMeta pointer to the frame's first Display Meta, 
+         * NULL if async.
          * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event.
          * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
          * NULL if Frame level absence, total, min, max, etc. events.
          */
-        void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
-            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        void DoHandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+            uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+            NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta);
     
     };
         
+    /**
+     * @class FileBinaryOdeAction
+     * @brief Binary File ODE Action class. Appends fixed-size records to 
+     * memory-mapped, pre-allocated segment files. See DslOdeEventLog.h for 
+     * the record format and reader. A dedicated thread pre-allocates the 
+     * next segment and closes the previous, so that rolling over to a new
+     * segment is a swap of mappings on the calling thread.
+     */
+    class FileBinaryOdeAction : public DeferrableOdeAction
+    {
+    public:
+    
+        /**
+         * @brief ctor for the ODE Binary File Action class
+         * @param[in] filePath absolute or relative path for the segment files. 
+         * Segments are named "<filePath>.<index>".
+         * @param[in] mode open/write mode - truncate or append
+         */
+        FileBinaryOdeAction(const char* name, 
+            const char* filePath, uint mode);
+        
+        /**
+         * @brief dtor for the ODE Binary File Action class
+         */
+        ~FileBinaryOdeAction();
+        
+        /**
+         * @brief Handles the ODE occurrence by writing an event record to 
+         * the current segment.
+         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event.
+         * @param[in] eventId unique ODE occurrence id.
+         * @param[in] occurrences Trigger occurrences at the time of the event.
+         * @param[in] pBuffer pointer to the batched stream buffer that triggered 
+         * the event, NULL if async.
+         * @param[in] pDisplayMeta pointer to the frame's first Display Meta, 
+         * NULL if async.
+         * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event.
+         * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
+         * NULL if Frame level absence, total, min, max, etc. events.
+         */
+        void DoHandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+            uint64_t eventId, uint64_t occurrences, GstBuffer* pBuffer, 
+            NvDsDisplayMeta* pDisplayMeta, NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief Overrides the base function - occurrences are written to 
+         * file in batch order.
+         * @return true always.
+         */
+        bool RequiresOrderedExecution(){return true;};
+        
+        /**
+         * @brief Segment thread function. ** To be called by the segment 
+         * thread only **.
+         */
+        void SegmentThread();
+            
+    private:
+    
+        /**
+         * @brief Creates, pre-allocates, and maps a new segment file, and 
+         * writes its header.
+         * @param[in] index index of the segment to create.
+         * @param[out] fd file descriptor of the new segment.
+         * @param[out] pSegment mapping of the new segment.
+         * @return true on success.
+         */
+        bool createSegment(uint64_t index, int& fd, uint8_t*& pSegment);
+        
+        /**
+         * @brief Unmaps a segment, truncates it to the size used, and closes it.
+         * @param[in] fd file descriptor of the segment.
+         * @param[in] pSegment mapping of the segment.
+         * @param[in] recordCount number of records written, excluding the header.
+         * @param[in] index index of the segment.
+         */
+        void releaseSegment(int fd, uint8_t* pSegment, uint64_t recordCount,
+            uint64_t index);
+        
+        /**
+         * @brief Rolls over from the current segment to the next segment 
+         * pre-allocated by the segment thread, handing the current segment
+         * to the thread to close. Waits only if the next segment is not yet 
+         * ready. The property mutex must be held.
+         * @return true on success, false if the next segment failed to open.
+         */
+        bool nextSegment();
+        
+        /**
+         * @brief Gets the id for a string, writing a new string record to 
+         * the current segment if not yet defined.
+         * @param[in] str string to get the id for.
+         * @return id for the string, 0 if str is empty.
+         */
+        uint32_t getStringId(const char* str);
+        
+        /**
+         * @brief Gets the next record in the current segment.
+         * @return pointer to the record to fill in.
+         */
+        uint8_t* nextRecord();
+        
+        /**
+         * @brief Commits all records returned by nextRecord, making them 
+         * visible to readers of the segment.
+         */
+        void commitRecords();
+    
+        /**
+         * @brief relative or absolute path for the segment files.
+         */ 
+        std::string m_filePath;
+        
+        /**
+         * @brief file descriptor of the current segment, -1 if none.
+         */
+        int m_fd;
+        
+        /**
+         * @brief mapping of the current segment, NULL if none.
+         */
+        uint8_t* m_pSegment;
+        
+        /**
+         * @brief index of the current segment.
+         */
+        uint64_t m_segmentIndex;
+        
+        /**
+         * @brief number of records written to the current segment, 
+         * excluding the header.
+         */
+        uint64_t m_recordCount;
+        
+        /**
+         * @brief maximum number of records the segment can hold.
+         */
+        uint64_t m_maxRecords;
+        
+        /**
+         * @brief ids of the strings defined in the current segment.
+         */
+        std::unordered_map<std::string, uint32_t> m_stringIds;
+        
+        /**
+         * @brief reusable key for string id lookups.
+         */
+        std::string m_stringKey;
+        
+        /**
+         * @brief index of the next segment to pre-allocate.
+         */
+        uint64_t m_nextIndex;
+        
+        /**
+         * @brief file descriptor and mapping of the next segment, 
+         * -1 and NULL until ready.
+         */
+        int m_nextFd;
+        uint8_t* m_pNextSegment;
+        
+        /**
+         * @brief set if the segment thread failed to create the next segment.
+         */
+        bool m_nextFailed;
+        
+        /**
+         * @brief previous segment for the segment thread to close, 
+         * m_pRetiredSegment is NULL if none.
+         */
+        int m_retiredFd;
+        uint8_t* m_pRetiredSegment;
+        uint64_t m_retiredRecordCount;
+        uint64_t m_retiredIndex;
+        
+        /**
+         * @brief set on destruction to stop the segment thread.
+         */
+        bool m_stop;
+        
+        /**
+         * @brief mutex to protect the next and retired segments.
+         */
+        DslMutex m_segmentMutex;
+        
+        /**
+         * @brief condition to wake the segment thread.
+         */
+        DslCond m_segmentCond;
+        
+        /**
+         * @brief condition to signal the next segment is ready, or failed.
+         */
+        DslCond m_nextReadyCond;
+        
+        /**
+         * @brief the segment thread.
+         */
+        GThread* m_pThread;
+    };
+    
+    /**
+     * @brief Thread function to run a Binary File ODE Action's segment loop.
+     * @param[in] pAction pointer to the FileBinaryOdeAction to run.
+     * @return NULL always.
+     */
+    static gpointer file_binary_segment_thread(gpointer pAction);
+        
     // ********************************************************************
 
     /**
@@ -2165,7 +2890,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
     private:
@@ -2375,8 +3100,15 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pBaseTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Overrides the base function - the Action calls back into 
+         * other ODE components.
+         * @return true always.
+         */
+        bool RequiresSerialExecution(){return true;};
         
     private:
     
@@ -2418,8 +3150,15 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Overrides the base function - the Action calls back into 
+         * other ODE components.
+         * @return true always.
+         */
+        bool RequiresSerialExecution(){return true;};
         
     private:
     
@@ -2461,8 +3200,15 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pBaseTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Overrides the base function - the Action calls back into 
+         * other ODE components.
+         * @return true always.
+         */
+        bool RequiresSerialExecution(){return true;};
         
     private:
     
@@ -2504,8 +3250,15 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Overrides the base function - the Action calls back into 
+         * other ODE components.
+         * @return true always.
+         */
+        bool RequiresSerialExecution(){return true;};
         
     private:
     
@@ -2547,8 +3300,15 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Overrides the base function - the Action calls back into 
+         * other ODE components.
+         * @return true always.
+         */
+        bool RequiresSerialExecution(){return true;};
         
     private:
     
@@ -2591,8 +3351,15 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Overrides the base function - the Action calls back into 
+         * other ODE components.
+         * @return true always.
+         */
+        bool RequiresSerialExecution(){return true;};
         
     private:
     
@@ -2639,8 +3406,15 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Overrides the base function - the Action calls back into 
+         * other ODE components.
+         * @return true always.
+         */
+        bool RequiresSerialExecution(){return true;};
         
     private:
     
@@ -2689,7 +3463,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2748,7 +3522,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2794,7 +3568,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2853,7 +3627,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2897,7 +3671,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -3000,7 +3774,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -3061,7 +3835,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
         /**
@@ -0,0 +1,282 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "Dsl.h"
+#include "DslOdeActionExecutor.h"
+#include "DslOdeAction.h"
+
+namespace DSL
+{
+    OdeDeferredOccurrence::OdeDeferredOccurrence(
+        std::shared_ptr<DeferrableOdeAction> pAction, DSL_BASE_PTR pOdeTrigger, 
+        uint64_t eventId, uint64_t occurrences, NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
+        : pAction(pAction)
+        , pOdeTrigger(pOdeTrigger)
+        , eventId(eventId)
+        , occurrences(occurrences)
+        , frameMeta(*pFrameMeta)
+        , objectMeta{}
+        , isObjectOccurrence(pObjectMeta != NULL)
+    {
+        // No function log - avoid overhead.
+        
+        // All meta pointers are only valid while the batch is held.
+        frameMeta.base_meta.batch_meta = NULL;
+        frameMeta.obj_meta_list = NULL;
+        frameMeta.display_meta_list = NULL;
+        frameMeta.frame_user_meta_list = NULL;
+        
+        if (!pObjectMeta)
+        {
+            return;
+        }
+        objectMeta = *pObjectMeta;
+        objectMeta.base_meta.batch_meta = NULL;
+        objectMeta.parent = NULL;
+        objectMeta.classifier_meta_list = NULL;
+        objectMeta.obj_user_meta_list = NULL;
+        objectMeta.text_params.display_text = NULL;
+        
+        if (!pObjectMeta->classifier_meta_list)
+        {
+            return;
+        }
+        
+        // Size all vectors up front so the list links stay valid.
+        uint classifierCount(0), labelCount(0);
+        for (GList* pClassifierMetaList = pObjectMeta->classifier_meta_list;
+            pClassifierMetaList; pClassifierMetaList = pClassifierMetaList->next)
+        {
+            NvDsClassifierMeta* pClassifierMeta = 
+                (NvDsClassifierMeta*)(pClassifierMetaList->data);
+            if (pClassifierMeta != NULL)
+            {
+                classifierCount++;
+                labelCount += g_list_length(pClassifierMeta->label_info_list);
+            }
+        }
+        classifierMeta.reserve(classifierCount);
+        labelInfo.reserve(labelCount);
+        listNodes.reserve(classifierCount + labelCount);
+
+        GList* pLastClassifierNode(NULL);
+        for (GList* pClassifierMetaList = pObjectMeta->classifier_meta_list;
+            pClassifierMetaList; pClassifierMetaList = pClassifierMetaList->next)
+        {
+            NvDsClassifierMeta* pClassifierMeta = 
+                (NvDsClassifierMeta*)(pClassifierMetaList->data);
+            if (pClassifierMeta == NULL)
+            {
+                continue;
+            }
+            classifierMeta.push_back(*pClassifierMeta);
+            NvDsClassifierMeta* pCopy = &classifierMeta.back();
+            pCopy->base_meta.batch_meta = NULL;
+            pCopy->label_info_list = NULL;
+            
+            GList* pLastLabelNode(NULL);
+            for (GList* pLabelInfoList = pClassifierMeta->label_info_list;
+                pLabelInfoList; pLabelInfoList = pLabelInfoList->next)
+            {
+                NvDsLabelInfo* pLabelInfo = (NvDsLabelInfo*)(pLabelInfoList->data);
+                if (pLabelInfo == NULL)
+                {
+                    continue;
+                }
+                labelInfo.push_back(*pLabelInfo);
+                labelInfo.back().base_meta.batch_meta = NULL;
+                labelInfo.back().pResult_label = NULL;
+                
+                listNodes.push_back({&labelInfo.back(), NULL, pLastLabelNode});
+                if (pLastLabelNode)
+                {
+                    pLastLabelNode->next = &listNodes.back();
+                }
+                else
+                {
+                    pCopy->label_info_list = &listNodes.back();
+                }
+                pLastLabelNode = &listNodes.back();
+            }
+            
+            listNodes.push_back({pCopy, NULL, pLastClassifierNode});
+            if (pLastClassifierNode)
+            {
+                pLastClassifierNode->next = &listNodes.back();
+            }
+            else
+            {
+                objectMeta.classifier_meta_list = &listNodes.back();
+            }
+            pLastClassifierNode = &listNodes.back();
+        }
+    }
+    
+    //--------------------------------------------------------------------------------
+    
+    OdeActionExecutor* OdeActionExecutor::GetExecutor()
+    {
+        static OdeActionExecutor executor(DSL_ODE_ACTION_EXECUTOR_WORKERS,
+            DSL_ODE_ACTION_EXECUTOR_QUEUE_SIZE);
+        
+        return &executor;
+    }
+    
+    OdeActionExecutor::OdeActionExecutor(uint numWorkers, uint queueSize)
+        : m_stop(false)
+    {
+        LOG_FUNC();
+        
+        for (uint i = 0; i < numWorkers; i++)
+        {
+            m_workers.push_back(std::unique_ptr<OdeActionExecutorWorker>(
+                new OdeActionExecutorWorker(this, queueSize)));
+        }
+        for (const auto &ivec: m_workers)
+        {
+            ivec->pThread = g_thread_new("ode-action-executor", 
+                ode_action_executor_thread, ivec.get());
+        }
+    }
+    
+    OdeActionExecutor::~OdeActionExecutor()
+    {
+        LOG_FUNC();
+        
+        m_stop = true;
+        for (const auto &ivec: m_workers)
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&ivec->mutex);
+            g_cond_signal(&ivec->wakeCond);
+        }
+        for (const auto &ivec: m_workers)
+        {
+            g_thread_join(ivec->pThread);
+        }
+    }
+    
+    bool OdeActionExecutor::Queue(OdeDeferredOccurrence* pOccurrence)
+    {
+        // No function log - avoid overhead.
+        
+        // The same Action is always serviced by the same worker.
+        OdeActionExecutorWorker* pWorker = m_workers[
+            std::hash<DeferrableOdeAction*>()(pOccurrence->pAction.get()) 
+                % m_workers.size()].get();
+                
+        if (!pWorker->queue.Push(pOccurrence))
+        {
+            return false;
+        }
+        pWorker->queued++;
+        
+        // Pairs with the fence in WorkerThread - either the worker sees the 
+        // new occurrence, or we see that it is sleeping and wake it.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (pWorker->sleeping.load(std::memory_order_relaxed))
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&pWorker->mutex);
+            g_cond_signal(&pWorker->wakeCond);
+        }
+        return true;
+    }
+    
+    void OdeActionExecutor::Flush()
+    {
+        LOG_FUNC();
+        
+        for (const auto &ivec: m_workers)
+        {
+            uint64_t target = ivec->queued;
+            
+            ivec->flushing++;
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&ivec->mutex);
+                while (ivec->handled < target)
+                {
+                    g_cond_wait(&ivec->handledCond, &ivec->mutex);
+                }
+            }
+            ivec->flushing--;
+        }
+    }
+    
+    void OdeActionExecutor::handleOccurrence(OdeActionExecutorWorker* pWorker,
+        OdeDeferredOccurrence* pOccurrence)
+    {
+        // No function log - avoid overhead.
+        
+        pOccurrence->pAction->HandleDeferredOccurrence(*pOccurrence);
+        delete pOccurrence;
+        
+        pWorker->handled++;
+        if (pWorker->flushing)
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&pWorker->mutex);
+            g_cond_broadcast(&pWorker->handledCond);
+        }
+    }
+    
+    void OdeActionExecutor::WorkerThread(OdeActionExecutorWorker* pWorker)
+    {
+        OdeDeferredOccurrence* pOccurrence(NULL);
+        
+        while (true)
+        {
+            while (pWorker->queue.Pop(pOccurrence))
+            {
+                handleOccurrence(pWorker, pOccurrence);
+            }
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&pWorker->mutex);
+            
+            pWorker->sleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            
+            // Re-check once flagged as sleeping, as a producer that pushed 
+            // before seeing the flag will not signal.
+            if (pWorker->queue.GetSize())
+            {
+                pWorker->sleeping = false;
+                continue;
+            }
+            if (m_stop)
+            {
+                break;
+            }
+            g_cond_wait(&pWorker->wakeCond, &pWorker->mutex);
+            pWorker->sleeping = false;
+        }
+    }
+
+    static gpointer ode_action_executor_thread(gpointer pWorker)
+    {
+        OdeActionExecutorWorker* pExecutorWorker = 
+            static_cast<OdeActionExecutorWorker*>(pWorker);
+        pExecutorWorker->pExecutor->WorkerThread(pExecutorWorker);
+        
+        return NULL;
+    }
+}
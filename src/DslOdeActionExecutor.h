@@ -0,0 +1,232 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_ODE_ACTION_EXECUTOR_H
+#define _DSL_ODE_ACTION_EXECUTOR_H
+
+#include "Dsl.h"
+#include "DslBase.h"
+#include "DslBoundedQueue.h"
+
+namespace DSL
+{
+    /**
+     * @brief number of worker threads servicing the deferred ODE occurrences.
+     */
+    #define DSL_ODE_ACTION_EXECUTOR_WORKERS                             2
+    
+    /**
+     * @brief maximum number of deferred ODE occurrences pending per worker.
+     * Occurrences queued when full are dropped and counted.
+     */
+    #define DSL_ODE_ACTION_EXECUTOR_QUEUE_SIZE                          1024
+    
+    // forward declaration - see DslOdeAction.h
+    class DeferrableOdeAction;
+    
+    /**
+     * @struct OdeDeferredOccurrence
+     * @brief Owned copy of an ODE occurrence that can be handled after the
+     * batch's metadata has been released. The frame and object metadata 
+     * are copied by value with all pointers into the batch's metadata 
+     * cleared, except for the object's classifier metadata which is 
+     * copied and re-linked.
+     */
+    struct OdeDeferredOccurrence
+    {
+        OdeDeferredOccurrence(std::shared_ptr<DeferrableOdeAction> pAction,
+            DSL_BASE_PTR pOdeTrigger, uint64_t eventId, uint64_t occurrences,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+            
+        /**
+         * @brief Action to handle the occurrence.
+         */
+        std::shared_ptr<DeferrableOdeAction> pAction;
+        
+        /**
+         * @brief ODE Trigger that triggered the occurrence.
+         */
+        DSL_BASE_PTR pOdeTrigger;
+        
+        /**
+         * @brief unique ODE id and Trigger occurrences at the time of the
+         * occurrence.
+         */
+        uint64_t eventId;
+        uint64_t occurrences;
+        
+        /**
+         * @brief copy of the Frame Meta that triggered the occurrence.
+         */
+        NvDsFrameMeta frameMeta;
+        
+        /**
+         * @brief copy of the Object Meta that triggered the occurrence, 
+         * valid only if isObjectOccurrence is true.
+         */
+        NvDsObjectMeta objectMeta;
+        
+        /**
+         * @brief true if an object occurrence, false for frame-level events.
+         */
+        bool isObjectOccurrence;
+        
+        /**
+         * @brief copies of the object's classifier and label-info metadata,
+         * and the list nodes linking them into objectMeta.classifier_meta_list.
+         */
+        std::vector<NvDsClassifierMeta> classifierMeta;
+        std::vector<NvDsLabelInfo> labelInfo;
+        std::vector<GList> listNodes;
+    };
+    
+    class OdeActionExecutor;
+    
+    /**
+     * @struct OdeActionExecutorWorker
+     * @brief Single worker thread of the ODE Action Executor with its own
+     * queue of pending occurrences.
+     */
+    struct OdeActionExecutorWorker
+    {
+        OdeActionExecutorWorker(OdeActionExecutor* pParent, uint queueSize)
+            : pExecutor(pParent)
+            , queue(queueSize)
+            , sleeping(false)
+            , flushing(0)
+            , queued(0)
+            , handled(0)
+            , pThread(NULL)
+        {};
+        
+        /**
+         * @brief executor that owns the worker.
+         */
+        OdeActionExecutor* pExecutor;
+        
+        /**
+         * @brief occurrences pending for this worker.
+         */
+        BoundedQueue<OdeDeferredOccurrence*> queue;
+        
+        /**
+         * @brief true while the worker is, or is about to be, waiting on
+         * wakeCond. Producers only take the worker's mutex to wake it.
+         */
+        std::atomic<bool> sleeping;
+        
+        /**
+         * @brief number of threads waiting in Flush for this worker.
+         */
+        std::atomic<uint> flushing;
+        
+        /**
+         * @brief running counts of occurrences queued and handled.
+         */
+        std::atomic<uint64_t> queued;
+        std::atomic<uint64_t> handled;
+        
+        /**
+         * @brief mutex and conditions to wake the worker, and to wait on 
+         * the worker to handle all queued occurrences.
+         */
+        DslMutex mutex;
+        DslCond wakeCond;
+        DslCond handledCond;
+        
+        /**
+         * @brief the worker's thread.
+         */
+        GThread* pThread;
+    };
+    
+    /**
+     * @class OdeActionExecutor
+     * @brief Process-wide pool of worker threads that handle deferred ODE
+     * occurrences off of the streaming thread. Each Action is serviced by 
+     * the same worker, so an Action's occurrences are always handled in the 
+     * order they were queued. Queuing never waits on a busy worker.
+     */
+    class OdeActionExecutor
+    {
+    public:
+    
+        /**
+         * @brief Gets the executor, starting its workers on first call.
+         */
+        static OdeActionExecutor* GetExecutor();
+        
+        /**
+         * @brief Queues an occurrence to be handled by a worker thread.
+         * @param[in] pOccurrence occurrence to queue. Ownership is taken 
+         * on success only.
+         * @return true on success, false if the worker's queue is full.
+         */
+        bool Queue(OdeDeferredOccurrence* pOccurrence);
+        
+        /**
+         * @brief Blocks until all occurrences queued before the call have
+         * been handled.
+         */
+        void Flush();
+        
+        /**
+         * @brief Worker thread function. ** To be called by the worker threads only **.
+         * @param[in] pWorker the calling worker.
+         */
+        void WorkerThread(OdeActionExecutorWorker* pWorker);
+        
+    private:
+    
+        OdeActionExecutor(uint numWorkers, uint queueSize);
+        
+        ~OdeActionExecutor();
+        
+        /**
+         * @brief handles a single occurrence and frees it.
+         */
+        void handleOccurrence(OdeActionExecutorWorker* pWorker,
+            OdeDeferredOccurrence* pOccurrence);
+        
+        /**
+         * @brief workers created on construction.
+         */
+        std::vector<std::unique_ptr<OdeActionExecutorWorker>> m_workers;
+        
+        /**
+         * @brief set on destruction to stop all workers once their queues
+         * are empty.
+         */
+        std::atomic<bool> m_stop;
+    };
+    
+    /**
+     * @brief Thread function to run an ODE Action Executor's worker loop.
+     * @param[in] pWorker pointer to the OdeActionExecutorWorker to run.
+     * @return NULL always.
+     */
+    static gpointer ode_action_executor_thread(gpointer pWorker);
+}
+
+#endif // _DSL_ODE_ACTION_EXECUTOR_H
@@ -43,7 +43,7 @@ namespace DSL
         LOG_FUNC();
     }
         
-    void OdeArea::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData,  
+    void OdeArea::AddMeta(DisplayMetaAllocator& displayMetaData,  
         NvDsFrameMeta* pFrameMeta)
     {
         LOG_FUNC();
@@ -125,6 +125,8 @@ namespace DSL
         DSL_RGBA_POLYGON_PTR pPolygon, bool show, uint bboxTestPoint)
         : OdeArea(name, pPolygon, show, bboxTestPoint)
         , m_pPolygon(pPolygon)
+        , m_preparedPolygon(*pPolygon)
+        , m_lineHalfWidth(pPolygon->border_width/2)
     {
         LOG_FUNC();
     }
@@ -138,66 +140,60 @@ namespace DSL
     {
         // Do not log function entry
         
-        GeosPolygon testPolygon(bbox);
-        
         if (m_bboxTestPoint == DSL_BBOX_POINT_ANY)
         {
-            return (((GeosPolygon)*m_pPolygon).Overlaps(testPolygon) or
-                ((GeosPolygon)*m_pPolygon).Contains(testPolygon) or
-                testPolygon.Contains((GeosPolygon)*m_pPolygon));
+            // bboxes clear of the Polygon's bounds can't overlap or contain
+            if (m_preparedPolygon.IsOutsideBounds(bbox))
+            {
+                return false;
+            }
+            GeosPolygon testPolygon(bbox);
+            
+            return (m_preparedPolygon.m_geosPolygon.Overlaps(testPolygon) or
+                m_preparedPolygon.m_geosPolygon.Contains(testPolygon) or
+                testPolygon.Contains(m_preparedPolygon.m_geosPolygon));
         }        
         dsl_coordinate coordinate;
         getCoordinate(bbox, coordinate);
         
-        GeosPoint testPoint(coordinate.x, coordinate.y);
-        return ((GeosPolygon)*m_pPolygon).Contains(testPoint);
+        return m_preparedPolygon.Contains(coordinate.x, coordinate.y);
     }
 
     bool OdePolygonArea::IsPointInside(const dsl_coordinate& coordinate)
     {
         // Do not log function entry
 
-        GeosPoint testPoint(coordinate.x, coordinate.y);
-
+        // points clear of the Polygon's bounds, including line width, are 
+        // neither on a line nor inside. 
+        if (m_preparedPolygon.IsOutsideBounds(coordinate.x, coordinate.y,
+            m_lineHalfWidth+1))
+        {
+            return false;
+        }
         // first test to see if the coordinate is touching one of the lines
-        for (uint i = 0; i < m_pPolygon->num_coordinates-1; i++)
+        if (m_preparedPolygon.IsNearEdge(coordinate.x, coordinate.y, 
+            m_lineHalfWidth))
         {
-            GeosLine lineSegment(
-                m_pPolygon->coordinates[i].x, 
-                m_pPolygon->coordinates[i].y, 
-                m_pPolygon->coordinates[(i+1)].x, 
-                m_pPolygon->coordinates[(i+1)].y);
-            
-            if (lineSegment.Distance(testPoint) <= 
-                (m_pPolygon->border_width/2))
-            {
-                return false;
-            }
+            return false;
         }
-        return ((GeosPolygon)*m_pPolygon).Contains(testPoint);          
+        return m_preparedPolygon.Contains(coordinate.x, coordinate.y);          
     }
     
     uint OdePolygonArea::GetPointLocation(const dsl_coordinate& coordinate)
     {
         // Do not log function entry
         
-        GeosPoint testPoint(coordinate.x, coordinate.y);
-
-        for (uint i = 0; i < m_pPolygon->num_coordinates-1; i++)
+        if (m_preparedPolygon.IsOutsideBounds(coordinate.x, coordinate.y,
+            m_lineHalfWidth+1))
         {
-            GeosLine lineSegment(
-                m_pPolygon->coordinates[i].x, 
-                m_pPolygon->coordinates[i].y, 
-                m_pPolygon->coordinates[(i+1)].x, 
-                m_pPolygon->coordinates[(i+1)].y);
-            
-            if (lineSegment.Distance(testPoint) <= 
-                (m_pPolygon->border_width/2))
-            {
-                return DSL_AREA_POINT_LOCATION_ON_LINE;
-            }
+            return DSL_AREA_POINT_LOCATION_OUTSIDE;
         }
-        return ((GeosPolygon)*m_pPolygon).Contains(testPoint)
+        if (m_preparedPolygon.IsNearEdge(coordinate.x, coordinate.y, 
+            m_lineHalfWidth))
+        {
+            return DSL_AREA_POINT_LOCATION_ON_LINE;
+        }
+        return m_preparedPolygon.Contains(coordinate.x, coordinate.y)
             ? DSL_AREA_POINT_LOCATION_INSIDE
             : DSL_AREA_POINT_LOCATION_OUTSIDE;
     }
@@ -206,23 +202,13 @@ namespace DSL
     {
         // Do not log function entry
 
-        GeosPoint point(coordinate.x, coordinate.y);
-        
-        for (uint i = 0; i < m_pPolygon->num_coordinates-1; i++)
+        if (m_preparedPolygon.IsOutsideBounds(coordinate.x, coordinate.y,
+            m_lineHalfWidth+1))
         {
-            GeosLine lineSegment(
-                m_pPolygon->coordinates[i].x, 
-                m_pPolygon->coordinates[i].y, 
-                m_pPolygon->coordinates[(i+1)].x, 
-                m_pPolygon->coordinates[(i+1)].y);
-            
-            if (lineSegment.Distance(point) <= 
-                (m_pPolygon->border_width/2))
-            {
-                return true;
-            }
+            return false;
         }
-        return false;
+        return m_preparedPolygon.IsNearEdge(coordinate.x, coordinate.y, 
+            m_lineHalfWidth);
     }
     
     bool OdePolygonArea::DoesTraceCrossLine(dsl_coordinate* coordinates, 
@@ -230,28 +216,22 @@ namespace DSL
     {
         // Do not log function entry
         
-        // covert the trace vector to line-parameters for testing
-        dsl_multi_line_params lineParms = {coordinates, numCoordinates};
-        
         direction = DSL_AREA_CROSS_DIRECTION_NONE;
 
-        // create a Geos object from the line-parameters to check 
-        // for cross with this Area's line.
-        GeosMultiLine multiLine(lineParms);
+        // covert the trace vector to a path to check for cross with 
+        // this Area's polygon boundary.
+        GeometryPath trace(coordinates, numCoordinates, false);
         
-        if (!multiLine.Crosses(*m_pPolygon))
+        if (!GeometryPathIntersectsPath(trace, m_preparedPolygon.m_ring))
         { 
             return false;
         }
         
         // use the Area's line width and trace-endpoint to determine if the cross
         // is sufficient to report, i.e. the line width is used as hysteresis.
-        GeosPoint endPoint(
+        bool crossed(GeometryPointToPathDistance(m_preparedPolygon.m_ring,
             coordinates[numCoordinates-1].x, 
-            coordinates[numCoordinates-1].y);
-        
-        bool crossed(((GeosPolygon)*m_pPolygon).Distance(endPoint) > 
-            (m_pPolygon->border_width/2));
+            coordinates[numCoordinates-1].y) > m_lineHalfWidth);
 
         if (crossed)
         {
@@ -300,6 +280,7 @@ namespace DSL
         DSL_RGBA_LINE_PTR pLine, bool show, uint bboxTestPoint)
         : OdeArea(name, pLine, show, bboxTestPoint)
         , m_pLine(pLine)
+        , m_linePath(pLine->x1, pLine->y1, pLine->x2, pLine->y2)
     {
         LOG_FUNC();
     }
@@ -338,10 +319,8 @@ namespace DSL
     {
         // Do not log function entry
 
-        GeosPoint point(coordinate.x, coordinate.y);
-        
-        if (((GeosLine)*m_pLine).Distance(point) <= 
-            (m_pLine->line_width/2))
+        if (GeometryPointToPathDistance(m_linePath, 
+            coordinate.x, coordinate.y) <= (m_pLine->line_width/2))
         {
             return DSL_AREA_POINT_LOCATION_ON_LINE;
         }
@@ -358,10 +337,8 @@ namespace DSL
     {
         // Do not log function entry
 
-        GeosPoint point(coordinate.x, coordinate.y);
-        
-        return (((GeosLine)*m_pLine).Distance(point) <= 
-            (m_pLine->line_width/2));
+        return (GeometryPointToPathDistance(m_linePath, 
+            coordinate.x, coordinate.y) <= (m_pLine->line_width/2));
     }
     
     bool OdeLineArea::DoesTraceCrossLine(dsl_coordinate* coordinates,
@@ -369,29 +346,22 @@ namespace DSL
     {
         // Do not log function entry
         
-        // covert the trace vector to line-parameters for testing
-        dsl_multi_line_params lineParms = {coordinates, 
-            numCoordinates};
-
         direction = DSL_AREA_CROSS_DIRECTION_NONE;
         
-        // create a Geos object from the line-parameters to check 
-        // for cross with this Area's line.
-        GeosMultiLine multiLine(lineParms);
+        // covert the trace vector to a path to check for cross with 
+        // this Area's line.
+        GeometryPath trace(coordinates, numCoordinates, false);
         
-        if (!multiLine.Crosses(*m_pLine))
+        if (!GeometryPathIntersectsPath(trace, m_linePath))
         { 
             return false;
         }
 
         // use the Area's line width and trace-endpoint to determine if the cross
         // is sufficient to report, i.e. the line width is used as hysteresis.
-        GeosPoint endPoint(
+        bool crossed(GeometryPointToPathDistance(m_linePath,
             coordinates[numCoordinates-1].x, 
-            coordinates[numCoordinates-1].y);
-        
-        bool crossed(((GeosLine)*m_pLine).Distance(endPoint) > 
-            (m_pLine->line_width/2));
+            coordinates[numCoordinates-1].y) > (m_pLine->line_width/2));
             
         if (crossed)
         {
@@ -412,6 +382,8 @@ namespace DSL
         DSL_RGBA_MULTI_LINE_PTR pMultiLine, bool show, uint bboxTestPoint)
         : OdeArea(name, pMultiLine, show, bboxTestPoint)
         , m_pMultiLine(pMultiLine)
+        , m_multiLinePath(pMultiLine->coordinates, 
+            pMultiLine->num_coordinates, false)
     {
         LOG_FUNC();
     }
@@ -454,10 +426,8 @@ namespace DSL
         // Do not log function entry
 
         uint inside(0), outside(0);
-        GeosPoint point(coordinate.x, coordinate.y);
-
-        if (((GeosMultiLine)*m_pMultiLine).Distance(point) <= 
-            (m_pMultiLine->line_width/2))
+        if (GeometryPointToPathDistance(m_multiLinePath, 
+            coordinate.x, coordinate.y) <= (m_pMultiLine->line_width/2))
         {
             return false;
         }
@@ -486,10 +456,8 @@ namespace DSL
         // Do not log function entry
 
         uint inside(0), outside(0);
-        GeosPoint point(coordinate.x, coordinate.y);
-
-        if (((GeosMultiLine)*m_pMultiLine).Distance(point) <= 
-            (m_pMultiLine->line_width/2))
+        if (GeometryPointToPathDistance(m_multiLinePath, 
+            coordinate.x, coordinate.y) <= (m_pMultiLine->line_width/2))
         {
             return DSL_AREA_POINT_LOCATION_ON_LINE;
         }
@@ -517,10 +485,10 @@ namespace DSL
     
     bool OdeMultiLineArea::IsPointOnLine(const dsl_coordinate& coordinate)
     {
-        GeosPoint point(coordinate.x, coordinate.y);
-        
-        return (((GeosMultiLine)*m_pMultiLine).Distance(point) <= 
-            (m_pMultiLine->line_width/2));
+        // Do not log function entry
+
+        return (GeometryPointToPathDistance(m_multiLinePath, 
+            coordinate.x, coordinate.y) <= (m_pMultiLine->line_width/2));
     }
     
     bool OdeMultiLineArea::DoesTraceCrossLine(dsl_coordinate* coordinates, 
@@ -528,29 +496,22 @@ namespace DSL
     {
         // Do not log function entry
         
-        // covert the trace vector to line-parameters for testing
-        dsl_multi_line_params lineParms = {coordinates, 
-            numCoordinates};
-
         direction = DSL_AREA_CROSS_DIRECTION_NONE;
         
-        // create a Geos object from the line-parameters to check 
-        // for cross with this Area's line.
-        GeosMultiLine multiLine(lineParms);
+        // covert the trace vector to a path to check for cross with 
+        // this Area's multi-line.
+        GeometryPath trace(coordinates, numCoordinates, false);
         
-        if (!multiLine.Crosses(*m_pMultiLine))
+        if (!GeometryPathIntersectsPath(trace, m_multiLinePath))
         { 
             return false;
         }
         
         // use the Area's line width and trace-endpoint to determine if the cross
         // is sufficient to report, i.e. the line width is used as hysteresis.
-        GeosPoint endPoint(
+        bool crossed(GeometryPointToPathDistance(m_multiLinePath,
             coordinates[numCoordinates-1].x, 
-            coordinates[numCoordinates-1].y);
-        
-        bool crossed(((GeosMultiLine)*m_pMultiLine).Distance(endPoint) > 
-            (m_pMultiLine->line_width/2));
+            coordinates[numCoordinates-1].y) > (m_pMultiLine->line_width/2));
             
         if (crossed)
         {
@@ -86,7 +86,7 @@ namespace DSL
          * structures to add the Area's underliying Display Type to.
          * @param[in] pFrameMeta the Frame metadata for the current Frame
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData,  
+        void AddMeta(DisplayMetaAllocator& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
         
         /**
@@ -243,6 +243,18 @@ namespace DSL
          * @brief Polygon display type used to define the Area's location, dimensions, and color
          */
         DSL_RGBA_POLYGON_PTR m_pPolygon;
+
+        /**
+         * @brief Polygon edges, bounds, and GEOS Polygon built once from 
+         * m_pPolygon - the Polygon's coordinates can't be changed once created.
+         */
+        PreparedPolygon m_preparedPolygon;
+        
+        /**
+         * @brief half of the Polygon's border width - distance from an edge
+         * that is considered on-line.
+         */
+        uint m_lineHalfWidth;
         
     };
 
@@ -360,6 +372,11 @@ namespace DSL
          */
         DSL_RGBA_LINE_PTR m_pLine;
 
+        /**
+         * @brief single segment path for m_pLine, built once.
+         */
+        GeometryPath m_linePath;
+
         /**
          * @brief one of DSL_BBOX_EDGE values defining which edge
          * of the bounding box to test for lines crossing
@@ -438,6 +455,11 @@ namespace DSL
          */
         DSL_RGBA_MULTI_LINE_PTR m_pMultiLine;
 
+        /**
+         * @brief path for m_pMultiLine's coordinates, built once.
+         */
+        GeometryPath m_multiLinePath;
+
         /**
          * @brief one of DSL_BBOX_EDGE values defining which edge
          * of the bounding box to test for lines crossing
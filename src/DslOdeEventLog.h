@@ -0,0 +1,379 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_ODE_EVENT_LOG_H
+#define _DSL_ODE_EVENT_LOG_H
+
+// This header has no GStreamer or DeepStream dependencies so that 
+// offline tools can include it to read event log files on their own.
+#include "DslApi.h"
+
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <ostream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__,
+    "ODE event log records are written and read as little-endian");
+
+namespace DSL
+{
+    /**
+     * @brief Event log file identifier and version, written to the start 
+     * of each segment file.
+     */
+    #define DSL_ODE_EVENT_LOG_MAGIC                                     "DSLODEB1"
+    #define DSL_ODE_EVENT_LOG_VERSION                                   1
+
+    /**
+     * @brief Size of every record in a segment file, including the header.
+     */
+    #define DSL_ODE_EVENT_LOG_RECORD_SIZE                               80
+    
+    /**
+     * @brief Pre-allocated size of each segment file. Segments are truncated 
+     * to the size used when closed.
+     */
+    #define DSL_ODE_EVENT_LOG_SEGMENT_SIZE                              (64*1024*1024)
+    
+    /**
+     * @brief Record types. String records define an id for a name used by 
+     * the event records that follow them in the same segment.
+     */
+    #define DSL_ODE_EVENT_LOG_RECORD_EVENT                              1
+    #define DSL_ODE_EVENT_LOG_RECORD_STRING                             2
+    
+    /**
+     * @brief Event record flags - the direction is stored as one of the 
+     * DSL_AREA_CROSS_DIRECTION_* values shifted into bits 2 and 3.
+     */
+    #define DSL_ODE_EVENT_LOG_FLAG_OBJECT                               0x0001
+    #define DSL_ODE_EVENT_LOG_FLAG_INFER_DONE                           0x0002
+    #define DSL_ODE_EVENT_LOG_FLAG_DIRECTION_SHIFT                      2
+    #define DSL_ODE_EVENT_LOG_FLAG_DIRECTION_MASK                       0x000C
+    
+    /**
+     * @brief Maximum length of a string record's text, longer names are truncated.
+     */
+    #define DSL_ODE_EVENT_LOG_MAX_STRING_LENGTH                         72
+
+    /**
+     * @struct OdeEventLogHeader
+     * @brief First record in each segment file. recordCount is updated after
+     * each record is written, so a segment can be read while it's written.
+     */
+    struct OdeEventLogHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t recordSize;
+        uint64_t recordCount;
+        uint64_t segmentIndex;
+        uint8_t reserved[48];
+    };
+
+    /**
+     * @struct OdeEventLogEventRecord
+     * @brief Fixed-size record for a single ODE occurrence. String ids are 0 
+     * if unset, i.e. labelId for Frame level events.
+     */
+    struct OdeEventLogEventRecord
+    {
+        uint16_t type;
+        uint16_t flags;
+        uint32_t triggerId;
+        uint64_t eventId;
+        uint64_t ntpTimestamp;
+        uint64_t trackingId;
+        uint64_t occurrences;
+        uint32_t sourceId;
+        uint32_t frameNum;
+        int32_t classId;
+        uint32_t labelId;
+        float left;
+        float top;
+        float width;
+        float height;
+        float inferConfidence;
+        float trackerConfidence;
+    };
+
+    /**
+     * @struct OdeEventLogStringRecord
+     * @brief Fixed-size record defining a string id for the segment.
+     */
+    struct OdeEventLogStringRecord
+    {
+        uint16_t type;
+        uint16_t length;
+        uint32_t stringId;
+        char text[DSL_ODE_EVENT_LOG_MAX_STRING_LENGTH];
+    };
+
+    static_assert(sizeof(OdeEventLogHeader) == DSL_ODE_EVENT_LOG_RECORD_SIZE,
+        "invalid ODE event log header size");
+    static_assert(sizeof(OdeEventLogEventRecord) == DSL_ODE_EVENT_LOG_RECORD_SIZE,
+        "invalid ODE event log event record size");
+    static_assert(sizeof(OdeEventLogStringRecord) == DSL_ODE_EVENT_LOG_RECORD_SIZE,
+        "invalid ODE event log string record size");
+
+    /**
+     * @brief Gets the file path for a segment of an event log.
+     * @param[in] filePath file path of the event log.
+     * @param[in] index index of the segment.
+     * @return "<filePath>.<index>" with the index zero padded to six digits.
+     */
+    static inline std::string OdeEventLogSegmentPath(const std::string& filePath, 
+        uint64_t index)
+    {
+        char suffix[24] = {0};
+        snprintf(suffix, sizeof(suffix), ".%06lu", (unsigned long)index);
+        return filePath + suffix;
+    }
+
+    /**
+     * @class OdeEventLogReader
+     * @brief Reads the event records from a single event log segment file,
+     * resolving the trigger names and object labels from the segment's 
+     * string records.
+     */
+    class OdeEventLogReader
+    {
+    public:
+    
+        /**
+         * @brief ctor for the OdeEventLogReader class
+         * @param[in] segmentPath path of the segment file to read.
+         */
+        OdeEventLogReader(const char* segmentPath)
+            : m_pData(NULL)
+            , m_size(0)
+            , m_next(1)
+        {
+            int fd = open(segmentPath, O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+            {
+                return;
+            }
+            struct stat fileStat;
+            if (fstat(fd, &fileStat) == 0 and 
+                (size_t)fileStat.st_size >= sizeof(OdeEventLogHeader))
+            {
+                void* pData = mmap(NULL, fileStat.st_size, PROT_READ, 
+                    MAP_SHARED, fd, 0);
+                if (pData != MAP_FAILED)
+                {
+                    m_pData = (const uint8_t*)pData;
+                    m_size = fileStat.st_size;
+                }
+            }
+            close(fd);
+            
+            if (m_pData and (memcmp(GetHeader()->magic, DSL_ODE_EVENT_LOG_MAGIC, 
+                sizeof(GetHeader()->magic)) or 
+                GetHeader()->recordSize != DSL_ODE_EVENT_LOG_RECORD_SIZE))
+            {
+                munmap((void*)m_pData, m_size);
+                m_pData = NULL;
+            }
+        };
+        
+        ~OdeEventLogReader()
+        {
+            if (m_pData)
+            {
+                munmap((void*)m_pData, m_size);
+            }
+        };
+        
+        /**
+         * @brief Returns true if the segment was opened and is a valid 
+         * event log segment.
+         */
+        bool IsOpen()
+        {
+            return m_pData != NULL;
+        };
+        
+        /**
+         * @brief Gets the segment's header.
+         */
+        const OdeEventLogHeader* GetHeader()
+        {
+            return (const OdeEventLogHeader*)m_pData;
+        };
+        
+        /**
+         * @brief Gets the next event record in the segment.
+         * @param[out] pEvent set to the next event record on success.
+         * @return false if there are no more event records.
+         */
+        bool Next(const OdeEventLogEventRecord** pEvent)
+        {
+            if (!m_pData)
+            {
+                return false;
+            }
+            // Pairs with the writer's release store after each record.
+            uint64_t recordCount = __atomic_load_n(
+                &GetHeader()->recordCount, __ATOMIC_ACQUIRE);
+            uint64_t maxRecords = m_size/DSL_ODE_EVENT_LOG_RECORD_SIZE - 1;
+            if (recordCount > maxRecords)
+            {
+                recordCount = maxRecords;
+            }
+            while (m_next <= recordCount)
+            {
+                const uint8_t* pRecord = 
+                    m_pData + (m_next++)*DSL_ODE_EVENT_LOG_RECORD_SIZE;
+                uint16_t type;
+                memcpy(&type, pRecord, sizeof(type));
+                
+                if (type == DSL_ODE_EVENT_LOG_RECORD_EVENT)
+                {
+                    *pEvent = (const OdeEventLogEventRecord*)pRecord;
+                    return true;
+                }
+                if (type == DSL_ODE_EVENT_LOG_RECORD_STRING)
+                {
+                    const OdeEventLogStringRecord* pString = 
+                        (const OdeEventLogStringRecord*)pRecord;
+                    if (pString->stringId >= m_strings.size())
+                    {
+                        m_strings.resize(pString->stringId + 1);
+                    }
+                    m_strings[pString->stringId].assign(pString->text, 
+                        std::min((uint)pString->length, 
+                            (uint)DSL_ODE_EVENT_LOG_MAX_STRING_LENGTH));
+                }
+            }
+            return false;
+        };
+        
+        /**
+         * @brief Gets a string defined by the segment's string records.
+         * @param[in] stringId id of the string to get.
+         * @return the string, or an empty string if not defined.
+         */
+        const std::string& GetString(uint32_t stringId)
+        {
+            static const std::string empty;
+            return (stringId < m_strings.size()) ? m_strings[stringId] : empty;
+        };
+        
+    private:
+    
+        /**
+         * @brief read only mapping of the segment file.
+         */
+        const uint8_t* m_pData;
+        
+        /**
+         * @brief size of the mapping in bytes.
+         */
+        size_t m_size;
+        
+        /**
+         * @brief index of the next record to read.
+         */
+        uint64_t m_next;
+        
+        /**
+         * @brief strings defined by the string records read so far.
+         */
+        std::vector<std::string> m_strings;
+    };
+    
+    /**
+     * @brief Writes the CSV column headers for an event log.
+     * @param[in] ostream output stream to write to.
+     */
+    static inline void OdeEventLogWriteCsvHeader(std::ostream& ostream)
+    {
+        ostream << "Trigger Name,Event Id,NTP Timestamp,Inference Done,"
+            << "Source Id,Frame,Occurrences,Class Id,Object Id,Label,"
+            << "Direction In,Direction Out,Infer Conf,Tracker Conf,"
+            << "Left,Top,Width,Height\n";
+    }
+    
+    /**
+     * @brief Writes all event records in a segment as CSV rows.
+     * @param[in] reader reader for the segment to convert.
+     * @param[in] ostream output stream to write to.
+     * @return number of event records written.
+     */
+    static inline uint64_t OdeEventLogWriteCsv(OdeEventLogReader& reader, 
+        std::ostream& ostream)
+    {
+        uint64_t count(0);
+        const OdeEventLogEventRecord* pEvent(NULL);
+        
+        while (reader.Next(&pEvent))
+        {
+            uint direction = (pEvent->flags & DSL_ODE_EVENT_LOG_FLAG_DIRECTION_MASK)
+                >> DSL_ODE_EVENT_LOG_FLAG_DIRECTION_SHIFT;
+                
+            ostream << reader.GetString(pEvent->triggerId) << ",";
+            ostream << pEvent->eventId << ",";
+            ostream << pEvent->ntpTimestamp << ",";
+            ostream << ((pEvent->flags & DSL_ODE_EVENT_LOG_FLAG_INFER_DONE) 
+                ? "Yes," : "No,");
+            ostream << pEvent->sourceId << ",";
+            ostream << pEvent->frameNum << ",";
+            ostream << pEvent->occurrences << ",";
+            if (pEvent->flags & DSL_ODE_EVENT_LOG_FLAG_OBJECT)
+            {
+                ostream << pEvent->classId << ",";
+                ostream << pEvent->trackingId << ",";
+                ostream << reader.GetString(pEvent->labelId) << ",";
+                ostream << ((direction == DSL_AREA_CROSS_DIRECTION_IN) 
+                    ? "Yes," : "No,");
+                ostream << ((direction == DSL_AREA_CROSS_DIRECTION_OUT) 
+                    ? "Yes," : "No,");
+                ostream << pEvent->inferConfidence << ",";
+                ostream << pEvent->trackerConfidence << ",";
+                ostream << pEvent->left << ",";
+                ostream << pEvent->top << ",";
+                ostream << pEvent->width << ",";
+                ostream << pEvent->height << "\n";
+            }
+            else
+            {
+                ostream << ",,,,,,,,,,\n";
+            }
+            count++;
+        }
+        return count;
+    }
+}
+
+#endif // _DSL_ODE_EVENT_LOG_H
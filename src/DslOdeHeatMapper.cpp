@@ -33,12 +33,13 @@ namespace DSL
         : OdeBase(name)
         , m_cols(cols)
         , m_rows(rows)
-        , m_gridRectWidth(0)
-        , m_gridRectHeight(0)
         , m_bboxTestPoint(bboxTestPoint)
+        , m_mode(DSL_ODE_HEAT_MAP_MODE_CUMULATIVE)
+        , m_decayHalfLife(0)
+        , m_decayRate(0)
+        , m_windowInterval(0)
+        , m_windowIntervals(0)
         , m_pColorPalette(pColorPalette)
-        , m_heatMap(rows, std::vector<uint64_t> (cols, 0))
-        , m_mostOccurrences(0)
         , m_legendEnabled(false)
         , m_legendLocation(0)
         , m_legendLeft(0)
@@ -49,6 +50,8 @@ namespace DSL
         LOG_FUNC();
         
         m_outBuffer = std::unique_ptr<uint64_t[]>(new uint64_t[cols*rows]);
+        
+        updatePaletteColors();
     }
 
     OdeHeatMapper::~OdeHeatMapper()
@@ -70,6 +73,7 @@ namespace DSL
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
             m_pColorPalette = pColorPalette;
+            updatePaletteColors();
         }
         // need to recalculated legend settings.
         return SetLegendSettings(m_legendEnabled, m_legendLocation,
@@ -96,6 +100,11 @@ namespace DSL
         // disable untill all params are checked.
         m_legendEnabled = false;
         
+        for (auto &imap: m_heatMaps)
+        {
+            imap.second->legendRectsValid = false;
+        }
+        
         // If client is disabling - done
         if (!enabled)
         {
@@ -140,17 +149,106 @@ namespace DSL
         return true;
     }            
 
+    uint OdeHeatMapper::GetDecay()
+    {
+        LOG_FUNC();
+        
+        return m_decayHalfLife;
+    }
+    
+    bool OdeHeatMapper::SetDecay(uint halfLife)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (halfLife == m_decayHalfLife)
+        {
+            return true;
+        }
+        // decayed counts remain valid if only the half-life is changing.
+        bool modeChanged(m_mode != DSL_ODE_HEAT_MAP_MODE_DECAY or !halfLife);
+        
+        m_decayHalfLife = halfLife;
+        m_decayRate = (halfLife) 
+            ? 1.0/((double)halfLife*GST_SECOND)
+            : 0;
+            
+        if (halfLife)
+        {
+            m_mode = DSL_ODE_HEAT_MAP_MODE_DECAY;
+            m_windowInterval = 0;
+            m_windowIntervals = 0;
+        }
+        else
+        {
+            m_mode = DSL_ODE_HEAT_MAP_MODE_CUMULATIVE;
+        }
+        for (auto &imap: m_heatMaps)
+        {
+            if (modeChanged)
+            {
+                clearSourceHeatMap(*imap.second);
+            }
+            imap.second->countsUpdated = true;
+        }
+        return true;
+    }
+    
+    void OdeHeatMapper::GetWindow(uint* interval, uint* intervals)
+    {
+        LOG_FUNC();
+        
+        *interval = m_windowInterval;
+        *intervals = m_windowIntervals;
+    }
+    
+    bool OdeHeatMapper::SetWindow(uint interval, uint intervals)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (interval and !intervals)
+        {
+            LOG_ERROR("Invalid number of intervals = 0 for Heat-Mapper '" 
+                << GetName() << "'");
+            return false;
+        }
+        if (!interval)
+        {
+            intervals = 0;
+        }
+        if (interval == m_windowInterval and intervals == m_windowIntervals)
+        {
+            return true;
+        }
+        m_windowInterval = interval;
+        m_windowIntervals = intervals;
+        
+        if (interval)
+        {
+            m_mode = DSL_ODE_HEAT_MAP_MODE_WINDOW;
+            m_decayHalfLife = 0;
+            m_decayRate = 0;
+        }
+        else
+        {
+            m_mode = DSL_ODE_HEAT_MAP_MODE_CUMULATIVE;
+        }
+        // the sub-grids are resized and all counts cleared.
+        for (auto &imap: m_heatMaps)
+        {
+            clearSourceHeatMap(*imap.second);
+        }
+        return true;
+    }
+
     void OdeHeatMapper::HandleOccurrence(NvDsFrameMeta* pFrameMeta, 
         NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
-        // one-time initialization of the grid rectangle dimensions
-        if (!m_gridRectWidth)
-        {
-            m_gridRectWidth = pFrameMeta->source_frame_width/m_cols;
-            m_gridRectHeight = pFrameMeta->source_frame_height/m_rows;
-        }
+        OdeSourceHeatMap& heatMap = getSourceHeatMap(pFrameMeta);
+        heatMap.currentTime = pFrameMeta->buf_pts;
         
         // get the x,y map coordinates based on the bbox and test-point.
         dsl_coordinate mapCoordinate;
@@ -158,88 +256,139 @@ namespace DSL
 
         // determine the column and row that maps to the x, y coordinates
         // coordinates are 1-based, so subtract 1 pixel to keep within map.
-        uint colPosition((mapCoordinate.x-1)/m_gridRectWidth);
-        uint rowPosition((mapCoordinate.y-1)/m_gridRectHeight);
+        // Points outside of the frame are mapped to the nearest edge.
+        uint colPosition(std::min((std::max(mapCoordinate.x, 1u)-1)/
+            heatMap.gridRectWidth, m_cols-1));
+        uint rowPosition(std::min((std::max(mapCoordinate.y, 1u)-1)/
+            heatMap.gridRectHeight, m_rows-1));
+
+        uint position(rowPosition*m_cols + colPosition);
+        
+        if (m_mode == DSL_ODE_HEAT_MAP_MODE_DECAY)
+        {
+            // decay this position's count to the current time before adding 
+            // to it. All other positions are left as is until read.
+            double& decayedCount = heatMap.decayedCounts[position];
+            decayedCount = decayedCount*getDecayFactor(heatMap.currentTime,
+                heatMap.decayTimes[position]) + 1;
+            heatMap.decayTimes[position] = heatMap.currentTime;
+            
+            if (decayedCount > heatMap.mostDecayedCount*getDecayFactor(
+                heatMap.currentTime, heatMap.mostDecayedTime))
+            {
+                // the ratio to the most occurrences changes for all positions.
+                heatMap.mostDecayedCount = decayedCount;
+                heatMap.mostDecayedTime = heatMap.currentTime;
+                heatMap.countsUpdated = true;
+            }
+            // otherwise, only this position needs to be re-colored, until 
+            // the list is as large as the map itself.
+            if (!heatMap.countsUpdated)
+            {
+                if (heatMap.updatedPositions.size() < heatMap.decayedCounts.size())
+                {
+                    heatMap.updatedPositions.push_back(position);
+                }
+                else
+                {
+                    heatMap.countsUpdated = true;
+                }
+            }
+            return;
+        }
+        if (m_mode == DSL_ODE_HEAT_MAP_MODE_WINDOW)
+        {
+            advanceWindow(heatMap, heatMap.currentTime);
+            heatMap.intervalCounts[
+                (size_t)heatMap.currentInterval*m_cols*m_rows + position] += 1;
+        }
 
         // increment the running count of occurrences at this poisition
-        m_heatMap[rowPosition][colPosition] += 1;
+        uint64_t& count = heatMap.counts[position];
+        count += 1;
         
         // if the new total for this position is now the greatest  
-        if (m_heatMap[rowPosition][colPosition] > m_mostOccurrences)
+        if (count > heatMap.mostOccurrences)
         {
-            m_mostOccurrences = m_heatMap[rowPosition][colPosition];
+            heatMap.mostOccurrences = count;
         }
+        heatMap.countsUpdated = true;
     }
   
-    void OdeHeatMapper::AddDisplayMeta(std::vector<NvDsDisplayMeta*>& displayMetaData)
+    void OdeHeatMapper::AddDisplayMeta(DisplayMetaAllocator& displayMetaData,
+        NvDsFrameMeta* pFrameMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
+        // nothing to display until the first occurrence for this source.
+        auto imap = m_heatMaps.find(pFrameMeta->source_id);
+        if (imap == m_heatMaps.end())
+        {
+            return;
+        }
+        OdeSourceHeatMap& heatMap = *imap->second;
+        heatMap.currentTime = pFrameMeta->buf_pts;
+        
+        if (m_mode == DSL_ODE_HEAT_MAP_MODE_WINDOW)
+        {
+            advanceWindow(heatMap, heatMap.currentTime);
+        }
+        else if (m_mode == DSL_ODE_HEAT_MAP_MODE_DECAY)
+        {
+            // periodically re-color so that expired positions are removed.
+            uint64_t refreshPeriod((uint64_t)m_decayHalfLife*GST_SECOND/
+                DSL_ODE_HEAT_MAP_DECAY_REFRESHES_PER_HALF_LIFE);
+            if (heatMap.currentTime < heatMap.refreshTime or
+                heatMap.currentTime >= heatMap.refreshTime + refreshPeriod)
+            {
+                heatMap.countsUpdated = true;
+            }
+        }
+        
         // Add legend first, just in case we run out of display-meta
         if (m_legendEnabled)
         {
-            // If the legend is added to a vertical axis
-            if (m_legendLocation == DSL_HEAT_MAP_LEGEND_LOCATION_TOP or
-                m_legendLocation == DSL_HEAT_MAP_LEGEND_LOCATION_BOTTOM)
+            if (!heatMap.legendRectsValid)
             {
-                for (uint j=0; j < m_pColorPalette->GetSize(); j++)
-                {
-                    m_pColorPalette->SetIndex(j);
-
-                    DSL_RGBA_RECTANGLE_PTR pRectangle = DSL_RGBA_RECTANGLE_NEW("", 
-                        m_legendLeft*m_gridRectWidth + j*m_gridRectWidth*m_legendWidth, 
-                        m_legendTop*m_gridRectHeight, 
-                        m_gridRectWidth*m_legendWidth, 
-                        m_gridRectHeight*m_legendHeight, 
-                        false, m_pColorPalette, true, m_pColorPalette);
-                        
-                    pRectangle->AddMeta(displayMetaData, NULL);
-                }
+                updateLegendRects(heatMap);
             }
-            // Else the legend is added to a horizontal axis
-            else
+            for (const auto &ivec: heatMap.legendRects)
             {
-                for (uint i=0; i < m_pColorPalette->GetSize(); i++)
+                // check to see if we're adding meta data - client can disable
+                // by setting the PPH ODE display meta alloc size to 0.
+                NvOSD_RectParams* pRectParams = displayMetaData.AcquireRect();
+                if (!pRectParams)
                 {
-                    m_pColorPalette->SetIndex(i);
-
-                    DSL_RGBA_RECTANGLE_PTR pRectangle = DSL_RGBA_RECTANGLE_NEW("", 
-                        m_legendLeft*m_gridRectWidth, 
-                        m_legendTop*m_gridRectHeight + i*m_gridRectHeight*m_legendHeight, 
-                        m_gridRectWidth*m_legendWidth, 
-                        m_gridRectHeight*m_legendHeight, 
-                        false, m_pColorPalette, true, m_pColorPalette);
-                        
-                    pRectangle->AddMeta(displayMetaData, NULL);
+                    return;
                 }
-            }    
+                *pRectParams = ivec;
+            }
         }
-        // Iterate through all rows
-        for (uint i=0; i < m_rows; i++)
+        // the cell rectangles only need to be rebuilt if a location's 
+        // palette index has changed since the last frame.
+        if (heatMap.countsUpdated or !heatMap.updatedPositions.empty())
         {
-            // and for each row, iterate through all columns.
-            for (uint j=0; j < m_cols; j++)
+            bool changed = (m_mode == DSL_ODE_HEAT_MAP_MODE_DECAY)
+                ? updateDecayedPaletteIndices(heatMap)
+                : updatePaletteIndices(heatMap);
+            if (changed)
             {
-                // if we have at least one occurrence at the current iteration
-                if (m_heatMap[i][j])
-                {
-                    // Callculate the index into the color palette of size 10 as 
-                    // a ratio of occurrences for the current position vs. the 
-                    // position with the most occurrences. 
-                    
-                    // multiply the occurrence for the current position by 10 and 
-                    // divide by the most occurrences rouded up or down.
-                    m_pColorPalette->SetIndex(
-                        std::round((double)m_heatMap[i][j]*(m_pColorPalette->GetSize()-1) / 
-                            (double)(m_mostOccurrences)));
-                    
-                    DSL_RGBA_RECTANGLE_PTR pRectangle = DSL_RGBA_RECTANGLE_NEW(
-                        "", j*m_gridRectWidth, i*m_gridRectHeight, m_gridRectWidth, 
-                        m_gridRectHeight, false, m_pColorPalette, true, m_pColorPalette);
-                        
-                    pRectangle->AddMeta(displayMetaData, NULL);
-                }
+                heatMap.cellRectsValid = false;
             }
+            heatMap.countsUpdated = false;
+        }
+        if (!heatMap.cellRectsValid)
+        {
+            updateCellRects(heatMap);
+        }
+        for (const auto &ivec: heatMap.cellRects)
+        {
+            NvOSD_RectParams* pRectParams = displayMetaData.AcquireRect();
+            if (!pRectParams)
+            {
+                return;
+            }
+            *pRectParams = ivec;
         }
     }
 
@@ -248,17 +397,10 @@ namespace DSL
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
-        // Iterate through all rows
-        for (uint i=0; i < m_rows; i++)
+        for (auto &imap: m_heatMaps)
         {
-            // and for each row, iterate through all columns.
-            for (uint j=0; j < m_cols; j++)
-            {
-                // clear data by resetting to 0
-                m_heatMap[i][j] = 0;
-            }
+            clearSourceHeatMap(*imap.second);
         }
-        m_mostOccurrences = 0;
     }
 
     void OdeHeatMapper::GetMetrics(const uint64_t** buffer, uint* size)
@@ -266,14 +408,8 @@ namespace DSL
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        int i=0;
-        for (auto const& ivec: m_heatMap)
-        {
-            for (auto const& jvec: ivec)
-            {
-                m_outBuffer[i++] = jvec;
-            }
-        }
+        totalMetrics();
+        
         *buffer = m_outBuffer.get();
         *size = m_cols * m_rows;
     }
@@ -283,16 +419,18 @@ namespace DSL
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        uint charwidth = (m_mostOccurrences)
-            ? floor(log10(m_mostOccurrences)) + 2
+        uint64_t mostOccurrences = totalMetrics();
+        uint charwidth = (mostOccurrences)
+            ? floor(log10(mostOccurrences)) + 2
             : 2;
         
-        for (auto const& ivec: m_heatMap)
+        for (uint i=0; i < m_rows; i++)
         {
             std::stringstream ss;
-            for (auto const& jvec: ivec)
+            for (uint j=0; j < m_cols; j++)
             {
-                ss << std::setw(charwidth) << std::setfill(' ') << jvec;
+                ss << std::setw(charwidth) << std::setfill(' ') 
+                    << m_outBuffer[i*m_cols + j];
             }
             std::cout << ss.str();
             std::cout << std::endl;
@@ -304,16 +442,18 @@ namespace DSL
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        uint charwidth = (m_mostOccurrences)
-            ? floor(log10(m_mostOccurrences)) + 2
+        uint64_t mostOccurrences = totalMetrics();
+        uint charwidth = (mostOccurrences)
+            ? floor(log10(mostOccurrences)) + 2
             : 2;
 
-        for (auto const& ivec: m_heatMap)
+        for (uint i=0; i < m_rows; i++)
         {
             std::stringstream ss;
-            for (auto const& jvec: ivec)
+            for (uint j=0; j < m_cols; j++)
             {
-                ss << std::setw(charwidth) << std::setfill(' ') << jvec;
+                ss << std::setw(charwidth) << std::setfill(' ') 
+                    << m_outBuffer[i*m_cols + j];
             }
             LOG_INFO(ss.str());
         }
@@ -344,8 +484,9 @@ namespace DSL
             return false;
         }
 
-        uint charwidth = (m_mostOccurrences)
-            ? floor(log10(m_mostOccurrences)) + 2
+        uint64_t mostOccurrences = totalMetrics();
+        uint charwidth = (mostOccurrences)
+            ? floor(log10(mostOccurrences)) + 2
             : 2;
     
         if ( format == DSL_EVENT_FILE_FORMAT_TEXT)
@@ -363,22 +504,23 @@ namespace DSL
             ostream << " File opened: " << dateTimeStr.c_str() << "\n";
             ostream << "-------------------------------------------------------------------" << "\n";
             
-            for (auto const& ivec: m_heatMap)
+            for (uint i=0; i < m_rows; i++)
             {
-                for (auto const& jvec: ivec)
+                for (uint j=0; j < m_cols; j++)
                 {
-                    ostream << std::setw(charwidth) << std::setfill(' ') << jvec;
+                    ostream << std::setw(charwidth) << std::setfill(' ') 
+                        << m_outBuffer[i*m_cols + j];
                 }
                 ostream << std::endl;
             }
         }
         else
         {
-            for (auto const& ivec: m_heatMap)
+            for (uint i=0; i < m_rows; i++)
             {
-                for (auto const& jvec: ivec)
+                for (uint j=0; j < m_cols; j++)
                 {
-                    ostream << jvec << ",";
+                    ostream << m_outBuffer[i*m_cols + j] << ",";
                 }
                 ostream << std::endl;
             }
@@ -448,4 +590,289 @@ namespace DSL
         }          
     }
     
+    OdeSourceHeatMap& OdeHeatMapper::getSourceHeatMap(NvDsFrameMeta* pFrameMeta)
+    {
+        uint sourceId(pFrameMeta->source_id);
+        
+        std::unique_ptr<OdeSourceHeatMap>& pHeatMap = m_heatMaps[sourceId];
+        if (!pHeatMap)
+        {
+            // one-time initialization of the grid rectangle dimensions
+            pHeatMap = std::unique_ptr<OdeSourceHeatMap>(
+                new OdeSourceHeatMap(m_cols, m_rows,
+                    std::max(pFrameMeta->source_frame_width/m_cols, 1u),
+                    std::max(pFrameMeta->source_frame_height/m_rows, 1u)));
+            pHeatMap->currentTime = pFrameMeta->buf_pts;
+            clearSourceHeatMap(*pHeatMap);
+        }
+        return *pHeatMap;
+    }
+    
+    void OdeHeatMapper::clearSourceHeatMap(OdeSourceHeatMap& heatMap)
+    {
+        uint size(m_cols*m_rows);
+        
+        std::fill(heatMap.counts.begin(), heatMap.counts.end(), 0);
+        heatMap.mostOccurrences = 0;
+        
+        heatMap.decayedCounts.assign(
+            (m_mode == DSL_ODE_HEAT_MAP_MODE_DECAY) ? size : 0, 0);
+        heatMap.decayTimes.assign(
+            (m_mode == DSL_ODE_HEAT_MAP_MODE_DECAY) ? size : 0, 0);
+        heatMap.mostDecayedCount = 0;
+        heatMap.mostDecayedTime = 0;
+        heatMap.updatedPositions.clear();
+        
+        heatMap.intervalCounts.assign(
+            (m_mode == DSL_ODE_HEAT_MAP_MODE_WINDOW) 
+                ? (size_t)size*m_windowIntervals : 0, 0);
+        heatMap.currentInterval = 0;
+        heatMap.intervalStartTime = heatMap.currentTime;
+        
+        heatMap.refreshTime = heatMap.currentTime;
+        heatMap.countsUpdated = true;
+    }
+    
+    double OdeHeatMapper::getDecayFactor(uint64_t currentTime, uint64_t updateTime)
+    {
+        // No function log - avoid overhead.
+        
+        // stream time can go backwards, e.g. on source reconnect.
+        return (currentTime > updateTime)
+            ? exp2(-(double)(currentTime - updateTime)*m_decayRate)
+            : 1.0;
+    }
+    
+    void OdeHeatMapper::advanceWindow(OdeSourceHeatMap& heatMap, 
+        uint64_t currentTime)
+    {
+        // No function log - avoid overhead.
+
+        if (currentTime < heatMap.intervalStartTime)
+        {
+            // stream time has gone backwards - restart the current interval.
+            heatMap.intervalStartTime = currentTime;
+            return;
+        }
+        uint64_t intervalLength((uint64_t)m_windowInterval*GST_SECOND);
+        uint64_t expired((currentTime - heatMap.intervalStartTime)/intervalLength);
+        
+        if (!expired)
+        {
+            return;
+        }
+        uint size(m_cols*m_rows);
+        uint64_t* counts = heatMap.counts.data();
+        
+        if (expired >= m_windowIntervals)
+        {
+            // the entire window has expired.
+            std::fill(heatMap.intervalCounts.begin(), 
+                heatMap.intervalCounts.end(), 0);
+            std::fill(counts, counts + size, 0);
+            heatMap.currentInterval = 0;
+        }
+        else
+        {
+            // step to each expired sub-grid, removing its counts from the 
+            // window totals and reusing it for the new interval.
+            for (uint64_t i = 0; i < expired; i++)
+            {
+                heatMap.currentInterval = 
+                    (heatMap.currentInterval + 1) % m_windowIntervals;
+                uint64_t* intervalCounts = heatMap.intervalCounts.data() +
+                    (size_t)heatMap.currentInterval*size;
+                    
+                for (uint j = 0; j < size; j++)
+                {
+                    counts[j] -= intervalCounts[j];
+                }
+                std::fill(intervalCounts, intervalCounts + size, 0);
+            }
+        }
+        heatMap.intervalStartTime += expired*intervalLength;
+        heatMap.mostOccurrences = *std::max_element(counts, counts + size);
+        heatMap.countsUpdated = true;
+    }
+    
+    bool OdeHeatMapper::updatePaletteIndices(OdeSourceHeatMap& heatMap)
+    {
+        // Calculate the index into the color palette as a ratio of occurrences 
+        // for each position vs. the position with the most occurrences,
+        // rounded up or down. A single branch-free pass over the contiguous
+        // counts that the compiler can vectorize.
+        const uint64_t* counts = heatMap.counts.data();
+        uint* paletteIndices = heatMap.paletteIndices.data();
+        double maxIndex(m_paletteColors.size() - 1);
+        double mostOccurrences(std::max(heatMap.mostOccurrences, (uint64_t)1));
+        uint changed(0);
+        
+        for (size_t i = 0; i < heatMap.counts.size(); i++)
+        {
+            uint index = (counts[i]) 
+                ? (uint)((double)counts[i]*maxIndex/mostOccurrences + 0.5)
+                : DSL_ODE_HEAT_MAP_NO_INDEX;
+            changed |= (index != paletteIndices[i]);
+            paletteIndices[i] = index;
+        }
+        return changed;
+    }
+    
+    bool OdeHeatMapper::updateDecayedPaletteIndices(OdeSourceHeatMap& heatMap)
+    {
+        // All positions decay at the same rate, so the ratio of each position
+        // vs. the most occurrences only changes when a position is updated. 
+        // Only the positions that have decayed below the min count change 
+        // with time alone, which the periodic full refresh takes care of.
+        const double* decayedCounts = heatMap.decayedCounts.data();
+        const uint64_t* decayTimes = heatMap.decayTimes.data();
+        uint* paletteIndices = heatMap.paletteIndices.data();
+        uint64_t currentTime(heatMap.currentTime);
+        uint maxIndex(m_paletteColors.size() - 1);
+        double mostOccurrences(std::max(heatMap.mostDecayedCount*getDecayFactor(
+            currentTime, heatMap.mostDecayedTime), DSL_ODE_HEAT_MAP_DECAY_MIN_COUNT));
+        uint changed(0);
+        
+        auto updateIndex = [&](size_t i)
+        {
+            double count = decayedCounts[i]*getDecayFactor(currentTime, 
+                decayTimes[i]);
+            uint index = (count >= DSL_ODE_HEAT_MAP_DECAY_MIN_COUNT) 
+                ? std::min((uint)(count*maxIndex/mostOccurrences + 0.5), maxIndex)
+                : DSL_ODE_HEAT_MAP_NO_INDEX;
+            changed |= (index != paletteIndices[i]);
+            paletteIndices[i] = index;
+        };
+        
+        if (heatMap.countsUpdated)
+        {
+            for (size_t i = 0; i < heatMap.decayedCounts.size(); i++)
+            {
+                updateIndex(i);
+            }
+            heatMap.refreshTime = currentTime;
+        }
+        else
+        {
+            for (auto position: heatMap.updatedPositions)
+            {
+                updateIndex(position);
+            }
+        }
+        heatMap.updatedPositions.clear();
+        
+        return changed;
+    }
+    
+    void OdeHeatMapper::updateCellRects(OdeSourceHeatMap& heatMap)
+    {
+        heatMap.cellRects.clear();
+        
+        for (uint i=0; i < m_rows; i++)
+        {
+            for (uint j=0; j < m_cols; j++)
+            {
+                uint index = heatMap.paletteIndices[i*m_cols + j];
+                if (index != DSL_ODE_HEAT_MAP_NO_INDEX)
+                {
+                    NvOSD_ColorParams color = m_paletteColors[index];
+                    
+                    heatMap.cellRects.push_back(NvOSD_RectParams{
+                        (float)(j*heatMap.gridRectWidth), 
+                        (float)(i*heatMap.gridRectHeight), 
+                        (float)heatMap.gridRectWidth, 
+                        (float)heatMap.gridRectHeight, 
+                        0, color, true, 0, color});
+                }
+            }
+        }
+        heatMap.cellRectsValid = true;
+    }
+    
+    void OdeHeatMapper::updateLegendRects(OdeSourceHeatMap& heatMap)
+    {
+        heatMap.legendRects.clear();
+        
+        uint gridRectWidth(heatMap.gridRectWidth);
+        uint gridRectHeight(heatMap.gridRectHeight);
+        
+        for (uint i=0; i < m_paletteColors.size(); i++)
+        {
+            NvOSD_ColorParams color = m_paletteColors[i];
+            
+            // If the legend is added to a vertical axis
+            if (m_legendLocation == DSL_HEAT_MAP_LEGEND_LOCATION_TOP or
+                m_legendLocation == DSL_HEAT_MAP_LEGEND_LOCATION_BOTTOM)
+            {
+                heatMap.legendRects.push_back(NvOSD_RectParams{
+                    (float)(m_legendLeft*gridRectWidth + i*gridRectWidth*m_legendWidth), 
+                    (float)(m_legendTop*gridRectHeight), 
+                    (float)(gridRectWidth*m_legendWidth), 
+                    (float)(gridRectHeight*m_legendHeight), 
+                    0, color, true, 0, color});
+            }
+            // Else the legend is added to a horizontal axis
+            else
+            {
+                heatMap.legendRects.push_back(NvOSD_RectParams{
+                    (float)(m_legendLeft*gridRectWidth), 
+                    (float)(m_legendTop*gridRectHeight + i*gridRectHeight*m_legendHeight), 
+                    (float)(gridRectWidth*m_legendWidth), 
+                    (float)(gridRectHeight*m_legendHeight), 
+                    0, color, true, 0, color});
+            }
+        }
+        heatMap.legendRectsValid = true;
+    }
+    
+    void OdeHeatMapper::updatePaletteColors()
+    {
+        m_paletteColors.clear();
+        
+        for (uint i=0; i < m_pColorPalette->GetSize(); i++)
+        {
+            m_pColorPalette->SetIndex(i);
+            
+            m_pColorPalette->Lock();
+            m_paletteColors.push_back(*m_pColorPalette);
+            m_pColorPalette->Unlock();
+        }
+        // the palette size may have changed, so all indices are recalculated.
+        for (auto &imap: m_heatMaps)
+        {
+            imap.second->countsUpdated = true;
+            imap.second->cellRectsValid = false;
+            imap.second->legendRectsValid = false;
+        }
+    }
+    
+    uint64_t OdeHeatMapper::totalMetrics()
+    {
+        uint64_t* totals = m_outBuffer.get();
+        std::fill(totals, totals + m_cols*m_rows, 0);
+        
+        for (const auto &imap: m_heatMaps)
+        {
+            const OdeSourceHeatMap* pHeatMap = imap.second.get();
+            
+            if (m_mode == DSL_ODE_HEAT_MAP_MODE_DECAY)
+            {
+                // decayed counts are rounded to the nearest occurrence
+                for (size_t i = 0; i < pHeatMap->decayedCounts.size(); i++)
+                {
+                    totals[i] += llround(pHeatMap->decayedCounts[i]*getDecayFactor(
+                        pHeatMap->currentTime, pHeatMap->decayTimes[i]));
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < pHeatMap->counts.size(); i++)
+                {
+                    totals[i] += pHeatMap->counts[i];
+                }
+            }
+        }
+        return *std::max_element(totals, totals + m_cols*m_rows);
+    }
+    
 }
\ No newline at end of file
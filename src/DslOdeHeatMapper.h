@@ -32,6 +32,29 @@ THE SOFTWARE.
 
 namespace DSL
 {
+    /**
+     * @brief palette index for a heat-map location with no occurrences.
+     */
+    #define DSL_ODE_HEAT_MAP_NO_INDEX                                   UINT32_MAX
+
+    /**
+     * @brief heat-map accumulation modes.
+     */
+    #define DSL_ODE_HEAT_MAP_MODE_CUMULATIVE                            0
+    #define DSL_ODE_HEAT_MAP_MODE_DECAY                                 1
+    #define DSL_ODE_HEAT_MAP_MODE_WINDOW                                2
+
+    /**
+     * @brief decayed counts below this value are treated as no occurrences.
+     */
+    #define DSL_ODE_HEAT_MAP_DECAY_MIN_COUNT                            0.5
+
+    /**
+     * @brief a decayed heat-map is re-colored at least this many times per
+     * half-life, so that expired locations are removed without new occurrences.
+     */
+    #define DSL_ODE_HEAT_MAP_DECAY_REFRESHES_PER_HALF_LIFE              8
+
     /**
      * @brief convenience macros for shared pointer abstraction
      */
@@ -42,6 +65,136 @@ namespace DSL
     
     // ********************************************************************
 
+    /**
+     * @struct OdeSourceHeatMap
+     * @brief Heat-map counts and cached display metadata for a single source.
+     */
+    struct OdeSourceHeatMap
+    {
+        OdeSourceHeatMap(uint cols, uint rows, 
+            uint gridRectWidth, uint gridRectHeight)
+            : counts(cols*rows, 0)
+            , mostOccurrences(0)
+            , gridRectWidth(gridRectWidth)
+            , gridRectHeight(gridRectHeight)
+            , paletteIndices(cols*rows, DSL_ODE_HEAT_MAP_NO_INDEX)
+            , mostDecayedCount(0)
+            , mostDecayedTime(0)
+            , currentInterval(0)
+            , intervalStartTime(0)
+            , currentTime(0)
+            , refreshTime(0)
+            , countsUpdated(false)
+            , cellRectsValid(false)
+            , legendRectsValid(false)
+        {};
+        
+        /**
+         * @brief contiguous, row-major, cols x rows occurrence counts.
+         */
+        std::vector<uint64_t> counts;
+        
+        /**
+         * @brief the most occurrences in any one map location.
+         */
+        uint64_t mostOccurrences;
+        
+        /**
+         * @brief DSL_ODE_HEAT_MAP_MODE_DECAY only. Decayed count for each 
+         * map location, as of the location's last update time in decayTimes.
+         * Decay is applied lazily, only when a location is updated or read.
+         */
+        std::vector<double> decayedCounts;
+        
+        /**
+         * @brief DSL_ODE_HEAT_MAP_MODE_DECAY only. Frame PTS in nanoseconds
+         * of the last update to each map location.
+         */
+        std::vector<uint64_t> decayTimes;
+        
+        /**
+         * @brief DSL_ODE_HEAT_MAP_MODE_DECAY only. The most decayed occurrences 
+         * in any one map location as of mostDecayedTime. All locations decay 
+         * at the same rate, so this only changes when a location is updated.
+         */
+        double mostDecayedCount;
+        uint64_t mostDecayedTime;
+        
+        /**
+         * @brief DSL_ODE_HEAT_MAP_MODE_DECAY only. Locations updated since
+         * the palette indices were last calculated. Only these need to be
+         * re-colored unless countsUpdated is set.
+         */
+        std::vector<uint> updatedPositions;
+        
+        /**
+         * @brief DSL_ODE_HEAT_MAP_MODE_WINDOW only. Ring of per-interval
+         * sub-grids, each cols x rows, stored contiguously. counts holds
+         * the sum of all sub-grids in the ring.
+         */
+        std::vector<uint64_t> intervalCounts;
+        
+        /**
+         * @brief DSL_ODE_HEAT_MAP_MODE_WINDOW only. Index of the sub-grid
+         * for the current interval and the frame PTS the interval started.
+         */
+        uint currentInterval;
+        uint64_t intervalStartTime;
+        
+        /**
+         * @brief PTS in nanoseconds of the latest frame seen for this source.
+         */
+        uint64_t currentTime;
+        
+        /**
+         * @brief DSL_ODE_HEAT_MAP_MODE_DECAY only. Frame PTS the palette
+         * indices were last calculated.
+         */
+        uint64_t refreshTime;
+        
+        /**
+         * @brief width and height of the grid rectangles in pixels, 
+         * calculated from the source's frame dimensions.
+         */
+        uint gridRectWidth, gridRectHeight;
+        
+        /**
+         * @brief color palette index for each map location, or
+         * DSL_ODE_HEAT_MAP_NO_INDEX if the location has no occurrences.
+         */
+        std::vector<uint> paletteIndices;
+        
+        /**
+         * @brief cached rectangle params for all locations with occurrences.
+         */
+        std::vector<NvOSD_RectParams> cellRects;
+        
+        /**
+         * @brief cached rectangle params for all legend entries.
+         */
+        std::vector<NvOSD_RectParams> legendRects;
+        
+        /**
+         * @brief true if the counts have been updated since the palette 
+         * indices were last calculated. For DSL_ODE_HEAT_MAP_MODE_DECAY, 
+         * true only if all indices must be recalculated, i.e. the most 
+         * decayed count has changed or the periodic refresh is due.
+         */
+        bool countsUpdated;
+        
+        /**
+         * @brief true if the cached cell rectangles match the palette indices.
+         */
+        bool cellRectsValid;
+        
+        /**
+         * @brief true if the cached legend rectangles match the legend settings.
+         */
+        bool legendRectsValid;
+    };
+
+    // ********************************************************************
+
     class OdeHeatMapper : public OdeBase
     {
     public: 
@@ -96,6 +249,40 @@ namespace DSL
         bool SetLegendSettings(bool enabled, uint location, 
             uint width, uint height);
         
+        /**
+         * @brief Gets the current exponential-decay half-life.
+         * @return half-life in seconds, 0 if decay is disabled.
+         */
+        uint GetDecay();
+        
+        /**
+         * @brief Sets the exponential-decay half-life. Occurrence counts are
+         * halved every half-life seconds of stream time. Enabling decay 
+         * disables the sliding-window and clears the current metrics.
+         * @param[in] halfLife half-life in seconds, 0 to disable.
+         * @return true on successful update, false otherwise
+         */
+        bool SetDecay(uint halfLife);
+        
+        /**
+         * @brief Gets the current sliding-window settings.
+         * @param[out] interval length of each interval in seconds,
+         * 0 if the sliding-window is disabled.
+         * @param[out] intervals number of intervals in the window.
+         */
+        void GetWindow(uint* interval, uint* intervals);
+        
+        /**
+         * @brief Sets the sliding-window settings. Only occurrences from the 
+         * last interval x intervals seconds of stream time are counted, with 
+         * the oldest interval dropped as each new interval starts. Enabling 
+         * the window disables decay and clears the current metrics.
+         * @param[in] interval length of each interval in seconds, 0 to disable.
+         * @param[in] intervals number of intervals in the window.
+         * @return true on successful update, false otherwise
+         */
+        bool SetWindow(uint interval, uint intervals);
+        
         /**
          * @brief Handles the ODE occurrence by updating the heat-map with new 
          * the bounding box center point provided by pObjectMeta,  
@@ -109,33 +296,41 @@ namespace DSL
          * downstream display.
          * @param[in] displayMetaData Vector of metadata structures to add the 
          * heat-map's display-metadata to.
+         * @param[in] pFrameMeta pointer to the Frame Meta data for the current 
+         * frame, used to select the heat-map for the frame's source.
          */
-        void AddDisplayMeta(std::vector<NvDsDisplayMeta*>& displayMetaData);
+        void AddDisplayMeta(DisplayMetaAllocator& displayMetaData,
+            NvDsFrameMeta* pFrameMeta);
         
         /**
-         * @brief Resets the OdeHeatMapper which clears the 2D m_heatMap vector.
+         * @brief Resets the OdeHeatMapper which clears the heat-maps for all
+         * sources.
          */
         void ClearMetrics();
         
         /**
-         * @brief Gets the 2D m_heatMap vector as a linear buffer.
+         * @brief Gets the heat-map metrics, totaled over all sources, as a 
+         * linear buffer.
          * @param[out] buffer pointer to the returned buffer
          * @param[out] size of the return buffer m_cols*m_rows
          */
         void GetMetrics(const uint64_t** buffer, uint* size); 
 
         /**
-         * @brief Prints the 2D m_heatMap vector to the console.
+         * @brief Prints the heat-map metrics, totaled over all sources, 
+         * to the console.
          */
         void PrintMetrics(); 
         
         /**
-         * @brief Logs the 2D m_heatMap vector at level = INFO.
+         * @brief Logs the heat-map metrics, totaled over all sources, at 
+         * level = INFO.
          */
         void LogMetrics(); 
         
         /**
-         * @brief Writes the 2D m_heatMap vector to a file.
+         * @brief Writes the heat-map metrics, totaled over all sources, 
+         * to a file.
          * @param[in] relative or absolute path to the file to write to.
          * @param[in] mode file open/write mode, one of DSL_EVENT_FILE_MODE_* options
          * @param[in] format one of the DSL_EVENT_FILE_FORMAT_* options
@@ -152,6 +347,74 @@ namespace DSL
          */
         void getCoordinate(NvDsObjectMeta* pObjectMeta, 
             dsl_coordinate& mapCoordinate);
+            
+        /**
+         * @brief Gets the heat-map for a given source, creating it if needed.
+         * @param[in] pFrameMeta frame meta for the source, used to size the
+         * grid rectangles on creation.
+         */
+        OdeSourceHeatMap& getSourceHeatMap(NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief Clears all counts of a heat-map, sizing its mode specific 
+         * data for the current mode.
+         */
+        void clearSourceHeatMap(OdeSourceHeatMap& heatMap);
+        
+        /**
+         * @brief Gets the factor to decay a count updated at a given time
+         * to the current time.
+         * @param[in] currentTime current frame PTS in nanoseconds.
+         * @param[in] updateTime frame PTS of the update in nanoseconds.
+         */
+        double getDecayFactor(uint64_t currentTime, uint64_t updateTime);
+        
+        /**
+         * @brief Advances the sliding-window of a heat-map to the current time, 
+         * dropping the counts of all intervals that have expired.
+         * @param[in] currentTime current frame PTS in nanoseconds.
+         */
+        void advanceWindow(OdeSourceHeatMap& heatMap, uint64_t currentTime);
+        
+        /**
+         * @brief Recalculates the palette index for every location of a 
+         * heat-map from its counts.
+         * @return true if any index changed, false otherwise.
+         */
+        bool updatePaletteIndices(OdeSourceHeatMap& heatMap);
+        
+        /**
+         * @brief Recalculates the palette indices of a decayed heat-map from 
+         * its counts decayed to the current time. Every location is 
+         * recalculated if countsUpdated is set, otherwise only the 
+         * updatedPositions.
+         * @return true if any index changed, false otherwise.
+         */
+        bool updateDecayedPaletteIndices(OdeSourceHeatMap& heatMap);
+        
+        /**
+         * @brief Rebuilds the cached cell rectangles of a heat-map from its
+         * palette indices.
+         */
+        void updateCellRects(OdeSourceHeatMap& heatMap);
+        
+        /**
+         * @brief Rebuilds the cached legend rectangles of a heat-map from
+         * the current legend settings.
+         */
+        void updateLegendRects(OdeSourceHeatMap& heatMap);
+        
+        /**
+         * @brief Copies the colors from the current Color Palette and 
+         * invalidates the cached rectangles for all sources.
+         */
+        void updatePaletteColors();
+        
+        /**
+         * @brief Totals the counts over all sources into m_outBuffer.
+         * @return the most occurrences in any one map location of the totals.
+         */
+        uint64_t totalMetrics();
     
         /**
          * @brief number of columns along the horizontal axis
@@ -166,20 +429,35 @@ namespace DSL
         uint m_rows;
         
         /**
-         * @brief width of the grid rectangles in pixels.
+         * @brief one of DSL_BBOX_POINT values defining which point of a
+         * object's bounding box to use as map coordinates.
          */
-        uint m_gridRectWidth;
-
+        uint m_bboxTestPoint;
+        
         /**
-         * @brief height of the grid rectangles in pixels.
+         * @brief one of the DSL_ODE_HEAT_MAP_MODE_* constants.
          */
-        uint m_gridRectHeight;
+        uint m_mode;
         
         /**
-         * @brief one of DSL_BBOX_POINT values defining which point of a
-         * object's bounding box to use as map coordinates.
+         * @brief decay half-life in seconds, 0 if disabled.
          */
-        uint m_bboxTestPoint;
+        uint m_decayHalfLife;
+        
+        /**
+         * @brief decay rate in half-lives per nanosecond of stream time.
+         */
+        double m_decayRate;
+        
+        /**
+         * @brief sliding-window interval in seconds, 0 if disabled.
+         */
+        uint m_windowInterval;
+        
+        /**
+         * @brief number of intervals in the sliding-window.
+         */
+        uint m_windowIntervals;
 
         /**
          * @brief shared pointer to a RGBA Color Palette to color
@@ -188,20 +466,21 @@ namespace DSL
         DSL_RGBA_COLOR_PALETTE_PTR m_pColorPalette;
         
         /**
-         * @brief two dimensional vector sized cols x rows
+         * @brief colors copied from m_pColorPalette, indexed by palette index.
          */
-        std::vector<std::vector<uint64_t>> m_heatMap;
+        std::vector<NvOSD_ColorParams> m_paletteColors;
         
         /**
-         * @brief a linear array of heat-map metrics updated on
-         * on call to get metrics and returned to the caller.
+         * @brief heat-map for each source, keyed by source-id. Source-ids
+         * are sparse, so only the sources with occurrences have a map.
          */
-        std::unique_ptr<uint64_t[]> m_outBuffer;
+        std::unordered_map<uint, std::unique_ptr<OdeSourceHeatMap>> m_heatMaps;
         
         /**
-         * @brief the most occurrences in any one map location..
+         * @brief a linear array of heat-map metrics, totaled over all sources,
+         * updated on call to get metrics and returned to the caller.
          */
-        uint64_t m_mostOccurrences;
+        std::unique_ptr<uint64_t[]> m_outBuffer;
         
         /**
          * @brief true if Legend display is enabled, false otherwise.
@@ -0,0 +1,322 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_ODE_STATS_H
+#define _DSL_ODE_STATS_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+
+namespace DSL
+{
+    /**
+     * @brief Trigger operations timed when stats are enabled.
+     */
+    #define DSL_ODE_STATS_PRE_PROCESS_FRAME                             0
+    #define DSL_ODE_STATS_CHECK_FOR_OCCURRENCE                          1
+    #define DSL_ODE_STATS_POST_PROCESS_FRAME                            2
+    #define DSL_ODE_STATS_HANDLE_OCCURRENCE                             3
+    #define DSL_ODE_STATS_OPERATIONS                                    4
+
+    /**
+     * @brief Histogram resolution - each power of two is split into
+     * 2^DSL_ODE_STATS_SUB_BUCKET_BITS linear sub-buckets, for a worst case
+     * error of 1/16 (6.25%). Values >= 2^DSL_ODE_STATS_MAX_VALUE_BITS ns
+     * (~18 minutes) are counted in the last bucket.
+     */
+    #define DSL_ODE_STATS_SUB_BUCKET_BITS                               4
+    #define DSL_ODE_STATS_SUB_BUCKETS (1 << DSL_ODE_STATS_SUB_BUCKET_BITS)
+    #define DSL_ODE_STATS_MAX_VALUE_BITS                                40
+    #define DSL_ODE_STATS_BUCKETS ((DSL_ODE_STATS_MAX_VALUE_BITS - \
+        DSL_ODE_STATS_SUB_BUCKET_BITS + 1)*DSL_ODE_STATS_SUB_BUCKETS)
+
+    /**
+     * @class OdeLatencyHistogram
+     * @brief HDR-style, log-linear latency histogram in nanoseconds. Values
+     * are recorded lock-free from any number of threads.
+     */
+    class OdeLatencyHistogram
+    {
+    public:
+
+        OdeLatencyHistogram()
+        {
+            Reset();
+        };
+
+        /**
+         * @brief Clears all counts. Concurrent records may be partially kept.
+         */
+        void Reset()
+        {
+            for (auto &ivec: m_buckets)
+            {
+                ivec.store(0, std::memory_order_relaxed);
+            }
+            m_count.store(0, std::memory_order_relaxed);
+            m_max.store(0, std::memory_order_relaxed);
+        };
+
+        /**
+         * @brief Records a single latency value.
+         * @param[in] ns latency to record in nanoseconds.
+         */
+        void Record(uint64_t ns)
+        {
+            m_buckets[GetBucketIndex(ns)].fetch_add(1, std::memory_order_relaxed);
+            m_count.fetch_add(1, std::memory_order_relaxed);
+
+            uint64_t max = m_max.load(std::memory_order_relaxed);
+            while (ns > max and !m_max.compare_exchange_weak(max, ns,
+                std::memory_order_relaxed))
+            {
+            }
+        };
+
+        /**
+         * @brief Gets the total number of values recorded.
+         */
+        uint64_t GetCount()
+        {
+            return m_count.load(std::memory_order_relaxed);
+        };
+
+        /**
+         * @brief Gets the largest value recorded.
+         */
+        uint64_t GetMax()
+        {
+            return m_max.load(std::memory_order_relaxed);
+        };
+
+        /**
+         * @brief Gets the value at a given percentile, reported as the
+         * highest value equivalent to the bucket the percentile falls in.
+         * @param[in] percentile in the range (0, 100]
+         * @return latency in nanoseconds, 0 if no values have been recorded.
+         */
+        uint64_t GetPercentile(double percentile)
+        {
+            uint64_t total(0);
+            for (const auto &ivec: m_buckets)
+            {
+                total += ivec.load(std::memory_order_relaxed);
+            }
+            if (!total)
+            {
+                return 0;
+            }
+            uint64_t target = std::max((uint64_t)1,
+                (uint64_t)ceil(percentile*total/100.0));
+
+            uint64_t count(0);
+            for (uint i = 0; i < DSL_ODE_STATS_BUCKETS; i++)
+            {
+                count += m_buckets[i].load(std::memory_order_relaxed);
+                if (count >= target)
+                {
+                    return std::min(GetBucketHighestValue(i), GetMax());
+                }
+            }
+            return GetMax();
+        };
+
+        /**
+         * @brief Fills in a client stats structure.
+         * @param[out] stats count, p50, p99, and max latency.
+         */
+        void GetStats(dsl_ode_latency_stats* stats)
+        {
+            stats->count = GetCount();
+            stats->p50 = GetPercentile(50.0);
+            stats->p99 = GetPercentile(99.0);
+            stats->max = GetMax();
+        };
+
+    private:
+
+        static uint GetBucketIndex(uint64_t ns)
+        {
+            if (ns < DSL_ODE_STATS_SUB_BUCKETS)
+            {
+                return ns;
+            }
+            uint msb = 63 - __builtin_clzll(ns);
+            if (msb >= DSL_ODE_STATS_MAX_VALUE_BITS)
+            {
+                return DSL_ODE_STATS_BUCKETS - 1;
+            }
+            uint shift = msb - DSL_ODE_STATS_SUB_BUCKET_BITS;
+            uint subBucket = (ns >> shift) & (DSL_ODE_STATS_SUB_BUCKETS - 1);
+
+            return (shift + 1)*DSL_ODE_STATS_SUB_BUCKETS + subBucket;
+        };
+
+        static uint64_t GetBucketHighestValue(uint index)
+        {
+            if (index < DSL_ODE_STATS_SUB_BUCKETS)
+            {
+                return index;
+            }
+            uint shift = index/DSL_ODE_STATS_SUB_BUCKETS - 1;
+            uint64_t subBucket = index % DSL_ODE_STATS_SUB_BUCKETS;
+
+            return (((DSL_ODE_STATS_SUB_BUCKETS + subBucket + 1) << shift) - 1);
+        };
+
+        /**
+         * @brief count of values recorded for each bucket.
+         */
+        std::atomic<uint64_t> m_buckets[DSL_ODE_STATS_BUCKETS];
+
+        /**
+         * @brief total count of values recorded.
+         */
+        std::atomic<uint64_t> m_count;
+
+        /**
+         * @brief largest value recorded.
+         */
+        std::atomic<uint64_t> m_max;
+    };
+
+    /**
+     * @class OdeLatencyTimer
+     * @brief Scoped timer that records the time from construction to
+     * destruction to a Histogram, using the monotonic clock. Does nothing
+     * if the Histogram is NULL, i.e. when stats are disabled.
+     */
+    class OdeLatencyTimer
+    {
+    public:
+
+        OdeLatencyTimer(OdeLatencyHistogram* pHistogram)
+            : m_pHistogram(pHistogram)
+        {
+            if (m_pHistogram)
+            {
+                m_start = std::chrono::steady_clock::now();
+            }
+        };
+
+        ~OdeLatencyTimer()
+        {
+            if (m_pHistogram)
+            {
+                m_pHistogram->Record(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - m_start).count());
+            }
+        };
+
+    private:
+
+        OdeLatencyHistogram* m_pHistogram;
+
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    /**
+     * @struct OdeTriggerStats
+     * @brief Latency histograms and occurrence count for a single ODE Trigger.
+     */
+    struct OdeTriggerStats
+    {
+        OdeTriggerStats()
+            : occurrences(0)
+            , startTime(std::chrono::steady_clock::now())
+        {};
+
+        void Reset()
+        {
+            for (auto &ivec: latencies)
+            {
+                ivec.Reset();
+            }
+            occurrences = 0;
+            startTime = std::chrono::steady_clock::now();
+        };
+
+        /**
+         * @brief one histogram for each of the DSL_ODE_STATS_* operations.
+         */
+        OdeLatencyHistogram latencies[DSL_ODE_STATS_OPERATIONS];
+
+        /**
+         * @brief number of ODE occurrences since enabled or reset.
+         */
+        std::atomic<uint64_t> occurrences;
+
+        /**
+         * @brief time the stats were enabled or reset.
+         */
+        std::chrono::steady_clock::time_point startTime;
+    };
+
+    /**
+     * @struct OdeHandlerStats
+     * @brief Latency histogram and frame count for a single ODE Pad Probe Handler.
+     */
+    struct OdeHandlerStats
+    {
+        OdeHandlerStats()
+            : frames(0)
+            , startTime(std::chrono::steady_clock::now())
+        {};
+
+        void Reset()
+        {
+            batches.Reset();
+            frames = 0;
+            startTime = std::chrono::steady_clock::now();
+        };
+
+        /**
+         * @brief latency of each call to handle a batched buffer.
+         */
+        OdeLatencyHistogram batches;
+
+        /**
+         * @brief number of frames processed since enabled or reset.
+         */
+        std::atomic<uint64_t> frames;
+
+        /**
+         * @brief time the stats were enabled or reset.
+         */
+        std::chrono::steady_clock::time_point startTime;
+    };
+
+    /**
+     * @brief Gets the time since a given start time in seconds.
+     */
+    static inline double GetSecondsSince(
+        const std::chrono::steady_clock::time_point& startTime)
+    {
+        return std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - startTime).count();
+    }
+}
+
+#endif // _DSL_ODE_STATS_H
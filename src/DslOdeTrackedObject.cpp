@@ -27,26 +27,223 @@ THE SOFTWARE.
 
 namespace DSL
 {
+    TrackedObjectHistory::TrackedObjectHistory(uint64_t trackingId, 
+        uint64_t frameNumber, const NvBbox_Coords* pCoordinates, uint maxHistory)
+        : trackingId(trackingId)
+        , frameNumber(frameNumber)
+        , m_maxHistory(0)
+        , m_firstIndex(0)
+        , m_nextIndex(0)
+    {
+        // No function log - avoid overhead.
+        
+        SetMaxHistory(maxHistory);
+        Update(frameNumber, pCoordinates);
+    }
+    
+    void TrackedObjectHistory::SetMaxHistory(uint maxHistory)
+    {
+        // No function log - avoid overhead.
+        
+        if (maxHistory == m_maxHistory)
+        {
+            return;
+        }
+        // grow the ring to the next power of two, copying over the current 
+        // history as the position of each bbox depends on the ring size.
+        if (maxHistory > m_bboxRing.size())
+        {
+            size_t ringSize(1);
+            while (ringSize < maxHistory)
+            {
+                ringSize <<= 1;
+            }
+            std::vector<NvBbox_Coords> bboxRing(ringSize);
+            for (uint64_t i = m_firstIndex; i < m_nextIndex; i++)
+            {
+                bboxRing[i & (ringSize-1)] = GetBbox(i);
+            }
+            m_bboxRing.swap(bboxRing);
+        }
+        m_maxHistory = maxHistory;
+        
+        if (m_nextIndex - m_firstIndex > m_maxHistory)
+        {
+            m_firstIndex = m_nextIndex - m_maxHistory;
+        }
+    }
+    
+    void TrackedObjectHistory::Update(uint64_t currentFrameNumber, 
+        const NvBbox_Coords* pCoordinates)
+    {
+        // No function log - avoid overhead.
+        
+        // update the tracked object's frame number - the filter used for purging.
+        frameNumber = currentFrameNumber;
+        
+        // the index is incremented even when no history is kept.
+        uint64_t index = m_nextIndex++;
+
+        // If maintaining bbox trace-point history
+        if (m_maxHistory)
+        {
+            // Copy only the rectangle coordinates of the Object's RectParams,
+            // overwriting the oldest once the history is full.
+            m_bboxRing[index & (m_bboxRing.size()-1)] = *pCoordinates;
+        }
+        if (m_nextIndex - m_firstIndex > m_maxHistory)
+        {
+            m_firstIndex = m_nextIndex - m_maxHistory;
+        }
+    }
+    
+    //********************************************************************************
+    
+    TrackedObjectStore::TrackedObjectStore(uint maxMissingFromFrame)
+        : m_maxMissingFromFrame(maxMissingFromFrame)
+        , m_maxHistory(0)
+    {
+        LOG_FUNC();
+    }
+    
+    void TrackedObjectStore::ReserveHistory(uint maxHistory)
+    {
+        LOG_FUNC();
+        
+        uint currentMaxHistory = m_maxHistory.load();
+        while (maxHistory > currentMaxHistory and 
+            !m_maxHistory.compare_exchange_weak(currentMaxHistory, maxHistory))
+        {
+        }
+    }
+    
+    void TrackedObjectStore::PrepareSource(uint sourceId)
+    {
+        // No function log - avoid overhead.
+        
+        getSourceTable(sourceId);
+    }
+    
+    TrackedObjectStore::HistoryTableT& TrackedObjectStore::getSourceTable(
+        uint sourceId)
+    {
+        auto imap = m_sourceTables.find(sourceId);
+        if (imap != m_sourceTables.end())
+        {
+            return *imap->second;
+        }
+        LOG_INFO("Creating tracked object table for source = " << sourceId);
+        
+        std::unique_ptr<HistoryTableT>& pTable = m_sourceTables[sourceId];
+        pTable = std::unique_ptr<HistoryTableT>(new HistoryTableT());
+        
+        return *pTable;
+    }
+    
+    TrackedObjectHistory* TrackedObjectStore::Update(NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
+    {
+        // No function log - avoid overhead.
+        
+        HistoryTableT& table = getSourceTable(pFrameMeta->source_id);
+        uint maxHistory = m_maxHistory.load(std::memory_order_relaxed);
+        
+        TrackedObjectHistory* pHistory = table.Find(pFrameMeta->source_id, 
+            pObjectMeta->object_id);
+
+        if (pHistory == NULL)
+        {
+            LOG_DEBUG("New object detected with id = " << pObjectMeta->object_id 
+                << " for source = " << pFrameMeta->source_id);
+            
+            return table.Insert(pFrameMeta->source_id, pObjectMeta->object_id,
+                TrackedObjectHistory(pObjectMeta->object_id, pFrameMeta->frame_num,
+                    (NvBbox_Coords*)&pObjectMeta->rect_params, maxHistory));
+        }
+        // only the first update for the current frame is pushed on to the history.
+        if (pHistory->frameNumber != pFrameMeta->frame_num)
+        {
+            pHistory->SetMaxHistory(maxHistory);
+            pHistory->Update(pFrameMeta->frame_num, 
+                (NvBbox_Coords*)&pObjectMeta->rect_params);
+        }
+        return pHistory;
+    }
+    
+    void TrackedObjectStore::UpdateFrame(NvDsFrameMeta* pFrameMeta)
+    {
+        // No function log - avoid overhead.
+        
+        for (NvDsMetaList* pMeta = pFrameMeta->obj_meta_list; pMeta; 
+            pMeta = pMeta->next)
+        {
+            NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*) (pMeta->data);
+            if (pObjectMeta != NULL)
+            {
+                Update(pFrameMeta, pObjectMeta);
+            }
+        }
+    }
+    
+    void TrackedObjectStore::Purge(uint sourceId, uint64_t currentFrameNumber)
+    {
+        // No function log - avoid overhead.
+        
+        auto imap = m_sourceTables.find(sourceId);
+        if (imap == m_sourceTables.end())
+        {
+            return;
+        }
+        purgeTable(*imap->second, currentFrameNumber);
+    }
+    
+    void TrackedObjectStore::Purge(uint64_t currentFrameNumber)
+    {
+        // No function log - avoid overhead.
+        
+        // only the sources that have been seen have a table to purge.
+        for (auto& imap: m_sourceTables)
+        {
+            purgeTable(*imap.second, currentFrameNumber);
+        }
+    }
+    
+    void TrackedObjectStore::purgeTable(HistoryTableT& table, 
+        uint64_t currentFrameNumber)
+    {
+        // No function log - avoid overhead.
+        
+        table.EraseIf(
+            [&](uint id, const TrackedObjectHistory& history)
+            {
+                return (currentFrameNumber > history.frameNumber + 
+                    m_maxMissingFromFrame);
+            });
+    }
+    
+    //********************************************************************************
+    
     TrackedObject::TrackedObject(uint64_t trackingId, uint64_t frameNumber,
-        const NvBbox_Coords* pCoordinates, DSL_RGBA_COLOR_PTR pColor, 
+        TrackedObjectHistory* pHistory, DSL_RGBA_COLOR_PTR pColor, 
         uint maxHistory)
         : trackingId(trackingId)
-        , m_maxHistory(maxHistory)
         , frameCount(0)
         , preEventFrameCount(1)
         , onEventFrameCount(0)
+        , m_maxHistory(maxHistory)
+        , m_pHistory(pHistory)
+        , m_traceIndex(pHistory->GetNextIndex()-1)
+        , m_prevTraceIndex(0)
+        , m_hasPrevTrace(false)
     {
         // No function log - avoid overhead.
         
-        m_pBboxTrace = std::shared_ptr<std::deque<std::shared_ptr<NvBbox_Coords>>>(
-            new std::deque<std::shared_ptr<NvBbox_Coords>>);
-        
         timeval creationTime;
         gettimeofday(&creationTime, NULL);
         m_creationTimeMs = creationTime.tv_sec*1000.0 + creationTime.tv_usec/1000.0;
         
         // update will increment the frameCount to 1
-        Update(frameNumber, pCoordinates);
+        Update(frameNumber, pHistory);
         
         if (pColor)
         {
@@ -66,7 +263,7 @@ namespace DSL
     }
     
     void TrackedObject::Update(uint64_t currentFrameNumber, 
-        const NvBbox_Coords* pCoordinates)
+        TrackedObjectHistory* pHistory)
     {
         // No function log - avoid overhead.
         
@@ -76,41 +273,13 @@ namespace DSL
         // update the tracked object's frame number - the filter used for purging.
         frameNumber = currentFrameNumber;
         
-        // Copy only the rectangle coordinates of the Object's RectParams
-        std::shared_ptr pBboxCoords = 
-            std::shared_ptr<NvBbox_Coords>(new NvBbox_Coords);
-            
-        *pBboxCoords = *pCoordinates;
-
-        // If maintaining bbox trace-point history
-        if (m_maxHistory)
+        // restart the trace if the history was purged and re-created.
+        if (m_traceIndex >= pHistory->GetNextIndex())
         {
-            // if there's a previous trace, purge from this deque first.
-            if (m_pPrevBboxTrace)
-            {
-                // while there are elements to purge..
-                while (m_pPrevBboxTrace and 
-                    (m_pPrevBboxTrace->size() + m_pBboxTrace->size() >= m_maxHistory))
-                {
-                   m_pPrevBboxTrace->pop_front();
-                   
-                   // If we've emptied the previous trace deque then remove it.
-                   if (m_pPrevBboxTrace->empty())
-                   {
-                       m_pPrevBboxTrace = nullptr;
-                   }
-                }
-                
-            }
-            else
-            {
-                while (m_pBboxTrace->size() >= m_maxHistory)
-                {
-                   m_pBboxTrace->pop_front();
-                }
-            }            
-            m_pBboxTrace->push_back(pBboxCoords);
+            m_traceIndex = pHistory->GetNextIndex()-1;
+            m_hasPrevTrace = false;
         }
+        m_pHistory = pHistory;
     }
 
     double TrackedObject::GetDurationMs()
@@ -121,18 +290,32 @@ namespace DSL
         return (currentTime.tv_sec*1000.0 + currentTime.tv_usec/1000.0) -
             m_creationTimeMs;
     }
+    
+    size_t TrackedObject::BboxTraceSize()
+    {
+        uint64_t first(0), last(0);
+        return (getTraceRange(false, first, last)) ? last - first + 1 : 0;
+    }
 
     dsl_coordinate TrackedObject::GetFirstCoordinate(uint testPoint)
     {
         dsl_coordinate traceCoordinate{0};
-        getCoordinate(m_pBboxTrace->front(), testPoint, traceCoordinate);
+        uint64_t first(0), last(0);
+        if (getTraceRange(false, first, last))
+        {
+            getCoordinate(m_pHistory->GetBbox(first), testPoint, traceCoordinate);
+        }
         return traceCoordinate;
     }
     
     dsl_coordinate TrackedObject::GetLastCoordinate(uint testPoint)
     {
         dsl_coordinate traceCoordinate{0};
-        getCoordinate(m_pBboxTrace->back(), testPoint, traceCoordinate);
+        uint64_t first(0), last(0);
+        if (getTraceRange(false, first, last))
+        {
+            getCoordinate(m_pHistory->GetBbox(last), testPoint, traceCoordinate);
+        }
         return traceCoordinate;
     }
     
@@ -141,30 +324,21 @@ namespace DSL
     {
         // No function log - avoid overhead.
         
-        // Create the trace - i.e. a vector of pre-sized blank coordinates
-        std::vector<dsl_coordinate> traceCoordinates;
-
-        dsl_coordinate traceCoordinate{0};
-            
-        if (method == DSL_OBJECT_TRACE_TEST_METHOD_END_POINTS)
-        {
-            getCoordinate(m_pBboxTrace->front(), testPoint, traceCoordinate);
-            traceCoordinates.push_back(traceCoordinate);
-            
-            getCoordinate(m_pBboxTrace->back(), testPoint, traceCoordinate);
-            traceCoordinates.push_back(traceCoordinate);
-        }
-
-        else
+        uint64_t first(0), last(0);
+        if (!getTraceRange(false, first, last))
         {
-            for (const auto& ideque: *m_pBboxTrace)
-            {
-                getCoordinate(ideque, testPoint, traceCoordinate);
-                traceCoordinates.push_back(traceCoordinate);
-            }
+            // an empty trace
+            first = 1;
         }
-        return DSL_RGBA_MULTI_LINE_NEW("", traceCoordinates.data(), 
-            traceCoordinates.size(), lineWidth, m_pColor);
+        getTrace(first, last, testPoint, method, lineWidth, m_pTrace);
+        
+        return m_pTrace;
+    }
+    
+    bool TrackedObject::HasPreviousTrace()
+    {
+        uint64_t first(0), last(0);
+        return getTraceRange(true, first, last);
     }
 
     DSL_RGBA_MULTI_LINE_PTR TrackedObject::GetPreviousTrace(
@@ -172,92 +346,135 @@ namespace DSL
     {
         // No function log - avoid overhead.
         
-        if (m_pPrevBboxTrace == nullptr)
+        uint64_t first(0), last(0);
+        if (!getTraceRange(true, first, last))
         {
             return nullptr;
         }
+        getTrace(first, last, testPoint, method, lineWidth, m_pPreviousTrace);
         
-        // Create the trace - i.e. a vector of pre-sized blank coordinates
-        std::vector<dsl_coordinate> traceCoordinates;
+        return m_pPreviousTrace;
+    }
 
-        dsl_coordinate traceCoordinate{0};
-            
-        if (method == DSL_OBJECT_TRACE_TEST_METHOD_END_POINTS)
+    void TrackedObject::HandleOccurrence()
+    {
+        // The last point of the current trace is the first point of the new
+        // trace to ensure a continuous line (line segment between 
+        // previous-trace-end and current-trace-start) 
+        m_prevTraceIndex = m_traceIndex;
+        m_traceIndex = m_pHistory->GetNextIndex()-1;
+        m_hasPrevTrace = true;
+
+        preEventFrameCount = 1;
+        onEventFrameCount = 0;
+    }
+    
+    bool TrackedObject::getTraceRange(bool previous, 
+        uint64_t& first, uint64_t& last)
+    {
+        if (!m_maxHistory or m_pHistory->GetFirstIndex() == 
+            m_pHistory->GetNextIndex())
         {
-            getCoordinate(m_pPrevBboxTrace->front(), testPoint, traceCoordinate);
-            traceCoordinates.push_back(traceCoordinate);
-            
-            getCoordinate(m_pPrevBboxTrace->back(), testPoint, traceCoordinate);
-            traceCoordinates.push_back(traceCoordinate);
+            return false;
+        }
+        uint64_t newest = m_pHistory->GetNextIndex()-1;
+        
+        // the current trace is limited to the last max-history points
+        uint64_t traceLength = newest - m_traceIndex + 1;
+        if (!previous)
+        {
+            first = std::max(m_pHistory->GetFirstIndex(), (traceLength > m_maxHistory) 
+                ? newest - m_maxHistory + 1 : m_traceIndex);
+            last = newest;
+            return true;
+        }
+        // the previous trace gets what remains of the max-history
+        if (!m_hasPrevTrace or traceLength >= m_maxHistory)
+        {
+            return false;
+        }
+        uint64_t remaining = m_maxHistory - traceLength;
+        last = m_traceIndex;
+        first = std::max(m_prevTraceIndex, (last + 1 > remaining) 
+            ? last + 1 - remaining : 0);
+        first = std::max(first, m_pHistory->GetFirstIndex());
+        
+        return (first <= last);
+    }
+    
+    void TrackedObject::getTrace(uint64_t first, uint64_t last, 
+        uint testPoint, uint method, uint lineWidth, DSL_RGBA_MULTI_LINE_PTR& pTrace)
+    {
+        if (pTrace == nullptr)
+        {
+            pTrace = DSL_RGBA_MULTI_LINE_NEW("", NULL, 0, lineWidth, m_pColor);
+        }
+        pTrace->line_width = lineWidth;
+        
+        if (first > last)
+        {
+            // empty trace, nothing to add.
+            pTrace->SetNumCoordinates(0);
+        }
+        else if (method == DSL_OBJECT_TRACE_TEST_METHOD_END_POINTS)
+        {
+            pTrace->SetNumCoordinates(2);
+            getCoordinate(m_pHistory->GetBbox(first), testPoint, 
+                pTrace->coordinates[0]);
+            getCoordinate(m_pHistory->GetBbox(last), testPoint, 
+                pTrace->coordinates[1]);
         }
-
         else
         {
-            traceCoordinates.reserve(m_pPrevBboxTrace->size());
-            for (const auto& ideque: *m_pPrevBboxTrace)
+            pTrace->SetNumCoordinates(last - first + 1);
+            for (uint64_t i = first; i <= last; i++)
             {
-                getCoordinate(ideque, testPoint, traceCoordinate);
-                traceCoordinates.push_back(traceCoordinate);
+                getCoordinate(m_pHistory->GetBbox(i), testPoint, 
+                    pTrace->coordinates[i - first]);
             }
         }
-        return DSL_RGBA_MULTI_LINE_NEW("", traceCoordinates.data(), 
-            traceCoordinates.size(), lineWidth, m_pColor);
-    }
-
-    void TrackedObject::HandleOccurrence()
-    {
-        m_pPrevBboxTrace = m_pBboxTrace;
-        m_pBboxTrace = std::shared_ptr<std::deque<std::shared_ptr<NvBbox_Coords>>>(
-            new std::deque<std::shared_ptr<NvBbox_Coords>>);
-
-        // Add last point of previous trace as first point to current trace to ensure
-        // a continuous line (line segment between previous-trace-end and current-trace-start) 
-        m_pBboxTrace->push_back(m_pPrevBboxTrace->back());
-
-        preEventFrameCount = 1;
-        onEventFrameCount = 0;
     }
     
-    void TrackedObject::getCoordinate(std::shared_ptr<NvBbox_Coords> pBbox, 
+    void TrackedObject::getCoordinate(const NvBbox_Coords& bbox, 
         uint testPoint, dsl_coordinate& traceCoordinate)
     {
         switch (testPoint)
         {
         case DSL_BBOX_POINT_CENTER :
-            traceCoordinate.x = round(pBbox->left + pBbox->width/2);
-            traceCoordinate.y = round(pBbox->top + pBbox->height/2);
+            traceCoordinate.x = round(bbox.left + bbox.width/2);
+            traceCoordinate.y = round(bbox.top + bbox.height/2);
             break;
         case DSL_BBOX_POINT_NORTH_WEST :
-            traceCoordinate.x = round(pBbox->left);
-            traceCoordinate.y = round(pBbox->top);
+            traceCoordinate.x = round(bbox.left);
+            traceCoordinate.y = round(bbox.top);
             break;
         case DSL_BBOX_POINT_NORTH :
-            traceCoordinate.x = round(pBbox->left + pBbox->width/2);
-            traceCoordinate.y = round(pBbox->top);
+            traceCoordinate.x = round(bbox.left + bbox.width/2);
+            traceCoordinate.y = round(bbox.top);
             break;
         case DSL_BBOX_POINT_NORTH_EAST :
-            traceCoordinate.x = round(pBbox->left + pBbox->width);
-            traceCoordinate.y = round(pBbox->top);
+            traceCoordinate.x = round(bbox.left + bbox.width);
+            traceCoordinate.y = round(bbox.top);
             break;
         case DSL_BBOX_POINT_EAST :
-            traceCoordinate.x = round(pBbox->left + pBbox->width);
-            traceCoordinate.y = round(pBbox->top + pBbox->height/2);
+            traceCoordinate.x = round(bbox.left + bbox.width);
+            traceCoordinate.y = round(bbox.top + bbox.height/2);
             break;
         case DSL_BBOX_POINT_SOUTH_EAST :
-            traceCoordinate.x = round(pBbox->left + pBbox->width);
-            traceCoordinate.y = round(pBbox->top + pBbox->height);
+            traceCoordinate.x = round(bbox.left + bbox.width);
+            traceCoordinate.y = round(bbox.top + bbox.height);
             break;
         case DSL_BBOX_POINT_SOUTH :
-            traceCoordinate.x = round(pBbox->left + pBbox->width/2);
-            traceCoordinate.y = round(pBbox->top + pBbox->height);
+            traceCoordinate.x = round(bbox.left + bbox.width/2);
+            traceCoordinate.y = round(bbox.top + bbox.height);
             break;
         case DSL_BBOX_POINT_SOUTH_WEST :
-            traceCoordinate.x = round(pBbox->left);
-            traceCoordinate.y = round(pBbox->top + pBbox->height);
+            traceCoordinate.x = round(bbox.left);
+            traceCoordinate.y = round(bbox.top + bbox.height);
             break;
         case DSL_BBOX_POINT_WEST :
-            traceCoordinate.x = round(pBbox->left);
-            traceCoordinate.y = round(pBbox->top + pBbox->height/2);
+            traceCoordinate.x = round(bbox.left);
+            traceCoordinate.y = round(bbox.top + bbox.height/2);
             break;
         default:
             LOG_ERROR("Invalid DSL_BBOX_POINT = '" << testPoint 
@@ -273,181 +490,119 @@ namespace DSL
         , m_maxMissingFromFrame(maxMissingFromFrame)
     {
         LOG_FUNC();
+        
+        SetTrackStore(nullptr);
+    }
+    
+    void TrackedObjects::SetTrackStore(std::shared_ptr<TrackedObjectStore> pTrackStore)
+    {
+        LOG_FUNC();
+        
+        m_ownsTrackStore = (pTrackStore == nullptr);
+        
+        m_pTrackStore = (m_ownsTrackStore) 
+            ? std::shared_ptr<TrackedObjectStore>(
+                new TrackedObjectStore(m_maxMissingFromFrame))
+            : pTrackStore;
+        m_pTrackStore->ReserveHistory(m_maxHistory);
+        
+        // all current objects refer to the previous store's history
+        m_trackedObjects.Clear();
     }
     
     bool TrackedObjects::IsTracked(uint sourceId, uint64_t trackingId)
     {
         // No function log - avoid overhead.
 
-        // If the sourceId does not exist, then not tracked.
-        if (m_trackedObjectsPerSource.find(sourceId) == 
-            m_trackedObjectsPerSource.end())
-        {
-            return false;
-        }
-        std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-            m_trackedObjectsPerSource[sourceId];
-            
-        // else, if this is the first occurrence of a specific object for this source
-        if (pTrackedObjects->find(trackingId) == pTrackedObjects->end())
-        {
-            return false;
-        }
-        
-        // else, the object is currently being tracked.
-        return true;
+        return (m_trackedObjects.Find(sourceId, trackingId) != NULL);
     }
     
-    std::shared_ptr<TrackedObject> TrackedObjects::GetObject(
-        uint sourceId, uint64_t trackingId)
+    TrackedObject* TrackedObjects::GetObject(uint sourceId, uint64_t trackingId)
     {
         // No function log - avoid overhead.
 
-        // If the sourceId does not exist, then not tracked.
-        if (m_trackedObjectsPerSource.find(sourceId) == 
-            m_trackedObjectsPerSource.end())
-        {
-            return nullptr;
-        }
-        std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-            m_trackedObjectsPerSource[sourceId];
-            
-        // else, if this is the first occurrence of a specific object for this source
-        if (pTrackedObjects->find(trackingId) == pTrackedObjects->end())
-        {
-            return nullptr;
-        }
-        
-        // else, the object is currently being tracked.
-        return pTrackedObjects->at(trackingId);
+        return m_trackedObjects.Find(sourceId, trackingId);
     }
     
-    std::shared_ptr<TrackedObject> TrackedObjects::Track(NvDsFrameMeta* pFrameMeta, 
+    TrackedObject* TrackedObjects::Track(NvDsFrameMeta* pFrameMeta, 
         NvDsObjectMeta* pObjectMeta, DSL_RGBA_COLOR_PTR pColor)
     {
         // No function log - avoid overhead.
 
-        // if this is the first occurrence of any object for this source
-        if (m_trackedObjectsPerSource.find(pFrameMeta->source_id) == 
-            m_trackedObjectsPerSource.end())
+        if (IsTracked(pFrameMeta->source_id, pObjectMeta->object_id))
         {
-            LOG_DEBUG("First object detected with id = " << pObjectMeta->object_id 
-                << " for source = " << pFrameMeta->source_id);
-            
-            // create a new tracked object for this tracking Id and source
-            std::shared_ptr<TrackedObject> pTrackedObject = 
-                std::shared_ptr<TrackedObject>(new TrackedObject(
-                    pObjectMeta->object_id, pFrameMeta->frame_num, 
-                    (NvBbox_Coords*)&pObjectMeta->rect_params, 
-                    pColor, m_maxHistory));
-                
-            // create a map of tracked objects for this source    
-            std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-                std::shared_ptr<TrackedObjectsT>(new TrackedObjectsT());
-                
-            // insert the new tracked object into the new map    
-            pTrackedObjects->insert(std::pair<uint64_t, 
-                std::shared_ptr<TrackedObject>>(pObjectMeta->object_id, 
-                    pTrackedObject));
-                
-            // add the map of tracked objects for this source to the map of 
-            // all tracked objects.
-            m_trackedObjectsPerSource[pFrameMeta->source_id] = pTrackedObjects;
-            
-            return pTrackedObject;
+            LOG_ERROR("Object with id = " << pObjectMeta->object_id 
+                << " for source = " << pFrameMeta->source_id 
+                << " is already being tracked");
+            return NULL;
         }
-        std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-            m_trackedObjectsPerSource[pFrameMeta->source_id];
-            
-        // else, if this is the first occurrence of a specific object for this source
-        if (pTrackedObjects->find(pObjectMeta->object_id) == pTrackedObjects->end())
-        {
-            LOG_DEBUG("New object detected with id = " << pObjectMeta->object_id 
-                << " for source = " << pFrameMeta->source_id);
-            
-            // create a new tracked object for this tracking Id and source
-            std::shared_ptr<TrackedObject> pTrackedObject = 
-                std::shared_ptr<TrackedObject>(new TrackedObject(
-                    pObjectMeta->object_id, pFrameMeta->frame_num,
-                    (NvBbox_Coords*)&pObjectMeta->rect_params, 
-                    pColor, m_maxHistory));
+        LOG_DEBUG("New object tracked with id = " << pObjectMeta->object_id 
+            << " for source = " << pFrameMeta->source_id);
 
-            // insert the new tracked object into the new map    
-            pTrackedObjects->insert(std::pair<uint64_t, 
-                std::shared_ptr<TrackedObject>>(pObjectMeta->object_id, 
-                    pTrackedObject));
-            
-            return pTrackedObject;
-        }
+        // add or update the object's shared history - the history may already
+        // exist if the object is, or was, tracked by another Trigger.
+        TrackedObjectHistory* pHistory = 
+            m_pTrackStore->Update(pFrameMeta, pObjectMeta);
+
+        return m_trackedObjects.Insert(pFrameMeta->source_id, 
+            pObjectMeta->object_id, TrackedObject(pObjectMeta->object_id, 
+                pFrameMeta->frame_num, pHistory, pColor, m_maxHistory));
+    }
+    
+    TrackedObject* TrackedObjects::Update(NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
+    {
+        // No function log - avoid overhead.
+
+        TrackedObject* pTrackedObject = m_trackedObjects.Find(
+            pFrameMeta->source_id, pObjectMeta->object_id);
         
-        LOG_ERROR("Object with id = " << pObjectMeta->object_id 
-            << " for source = " << pFrameMeta->source_id 
-            << " is already being tracked");
-        return nullptr;
+        if (pTrackedObject != NULL)
+        {
+            pTrackedObject->Update(pFrameMeta->frame_num, 
+                m_pTrackStore->Update(pFrameMeta, pObjectMeta));
+        }
+        return pTrackedObject;
     }
 
     void TrackedObjects::DeleteObject(uint sourceId, uint64_t trackingId)
     {
-        // If the sourceId does not exist, then not tracked.
-        if (m_trackedObjectsPerSource.find(sourceId) == 
-            m_trackedObjectsPerSource.end())
-        {
-            LOG_ERROR("Source = " << sourceId 
-                << " is not being tracked");
-            return;
-        }
-        std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-            m_trackedObjectsPerSource[sourceId];
-            
-        // else, if this is the first occurrence of a specific object for this source
-        if (pTrackedObjects->find(trackingId) == pTrackedObjects->end())
+        if (!m_trackedObjects.Erase(sourceId, trackingId))
         {
             LOG_ERROR("Object with id = " << trackingId 
                 << " for source = " << sourceId 
                 << " is not being tracked");
-            return;
         }
-        
-        // else, the object is currently being tracked.
-        pTrackedObjects->erase(trackingId);
     }    
 
     void TrackedObjects::Purge(uint64_t currentFrameNumber)
     {
         // No function log - avoid overhead.
 
-        for (const auto &trackedObjects: m_trackedObjectsPerSource)
-        {
-            std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-                trackedObjects.second;
-
-            auto trackedObject = pTrackedObjects->cbegin();
-            while (trackedObject != pTrackedObjects->cend())
+        m_trackedObjects.EraseIf(
+            [&](uint sourceId, const TrackedObject& trackedObject)
             {
-                if (currentFrameNumber > (trackedObject->second->frameNumber) + 
+                if (currentFrameNumber > trackedObject.frameNumber + 
                     m_maxMissingFromFrame)
                 {
-                    {
-                        LOG_DEBUG("Purging tracked object with id = " 
-                            << trackedObject->first << " for source = " 
-                            << trackedObjects.first);
-                        LOG_DEBUG("frame delta = " << currentFrameNumber - 
-                            trackedObject->second->frameNumber);
-                            
-                        // use the return value to update the iterator, as erase invalidates it
-                        trackedObject = pTrackedObjects->erase(trackedObject);
-                    }
+                    LOG_DEBUG("Purging tracked object with id = " 
+                        << trackedObject.trackingId << " for source = " 
+                        << sourceId);
+                    return true;
                 }
-                else {
-                    trackedObject++;
-                }            
-            }
+                return false;
+            });
+
+        // a shared store is purged by its owner, once per frame.
+        if (m_ownsTrackStore)
+        {
+            m_pTrackStore->Purge(currentFrameNumber);
         }
     }
     
     void TrackedObjects::Clear()
     {
-        m_trackedObjectsPerSource.clear();
+        m_trackedObjects.Clear();
     }
     
     double TrackedObjects::GetCreationTime(NvDsFrameMeta* pFrameMeta, 
@@ -455,17 +610,17 @@ namespace DSL
     {
         // No function log - avoid overhead.
         
-        if (!IsTracked(pFrameMeta->source_id, pObjectMeta->object_id))
+        TrackedObject* pTrackedObject = m_trackedObjects.Find(
+            pFrameMeta->source_id, pObjectMeta->object_id);
+        
+        if (pTrackedObject == NULL)
         {
             LOG_ERROR("Object with id = " << pObjectMeta->object_id 
                 << " for source = " << pFrameMeta->source_id 
                 << " is NOT being tracked");
             return 0;
         }
-        std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-            m_trackedObjectsPerSource[pFrameMeta->source_id];
-            
-        return pTrackedObjects->at(pObjectMeta->object_id)->GetDurationMs();
+        return pTrackedObject->GetDurationMs();
     }
 
     void TrackedObjects::SetMaxHistory(uint maxHistory)
@@ -473,17 +628,12 @@ namespace DSL
         LOG_FUNC();
         
         m_maxHistory = maxHistory;
+        m_pTrackStore->ReserveHistory(maxHistory);
 
-        for (const auto &trackedObjects: m_trackedObjectsPerSource)
+        m_trackedObjects.ForEach([&](TrackedObject& trackedObject)
         {
-            std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-                trackedObjects.second;
-                
-            for (const auto &trackedObject: *pTrackedObjects)
-            {
-                trackedObject.second->SetMaxHistory(maxHistory);
-            }
-        }
+            trackedObject.SetMaxHistory(maxHistory);
+        });
     }
     
     void TrackedObjects::SetMaxMissingFromFrame(uint maxMissingFromFrame)
@@ -492,4 +642,4 @@ namespace DSL
         
         m_maxMissingFromFrame = maxMissingFromFrame;
     }
-}    
\ No newline at end of file
+}
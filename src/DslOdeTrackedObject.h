@@ -32,10 +32,430 @@ THE SOFTWARE.
 
 namespace DSL
 {
+    /**
+     * @class TrackedObjectTable
+     * @file DslOdeTrackedObject.h
+     * @brief Open-addressing hash table of values keyed by source-id and 
+     * tracking-id. Values are stored contiguously and the slots, probed 
+     * linearly, hold indices into the values. Pointers returned by Find and
+     * Insert are valid until the next call to Insert, Erase, or EraseIf.
+     */
+    template<typename T>
+    class TrackedObjectTable
+    {
+    public:
+    
+        /**
+         * @brief Finds the value for a given key.
+         * @param[in] sourceId source-id for the value to find.
+         * @param[in] trackingId tracking-id for the value to find.
+         * @return pointer to the value if found, NULL otherwise.
+         */
+        T* Find(uint sourceId, uint64_t trackingId)
+        {
+            size_t slot = findSlot(sourceId, trackingId);
+            return (slot == SIZE_MAX) ? NULL : &m_entries[m_slots[slot]-1].value;
+        };
+        
+        /**
+         * @brief Inserts a new value. The key must not be in the table.
+         * @param[in] sourceId source-id for the new value.
+         * @param[in] trackingId tracking-id for the new value.
+         * @param[in] value value to move into the table.
+         * @return pointer to the inserted value.
+         */
+        T* Insert(uint sourceId, uint64_t trackingId, T&& value)
+        {
+            // keep the load factor at or under 1/2 to keep probes short.
+            if ((m_entries.size()+1)*2 > m_slots.size())
+            {
+                rehash(std::max((size_t)16, m_slots.size()*2));
+            }
+            m_entries.push_back(Entry{sourceId, trackingId, std::move(value)});
+            m_slots[findEmptySlot(sourceId, trackingId)] = m_entries.size();
+            
+            return &m_entries.back().value;
+        };
+        
+        /**
+         * @brief Erases the value for a given key.
+         * @param[in] sourceId source-id for the value to erase.
+         * @param[in] trackingId tracking-id for the value to erase.
+         * @return true if the value was found and erased, false otherwise.
+         */
+        bool Erase(uint sourceId, uint64_t trackingId)
+        {
+            size_t slot = findSlot(sourceId, trackingId);
+            if (slot == SIZE_MAX)
+            {
+                return false;
+            }
+            size_t index = m_slots[slot]-1;
+            eraseSlot(slot);
+            
+            // move the last value into the hole to keep the values contiguous.
+            size_t last = m_entries.size()-1;
+            if (index != last)
+            {
+                m_entries[index] = std::move(m_entries[last]);
+                m_slots[findSlot(m_entries[index].sourceId, 
+                    m_entries[index].trackingId)] = index+1;
+            }
+            m_entries.pop_back();
+            return true;
+        };
+        
+        /**
+         * @brief Erases all values that satisfy a given predicate.
+         * @param[in] predicate function returning true for each value to erase.
+         */
+        template<typename Predicate>
+        void EraseIf(Predicate predicate)
+        {
+            // iterate in reverse so that the value moved into an erased
+            // value's place has already been visited.
+            for (size_t i = m_entries.size(); i-- > 0; )
+            {
+                if (predicate(m_entries[i].sourceId, m_entries[i].value))
+                {
+                    Erase(m_entries[i].sourceId, m_entries[i].trackingId);
+                }
+            }
+        };
+        
+        /**
+         * @brief Calls a given function for each value in the table.
+         * @param[in] function function to call with a reference to each value.
+         */
+        template<typename Function>
+        void ForEach(Function function)
+        {
+            for (auto &ivec: m_entries)
+            {
+                function(ivec.value);
+            }
+        };
+        
+        /**
+         * @brief Erases all values.
+         */
+        void Clear()
+        {
+            m_entries.clear();
+            m_slots.clear();
+        };
+        
+        /**
+         * @brief Gets the number of values in the table.
+         */
+        size_t Size(){return m_entries.size();};
+        
+        /**
+         * @brief Query to determine if the table is empty.
+         */
+        bool IsEmpty(){return m_entries.empty();};
+        
+    private:
+    
+        struct Entry
+        {
+            uint sourceId;
+            uint64_t trackingId;
+            T value;
+        };
+        
+        static size_t hash(uint sourceId, uint64_t trackingId)
+        {
+            // 64-bit finalizer from MurmurHash3 - tracker ids are sequential
+            uint64_t key = trackingId ^ ((uint64_t)sourceId*0x9E3779B97F4A7C15ULL);
+            key ^= key >> 33;
+            key *= 0xFF51AFD7ED558CCDULL;
+            key ^= key >> 33;
+            key *= 0xC4CEB9FE1A85EC53ULL;
+            key ^= key >> 33;
+            return key;
+        };
+        
+        size_t findSlot(uint sourceId, uint64_t trackingId)
+        {
+            if (m_slots.empty())
+            {
+                return SIZE_MAX;
+            }
+            size_t mask = m_slots.size()-1;
+            for (size_t slot = hash(sourceId, trackingId) & mask; m_slots[slot]; 
+                slot = (slot+1) & mask)
+            {
+                const Entry& entry = m_entries[m_slots[slot]-1];
+                if (entry.trackingId == trackingId and entry.sourceId == sourceId)
+                {
+                    return slot;
+                }
+            }
+            return SIZE_MAX;
+        };
+        
+        size_t findEmptySlot(uint sourceId, uint64_t trackingId)
+        {
+            size_t mask = m_slots.size()-1;
+            size_t slot = hash(sourceId, trackingId) & mask;
+            while (m_slots[slot])
+            {
+                slot = (slot+1) & mask;
+            }
+            return slot;
+        };
+        
+        void eraseSlot(size_t slot)
+        {
+            // backward-shift deletion - no tombstones are left behind.
+            size_t mask = m_slots.size()-1;
+            for (size_t next = (slot+1) & mask; m_slots[next]; 
+                next = (next+1) & mask)
+            {
+                const Entry& entry = m_entries[m_slots[next]-1];
+                size_t home = hash(entry.sourceId, entry.trackingId) & mask;
+                
+                // the entry can fill the hole only if its home slot is not
+                // cyclically within (slot, next]
+                if (((next - home) & mask) >= ((next - slot) & mask))
+                {
+                    m_slots[slot] = m_slots[next];
+                    slot = next;
+                }
+            }
+            m_slots[slot] = 0;
+        };
+        
+        void rehash(size_t numSlots)
+        {
+            m_slots.assign(numSlots, 0);
+            for (size_t i = 0; i < m_entries.size(); i++)
+            {
+                m_slots[findEmptySlot(m_entries[i].sourceId, 
+                    m_entries[i].trackingId)] = i+1;
+            }
+        };
+    
+        /**
+         * @brief contiguous storage for all values.
+         */
+        std::vector<Entry> m_entries;
+        
+        /**
+         * @brief power-of-two sized slots, each holding an index+1 into
+         * m_entries, or 0 if empty.
+         */
+        std::vector<uint> m_slots;
+    };
+
+    //*******************************************************************************
+
+    /**
+     * @class TrackedObjectHistory
+     * @file DslOdeTrackedObject.h
+     * @brief Bounding box history for a single tracked object, shared by all
+     * Tracking Triggers using the same TrackedObjectStore. Each bbox is given
+     * a sequential index so that Triggers can reference a range of history.
+     * The bboxes are stored inline in a fixed-capacity ring, allocated once
+     * and only reallocated if the max history is increased.
+     */
+    class TrackedObjectHistory
+    {
+    public:
+
+        /**
+         * @brief Ctor for the TrackedObjectHistory class
+         * @param[in] unique trackingId for the tracked object
+         * @param[in] frameNumber the object was first detected
+         * @param[in] pCoordinates bounding box coordinates from the object's meta 
+         * when first detected
+         * @param[in] maxHistory maximum number of bbox coordinates to keep.
+         */
+        TrackedObjectHistory(uint64_t trackingId, uint64_t frameNumber,
+            const NvBbox_Coords* pCoordinates, uint maxHistory);
+            
+        /**
+         * @brief Sets the max history for this tracked object
+         * @param maxHistory new max history setting.
+         */
+        void SetMaxHistory(uint maxHistory);
+        
+        /**
+         * @brief function to update the tracked-object's last frame number and 
+         * push a new set of positional bbox coordinates on to the history.
+         * @param[in] currentFrameNumber new frame number to save
+         * @param[in] pCoordinates new bounding box coordinates to push.
+         */
+        void Update(uint64_t currentFrameNumber, const NvBbox_Coords* pCoordinates);
+        
+        /**
+         * @brief Gets the index of the oldest bbox still in the history.
+         */
+        uint64_t GetFirstIndex(){return m_firstIndex;};
+        
+        /**
+         * @brief Gets the index that will be given to the next bbox, i.e. 
+         * one past the index of the newest bbox.
+         */
+        uint64_t GetNextIndex(){return m_nextIndex;};
+        
+        /**
+         * @brief Gets a bbox from the history by index.
+         * @param[in] index in the range [GetFirstIndex(), GetNextIndex())
+         */
+        const NvBbox_Coords& GetBbox(uint64_t index)
+        {
+            return m_bboxRing[index & (m_bboxRing.size()-1)];
+        };
+        
+        /**
+         * @brief unique tracking id for the tracked object.
+         */
+        uint64_t trackingId;
+        
+        /**
+         * @brief frame number for the tracked object, updated on detection 
+         * within a new frame.
+         */
+        uint64_t frameNumber;
+        
+    private:
+    
+        /**
+         * @brief maximum number of bbox coordinates to keep.
+         */
+        uint m_maxHistory;
+        
+        /**
+         * @brief index of the oldest bbox still in the history.
+         */
+        uint64_t m_firstIndex;
+        
+        /**
+         * @brief index to give the next bbox pushed on to the history.
+         */
+        uint64_t m_nextIndex;
+
+        /**
+         * @brief power-of-two sized ring of bbox coordinates, indexed by
+         * history index masked with the ring size - 1. 
+         */
+        std::vector<NvBbox_Coords> m_bboxRing;
+    };
+
+    //*******************************************************************************
+
+    /**
+     * @class TrackedObjectStore
+     * @file DslOdeTrackedObject.h
+     * @brief Bbox history for all tracked objects, for all sources. The store 
+     * is updated once per object per frame and is shared by any number of 
+     * TrackedObjects containers, one per Tracking Trigger. Each source has 
+     * its own table so that frames from different sources can be processed 
+     * concurrently by an ODE Pad Probe Handler in parallel mode.
+     */
+    class TrackedObjectStore
+    {
+    public:
+    
+        /**
+         * @brief Ctor for the TrackedObjectStore class
+         * @param[in] maxMissingFromFrame The maximum number of consecutive frames 
+         * a tracked object can go undetected before it is purged. 
+         */
+        TrackedObjectStore(uint maxMissingFromFrame);
+        
+        /**
+         * @brief Increases the max history for all objects to at least a given
+         * value. The max history is never decreased as it may be shared.
+         * @param[in] maxHistory max history required by the caller.
+         */
+        void ReserveHistory(uint maxHistory);
+        
+        /**
+         * @brief Creates the table for a given source-id if not already created.
+         * Must be called for each source before the store can be updated from 
+         * more than one thread.
+         * @param[in] sourceId source-id to create the table for.
+         */
+        void PrepareSource(uint sourceId);
+        
+        /**
+         * @brief Adds or updates the history for a given object. The history
+         * is updated at most once per frame, so only the first call for the
+         * current frame updates, subsequent calls simply return the history.
+         * @param[in] pFrameMeta pointer to the frame that holds the Object Meta.
+         * @param[in] pObjectMeta pointer to the Object Meta to add or update.
+         * @return pointer to the object's history, valid until the next call 
+         * to Update or Purge for the same source.
+         */
+        TrackedObjectHistory* Update(NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta);
+            
+        /**
+         * @brief Adds or updates the history for all objects in a given frame.
+         * @param[in] pFrameMeta pointer to the frame to update from.
+         */
+        void UpdateFrame(NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief Purges all objects for a given source that have not been
+         * detected for more than the maximum number of frames.
+         * @param[in] sourceId source-id to purge objects for.
+         * @param[in] currentFrameNumber current frame number for the source.
+         */
+        void Purge(uint sourceId, uint64_t currentFrameNumber);
+        
+        /**
+         * @brief Purges all objects, for all sources, that have not been 
+         * detected for more than the maximum number of frames.
+         * @param[in] currentFrameNumber current frame number to use as a filter.
+         */
+        void Purge(uint64_t currentFrameNumber);
+        
+    private:
+    
+        typedef TrackedObjectTable<TrackedObjectHistory> HistoryTableT;
+        
+        /**
+         * @brief Gets the table for a given source-id, creating it if needed.
+         */
+        HistoryTableT& getSourceTable(uint sourceId);
+        
+        /**
+         * @brief Purges all objects in a given table that have not been
+         * detected for more than the maximum number of frames.
+         */
+        void purgeTable(HistoryTableT& table, uint64_t currentFrameNumber);
+        
+        /**
+         * @brief The maximum number of consecutive frames a tracked object
+         * can go undetected before it is purged.
+         */
+        uint m_maxMissingFromFrame;
+        
+        /**
+         * @brief maximum number of bbox coordinates to keep per object. Atomic
+         * as it may be increased by the client while streaming.
+         */
+        std::atomic<uint> m_maxHistory;
+        
+        /**
+         * @brief table of object histories for each source, keyed by source-id.
+         * Source-ids are sparse, i.e. the unique Pipeline id in the upper bits,
+         * so only the sources seen have a table.
+         */
+        std::unordered_map<uint, std::unique_ptr<HistoryTableT>> m_sourceTables;
+    };
+    
+    //*******************************************************************************
+
     /**
      * @class TrackedObject
      * @file DslOdeTrackedObject.h
-     * @brief Implements a Tracked Object with a history of bbox coordinates.
+     * @brief Implements a Tracking Trigger's view of a Tracked Object - the
+     * per-Trigger counts and trace range into the object's shared history.
      */
     class TrackedObject
     {
@@ -45,14 +465,14 @@ namespace DSL
          * @brief Ctor for the TrackedObject class
          * @param[in] unique trackingId for the tracked object
          * @param[in] frameNumber the object was first detected
-         * @param[in] pCoordinates bounding box coordinates from the object's meta 
-         * when first detected
+         * @param[in] pHistory the object's shared bbox history, updated with
+         * the bounding box coordinates from the object's meta when first detected.
          * @param[in] pColor shared pointer to an RGBA Color Type to
          * set a unique color for the tracked object. 
-         * @param[in] maxHistory maximum number of bbox coordinates to track
+         * @param[in] maxHistory maximum number of bbox coordinates to trace
          */
         TrackedObject(uint64_t trackingId, uint64_t frameNumber,
-            const NvBbox_Coords* pCoordinates, DSL_RGBA_COLOR_PTR pColor, 
+            TrackedObjectHistory* pHistory, DSL_RGBA_COLOR_PTR pColor, 
             uint maxHistory);
             
         /**
@@ -62,13 +482,13 @@ namespace DSL
         void SetMaxHistory(uint maxHistory);
         
         /**
-         * @brief function to update the tracked-object's last frame number and 
-         * push a new set of positional bbox coordinates on to the tracked 
-         * object's m_bboxTrace queue.
+         * @brief function to update the tracked-object's last frame number 
+         * and its shared history.
          * @param[in] currentFrameNumber new frame number to save
-         * @param[in] pCoordinates new bounding box coordinates to push.
+         * @param[in] pHistory the object's shared history, already updated 
+         * with the current frame's bbox coordinates.
          */
-        void Update(uint64_t currentFrameNumber, const NvBbox_Coords* pCoordinates);
+        void Update(uint64_t currentFrameNumber, TrackedObjectHistory* pHistory);
         
         /**
          * @brief calculates the duration of time the object has been tracked.
@@ -80,7 +500,7 @@ namespace DSL
          * @brief Gets the current size of the bounding box trace.
          * @return current size of the bbox trace.
          */
-        size_t BboxTraceSize(){return m_pBboxTrace->size();};
+        size_t BboxTraceSize();
         
         /**
          * @brief Gets the coordinates for a specific test-point for the 
@@ -99,12 +519,13 @@ namespace DSL
         dsl_coordinate GetLastCoordinate(uint testPoint);
         
         /**
-         * @brief Returns a vector of coordinates defining the TrackedObject's
-         * trace for a specfic test-point on the object's bounding box
+         * @brief Returns a multi-line defining the TrackedObject's trace for 
+         * a specfic test-point on the object's bounding box. The multi-line
+         * is owned and reused by the TrackedObject.
          * @param[in] testPoint test-point to generate the trace with.
          * @param[in] method one of the DSL_OBJECT_TRACE_TEST_METHOD_* constants
          * @param[in] lineWidth the width value to assign to the line.
-         * @return shared pointer to a vector of coordinates.
+         * @return shared pointer to the trace, overwritten by the next call.
          */
         DSL_RGBA_MULTI_LINE_PTR GetTrace(uint testPoint, uint method, 
             uint lineWidth);
@@ -113,23 +534,25 @@ namespace DSL
          * @brief used to query if the tracked object has a previous Trace
          * from a previous line cross event.
          */
-        bool HasPreviousTrace(){return m_pPrevBboxTrace != nullptr;};
+        bool HasPreviousTrace();
 
         /**
-         * @brief Returns a vector of coordinates defining the TrackedObject's
-         * previous trace for a specfic test-point on the object's bounding box.
+         * @brief Returns a multi-line defining the TrackedObject's previous 
+         * trace for a specfic test-point on the object's bounding box. The 
+         * multi-line is owned and reused by the TrackedObject.
          * @param[in] testPoint test-point to generate the trace with.
          * @param[in] method one of the DSL_OBJECT_TRACE_TEST_METHOD_* constants
          * @param[in] lineWidth the width value to assign to the line.
-         * @return shared pointer to a vector of coordinates.
+         * @return shared pointer to the previous trace, overwritten by the 
+         * next call, or nullptr if the object has no previous trace.
          */
         DSL_RGBA_MULTI_LINE_PTR GetPreviousTrace(uint testPoint, uint method, 
             uint lineWidth);
             
         /**
          * @brief Handles an ODE Occurrence for this tracked object. The current
-         * m_pBboxTrace is moved to the m_pPreviousBboxTrace and a new/empty
-         * m_pBboxTrace is created.
+         * trace becomes the previous trace and a new trace is started from
+         * the last point of the previous.
          */
         void HandleOccurrence();
 
@@ -161,14 +584,32 @@ namespace DSL
 
     private:
 
+        /**
+         * @brief Gets the [first, last] history indices for the current or 
+         * previous trace, limited to the max history for both combined.
+         * @param[in] previous if true, gets the range for the previous trace.
+         * @param[out] first index of the first bbox in the trace.
+         * @param[out] last index of the last bbox in the trace.
+         * @return false if the trace is empty, true otherwise.
+         */
+        bool getTraceRange(bool previous, uint64_t& first, uint64_t& last);
+        
+        /**
+         * @brief Fills in a multi-line for a range of the object's history,
+         * creating the multi-line on first use.
+         * @param[in,out] pTrace multi-line to reuse, created if nullptr.
+         */
+        void getTrace(uint64_t first, uint64_t last, uint testPoint, 
+            uint method, uint lineWidth, DSL_RGBA_MULTI_LINE_PTR& pTrace);
+
         /**
          * @brief Get an x,y coordinate from a Bbox based on this Trigger's
          * client specified test-point
-         * @param[in] pBbox to optain the coordinate from
+         * @param[in] bbox to optain the coordinate from
          * @param[in] testPoint one of the DSL_BBOX_POINT_* constants
          * @param[out] traceCoordinate x,y coordinate value.
          */
-        void getCoordinate(std::shared_ptr<NvBbox_Coords> pBbox, 
+        void getCoordinate(const NvBbox_Coords& bbox, 
             uint testPoint, dsl_coordinate& traceCoordinate);
         
         /**
@@ -178,25 +619,46 @@ namespace DSL
         double m_creationTimeMs;
         
         /**
-         * @brief maximum number of bbox coordinates to maintain/trace.
+         * @brief maximum number of bbox coordinates to trace.
          */
         uint m_maxHistory;
+        
+        /**
+         * @brief the object's shared history, set on each update.
+         */
+        TrackedObjectHistory* m_pHistory;
 
         /**
-         * @brief a max sized queue of Rectangle Params.
+         * @brief history index of the first bbox in the current trace.
+         */
+        uint64_t m_traceIndex;
+        
+        /**
+         * @brief history index of the first bbox in the previous trace,
+         * valid only if m_hasPrevTrace is true. The previous trace ends
+         * at m_traceIndex.
          */
-        std::shared_ptr<std::deque<std::shared_ptr<NvBbox_Coords>>> m_pBboxTrace;
+        uint64_t m_prevTraceIndex;
         
         /**
-         * @brief a max sized queue of Rectangle Params.
+         * @brief true if there's a previous trace from a previous occurrence.
          */
-        std::shared_ptr<std::deque<std::shared_ptr<NvBbox_Coords>>> m_pPrevBboxTrace;
+        bool m_hasPrevTrace;
         
         /**
          * @brief used to identify the tracked object with an RGBA color.
          */
         DSL_RGBA_COLOR_PTR m_pColor;
         
+        /**
+         * @brief reusable multi-line returned by GetTrace.
+         */
+        DSL_RGBA_MULTI_LINE_PTR m_pTrace;
+        
+        /**
+         * @brief reusable multi-line returned by GetPreviousTrace.
+         */
+        DSL_RGBA_MULTI_LINE_PTR m_pPreviousTrace;
     };
     
     //*******************************************************************************
@@ -204,7 +666,9 @@ namespace DSL
     /**
      * @class TrackedObjects
      * @file DslOdeTrackedObject.h
-     * @brief Manages a map of tracked objects.
+     * @brief Manages a Tracking Trigger's tracked objects, for all sources,
+     * with each object's history held in a TrackedObjectStore. The store is 
+     * owned by the container unless a shared store is set.
      */
     class TrackedObjects
     {
@@ -217,6 +681,14 @@ namespace DSL
          */
         TrackedObjects(uint maxHistory, uint maxMissingFromFrame);
         
+        /**
+         * @brief Sets the store to hold the tracked objects' history. All
+         * currently tracked objects are cleared.
+         * @param[in] pTrackStore shared store to use, or nullptr to use a
+         * store owned by this container.
+         */
+        void SetTrackStore(std::shared_ptr<TrackedObjectStore> pTrackStore);
+        
         /**
          * @brief determines if an object is currently tracked for a given source.
          * @param[in] sourceId source to filter on
@@ -232,19 +704,30 @@ namespace DSL
          * the frame that holds the Object Meta
          * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to check
          * @param[in] pColor RGBA color to assign to the new Tracked object.
-         * @return a shared pointer to the newly tracked object, null_ptr otherwise.
+         * @return a pointer to the newly tracked object, NULL otherwise. 
+         * Valid until the next call to Track, DeleteObject, Purge, or Clear.
          */
-        std::shared_ptr<TrackedObject> Track(NvDsFrameMeta* pFrameMeta, 
+        TrackedObject* Track(NvDsFrameMeta* pFrameMeta, 
             NvDsObjectMeta* pObjectMeta, DSL_RGBA_COLOR_PTR pColor);
         
+        /**
+         * @brief updates a tracked object with the current frame's meta.
+         * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data - 
+         * the frame that holds the Object Meta
+         * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to update from
+         * @return a pointer to the updated object if tracked, NULL otherwise.
+         * Valid until the next call to Track, DeleteObject, Purge, or Clear.
+         */
+        TrackedObject* Update(NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta);
+        
         /**
          * @brief Gets the Tracked Object for a specified source and tranking Id
          * @param[in] sourceId source to filter on
          * @param[in] trackingId unique tracking id of the object to query
-         * @return a shared pointer if found, null_ptr otherwise.
+         * @return a pointer if found, NULL otherwise.
          */
-        std::shared_ptr<TrackedObject> GetObject(uint sourceId, 
-            uint64_t trackingId);
+        TrackedObject* GetObject(uint sourceId, uint64_t trackingId);
         
         /**
          * @brief Deletes a Tracked Object by source Id and tracking Id
@@ -268,7 +751,7 @@ namespace DSL
          * @brief Query to determine if the container is empty
          * @return true if empty of tracked objects, false otherwise
          */
-        bool IsEmpty(){return m_trackedObjectsPerSource.empty();};
+        bool IsEmpty(){return m_trackedObjects.IsEmpty();};
         
         /**
          * @brief gets the time of tracked object creation
@@ -307,14 +790,20 @@ namespace DSL
         uint m_maxMissingFromFrame;
         
         /**
-         * @brief map of tracked objects - Key = unique Tracking Id
+         * @brief store holding the history for all tracked objects.
          */
-        typedef std::map <uint64_t, std::shared_ptr<TrackedObject>> TrackedObjectsT;
-
+        std::shared_ptr<TrackedObjectStore> m_pTrackStore;
+        
+        /**
+         * @brief true if m_pTrackStore is owned by, and must be purged by, 
+         * this container.
+         */
+        bool m_ownsTrackStore;
+        
         /**
-         * @brief map of tracked objects per source - Key = source Id
+         * @brief table of tracked objects - Key = source Id and tracking Id
          */
-        std::map <uint, std::shared_ptr<TrackedObjectsT>> m_trackedObjectsPerSource;
+        TrackedObjectTable<TrackedObject> m_trackedObjects;
     };    
 }
 
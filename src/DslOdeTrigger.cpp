@@ -27,13 +27,18 @@ THE SOFTWARE.
 #include "DslOdeAction.h"
 #include "DslOdeArea.h"
 #include "DslOdeHeatMapper.h"
+#include "DslGeometry.h"
 #include "DslServices.h"
+#include "DslTimerWheel.h"
 
 namespace DSL
 {
 
     // Initialize static Event Counter
-    uint64_t OdeTrigger::s_eventCount = 0;
+    std::atomic<uint64_t> OdeTrigger::s_eventCount(0);
+
+    // Initialize static Dispatch Version
+    std::atomic<uint64_t> OdeTrigger::s_dispatchVersion(0);
 
     OdeTrigger::OdeTrigger(const char* name, const char* source, 
         uint classId, uint limit)
@@ -65,10 +70,20 @@ namespace DSL
         , m_interval(0)
         , m_intervalCounter(0)
         , m_skipFrame(false)
+        , m_perSourceStateEnabled(false)
+        , m_loadedSourceId(-1)
+        , m_rateLimit(0)
+        , m_rateLimitBurst(0)
+        , m_debounceWindow(0)
+        , m_pCriteria(NULL)
+        , m_criteriaRetired(false)
+        , m_statsEnabled(false)
         , m_nextAreaIndex(0)
         , m_nextActionIndex(0)
     {
         LOG_FUNC();
+        
+        PublishCriteria();
     }
 
     OdeTrigger::~OdeTrigger()
@@ -85,8 +100,11 @@ namespace DSL
         if (m_resetTimerId)
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_resetTimerMutex);
-            g_source_remove(m_resetTimerId);
+            TimerWheel::GetTimerWheel()->Remove(m_resetTimerId);
         }
+        
+        // retired snapshots are freed with m_retiredCriteria
+        delete m_pCriteria.load();
     }
 
     bool OdeTrigger::AddAction(DSL_BASE_PTR pChild)
@@ -109,6 +127,8 @@ namespace DSL
         m_pOdeActions[pChild->GetName()] = pChild;
         m_pOdeActionsIndexed[m_nextActionIndex] = pChild;
         
+        updateFrameActions();
+        
         return true;
     }
 
@@ -127,6 +147,7 @@ namespace DSL
         // Erase the child from both maps
         m_pOdeActions.erase(pChild->GetName());
         m_pOdeActionsIndexed.erase(pChild->GetIndex());
+        updateFrameActions();
         
         // Clear the parent relationship and index
         pChild->ClearParentName();
@@ -147,6 +168,35 @@ namespace DSL
         }
         m_pOdeActions.clear();
         m_pOdeActionsIndexed.clear();
+        m_pFrameActions.clear();
+    }
+    
+    void OdeTrigger::PostProcessFrameActions(NvDsFrameMeta* pFrameMeta)
+    {
+        // No function log - avoid overhead.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        for (const auto &ivec: m_pFrameActions)
+        {
+            ivec->PostProcessFrame(pFrameMeta);
+        }
+    }
+    
+    void OdeTrigger::updateFrameActions()
+    {
+        LOG_FUNC();
+        // internal - m_propertyMutex must be locked by the caller
+        
+        m_pFrameActions.clear();
+        for (const auto &imap: m_pOdeActionsIndexed)
+        {
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(imap.second);
+            if (pOdeAction->RequiresPostProcessFrame())
+            {
+                m_pFrameActions.push_back(pOdeAction.get());
+            }
+        }
     }
     
     bool OdeTrigger::AddArea(DSL_BASE_PTR pChild)
@@ -168,6 +218,8 @@ namespace DSL
         m_pOdeAreas[pChild->GetName()] = pChild;
         m_pOdeAreasIndexed[m_nextAreaIndex] = pChild;
         
+        PublishCriteria();
+        
         return true;
     }
 
@@ -191,6 +243,8 @@ namespace DSL
         pChild->ClearParentName();
         pChild->SetIndex(0);
         
+        PublishCriteria();
+        
         return true;
     }
     
@@ -207,6 +261,8 @@ namespace DSL
         }
         m_pOdeAreas.clear();
         m_pOdeAreasIndexed.clear();
+        
+        PublishCriteria();
     }
 
     bool OdeTrigger::AddAccumulator(DSL_BASE_PTR pAccumulator)
@@ -279,6 +335,13 @@ namespace DSL
         
         m_frameCount = 0;
         
+        for (auto &imap: m_sourceStates)
+        {
+            imap.second.triggered = 0;
+            imap.second.frameCount = 0;
+        }
+        m_rateLimitStates.clear();
+        
         // iterate through the map of limit-event-listeners calling each
         for(auto const& imap: m_limitStateChangeListeners)
         {
@@ -294,13 +357,96 @@ namespace DSL
         }
     }
     
-    void OdeTrigger::IncrementAndCheckTriggerCount()
+    bool OdeTrigger::CheckForRateLimit(NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
+    {
+        // No function log - avoid overhead.
+        // internal do not lock m_propertyMutex
+        
+        if (!m_rateLimit and !m_debounceWindow)
+        {
+            return true;
+        }
+        // new sources start with a full bucket
+        OdeTriggerRateLimitState& state = 
+            m_rateLimitStates[pFrameMeta->source_id];
+        
+        int64_t now = g_get_monotonic_time();
+        
+        // Debounce first so that suppressed objects don't consume tokens.
+        bool debounce = (m_debounceWindow and pObjectMeta and
+            pObjectMeta->object_id != UNTRACKED_OBJECT_ID);
+        int64_t windowUs = (int64_t)m_debounceWindow*1000;
+        
+        if (debounce)
+        {
+            auto ientry = state.lastEventTimes.find(pObjectMeta->object_id);
+            if (ientry != state.lastEventTimes.end() and 
+                (now - ientry->second) < windowUs)
+            {
+                return false;
+            }
+        }
+        if (m_rateLimit)
+        {
+            // refill the bucket for the time elapsed since the last event
+            if (state.refillTime)
+            {
+                state.tokens = std::min((double)m_rateLimitBurst, state.tokens +
+                    (now - state.refillTime)*(double)m_rateLimit/1000000);
+            }
+            else
+            {
+                state.tokens = m_rateLimitBurst;
+            }
+            state.refillTime = now;
+            
+            if (state.tokens < 1)
+            {
+                return false;
+            }
+            state.tokens -= 1;
+        }
+        if (debounce)
+        {
+            state.lastEventTimes[pObjectMeta->object_id] = now;
+            
+            // purge objects outside of the window - amortized by doubling
+            // the purge size with the number of objects still within.
+            if (state.lastEventTimes.size() >= state.purgeSize)
+            {
+                for (auto ientry = state.lastEventTimes.begin(); 
+                    ientry != state.lastEventTimes.end();)
+                {
+                    ientry = ((now - ientry->second) >= windowUs)
+                        ? state.lastEventTimes.erase(ientry) : std::next(ientry);
+                }
+                state.purgeSize = std::max((size_t)DSL_ODE_TRIGGER_DEBOUNCE_PURGE_SIZE,
+                    state.lastEventTimes.size()*2);
+            }
+        }
+        return true;
+    }
+    
+    bool OdeTrigger::IncrementAndCheckTriggerCount(NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
     {
         LOG_FUNC();
         // internal do not lock m_propertyMutex
         
+        // Suppressed events are not counted - the caller skips the occurrence.
+        if (!CheckForRateLimit(pFrameMeta, pObjectMeta))
+        {
+            return false;
+        }
+        
         m_triggered++;
         
+        if (m_statsEnabled.load(std::memory_order_acquire))
+        {
+            m_pStats->occurrences++;
+        }
+        
         if (m_triggered >= m_eventLimit)
         {
             // iterate through the map of limit-event-listeners calling each
@@ -318,10 +464,11 @@ namespace DSL
             }
             if (m_resetTimeout)
             {
-                m_resetTimerId = g_timeout_add(1000*m_resetTimeout, 
-                    TriggerResetTimeoutHandler, this);            
+                m_resetTimerId = TimerWheel::GetTimerWheel()->Add(
+                    1000*m_resetTimeout, TriggerResetTimeoutHandler, this);
             }
         }
+        return true;
     }
 
     static int TriggerResetTimeoutHandler(gpointer pTrigger)
@@ -358,7 +505,7 @@ namespace DSL
         // timeout value is zero (disabled), then kill the timer.
         if (m_resetTimerId and !timeout)
         {
-            g_source_remove(m_resetTimerId);
+            TimerWheel::GetTimerWheel()->Remove(m_resetTimerId);
             m_resetTimerId = 0;
         }
         
@@ -366,24 +513,24 @@ namespace DSL
         // timeout value is non-zero, stop and restart the timer.
         else if (m_resetTimerId and timeout)
         {
-            g_source_remove(m_resetTimerId);
-            m_resetTimerId = g_timeout_add(1000*m_resetTimeout, 
-                TriggerResetTimeoutHandler, this);            
+            TimerWheel::GetTimerWheel()->Remove(m_resetTimerId);
+            m_resetTimerId = TimerWheel::GetTimerWheel()->Add(
+                1000*timeout, TriggerResetTimeoutHandler, this);
         }
         
         // Else, if the Trigger has reached its limit and the 
         // client is setting a Timeout value, start the timer.
         else if (m_eventLimit and (m_triggered >= m_eventLimit) and timeout)
         {
-            m_resetTimerId = g_timeout_add(1000*m_resetTimeout, 
-                TriggerResetTimeoutHandler, this);            
+            m_resetTimerId = TimerWheel::GetTimerWheel()->Add(
+                1000*timeout, TriggerResetTimeoutHandler, this);
         } 
         // Else, if the Trigger has reached its frame limit and the 
         // client is setting a Timeout value, start the timer.
         else if (m_frameLimit and (m_frameCount >= m_frameLimit) and timeout)
         {
-            m_resetTimerId = g_timeout_add(1000*m_resetTimeout, 
-                TriggerResetTimeoutHandler, this);            
+            m_resetTimerId = TimerWheel::GetTimerWheel()->Add(
+                1000*timeout, TriggerResetTimeoutHandler, this);
         } 
         
         m_resetTimeout = timeout;
@@ -443,6 +590,46 @@ namespace DSL
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_classId = classId;
+        PublishCriteria();
+        
+        // parent ODE Handlers must re-compile their dispatch tables
+        s_dispatchVersion++;
+    }
+
+    void OdeTrigger::GetDispatchClassIds(std::vector<uint>& classIds)
+    {
+        LOG_FUNC();
+        
+        classIds.push_back(m_classId);
+    }
+    
+    int OdeTrigger::GetDispatchSourceId()
+    {
+        LOG_FUNC();
+        
+        // No filter, or the filter has yet to be resolved from the source name.
+        if (!m_source.size())
+        {
+            return -1;
+        }
+        return m_sourceId;
+    }
+
+    void OdeTrigger::GetOrderedActions(std::vector<OdeAction*>& actions)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        for (const auto &imap: m_pOdeActionsIndexed)
+        {
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(imap.second);
+            if (pOdeAction->RequiresOrderedExecution() or 
+                pOdeAction->RequiresSerialExecution())
+            {
+                actions.push_back(pOdeAction.get());
+            }
+        }
     }
 
     uint OdeTrigger::GetEventLimit()
@@ -522,6 +709,10 @@ namespace DSL
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_source.assign(source);
+        
+        // the new source name will be resolved to its unique-id on first use.
+        m_sourceId = -1;
+        s_dispatchVersion++;
     }
 
     void OdeTrigger::_setSourceId(int id)
@@ -529,6 +720,7 @@ namespace DSL
         LOG_FUNC();
         
         m_sourceId = id;
+        s_dispatchVersion++;
     }
     
     const char* OdeTrigger::GetInfer()
@@ -570,6 +762,7 @@ namespace DSL
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_minConfidence = minConfidence;
+        PublishCriteria();
     }
     
     float OdeTrigger::GetMaxConfidence()
@@ -585,6 +778,7 @@ namespace DSL
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_maxConfidence = maxConfidence;
+        PublishCriteria();
     }
     
     float OdeTrigger::GetMinTrackerConfidence()
@@ -600,6 +794,7 @@ namespace DSL
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_minTrackerConfidence = minConfidence;
+        PublishCriteria();
     }
     
     float OdeTrigger::GetMaxTrackerConfidence()
@@ -615,6 +810,7 @@ namespace DSL
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_maxTrackerConfidence = maxConfidence;
+        PublishCriteria();
     }
     
     void OdeTrigger::GetMinDimensions(float* minWidth, float* minHeight)
@@ -632,6 +828,7 @@ namespace DSL
         
         m_minWidth = minWidth;
         m_minHeight = minHeight;
+        PublishCriteria();
     }
     
     void OdeTrigger::GetMaxDimensions(float* maxWidth, float* maxHeight)
@@ -649,6 +846,7 @@ namespace DSL
         
         m_maxWidth = maxWidth;
         m_maxHeight = maxHeight;
+        PublishCriteria();
     }
     
     bool OdeTrigger::GetInferDoneOnlySetting()
@@ -661,8 +859,10 @@ namespace DSL
     void OdeTrigger::SetInferDoneOnlySetting(bool inferDoneOnly)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_inferDoneOnly = inferDoneOnly;
+        PublishCriteria();
     }
     
     void OdeTrigger::GetMinFrameCount(uint* minFrameCountN, uint* minFrameCountD)
@@ -697,6 +897,219 @@ namespace DSL
         
         m_interval = interval;
         m_intervalCounter = 0;
+        
+        for (auto &imap: m_sourceStates)
+        {
+            imap.second.intervalCounter = 0;
+        }
+    }
+    
+    void OdeTrigger::GetRateLimit(float* rate, uint* burst)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        *rate = m_rateLimit;
+        *burst = m_rateLimitBurst;
+    }
+    
+    void OdeTrigger::SetRateLimit(float rate, uint burst)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_rateLimit = rate;
+        m_rateLimitBurst = burst;
+        m_rateLimitStates.clear();
+    }
+    
+    uint OdeTrigger::GetDebounce()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        return m_debounceWindow;
+    }
+    
+    void OdeTrigger::SetDebounce(uint window)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_debounceWindow = window;
+        m_rateLimitStates.clear();
+    }
+    
+    bool OdeTrigger::GetPerSourceStateEnabled()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        return m_perSourceStateEnabled;
+    }
+    
+    void OdeTrigger::SetPerSourceStateEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_perSourceStateEnabled = enabled;
+        
+        // start over with clear counts in either mode.
+        m_sourceStates.clear();
+        m_loadedSourceId = -1;
+        
+        m_triggered = 0;
+        m_frameCount = 0;
+        m_occurrences = 0;
+        m_intervalCounter = 0;
+        m_skipFrame = false;
+    }
+    
+    bool OdeTrigger::GetStatsEnabled()
+    {
+        LOG_FUNC();
+        
+        return m_statsEnabled;
+    }
+    
+    void OdeTrigger::SetStatsEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (enabled)
+        {
+            if (m_pStats)
+            {
+                m_pStats->Reset();
+            }
+            else
+            {
+                m_pStats = std::unique_ptr<OdeTriggerStats>(new OdeTriggerStats());
+            }
+        }
+        // release so the streaming thread sees the new stats before the flag
+        m_statsEnabled.store(enabled, std::memory_order_release);
+    }
+    
+    void OdeTrigger::GetStats(dsl_ode_trigger_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        *stats = {0};
+        
+        if (!m_pStats)
+        {
+            return;
+        }
+        m_pStats->latencies[DSL_ODE_STATS_PRE_PROCESS_FRAME].GetStats(
+            &stats->pre_process_frame);
+        m_pStats->latencies[DSL_ODE_STATS_CHECK_FOR_OCCURRENCE].GetStats(
+            &stats->check_for_occurrence);
+        m_pStats->latencies[DSL_ODE_STATS_POST_PROCESS_FRAME].GetStats(
+            &stats->post_process_frame);
+        m_pStats->latencies[DSL_ODE_STATS_HANDLE_OCCURRENCE].GetStats(
+            &stats->handle_occurrence);
+            
+        stats->occurrences = m_pStats->occurrences;
+        
+        double seconds = GetSecondsSince(m_pStats->startTime);
+        stats->occurrences_per_sec = (seconds > 0) 
+            ? stats->occurrences/seconds : 0;
+    }
+    
+    void OdeTrigger::InvokeAction(const std::shared_ptr<OdeAction>& pOdeAction,
+        GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        OdeLatencyTimer timer(
+            GetLatencyHistogram(DSL_ODE_STATS_HANDLE_OCCURRENCE));
+            
+        pOdeAction->HandleOccurrence(shared_from_this(), pBuffer, 
+            displayMetaData, pFrameMeta, pObjectMeta);
+    }
+    
+    void OdeTrigger::LoadSourceState(uint sourceId)
+    {
+        // Note: function is called from the system (callback) context
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (!m_perSourceStateEnabled or m_loadedSourceId == (int)sourceId)
+        {
+            return;
+        }
+        // save the working state for the previously loaded source
+        if (m_loadedSourceId != -1)
+        {
+            OdeTriggerSourceState& prevState = m_sourceStates[m_loadedSourceId];
+            prevState.triggered = m_triggered;
+            prevState.frameCount = m_frameCount;
+            prevState.occurrences = m_occurrences;
+            prevState.intervalCounter = m_intervalCounter;
+            prevState.skipFrame = m_skipFrame;
+        }
+        
+        // new sources start with a clear state
+        const OdeTriggerSourceState& state = m_sourceStates[sourceId];
+        m_triggered = state.triggered;
+        m_frameCount = state.frameCount;
+        m_occurrences = state.occurrences;
+        m_intervalCounter = state.intervalCounter;
+        m_skipFrame = state.skipFrame;
+        
+        m_loadedSourceId = sourceId;
+    }
+    
+    void OdeTrigger::PublishCriteria()
+    {
+        LOG_FUNC();
+        // internal - m_propertyMutex must be locked by the caller
+        
+        OdeTriggerCriteria* pCriteria = new OdeTriggerCriteria();
+        
+        pCriteria->classId = m_classId;
+        pCriteria->minConfidence = m_minConfidence;
+        pCriteria->maxConfidence = m_maxConfidence;
+        pCriteria->minTrackerConfidence = m_minTrackerConfidence;
+        pCriteria->maxTrackerConfidence = m_maxTrackerConfidence;
+        pCriteria->minWidth = m_minWidth;
+        pCriteria->minHeight = m_minHeight;
+        pCriteria->maxWidth = m_maxWidth;
+        pCriteria->maxHeight = m_maxHeight;
+        pCriteria->inferDoneOnly = m_inferDoneOnly;
+        
+        for (const auto &imap: m_pOdeAreasIndexed)
+        {
+            pCriteria->areas.push_back(
+                std::dynamic_pointer_cast<OdeArea>(imap.second));
+        }
+        
+        const OdeTriggerCriteria* pRetired = m_pCriteria.exchange(pCriteria);
+        
+        // The streaming thread may still be using the previous snapshot,
+        // it will be freed on the start of the next frame.
+        if (pRetired)
+        {
+            m_retiredCriteria.push_back(
+                std::unique_ptr<const OdeTriggerCriteria>(pRetired));
+            m_criteriaRetired = true;
+        }
+    }
+    
+    void OdeTrigger::ReleaseRetiredCriteria()
+    {
+        // Fast check without locking - criteria changes are rare.
+        if (!m_criteriaRetired)
+        {
+            return;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_retiredCriteria.clear();
+        m_criteriaRetired = false;
     }
     
     bool OdeTrigger::CheckForSourceId(int sourceId)
@@ -712,6 +1125,12 @@ namespace DSL
                 
                 Services::GetServices()->SourceUniqueIdGet(m_source.c_str(), 
                     &m_sourceId);
+                
+                // once resolved, parent ODE Handlers can bucket by source-id
+                if (m_sourceId != -1)
+                {
+                    s_dispatchVersion++;
+                }
             }
             if (m_sourceId != sourceId)
             {
@@ -742,11 +1161,14 @@ namespace DSL
     }
 
     void OdeTrigger::PreProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,
+        DisplayMetaAllocator& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
     {
         LOG_FUNC();
 
+        ReleaseRetiredCriteria();
+        LoadSourceState(pFrameMeta->source_id);
+
         // Reset the occurrences from the last frame, even if disabled  
         m_occurrences = 0;
 
@@ -776,7 +1198,7 @@ namespace DSL
     }
 
     uint OdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,
+        DisplayMetaAllocator& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
     {
         LOG_FUNC();
@@ -822,8 +1244,8 @@ namespace DSL
             }
             if (m_resetTimeout)
             {
-                m_resetTimerId = g_timeout_add(1000*m_resetTimeout, 
-                    TriggerResetTimeoutHandler, this);            
+                m_resetTimerId = TimerWheel::GetTimerWheel()->Add(
+                    1000*m_resetTimeout, TriggerResetTimeoutHandler, this);
             }
         }
 
@@ -848,7 +1270,7 @@ namespace DSL
         if (m_pHeatMapper)
         {
             std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->AddDisplayMeta(
-                displayMetaData);
+                displayMetaData, pFrameMeta);
         }
         
         return m_occurrences;
@@ -881,50 +1303,83 @@ namespace DSL
         {
             return false;
         }
+        return true;
+    }
+
+    bool OdeTrigger::CheckForCriteria(NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
+    {
+        // Note: function is called from the system (callback) context
+        // without locking - single load of the current snapshot.
+        const OdeTriggerCriteria* pCriteria = 
+            m_pCriteria.load(std::memory_order_acquire);
+            
+        return CheckForCriteria(pFrameMeta, pObjectMeta, 
+            pCriteria, pCriteria->classId);
+    }
+
+    bool OdeTrigger::CheckForCriteria(NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta, uint classId)
+    {
+        return CheckForCriteria(pFrameMeta, pObjectMeta, 
+            m_pCriteria.load(std::memory_order_acquire), classId);
+    }
+
+    bool OdeTrigger::CheckForCriteria(NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta, const OdeTriggerCriteria* pCriteria,
+        uint classId)
+    {
+        // No function log - avoid overhead.
+        
         // Filter on Class id if set
-        if ((m_classId != DSL_ODE_ANY_CLASS) and 
-            (m_classId != pObjectMeta->class_id))
+        if ((classId != DSL_ODE_ANY_CLASS) and 
+            (classId != pObjectMeta->class_id))
         {
             return false;
         }
         // Ensure that the minimum Inference confidence has been reached
         if (pObjectMeta->confidence > 0 and 
-            pObjectMeta->confidence < m_minConfidence)
+            pObjectMeta->confidence < pCriteria->minConfidence)
         {
             return false;
         }
         // Ensure that the maximum Inference confidence has been reached
-        if (pObjectMeta->confidence > 0 and m_maxConfidence and
-            pObjectMeta->confidence > m_maxConfidence)
+        if (pObjectMeta->confidence > 0 and pCriteria->maxConfidence and
+            pObjectMeta->confidence > pCriteria->maxConfidence)
         {
             return false;
         }
         // Ensure that the minimum Tracker confidence has been reached
         if (pObjectMeta->tracker_confidence > 0 and 
-            pObjectMeta->tracker_confidence < m_minTrackerConfidence)
+            pObjectMeta->tracker_confidence < pCriteria->minTrackerConfidence)
         {
             return false;
         }
         // Ensure that the maximum Tracker confidence has been reached
-        if (pObjectMeta->tracker_confidence > 0 and m_maxTrackerConfidence and
-            pObjectMeta->tracker_confidence > m_maxTrackerConfidence)
+        if (pObjectMeta->tracker_confidence > 0 and 
+            pCriteria->maxTrackerConfidence and
+            pObjectMeta->tracker_confidence > pCriteria->maxTrackerConfidence)
         {
             return false;
         }
         // If defined, check for minimum dimensions
-        if ((m_minWidth > 0 and pObjectMeta->rect_params.width < m_minWidth) or
-            (m_minHeight > 0 and pObjectMeta->rect_params.height < m_minHeight))
+        if ((pCriteria->minWidth > 0 and 
+                pObjectMeta->rect_params.width < pCriteria->minWidth) or
+            (pCriteria->minHeight > 0 and 
+                pObjectMeta->rect_params.height < pCriteria->minHeight))
         {
             return false;
         }
         // If defined, check for maximum dimensions
-        if ((m_maxWidth > 0 and pObjectMeta->rect_params.width > m_maxWidth) or
-            (m_maxHeight > 0 and pObjectMeta->rect_params.height > m_maxHeight))
+        if ((pCriteria->maxWidth > 0 and 
+                pObjectMeta->rect_params.width > pCriteria->maxWidth) or
+            (pCriteria->maxHeight > 0 and 
+                pObjectMeta->rect_params.height > pCriteria->maxHeight))
         {
             return false;
         }
         // If define, check if Inference was done on the frame or not
-        if (m_inferDoneOnly and !pFrameMeta->bInferDone)
+        if (pCriteria->inferDoneOnly and !pFrameMeta->bInferDone)
         {
             return false;
         }
@@ -935,21 +1390,22 @@ namespace DSL
     {
         LOG_FUNC();
         
+        const OdeTriggerCriteria* pCriteria = 
+            m_pCriteria.load(std::memory_order_acquire);
+        
         // If areas are defined, check condition
 
-        if (m_pOdeAreasIndexed.size())
+        if (pCriteria->areas.size())
         {
-            for (const auto &imap: m_pOdeAreasIndexed)
+            for (const auto &ivec: pCriteria->areas)
             {
-                DSL_ODE_AREA_PTR pOdeArea = 
-                    std::dynamic_pointer_cast<OdeArea>(imap.second);
-                if (pOdeArea->IsBboxInside(pObjectMeta->rect_params))
+                if (ivec->IsBboxInside(pObjectMeta->rect_params))
                 {
-                    return pOdeArea->IsType(typeid(OdeInclusionArea));
+                    return ivec->IsType(typeid(OdeInclusionArea));
                 }
                 else
                 {
-                    return pOdeArea->IsType(typeid(OdeExclusionArea));                    
+                    return ivec->IsType(typeid(OdeExclusionArea));                    
                 }
             }
             return false;
@@ -957,24 +1413,93 @@ namespace DSL
         return true;
     }
     
-    // *****************************************************************************
-    AlwaysOdeTrigger::AlwaysOdeTrigger(const char* name, 
-        const char* source, uint when)
-        : OdeTrigger(name, source, DSL_ODE_ANY_CLASS, 0)
-        , m_when(when)
-    {
-        LOG_FUNC();
-    }
-
-    AlwaysOdeTrigger::~AlwaysOdeTrigger()
+    bool OdeTrigger::CheckForInside(OdePredicateContext& context)
     {
-        LOG_FUNC();
+        // No function log - avoid overhead.
+        
+        const OdeTriggerCriteria* pCriteria = 
+            m_pCriteria.load(std::memory_order_acquire);
+        
+        // Same first-area semantics as above, with the membership shared 
+        // between all predicates that use the same Area.
+        if (pCriteria->areas.size())
+        {
+            const std::shared_ptr<OdeArea>& pArea = pCriteria->areas.front();
+            
+            return (context.IsBboxInside(pArea))
+                ? pArea->IsType(typeid(OdeInclusionArea))
+                : pArea->IsType(typeid(OdeExclusionArea));
+        }
+        return true;
+    }
+    
+    bool OdeTrigger::CheckForPredicate(OdePredicateContext& context)
+    {
+        // No function log - avoid overhead.
+        
+        // Lock-free rejection of objects that fail the current criteria
+        if (!CheckForCriteria(context.pFrameMeta, context.pObjectMeta) or 
+            !CheckForInside(context))
+        {
+            return false;
+        }
+        
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        return (CheckForSourceId(context.pFrameMeta->source_id) and
+            CheckForInferId(context.pObjectMeta->unique_component_id));
+    }
+    
+    // *****************************************************************************
+    
+    void OdePredicateContext::Reset(NvDsObjectMeta* pObjectMeta)
+    {
+        this->pObjectMeta = pObjectMeta;
+        areaResults.clear();
+    }
+    
+    bool OdePredicateContext::IsBboxInside(const std::shared_ptr<OdeArea>& pArea)
+    {
+        // Objects are tested against a small number of Areas - linear search.
+        for (const auto& ivec: areaResults)
+        {
+            if (ivec.first == pArea.get())
+            {
+                return ivec.second;
+            }
+        }
+        bool inside = pArea->IsBboxInside(pObjectMeta->rect_params);
+        areaResults.push_back(std::make_pair(pArea.get(), inside));
+        
+        return inside;
+    }
+    
+    // *****************************************************************************
+    AlwaysOdeTrigger::AlwaysOdeTrigger(const char* name, 
+        const char* source, uint when)
+        : OdeTrigger(name, source, DSL_ODE_ANY_CLASS, 0)
+        , m_when(when)
+    {
+        LOG_FUNC();
+    }
+
+    AlwaysOdeTrigger::~AlwaysOdeTrigger()
+    {
+        LOG_FUNC();
     }
     
     void AlwaysOdeTrigger::PreProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,
+        DisplayMetaAllocator& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
     {
+        ReleaseRetiredCriteria();
+        LoadSourceState(pFrameMeta->source_id);
+        
+        // Note: function is called from the system (callback) context
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
         if (!m_enabled or !CheckForSourceId(pFrameMeta->source_id) or 
             m_when != DSL_ODE_PRE_OCCURRENCE_CHECK)
         {
@@ -988,17 +1513,22 @@ namespace DSL
                 return;
             }
         }
+        // Frame level event - rate limited, but not debounced.
+        if (!CheckForRateLimit(pFrameMeta, NULL))
+        {
+            return;
+        }
         for (const auto &imap: m_pOdeActionsIndexed)
         {
             DSL_ODE_ACTION_PTR pOdeAction = 
                 std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), 
+            InvokeAction(pOdeAction, 
                 pBuffer, displayMetaData, pFrameMeta, NULL);
         }
     }
 
     uint AlwaysOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,
+        DisplayMetaAllocator& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
     {
         // Note: function is called from the system (callback) context
@@ -1018,11 +1548,16 @@ namespace DSL
                 return 0;
             }
         }
+        // Frame level event - rate limited, but not debounced.
+        if (!CheckForRateLimit(pFrameMeta, NULL))
+        {
+            return 0;
+        }
         for (const auto &imap: m_pOdeActionsIndexed)
         {
             DSL_ODE_ACTION_PTR pOdeAction = 
                 std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), 
+            InvokeAction(pOdeAction, 
                 pBuffer, displayMetaData, pFrameMeta, NULL);
         }
         return 1;
@@ -1043,22 +1578,31 @@ namespace DSL
     }
     
     bool OccurrenceOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,
+        DisplayMetaAllocator& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
+        // Lock-free rejection of objects that fail the current criteria
+        if (!CheckForCriteria(pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pObjectMeta))
+        {
+            return false;
+        }
+        
         // Note: function is called from the system (callback) context
         // Gaurd against property updates from the client API
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         if (!m_enabled or 
             !CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+            !CheckForMinCriteria(pFrameMeta, pObjectMeta))
         {
             return false;
         }
         
-        IncrementAndCheckTriggerCount();
+        if (!IncrementAndCheckTriggerCount(pFrameMeta, pObjectMeta))
+        {
+            return false;
+        }
         m_occurrences++;
         
         // update the total event count static variable
@@ -1078,7 +1622,7 @@ namespace DSL
         {
             DSL_ODE_ACTION_PTR pOdeAction = 
                 std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), pBuffer, 
+            InvokeAction(pOdeAction, pBuffer, 
                 displayMetaData, pFrameMeta, pObjectMeta);
             // try
             // {
@@ -1109,9 +1653,16 @@ namespace DSL
     }
     
     bool AbsenceOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
+        // Lock-free rejection of objects that fail the current criteria
+        if (!CheckForCriteria(pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pObjectMeta))
+        {
+            return false;
+        }
+        
         // Note: function is called from the system (callback) context
         // Gaurd against property updates from the client API
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -1121,8 +1672,7 @@ namespace DSL
         // occurrences in the PostProcessFrame() . If the m_occurrences is not updated the Trigger 
         // will report Absence incorrectly
         if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+            !CheckForMinCriteria(pFrameMeta, pObjectMeta))
         {
             return false;
         }
@@ -1133,7 +1683,7 @@ namespace DSL
     }
     
     uint AbsenceOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, NvDsFrameMeta* pFrameMeta)
+        DisplayMetaAllocator& displayMetaData, NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -1148,11 +1698,14 @@ namespace DSL
                 return 0;
             }        
             
+            // event has been triggered, unless suppressed by the rate limit
+            if (!IncrementAndCheckTriggerCount(pFrameMeta, NULL))
+            {
+                return 0;
+            }
+            
             // since occurrences = 0, ODE occurrence for the Absence Trigger = 1
             m_occurrences = 1;
-            
-            // event has been triggered 
-            IncrementAndCheckTriggerCount();
 
             // update the total event count static variable
             s_eventCount++;
@@ -1161,7 +1714,7 @@ namespace DSL
             {
                 DSL_ODE_ACTION_PTR pOdeAction = 
                     std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
+                InvokeAction(pOdeAction, 
                     pBuffer, displayMetaData, pFrameMeta, NULL);
             }
         }
@@ -1217,39 +1770,37 @@ namespace DSL
     }
     
     bool InstanceOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,
+        DisplayMetaAllocator& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
+        // Lock-free rejection of objects that fail the current criteria
+        if (!CheckForCriteria(pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pObjectMeta))
+        {
+            return false;
+        }
+        
         // Note: function is called from the system (callback) context
         // Gaurd against property updates from the client API
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         if (!m_enabled or 
             !CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+            !CheckForMinCriteria(pFrameMeta, pObjectMeta))
         {
             return false;
         }
 
-        std::shared_ptr<TrackedObject> pTrackedObject;
+        TrackedObject* pTrackedObject = 
+            m_pTrackedObjectsPerSource->Update(pFrameMeta, pObjectMeta);
         
         // if this is the first occurrence of this object for this source
-        if (!m_pTrackedObjectsPerSource->IsTracked(pFrameMeta->source_id,
-            pObjectMeta->object_id))
+        if (pTrackedObject == NULL)
         {
-            // Create a new Tracked object and return without occurence
+            // Create a new Tracked object
             pTrackedObject = m_pTrackedObjectsPerSource->Track(pFrameMeta, 
                 pObjectMeta, nullptr);
         }
-        else
-        {
-            pTrackedObject = m_pTrackedObjectsPerSource->GetObject(
-                pFrameMeta->source_id, pObjectMeta->object_id);
-                    
-            pTrackedObject->Update(pFrameMeta->frame_num, 
-                (NvBbox_Coords*)&pObjectMeta->rect_params);
-        }
 
         LOG_DEBUG("Tracked object with id = " 
             << pObjectMeta->object_id << " for source = " 
@@ -1258,8 +1809,11 @@ namespace DSL
 
         if (pTrackedObject->frameCount <= m_instanceCount)
         {
-            // event has been triggered
-            IncrementAndCheckTriggerCount();
+            // event has been triggered, unless suppressed by the rate limit
+            if (!IncrementAndCheckTriggerCount(pFrameMeta, pObjectMeta))
+            {
+                return false;
+            }
             m_occurrences++;
 
             // update the total event count static variable
@@ -1279,7 +1833,7 @@ namespace DSL
             {
                 DSL_ODE_ACTION_PTR pOdeAction = 
                     std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
+                InvokeAction(pOdeAction, 
                     pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
             }
             return true;
@@ -1297,7 +1851,7 @@ namespace DSL
     }
 
     uint InstanceOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaAllocator& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -1334,17 +1888,23 @@ namespace DSL
     }
     
     bool SummationOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
+        // Lock-free rejection of objects that fail the current criteria
+        if (!CheckForCriteria(pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pObjectMeta))
+        {
+            return false;
+        }
+        
         // Note: function is called from the system (callback) context
         // Gaurd against property updates from the client API
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         if (!m_enabled or 
             !CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+            !CheckForMinCriteria(pFrameMeta, pObjectMeta))
         {
             return false;
         }
@@ -1355,7 +1915,7 @@ namespace DSL
     }
 
     uint SummationOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaAllocator& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -1368,8 +1928,11 @@ namespace DSL
             {
                 return 0;
             }
-            // event has been triggered
-            IncrementAndCheckTriggerCount();
+            // event has been triggered, unless suppressed by the rate limit
+            if (!IncrementAndCheckTriggerCount(pFrameMeta, NULL))
+            {
+                return 0;
+            }
 
              // update the total event count static variable
             s_eventCount++;
@@ -1381,7 +1944,7 @@ namespace DSL
             {
                 DSL_ODE_ACTION_PTR pOdeAction = 
                     std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
+                InvokeAction(pOdeAction, 
                     pBuffer, displayMetaData, pFrameMeta, NULL);
             }
         }
@@ -1409,9 +1972,16 @@ namespace DSL
     }
     
     bool CustomOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
+        // Lock-free rejection of objects that fail the current criteria
+        if (!CheckForCriteria(pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pObjectMeta))
+        {
+            return false;
+        }
+        
         // Note: function is called from the system (callback) context
         // Gaurd against property updates from the client API
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -1420,8 +1990,7 @@ namespace DSL
         if (!m_enabled or 
             !m_clientChecker or 
             !CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+            !CheckForMinCriteria(pFrameMeta, pObjectMeta))
         {
             return false;
         }
@@ -1439,7 +2008,10 @@ namespace DSL
             return false;
         }
 
-        IncrementAndCheckTriggerCount();
+        if (!IncrementAndCheckTriggerCount(pFrameMeta, pObjectMeta))
+        {
+            return false;
+        }
         m_occurrences++;
         
         // update the total event count static variable
@@ -1455,14 +2027,14 @@ namespace DSL
         {
             DSL_ODE_ACTION_PTR pOdeAction = 
                 std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), 
+            InvokeAction(pOdeAction, 
                 pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
         }
         return true;
     }
     
     uint CustomOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaAllocator& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -1490,8 +2062,11 @@ namespace DSL
                 return false;
             }
 
-            // event has been triggered
-            IncrementAndCheckTriggerCount();
+            // event has been triggered, unless suppressed by the rate limit
+            if (!IncrementAndCheckTriggerCount(pFrameMeta, NULL))
+            {
+                return 0;
+            }
 
              // update the total event count static variable
             s_eventCount++;
@@ -1500,7 +2075,7 @@ namespace DSL
             {
                 DSL_ODE_ACTION_PTR pOdeAction = 
                     std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
+                InvokeAction(pOdeAction, 
                     pBuffer, displayMetaData, pFrameMeta, NULL);
             }
         }
@@ -1509,6 +2084,476 @@ namespace DSL
             displayMetaData, pFrameMeta);
     }
 
+    // *****************************************************************************
+
+    CustomBatchOdeTrigger::CustomBatchOdeTrigger(const char* name, 
+        const char* source, uint classId, uint limit, 
+        dsl_ode_check_for_occurrences_cb clientChecker, void* clientData)
+        : OdeTrigger(name, source, classId, limit)
+        , m_clientChecker(clientChecker)
+        , m_clientData(clientData)
+    {
+        LOG_FUNC();
+    }
+
+    CustomBatchOdeTrigger::~CustomBatchOdeTrigger()
+    {
+        LOG_FUNC();
+    }
+    
+    bool CustomBatchOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
+        DisplayMetaAllocator& displayMetaData, 
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        // Lock-free rejection of objects that fail the current criteria
+        if (!CheckForCriteria(pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pObjectMeta))
+        {
+            return false;
+        }
+        
+        // Note: function is called from the system (callback) context
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (!m_enabled or 
+            !CheckForSourceId(pFrameMeta->source_id) or 
+            !CheckForMinCriteria(pFrameMeta, pObjectMeta))
+        {
+            return false;
+        }
+        
+        dsl_ode_batch_object object;
+        object.class_id = pObjectMeta->class_id;
+        object.inference_component_id = pObjectMeta->unique_component_id;
+        object.tracking_id = pObjectMeta->object_id;
+        object.left = pObjectMeta->rect_params.left;
+        object.top = pObjectMeta->rect_params.top;
+        object.width = pObjectMeta->rect_params.width;
+        object.height = pObjectMeta->rect_params.height;
+        object.inference_confidence = pObjectMeta->confidence;
+        object.tracker_confidence = pObjectMeta->tracker_confidence;
+        
+        m_batchObjects.push_back(object);
+        m_batchObjectMeta.push_back(pObjectMeta);
+        
+        return true;
+    }
+    
+    uint CustomBatchOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
+        DisplayMetaAllocator& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+    {
+        // create scope so the property-mutex can be unlocked before
+        // calling the base-class PostProcessFrame which locks the mutex.
+        {
+            // Note: function is called from the system (callback) context
+            // Gaurd against property updates from the client API
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+            
+            m_occurrences = 0;
+            
+            uint count = m_batchObjects.size();
+            
+            if (m_enabled and count)
+            {
+                m_batchOccurrences.assign((count+63)/64, 0);
+                
+                bool occurrences(false);
+                try
+                {
+                    occurrences = m_clientChecker(pBuffer, pFrameMeta, 
+                        &m_batchObjects[0], count, &m_batchOccurrences[0], 
+                        m_clientData);
+                }
+                catch(...)
+                {
+                    LOG_ERROR("Custom Batch ODE Trigger '" << GetName() 
+                        << "' threw exception calling client callback");
+                }
+                
+                // scan the set bits of each word, lowest (first object) first.
+                for (uint word = 0; occurrences and word < m_batchOccurrences.size();
+                    word++)
+                {
+                    uint64_t bits = m_batchOccurrences[word];
+                    while (bits)
+                    {
+                        uint i = word*64 + __builtin_ctzll(bits);
+                        bits &= bits - 1;
+                        
+                        // ignore bits past the end of the array, and stop
+                        // once the event limit has been reached.
+                        if (i >= count or 
+                            (m_eventLimit and m_triggered >= m_eventLimit))
+                        {
+                            break;
+                        }
+                        NvDsObjectMeta* pObjectMeta = m_batchObjectMeta[i];
+                        
+                        if (!IncrementAndCheckTriggerCount(pFrameMeta, pObjectMeta))
+                        {
+                            continue;
+                        }
+                        m_occurrences++;
+                        
+                        // update the total event count static variable
+                        s_eventCount++;
+
+                        // set the primary metric as the current occurrence 
+                        pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
+                            = m_occurrences;
+                        
+                        if (m_pHeatMapper)
+                        {
+                            std::dynamic_pointer_cast<OdeHeatMapper>(
+                                m_pHeatMapper)->HandleOccurrence(
+                                    pFrameMeta, pObjectMeta);
+                        }
+                        for (const auto &imap: m_pOdeActionsIndexed)
+                        {
+                            DSL_ODE_ACTION_PTR pOdeAction = 
+                                std::dynamic_pointer_cast<OdeAction>(imap.second);
+                            InvokeAction(pOdeAction, 
+                                pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
+                        }
+                    }
+                }
+            }
+            
+            // reset for next frame
+            m_batchObjects.clear();
+            m_batchObjectMeta.clear();
+        }
+        // mutex unlocked - safe to call base class
+        return OdeTrigger::PostProcessFrame(pBuffer,
+            displayMetaData, pFrameMeta);
+    }
+
+    // *****************************************************************************
+    
+    CompositeOdeTrigger::CompositeOdeTrigger(const char* name, 
+        const char* source, uint classId, uint limit, uint compositeOperator)
+        : OdeTrigger(name, source, classId, limit)
+        , m_operator(compositeOperator)
+    {
+        LOG_FUNC();
+    }
+
+    CompositeOdeTrigger::~CompositeOdeTrigger()
+    {
+        LOG_FUNC();
+    }
+    
+    bool CompositeOdeTrigger::AddPredicate(DSL_BASE_PTR pChild, bool negate)
+    {
+        LOG_FUNC();
+        
+        DSL_ODE_TRIGGER_PTR pTrigger = 
+            std::dynamic_pointer_cast<OdeTrigger>(pChild);
+        
+        // Walk the predicate's nested predicates, with the property-mutex 
+        // released, to reject any cycle, e.g. A -> B -> A.
+        std::vector<OdeTrigger*> predicates;
+        pTrigger->GetPredicates(predicates);
+        
+        if (pTrigger.get() == this or std::find(predicates.begin(), 
+            predicates.end(), this) != predicates.end())
+        {
+            LOG_ERROR("ODE Trigger '" << pChild->GetName() 
+                << "' can not be added as a predicate of Composite ODE Trigger '" 
+                << GetName() << "' as it would create a cycle");
+            return false;
+        }
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (m_pPredicates.find(pChild->GetName()) != m_pPredicates.end())
+        {
+            LOG_ERROR("ODE Trigger '" << pChild->GetName() 
+                << "' is already a predicate of Composite ODE Trigger '" 
+                << GetName() << "'");
+            return false;
+        }
+        m_pPredicates[pChild->GetName()] = pChild;
+        m_predicatesIndexed.push_back(
+            {pTrigger, negate, pTrigger->IsStatefulPredicate()});
+        
+        // the predicate's class-ids are added to the dispatch class-ids
+        s_dispatchVersion++;
+        
+        return true;
+    }
+    
+    bool CompositeOdeTrigger::RemovePredicate(DSL_BASE_PTR pChild)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (m_pPredicates.find(pChild->GetName()) == m_pPredicates.end())
+        {
+            LOG_WARN("ODE Trigger '" << pChild->GetName() 
+                << "' is not a predicate of Composite ODE Trigger '" 
+                << GetName() << "'");
+            return false;
+        }
+        m_pPredicates.erase(pChild->GetName());
+        
+        for (auto ivec = m_predicatesIndexed.begin(); 
+            ivec != m_predicatesIndexed.end(); ivec++)
+        {
+            if (ivec->pTrigger == pChild)
+            {
+                m_predicatesIndexed.erase(ivec);
+                break;
+            }
+        }
+        s_dispatchVersion++;
+        
+        return true;
+    }
+    
+    void CompositeOdeTrigger::GetDispatchClassIds(std::vector<uint>& classIds)
+    {
+        LOG_FUNC();
+        
+        std::vector<OdeCompositePredicate> predicates;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+            
+            classIds.push_back(m_classId);
+            predicates = m_predicatesIndexed;
+        }
+        // mutex unlocked - each predicate locks its own property-mutex.
+        for (const auto& ivec: predicates)
+        {
+            ivec.pTrigger->GetDispatchClassIds(classIds);
+        }
+    }
+    
+    void CompositeOdeTrigger::GetPredicates(std::vector<OdeTrigger*>& predicates)
+    {
+        LOG_FUNC();
+        
+        std::vector<OdeCompositePredicate> children;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+            
+            children = m_predicatesIndexed;
+        }
+        // mutex unlocked - each predicate locks its own property-mutex.
+        // Cycles are rejected on AddPredicate, so the walk always ends.
+        for (const auto& ivec: children)
+        {
+            predicates.push_back(ivec.pTrigger.get());
+            ivec.pTrigger->GetPredicates(predicates);
+        }
+    }
+    
+    void CompositeOdeTrigger::snapshotPredicates(
+        std::vector<OdeCompositePredicate>& snapshot)
+    {
+        // No function log - avoid overhead.
+        {
+            // Gaurd against property updates from the client API
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+            
+            snapshot = m_predicatesIndexed;
+        }
+        // mutex unlocked - a nested Composite locks its own property-mutex.
+        for (auto& ivec: snapshot)
+        {
+            ivec.stateful = ivec.pTrigger->IsStatefulPredicate();
+        }
+    }
+    
+    bool CompositeOdeTrigger::CheckForPredicate(OdePredicateContext& context)
+    {
+        // No function log - avoid overhead.
+        
+        // The Composite's own criteria, Areas, source and infer-id filters.
+        if (!OdeTrigger::CheckForPredicate(context))
+        {
+            return false;
+        }
+        snapshotPredicates(m_nestedSnapshot);
+        
+        return EvaluatePredicates(m_nestedSnapshot, context);
+    }
+    
+    bool CompositeOdeTrigger::IsStatefulPredicate()
+    {
+        // No function log - avoid overhead.
+        
+        std::vector<OdeCompositePredicate> predicates;
+        snapshotPredicates(predicates);
+        
+        for (const auto& ivec: predicates)
+        {
+            if (ivec.stateful)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    void CompositeOdeTrigger::PostProcessPredicate(NvDsFrameMeta* pFrameMeta)
+    {
+        // No function log - avoid overhead.
+        
+        snapshotPredicates(m_nestedSnapshot);
+        
+        for (const auto& ivec: m_nestedSnapshot)
+        {
+            if (ivec.stateful)
+            {
+                ivec.pTrigger->PostProcessPredicate(pFrameMeta);
+            }
+        }
+    }
+    
+    bool CompositeOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
+        DisplayMetaAllocator& displayMetaData, 
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        // Note: function is called from the system (callback) context
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (!m_enabled or !CheckForSourceId(pFrameMeta->source_id))
+        {
+            return false;
+        }
+        
+        // all objects are kept for predicates that test against other objects
+        m_frameObjects.push_back(pObjectMeta);
+        
+        // Areas are checked on PostProcessFrame with the predicates' Areas
+        if (!CheckForCriteria(pFrameMeta, pObjectMeta) or
+            !CheckForMinCriteria(pFrameMeta, pObjectMeta))
+        {
+            return false;
+        }
+        m_candidates.push_back(pObjectMeta);
+        
+        return true;
+    }
+    
+    bool CompositeOdeTrigger::EvaluatePredicates(
+        const std::vector<OdeCompositePredicate>& predicates,
+        OdePredicateContext& context)
+    {
+        // No function log - avoid overhead.
+        
+        // no predicates - AND is true and OR is false.
+        bool result(m_operator == DSL_ODE_COMPOSITE_OPERATOR_AND);
+        bool resolved(false);
+        
+        for (const auto& ivec: predicates)
+        {
+            // once resolved, only stateful predicates need to be evaluated
+            if (resolved and !ivec.stateful)
+            {
+                continue;
+            }
+            bool value = (ivec.pTrigger->CheckForPredicate(context) != ivec.negate);
+            
+            if (!resolved and value != result)
+            {
+                // false for AND, true for OR, short-circuits the expression
+                result = value;
+                resolved = true;
+            }
+        }
+        return result;
+    }
+    
+    uint CompositeOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
+        DisplayMetaAllocator& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+    {
+        // The predicates are snapshot so that they can be evaluated with the 
+        // property-mutex released, as each predicate locks its own mutex.
+        {
+            // Note: function is called from the system (callback) context
+            // Gaurd against property updates from the client API
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+            
+            m_occurrences = 0;
+        }
+        snapshotPredicates(m_predicatesSnapshot);
+        
+        // The frame's objects are only updated from the streaming context.
+        m_context.pFrameMeta = pFrameMeta;
+        m_context.pFrameObjects = &m_frameObjects;
+        
+        for (const auto& pObjectMeta: m_candidates)
+        {
+            m_context.Reset(pObjectMeta);
+            
+            // resolve the combined expression before any actions are
+            // invoked. Predicates first, so that stateful predicates
+            // see every candidate, then the Composite's own Areas.
+            if (!EvaluatePredicates(m_predicatesSnapshot, m_context))
+            {
+                continue;
+            }
+            
+            // Gaurd against property updates from the client API
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+            
+            if (!CheckForInside(m_context))
+            {
+                continue;
+            }
+            // the event limit can be reached part way through the frame.
+            if (m_eventLimit and m_triggered >= m_eventLimit)
+            {
+                continue;
+            }
+            if (!IncrementAndCheckTriggerCount(pFrameMeta, pObjectMeta))
+            {
+                continue;
+            }
+            m_occurrences++;
+            
+            // update the total event count static variable
+            s_eventCount++;
+
+            // set the primary metric as the current occurrence 
+            pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
+                = m_occurrences;
+            
+            if (m_pHeatMapper)
+            {
+                std::dynamic_pointer_cast<OdeHeatMapper>(
+                    m_pHeatMapper)->HandleOccurrence(
+                        pFrameMeta, pObjectMeta);
+            }
+            for (const auto &imap: m_pOdeActionsIndexed)
+            {
+                DSL_ODE_ACTION_PTR pOdeAction = 
+                    std::dynamic_pointer_cast<OdeAction>(imap.second);
+                InvokeAction(pOdeAction, 
+                    pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
+            }
+        }
+        for (const auto& ivec: m_predicatesSnapshot)
+        {
+            if (ivec.stateful)
+            {
+                ivec.pTrigger->PostProcessPredicate(pFrameMeta);
+            }
+        }
+        
+        // reset for next frame
+        m_frameObjects.clear();
+        m_candidates.clear();
+        
+        // mutex unlocked - safe to call base class
+        return OdeTrigger::PostProcessFrame(pBuffer,
+            displayMetaData, pFrameMeta);
+    }
+
     // *****************************************************************************
     
     CountOdeTrigger::CountOdeTrigger(const char* name, const char* source,
@@ -1543,16 +2588,22 @@ namespace DSL
     }
     
     bool CountOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
+        // Lock-free rejection of objects that fail the current criteria
+        if (!CheckForCriteria(pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pObjectMeta))
+        {
+            return false;
+        }
+        
         // Note: function is called from the system (callback) context
         // Gaurd against property updates from the client API
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+            !CheckForMinCriteria(pFrameMeta, pObjectMeta))
         {
             return false;
         }
@@ -1568,7 +2619,7 @@ namespace DSL
     }
 
     uint CountOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaAllocator& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -1582,8 +2633,11 @@ namespace DSL
             {
                 return 0;
             }
-            // event has been triggered
-            IncrementAndCheckTriggerCount();
+            // event has been triggered, unless suppressed by the rate limit
+            if (!IncrementAndCheckTriggerCount(pFrameMeta, NULL))
+            {
+                return 0;
+            }
 
              // update the total event count static variable
             s_eventCount++;
@@ -1592,7 +2646,7 @@ namespace DSL
             {
                 DSL_ODE_ACTION_PTR pOdeAction = 
                     std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
+                InvokeAction(pOdeAction, 
                     pBuffer, displayMetaData, pFrameMeta, NULL);
             }
         }
@@ -1616,16 +2670,22 @@ namespace DSL
     }
     
     bool SmallestOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
+        // Lock-free rejection of objects that fail the current criteria
+        if (!CheckForCriteria(pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pObjectMeta))
+        {
+            return false;
+        }
+        
         // Note: function is called from the system (callback) context
         // Gaurd against property updates from the client API
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+            !CheckForMinCriteria(pFrameMeta, pObjectMeta))
         {
             return false;
         }
@@ -1636,7 +2696,7 @@ namespace DSL
     }
 
     uint SmallestOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaAllocator& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -1650,12 +2710,6 @@ namespace DSL
             // need at least one object for a Minimum event
             if (m_enabled and m_occurrenceMetaList.size())
             {
-                // One occurrence to return and increment the accumulative Trigger count
-                m_occurrences = 1;
-                IncrementAndCheckTriggerCount();
-                // update the total event count static variable
-                s_eventCount++;
-
                 uint smallestArea = UINT32_MAX;
                 NvDsObjectMeta* pSmallestObject(NULL);
                 
@@ -1669,22 +2723,33 @@ namespace DSL
                         pSmallestObject = ivec;    
                     }
                 }
-                // conditionally add the 
-                if (m_pHeatMapper)
-                {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, pSmallestObject);
-                }
-                // set the primary metric as the smallest bounding box by area
-                pSmallestObject->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                    = smallestArea;
-                for (const auto &imap: m_pOdeActionsIndexed)
+
+                // event has been triggered, unless suppressed by the rate limit
+                if (IncrementAndCheckTriggerCount(pFrameMeta, pSmallestObject))
                 {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
+                    // One occurrence to return and increment the accumulative Trigger count
+                    m_occurrences = 1;
                     
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                        pBuffer, displayMetaData, pFrameMeta, pSmallestObject);
+                    // update the total event count static variable
+                    s_eventCount++;
+
+                    // conditionally add the 
+                    if (m_pHeatMapper)
+                    {
+                        std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
+                            pFrameMeta, pSmallestObject);
+                    }
+                    // set the primary metric as the smallest bounding box by area
+                    pSmallestObject->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
+                        = smallestArea;
+                    for (const auto &imap: m_pOdeActionsIndexed)
+                    {
+                        DSL_ODE_ACTION_PTR pOdeAction = 
+                            std::dynamic_pointer_cast<OdeAction>(imap.second);
+                    
+                        InvokeAction(pOdeAction, 
+                            pBuffer, displayMetaData, pFrameMeta, pSmallestObject);
+                    }
                 }
             }   
 
@@ -1711,16 +2776,22 @@ namespace DSL
     }
     
     bool LargestOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
+        // Lock-free rejection of objects that fail the current criteria
+        if (!CheckForCriteria(pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pObjectMeta))
+        {
+            return false;
+        }
+        
         // Note: function is called from the system (callback) context
         // Gaurd against property updates from the client API
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+            !CheckForMinCriteria(pFrameMeta, pObjectMeta))
         {
             return false;
         }
@@ -1731,7 +2802,7 @@ namespace DSL
     }
 
     uint LargestOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaAllocator& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -1745,12 +2816,6 @@ namespace DSL
             // need at least one object for a Minimum event
             if (m_enabled and m_occurrenceMetaList.size())
             {
-                // Once occurrence to return and increment the accumulative Trigger count
-                m_occurrences = 1;
-                IncrementAndCheckTriggerCount();
-                // update the total event count static variable
-                s_eventCount++;
-
                 uint largestArea = 0;
                 NvDsObjectMeta* pLargestObject(NULL);
                 
@@ -1765,24 +2830,34 @@ namespace DSL
                     }
                 }
 
-                // If the client has added a heat mapper, call to add-occurrence
-                if (m_pHeatMapper)
+                // event has been triggered, unless suppressed by the rate limit
+                if (IncrementAndCheckTriggerCount(pFrameMeta, pLargestObject))
                 {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, pLargestObject);
-                }
+                    // One occurrence to return and increment the accumulative Trigger count
+                    m_occurrences = 1;
+                    
+                    // update the total event count static variable
+                    s_eventCount++;
+
+                    // If the client has added a heat mapper, call to add-occurrence
+                    if (m_pHeatMapper)
+                    {
+                        std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
+                            pFrameMeta, pLargestObject);
+                    }
                 
-                // set the primary metric as the larget area
-                pLargestObject->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                    = largestArea;
+                    // set the primary metric as the larget area
+                    pLargestObject->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
+                        = largestArea;
                 
-                for (const auto &imap: m_pOdeActionsIndexed)
-                {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
+                    for (const auto &imap: m_pOdeActionsIndexed)
+                    {
+                        DSL_ODE_ACTION_PTR pOdeAction = 
+                            std::dynamic_pointer_cast<OdeAction>(imap.second);
                     
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                        pBuffer, displayMetaData, pFrameMeta, pLargestObject);
+                        InvokeAction(pOdeAction, 
+                            pBuffer, displayMetaData, pFrameMeta, pLargestObject);
+                    }
                 }
             }   
 
@@ -1824,17 +2899,23 @@ namespace DSL
     }
     
     bool NewLowOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
+        // Lock-free rejection of objects that fail the current criteria
+        if (!CheckForCriteria(pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pObjectMeta))
+        {
+            return false;
+        }
+        
         // Note: function is called from the system (callback) context
         // Gaurd against property updates from the client API
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         if (!m_enabled or 
             !CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+            !CheckForMinCriteria(pFrameMeta, pObjectMeta))
         {
             return false;
         }
@@ -1845,7 +2926,7 @@ namespace DSL
     }
 
     uint NewLowOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaAllocator& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -1859,13 +2940,11 @@ namespace DSL
                 return 0;
             }
             
-            if (m_occurrences < m_currentLow)
+            // new low, unless the event is suppressed by the rate limit
+            if (m_occurrences < m_currentLow and 
+                IncrementAndCheckTriggerCount(pFrameMeta, NULL))
             {
-                // new low
                 m_currentLow = m_occurrences;
-                
-                // event has been triggered
-                IncrementAndCheckTriggerCount();
 
                  // update the total event count static variable
                 s_eventCount++;
@@ -1880,7 +2959,7 @@ namespace DSL
                 {
                     DSL_ODE_ACTION_PTR pOdeAction = 
                         std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                    InvokeAction(pOdeAction, 
                         pBuffer, displayMetaData, pFrameMeta, NULL);
                 }
                 // new high m_occurrences means ODE occurrence = 1
@@ -1927,17 +3006,23 @@ namespace DSL
     }
     
     bool NewHighOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
+        // Lock-free rejection of objects that fail the current criteria
+        if (!CheckForCriteria(pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pObjectMeta))
+        {
+            return false;
+        }
+        
         // Note: function is called from the system (callback) context
         // Gaurd against property updates from the client API
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         if (!m_enabled or 
             !CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+            !CheckForMinCriteria(pFrameMeta, pObjectMeta))
         {
             return false;
         }
@@ -1948,7 +3033,7 @@ namespace DSL
     }
 
     uint NewHighOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaAllocator& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -1962,13 +3047,11 @@ namespace DSL
                 return 0;
             }
             
-            if (m_occurrences > m_currentHigh)
+            // new high, unless the event is suppressed by the rate limit
+            if (m_occurrences > m_currentHigh and 
+                IncrementAndCheckTriggerCount(pFrameMeta, NULL))
             {
-                // new high
                 m_currentHigh = m_occurrences;
-                
-                // event has been triggered
-                IncrementAndCheckTriggerCount();
 
                  // update the total event count static variable
                 s_eventCount++;
@@ -1983,7 +3066,7 @@ namespace DSL
                 {
                     DSL_ODE_ACTION_PTR pOdeAction = 
                         std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                    InvokeAction(pOdeAction, 
                         pBuffer, displayMetaData, pFrameMeta, NULL);
                 }
                 // new high m_occurrences means ODE occurrence = 1
@@ -2030,6 +3113,15 @@ namespace DSL
         // call the base class to complete the Reset
         OdeTrigger::Reset();
     }
+    
+    void TrackingOdeTrigger::SetTrackStore(
+        std::shared_ptr<TrackedObjectStore> pTrackStore)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_pTrackedObjectsPerSource->SetTrackStore(pTrackStore);
+    }
    
     // *****************************************************************************
     
@@ -2057,9 +3149,15 @@ namespace DSL
     }
 
     bool CrossOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
+        // Lock-free rejection of objects that fail the current criteria
+        if (!CheckForCriteria(pFrameMeta, pObjectMeta))
+        {
+            return false;
+        }
+        
         // Note: function is called from the system (callback) context
         // Gaurd against property updates from the client API
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2078,9 +3176,12 @@ namespace DSL
             return false;
         }
 
+        // Get the tracked object and update with current frame meta
+        TrackedObject* pTrackedObject = 
+            m_pTrackedObjectsPerSource->Update(pFrameMeta, pObjectMeta);
+
         // if this is the first occurrence of this object for this source
-        if (!m_pTrackedObjectsPerSource->IsTracked(pFrameMeta->source_id,
-            pObjectMeta->object_id))
+        if (pTrackedObject == NULL)
         {
             // Create a new Tracked object and return without occurence
             m_pTrackedObjectsPerSource->Track(pFrameMeta, 
@@ -2091,14 +3192,6 @@ namespace DSL
             
             return false;
         }
-
-        // Else, get the tracked object and update with current frame meta
-        std::shared_ptr<TrackedObject> pTrackedObject = 
-            m_pTrackedObjectsPerSource->GetObject(pFrameMeta->source_id,
-                pObjectMeta->object_id);
-                
-        pTrackedObject->Update(pFrameMeta->frame_num, 
-            (NvBbox_Coords*)&pObjectMeta->rect_params);
             
         // Iterate through the map of 1 or more Areas to test for line cross
         for (const auto &imap: m_pOdeAreasIndexed)
@@ -2176,8 +3269,11 @@ namespace DSL
                     return false;
                 }
                 
-                // event has been triggered
-                IncrementAndCheckTriggerCount();
+                // event has been triggered, unless suppressed by the rate limit
+                if (!IncrementAndCheckTriggerCount(pFrameMeta, pObjectMeta))
+                {
+                    return false;
+                }
                 m_occurrences++;
                 
                 if (direction == DSL_AREA_CROSS_DIRECTION_IN)
@@ -2212,7 +3308,7 @@ namespace DSL
                 {
                     DSL_ODE_ACTION_PTR pOdeAction = 
                         std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                    InvokeAction(pOdeAction, 
                         pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
                 }
 
@@ -2228,7 +3324,7 @@ namespace DSL
     }
 
     uint CrossOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaAllocator& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // Note: function is called from the system (callback) context
         // Gaurd against property updates from the client API
@@ -2245,7 +3341,7 @@ namespace DSL
         if (m_pHeatMapper)
         {
             std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->AddDisplayMeta(
-                displayMetaData);
+                displayMetaData, pFrameMeta);
         }
 
         // If the client has added an accumulator, 
@@ -2374,23 +3470,31 @@ namespace DSL
     }
     
     bool PersistenceOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
+        // Lock-free rejection of objects that fail the current criteria
+        if (!CheckForCriteria(pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pObjectMeta))
+        {
+            return false;
+        }
+        
         // Note: function is called from the system (callback) context
         // Gaurd against property updates from the client API
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+            !CheckForMinCriteria(pFrameMeta, pObjectMeta))
         {
             return false;
         }
 
+        TrackedObject* pTrackedObject = 
+            m_pTrackedObjectsPerSource->Update(pFrameMeta, pObjectMeta);
+        
         // if this is the first occurrence of this object for this source
-        if (!m_pTrackedObjectsPerSource->IsTracked(pFrameMeta->source_id,
-            pObjectMeta->object_id))
+        if (pTrackedObject == NULL)
         {
             // Create a new Tracked object and return without occurence
             m_pTrackedObjectsPerSource->Track(pFrameMeta, 
@@ -2398,12 +3502,6 @@ namespace DSL
         }
         else
         {
-            std::shared_ptr<TrackedObject> pTrackedObject = 
-                m_pTrackedObjectsPerSource->GetObject(pFrameMeta->source_id,
-                    pObjectMeta->object_id);
-                    
-            pTrackedObject->Update(pFrameMeta->frame_num, 
-                (NvBbox_Coords*)&pObjectMeta->rect_params);
 
             double trackedTimeMs = pTrackedObject->GetDurationMs();
             
@@ -2411,11 +3509,11 @@ namespace DSL
                 << pObjectMeta->object_id << " for source = " 
                 << pFrameMeta->source_id << ", = " << trackedTimeMs << " ms");
             
-            // if the object's tracked time is within range. 
-            if (trackedTimeMs >= m_minimumMs and trackedTimeMs <= m_maximumMs)
+            // if the object's tracked time is within range, and the event
+            // is not suppressed by the rate limit.
+            if (trackedTimeMs >= m_minimumMs and trackedTimeMs <= m_maximumMs and
+                IncrementAndCheckTriggerCount(pFrameMeta, pObjectMeta))
             {
-                // event has been triggered
-                IncrementAndCheckTriggerCount();
                 m_occurrences++;
 
                 // update the total event count static variable
@@ -2438,7 +3536,7 @@ namespace DSL
                 {
                     DSL_ODE_ACTION_PTR pOdeAction = 
                         std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                    InvokeAction(pOdeAction, 
                         pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
                 }
             }
@@ -2447,7 +3545,7 @@ namespace DSL
     }
 
     uint PersistenceOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaAllocator& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -2468,6 +3566,47 @@ namespace DSL
             displayMetaData, pFrameMeta);
     }
 
+    bool PersistenceOdeTrigger::CheckForPredicate(OdePredicateContext& context)
+    {
+        // No function log - avoid overhead.
+        
+        if (!OdeTrigger::CheckForPredicate(context))
+        {
+            return false;
+        }
+        
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+
+        TrackedObject* pTrackedObject = m_pTrackedObjectsPerSource->Update(
+            context.pFrameMeta, context.pObjectMeta);
+        
+        // if this is the first occurrence of this object for this source
+        if (pTrackedObject == NULL)
+        {
+            m_pTrackedObjectsPerSource->Track(context.pFrameMeta, 
+                context.pObjectMeta, nullptr);
+            return false;
+        }
+        double trackedTimeMs = pTrackedObject->GetDurationMs();
+        
+        return (trackedTimeMs >= m_minimumMs and trackedTimeMs <= m_maximumMs);
+    }
+
+    void PersistenceOdeTrigger::PostProcessPredicate(NvDsFrameMeta* pFrameMeta)
+    {
+        // No function log - avoid overhead.
+        
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (!m_pTrackedObjectsPerSource->IsEmpty())
+        {
+            // purge all tracked objects, for all sources that are not in the current frame.
+            m_pTrackedObjectsPerSource->Purge(pFrameMeta->frame_num);
+        }
+    }
+
     // *****************************************************************************
     
     LatestOdeTrigger::LatestOdeTrigger(const char* name, const char* source, 
@@ -2485,22 +3624,31 @@ namespace DSL
     }
 
     bool LatestOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
+        // Lock-free rejection of objects that fail the current criteria
+        if (!CheckForCriteria(pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pObjectMeta))
+        {
+            return false;
+        }
+        
         // Note: function is called from the system (callback) context
         // Gaurd against property updates from the client API
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or !CheckForInside(pObjectMeta))
+            !CheckForMinCriteria(pFrameMeta, pObjectMeta))
         {
             return false;
         }
 
+        TrackedObject* pTrackedObject = 
+            m_pTrackedObjectsPerSource->Update(pFrameMeta, pObjectMeta);
+        
         // if this is the first occurrence of this object for this source
-        if (!m_pTrackedObjectsPerSource->IsTracked(pFrameMeta->source_id,
-            pObjectMeta->object_id))
+        if (pTrackedObject == NULL)
         {
             // Create a new Tracked object and return without occurence
             m_pTrackedObjectsPerSource->Track(pFrameMeta, 
@@ -2508,12 +3656,6 @@ namespace DSL
         }
         else
         {
-            std::shared_ptr<TrackedObject> pTrackedObject = 
-                m_pTrackedObjectsPerSource->GetObject(pFrameMeta->source_id,
-                    pObjectMeta->object_id);
-                    
-            pTrackedObject->Update(pFrameMeta->frame_num, 
-                (NvBbox_Coords*)&pObjectMeta->rect_params);
 
             double trackedTimeMs = pTrackedObject->GetDurationMs();
             
@@ -2527,7 +3669,7 @@ namespace DSL
     }
     
     uint LatestOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaAllocator& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -2544,34 +3686,35 @@ namespace DSL
             // If we a Latest Object ODE 
             if (m_pLatestObjectMeta != NULL)
             {
-                // event has been triggered
-                IncrementAndCheckTriggerCount();
-                m_occurrences++;
+                // event has been triggered, unless suppressed by the rate limit
+                if (IncrementAndCheckTriggerCount(pFrameMeta, m_pLatestObjectMeta))
+                {
+                    m_occurrences++;
 
-                // update the total event count static variable
-                s_eventCount++;
+                    // update the total event count static variable
+                    s_eventCount++;
 
-                // If the client has added a heat mapper, call to add the occurrence data
-                if (m_pHeatMapper)
-                {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, m_pLatestObjectMeta);
-                }
+                    // If the client has added a heat mapper, call to add the occurrence data
+                    if (m_pHeatMapper)
+                    {
+                        std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
+                            pFrameMeta, m_pLatestObjectMeta);
+                    }
                 
-                // add the persistence value to the array of misc_obj_info
-                // as both the Primary and Persistence specific indecies.
-                m_pLatestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] = 
-                m_pLatestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
-                    (uint64_t)(m_latestTrackedTimeMs/1000);
+                    // add the persistence value to the array of misc_obj_info
+                    // as both the Primary and Persistence specific indecies.
+                    m_pLatestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] = 
+                    m_pLatestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
+                        (uint64_t)(m_latestTrackedTimeMs/1000);
 
-                for (const auto &imap: m_pOdeActionsIndexed)
-                {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                        pBuffer, displayMetaData, pFrameMeta, m_pLatestObjectMeta);
+                    for (const auto &imap: m_pOdeActionsIndexed)
+                    {
+                        DSL_ODE_ACTION_PTR pOdeAction = 
+                            std::dynamic_pointer_cast<OdeAction>(imap.second);
+                        InvokeAction(pOdeAction, 
+                            pBuffer, displayMetaData, pFrameMeta, m_pLatestObjectMeta);
+                    }
                 }
-            
                 // clear the Newest Object data for the next frame 
                 m_pLatestObjectMeta = NULL;
                 m_latestTrackedTimeMs = 0;
@@ -2601,23 +3744,31 @@ namespace DSL
     }
 
     bool EarliestOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
+        // Lock-free rejection of objects that fail the current criteria
+        if (!CheckForCriteria(pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pObjectMeta))
+        {
+            return false;
+        }
+        
         // Note: function is called from the system (callback) context
         // Gaurd against property updates from the client API
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+            !CheckForMinCriteria(pFrameMeta, pObjectMeta))
         {
             return false;
         }
 
+        TrackedObject* pTrackedObject = 
+            m_pTrackedObjectsPerSource->Update(pFrameMeta, pObjectMeta);
+        
         // if this is the first occurrence of this object for this source
-        if (!m_pTrackedObjectsPerSource->IsTracked(pFrameMeta->source_id,
-            pObjectMeta->object_id)) 
+        if (pTrackedObject == NULL)
         {
             // Create a new Tracked object and return without occurence
             m_pTrackedObjectsPerSource->Track(pFrameMeta, 
@@ -2625,12 +3776,6 @@ namespace DSL
         }
         else
         {
-            std::shared_ptr<TrackedObject> pTrackedObject = 
-                m_pTrackedObjectsPerSource->GetObject(pFrameMeta->source_id,
-                    pObjectMeta->object_id);
-                    
-            pTrackedObject->Update(pFrameMeta->frame_num, 
-                (NvBbox_Coords*)&pObjectMeta->rect_params);
 
             double trackedTimeMs = pTrackedObject->GetDurationMs();
                 
@@ -2646,7 +3791,7 @@ namespace DSL
     }
     
     uint EarliestOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaAllocator& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -2662,34 +3807,35 @@ namespace DSL
             
             if (m_pEarliestObjectMeta != NULL)
             {
-                // event has been triggered
-                IncrementAndCheckTriggerCount();
-                m_occurrences++;
+                // event has been triggered, unless suppressed by the rate limit
+                if (IncrementAndCheckTriggerCount(pFrameMeta, m_pEarliestObjectMeta))
+                {
+                    m_occurrences++;
 
-                // update the total event count static variable
-                s_eventCount++;
+                    // update the total event count static variable
+                    s_eventCount++;
 
-                // If the client has added a heat mapper, call to add the occurrence data
-                if (m_pHeatMapper)
-                {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, m_pEarliestObjectMeta);
-                }
+                    // If the client has added a heat mapper, call to add the occurrence data
+                    if (m_pHeatMapper)
+                    {
+                        std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
+                            pFrameMeta, m_pEarliestObjectMeta);
+                    }
 
-                // add the persistence value to the array of misc_obj_info
-                // as both the Primary and Persistence specific indecies.
-                m_pEarliestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] = 
-                m_pEarliestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
-                    (uint64_t)(m_earliestTrackedTimeMs/1000);
+                    // add the persistence value to the array of misc_obj_info
+                    // as both the Primary and Persistence specific indecies.
+                    m_pEarliestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] = 
+                    m_pEarliestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
+                        (uint64_t)(m_earliestTrackedTimeMs/1000);
 
-                for (const auto &imap: m_pOdeActionsIndexed)
-                {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                        pBuffer, displayMetaData, pFrameMeta, m_pEarliestObjectMeta);
+                    for (const auto &imap: m_pOdeActionsIndexed)
+                    {
+                        DSL_ODE_ACTION_PTR pOdeAction = 
+                            std::dynamic_pointer_cast<OdeAction>(imap.second);
+                        InvokeAction(pOdeAction, 
+                            pBuffer, displayMetaData, pFrameMeta, m_pEarliestObjectMeta);
+                    }
                 }
-            
                 // clear the Earliest Object data for the next frame 
                 m_pEarliestObjectMeta = NULL;
                 m_earliestTrackedTimeMs = 0;
@@ -2712,6 +3858,8 @@ namespace DSL
         : OdeTrigger(name, source, classIdA, limit)
         , m_classIdA(classIdA)
         , m_classIdB(classIdB)
+        , m_broadPhaseEnabled(false)
+        , m_broadPhaseMargin(0)
     {
         LOG_FUNC();
         
@@ -2739,25 +3887,39 @@ namespace DSL
         m_classIdA = classIdA;
         m_classIdB = classIdB;
         m_classIdAOnly = (m_classIdA == m_classIdB);
+        
+        // parent ODE Handlers must re-compile their dispatch tables
+        s_dispatchVersion++;
+    }
+
+    void ABOdeTrigger::GetDispatchClassIds(std::vector<uint>& classIds)
+    {
+        LOG_FUNC();
+        
+        classIds.push_back(m_classIdA);
+        if (!m_classIdAOnly)
+        {
+            classIds.push_back(m_classIdB);
+        }
     }
     
     bool ABOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaAllocator& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         // Note: function is called from the system (callback) context
         // Gaurd against property updates from the client API
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        if (!m_enabled or !CheckForSourceId(pFrameMeta->source_id))
+        if (!m_enabled or !CheckForSourceId(pFrameMeta->source_id) or
+            !CheckForMinCriteria(pFrameMeta, pObjectMeta))
         {
             return false;
         }
         
         bool occurrenceAdded(false);
         
-        m_classId = m_classIdA;
-        if (CheckForMinCriteria(pFrameMeta, pObjectMeta) and 
+        if (CheckForCriteria(pFrameMeta, pObjectMeta, m_classIdA) and 
             CheckForInside(pObjectMeta))
         {
             m_occurrenceMetaListA.push_back(pObjectMeta);
@@ -2765,8 +3927,7 @@ namespace DSL
         }
         else if (!m_classIdAOnly)
         {
-            m_classId = m_classIdB;
-            if (CheckForMinCriteria(pFrameMeta, pObjectMeta) and 
+            if (CheckForCriteria(pFrameMeta, pObjectMeta, m_classIdB) and 
                 CheckForInside(pObjectMeta))
             {
                 m_occurrenceMetaListB.push_back(pObjectMeta);
@@ -2778,7 +3939,7 @@ namespace DSL
     }
 
     uint ABOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaAllocator& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         if (m_classIdAOnly)
         {
@@ -2787,6 +3948,55 @@ namespace DSL
         return  PostProcessFrameAB(pBuffer, displayMetaData, pFrameMeta);
     }
 
+    void ABOdeTrigger::GetBroadPhaseBox(NvDsObjectMeta* pObjectMeta, 
+        GeometryBox& box)
+    {
+        box.minX = pObjectMeta->rect_params.left;
+        box.minY = pObjectMeta->rect_params.top;
+        box.maxX = box.minX + pObjectMeta->rect_params.width;
+        box.maxY = box.minY + pObjectMeta->rect_params.height;
+    }
+    
+    void ABOdeTrigger::BuildBroadPhase(const std::vector<NvDsObjectMeta*>& objects,
+        size_t numQueryObjects, double margin)
+    {
+        m_broadPhaseEnabled = (objects.size()*numQueryObjects >= 
+            DSL_ODE_TRIGGER_BROAD_PHASE_MIN_PAIRS);
+        if (!m_broadPhaseEnabled)
+        {
+            return;
+        }
+        m_broadPhaseMargin = margin;
+        m_broadPhaseBoxes.resize(objects.size());
+        for (uint i = 0; i < objects.size(); i++)
+        {
+            GetBroadPhaseBox(objects[i], m_broadPhaseBoxes[i]);
+        }
+        m_broadPhase.Build(m_broadPhaseBoxes);
+    }
+    
+    void ABOdeTrigger::GetPairCandidates(NvDsObjectMeta* pObjectMeta, 
+        size_t numObjects)
+    {
+        if (!m_broadPhaseEnabled)
+        {
+            m_pairCandidates.resize(numObjects);
+            for (uint i = 0; i < numObjects; i++)
+            {
+                m_pairCandidates[i] = i;
+            }
+            return;
+        }
+        GeometryBox box;
+        GetBroadPhaseBox(pObjectMeta, box);
+        box.minX -= m_broadPhaseMargin;
+        box.minY -= m_broadPhaseMargin;
+        box.maxX += m_broadPhaseMargin;
+        box.maxY += m_broadPhaseMargin;
+        
+        m_broadPhase.Query(box, m_pairCandidates);
+    }
+
     // *****************************************************************************
     
     DistanceOdeTrigger::DistanceOdeTrigger(const char* name, const char* source, 
@@ -2842,7 +4052,7 @@ namespace DSL
     
     
     uint DistanceOdeTrigger::PostProcessFrameA(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaAllocator& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -2856,17 +4066,28 @@ namespace DSL
             // need at least two objects for intersection to occur
             while (m_enabled and m_occurrenceMetaListA.size() > 1)
             {
+                BuildDistanceBroadPhase(m_occurrenceMetaListA, 
+                    m_occurrenceMetaListA);
+                    
                 // iterate through the list of object occurrences that passed all min criteria
-                for (uint i = 0; i < m_occurrenceMetaListA.size()-1 ; i++) 
+                for (uint i = 0; i+1 < m_occurrenceMetaListA.size() ; i++) 
                 {
-                    for (uint j = i+1; j < m_occurrenceMetaListA.size() ; j++) 
+                    // only nearby objects, in list order, if the broad phase is enabled
+                    GetPairCandidates(m_occurrenceMetaListA[i], 
+                        m_occurrenceMetaListA.size());
+                        
+                    for (const auto &j: m_pairCandidates) 
                     {
-                        if (CheckDistance(m_occurrenceMetaListA[i], 
+                        if (j > i and CheckDistance(m_occurrenceMetaListA[i], 
                             m_occurrenceMetaListA[j]))
                         {
-                            // event has been triggered
+                            // event has been triggered, unless suppressed by the rate limit
+                            if (!IncrementAndCheckTriggerCount(pFrameMeta, 
+                                m_occurrenceMetaListA[i]))
+                            {
+                                continue;
+                            }
                             m_occurrences++;
-                            IncrementAndCheckTriggerCount();
                             
                              // update the total event count static variable
                             s_eventCount++;
@@ -2883,9 +4104,9 @@ namespace DSL
                                     std::dynamic_pointer_cast<OdeAction>(imap.second);
                                 
                                 // Invoke each action twice, once for each object in the tested pair
-                                pOdeAction->HandleOccurrence(shared_from_this(), 
+                                InvokeAction(pOdeAction, 
                                     pBuffer, displayMetaData, pFrameMeta, m_occurrenceMetaListA[i]);
-                                pOdeAction->HandleOccurrence(shared_from_this(), 
+                                InvokeAction(pOdeAction, 
                                     pBuffer, displayMetaData, pFrameMeta, m_occurrenceMetaListA[j]);
                             }
                             if (m_eventLimit and m_triggered >= m_eventLimit)
@@ -2908,7 +4129,7 @@ namespace DSL
     }
    
     uint DistanceOdeTrigger::PostProcessFrameAB(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaAllocator& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -2922,20 +4143,34 @@ namespace DSL
             // need at least one object from each of the two Classes 
             while (m_enabled and m_occurrenceMetaListA.size() and m_occurrenceMetaListB.size())
             {
+                BuildDistanceBroadPhase(m_occurrenceMetaListB, 
+                    m_occurrenceMetaListA);
+                    
                 // iterate through the list of object occurrences that passed all min criteria
-                for (const auto &iterA: m_occurrenceMetaListA) 
+                for (uint i = 0; i < m_occurrenceMetaListA.size(); i++) 
                 {
-                    for (const auto &iterB: m_occurrenceMetaListB) 
+                    NvDsObjectMeta* iterA = m_occurrenceMetaListA[i];
+                    
+                    // only nearby objects, in list order, if the broad phase is enabled
+                    GetPairCandidates(iterA, m_occurrenceMetaListB.size());
+                    
+                    for (const auto &j: m_pairCandidates) 
                     {
+                        NvDsObjectMeta* iterB = m_occurrenceMetaListB[j];
+                        
                         // ensure we are not testing the same object which can be in both vectors
                         // if Class Id A and B are specified to be the same.
                         if (iterA != iterB)
                         {
                             if (CheckDistance(iterA, iterB))
                             {
-                                // event has been triggered
+                                // event has been triggered, unless suppressed 
+                                // by the rate limit
+                                if (!IncrementAndCheckTriggerCount(pFrameMeta, iterA))
+                                {
+                                    continue;
+                                }
                                 m_occurrences++;
-                                IncrementAndCheckTriggerCount();
                                 
                                  // update the total event count static variable
                                 s_eventCount++;
@@ -2954,9 +4189,9 @@ namespace DSL
                                     
                                     // Invoke each action twice, once for each object 
                                     // in the tested pair
-                                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                                    InvokeAction(pOdeAction, 
                                         pBuffer, displayMetaData, pFrameMeta, iterA);
-                                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                                    InvokeAction(pOdeAction, 
                                         pBuffer, displayMetaData, pFrameMeta, iterB);
                                 }
                                 if (m_eventLimit and m_triggered >= m_eventLimit)
@@ -2981,15 +4216,48 @@ namespace DSL
             displayMetaData, pFrameMeta);
     }
 
+    bool DistanceOdeTrigger::CheckForPredicate(OdePredicateContext& context)
+    {
+        // No function log - avoid overhead.
+        
+        // Lock-free rejection of objects that fail the Class A criteria
+        if (!CheckForCriteria(context.pFrameMeta, context.pObjectMeta, m_classIdA) or 
+            !CheckForInside(context))
+        {
+            return false;
+        }
+        
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (!CheckForSourceId(context.pFrameMeta->source_id) or
+            !CheckForInferId(context.pObjectMeta->unique_component_id))
+        {
+            return false;
+        }
+        for (const auto& pObjectMetaB: *context.pFrameObjects)
+        {
+            // Class B is the same as Class A when in Class A only mode.
+            if (pObjectMetaB != context.pObjectMeta and
+                CheckForCriteria(context.pFrameMeta, pObjectMetaB, m_classIdB) and
+                CheckForInferId(pObjectMetaB->unique_component_id) and
+                CheckForInside(pObjectMetaB) and
+                CheckDistance(context.pObjectMeta, pObjectMetaB))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
     bool DistanceOdeTrigger::CheckDistance(NvDsObjectMeta* pObjectMetaA, 
         NvDsObjectMeta* pObjectMetaB)
     {
         uint distance(0);
         if (m_testPoint == DSL_BBOX_POINT_ANY)
         {
-            GeosRectangle rectA(pObjectMetaA->rect_params);
-            GeosRectangle rectB(pObjectMetaB->rect_params);
-            distance = rectA.Distance(rectB);
+            distance = GeometryRectDistance(pObjectMetaA->rect_params,
+                pObjectMetaB->rect_params);
         }
         else{
             uint xa(0), ya(0), xb(0), yb(0);
@@ -3055,12 +4323,18 @@ namespace DSL
                 throw;
             }
 
-            GeosPoint pointA(xa, ya);
-            GeosPoint pointB(xb, yb);
-            distance = pointA.Distance(pointB);
+            distance = GeometryPointDistance(xa, ya, xb, yb);
         }
         
         uint minimum(0), maximum(0);
+        GetRangeInPixels(pObjectMetaA, pObjectMetaB, minimum, maximum);
+        
+        return (minimum > distance or maximum < distance);
+    }
+
+    void DistanceOdeTrigger::GetRangeInPixels(NvDsObjectMeta* pObjectMetaA, 
+        NvDsObjectMeta* pObjectMetaB, uint& minimum, uint& maximum)
+    {
         switch (m_testMethod)
         {
         case DSL_DISTANCE_METHOD_FIXED_PIXELS :
@@ -3092,7 +4366,97 @@ namespace DSL
                 (uint64_t)pObjectMetaB->rect_params.height)/100);
             break;
         }    
-        return (minimum > distance or maximum < distance);
+    }
+
+    void DistanceOdeTrigger::GetBroadPhaseBox(NvDsObjectMeta* pObjectMeta, 
+        GeometryBox& box)
+    {
+        ABOdeTrigger::GetBroadPhaseBox(pObjectMeta, box);
+        if (m_testPoint == DSL_BBOX_POINT_ANY)
+        {
+            return;
+        }
+        double x(box.minX), y(box.minY);
+        switch (m_testPoint)
+        {
+        case DSL_BBOX_POINT_NORTH :
+        case DSL_BBOX_POINT_CENTER :
+        case DSL_BBOX_POINT_SOUTH :
+            x = (box.minX + box.maxX)/2;
+            break;
+        case DSL_BBOX_POINT_NORTH_EAST :
+        case DSL_BBOX_POINT_EAST :
+        case DSL_BBOX_POINT_SOUTH_EAST :
+            x = box.maxX;
+            break;
+        }
+        switch (m_testPoint)
+        {
+        case DSL_BBOX_POINT_WEST :
+        case DSL_BBOX_POINT_CENTER :
+        case DSL_BBOX_POINT_EAST :
+            y = (box.minY + box.maxY)/2;
+            break;
+        case DSL_BBOX_POINT_SOUTH_WEST :
+        case DSL_BBOX_POINT_SOUTH :
+        case DSL_BBOX_POINT_SOUTH_EAST :
+            y = box.maxY;
+            break;
+        }
+        box = {x, y, x, y};
+    }
+    
+    void DistanceOdeTrigger::BuildDistanceBroadPhase(
+        const std::vector<NvDsObjectMeta*>& objects,
+        const std::vector<NvDsObjectMeta*>& queryObjects)
+    {
+        m_broadPhaseEnabled = false;
+        if (objects.size()*queryObjects.size() < 
+            DSL_ODE_TRIGGER_BROAD_PHASE_MIN_PAIRS)
+        {
+            return;
+        }
+        // largest minimum and smallest maximum over all objects the range 
+        // depends on - Class A for the *_A methods, Class B otherwise.
+        const std::vector<NvDsObjectMeta*>& rangeObjects = 
+            (m_testMethod == DSL_DISTANCE_METHOD_PERCENT_WIDTH_A or
+            m_testMethod == DSL_DISTANCE_METHOD_PERCENT_HEIGHT_A) 
+                ? queryObjects : objects;
+        uint largestMinimum(0), smallestMaximum(UINT32_MAX);
+        for (const auto &ivec: rangeObjects)
+        {
+            uint minimum(0), maximum(0);
+            GetRangeInPixels(ivec, ivec, minimum, maximum);
+            largestMinimum = std::max(largestMinimum, minimum);
+            smallestMaximum = std::min(smallestMaximum, maximum);
+        }
+        
+        // the largest possible distance between any two objects is the 
+        // diagonal of the box that bounds them all.
+        GeometryBox extent, box;
+        GetBroadPhaseBox(objects[0], extent);
+        for (const auto &list: {&objects, &queryObjects})
+        {
+            for (const auto &ivec: *list)
+            {
+                GetBroadPhaseBox(ivec, box);
+                extent.minX = std::min(extent.minX, box.minX);
+                extent.minY = std::min(extent.minY, box.minY);
+                extent.maxX = std::max(extent.maxX, box.maxX);
+                extent.maxY = std::max(extent.maxY, box.maxY);
+            }
+        }
+        double diagonal = sqrt((extent.maxX - extent.minX)*(extent.maxX - extent.minX)
+            + (extent.maxY - extent.minY)*(extent.maxY - extent.minY));
+            
+        // If any pair can be beyond the maximum, all pairs must be tested. 
+        // Otherwise only pairs closer than the minimum can trigger. Both 
+        // bounds allow 2 pixels for the rounding of test-points and distances.
+        if (diagonal + 2 >= smallestMaximum)
+        {
+            return;
+        }
+        BuildBroadPhase(objects, queryObjects.size(), largestMinimum + 2);
     }
 
     // *****************************************************************************
@@ -3110,7 +4474,7 @@ namespace DSL
     }
     
     uint IntersectionOdeTrigger::PostProcessFrameA(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaAllocator& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -3124,19 +4488,30 @@ namespace DSL
             // need at least two objects for intersection to occur
             if (m_enabled and m_occurrenceMetaListA.size() > 1)
             {
+                BuildBroadPhase(m_occurrenceMetaListA, 
+                    m_occurrenceMetaListA.size(), 0);
+                    
                 // iterate through the list of object occurrences that passed all min criteria
-                for (uint i = 0; i < m_occurrenceMetaListA.size()-1 ; i++) 
+                for (uint i = 0; i+1 < m_occurrenceMetaListA.size() ; i++) 
                 {
-                    for (uint j = i+1; j < m_occurrenceMetaListA.size() ; j++) 
+                    // only touching objects, in list order, if the broad phase is enabled
+                    GetPairCandidates(m_occurrenceMetaListA[i], 
+                        m_occurrenceMetaListA.size());
+                        
+                    for (const auto &j: m_pairCandidates) 
                     {
                         // check each in turn for any frame overlap
-                        GeosRectangle rectA(m_occurrenceMetaListA[i]->rect_params);
-                        GeosRectangle rectB(m_occurrenceMetaListA[j]->rect_params);
-                        if (rectA.Overlaps(rectB))
+                        if (j > i and GeometryRectsOverlap(
+                            m_occurrenceMetaListA[i]->rect_params,
+                            m_occurrenceMetaListA[j]->rect_params))
                         {
-                            // event has been triggered
+                            // event has been triggered, unless suppressed by the rate limit
+                            if (!IncrementAndCheckTriggerCount(pFrameMeta, 
+                                m_occurrenceMetaListA[i]))
+                            {
+                                continue;
+                            }
                             m_occurrences++;
-                            IncrementAndCheckTriggerCount();
                             
                              // update the total event count static variable
                             s_eventCount++;
@@ -3153,9 +4528,9 @@ namespace DSL
                                     std::dynamic_pointer_cast<OdeAction>(imap.second);
                                 
                                 // Invoke each action twice, once for each object in the tested pair
-                                pOdeAction->HandleOccurrence(shared_from_this(), 
+                                InvokeAction(pOdeAction, 
                                     pBuffer, displayMetaData, pFrameMeta, m_occurrenceMetaListA[i]);
-                                pOdeAction->HandleOccurrence(shared_from_this(), 
+                                InvokeAction(pOdeAction, 
                                     pBuffer, displayMetaData, pFrameMeta, m_occurrenceMetaListA[j]);
                             }
                             if (m_eventLimit and m_triggered >= m_eventLimit)
@@ -3177,7 +4552,7 @@ namespace DSL
    }
 
     uint IntersectionOdeTrigger::PostProcessFrameAB(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaAllocator& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -3191,23 +4566,34 @@ namespace DSL
             // need at least one object from each of the two Classes 
             if (m_enabled and m_occurrenceMetaListA.size() and m_occurrenceMetaListB.size())
             {
+                BuildBroadPhase(m_occurrenceMetaListB, 
+                    m_occurrenceMetaListA.size(), 0);
+                    
                 // iterate through the list of object occurrences that passed all min criteria
                 for (const auto &iterA: m_occurrenceMetaListA) 
                 {
-                    for (const auto &iterB: m_occurrenceMetaListB) 
+                    // only touching objects, in list order, if the broad phase is enabled
+                    GetPairCandidates(iterA, m_occurrenceMetaListB.size());
+                    
+                    for (const auto &j: m_pairCandidates) 
                     {
+                        NvDsObjectMeta* iterB = m_occurrenceMetaListB[j];
+                        
                         // ensure we are not testing the same object which can be in both vectors
                         // if Class Id A and B are specified to be the same.
                         if (iterA != iterB)
                         {
                             // check each in turn for any frame overlap
-                            GeosRectangle rectA(iterA->rect_params);
-                            GeosRectangle rectB(iterB->rect_params);
-                            if (rectA.Overlaps(rectB))
+                            if (GeometryRectsOverlap(iterA->rect_params,
+                                iterB->rect_params))
                             {
-                                // event has been triggered
+                                // event has been triggered, unless suppressed 
+                                // by the rate limit
+                                if (!IncrementAndCheckTriggerCount(pFrameMeta, iterA))
+                                {
+                                    continue;
+                                }
                                 m_occurrences++;
-                                IncrementAndCheckTriggerCount();
                                 
                                  // update the total event count static variable
                                 s_eventCount++;
@@ -3226,9 +4612,9 @@ namespace DSL
                                     
                                     // Invoke each action twice, once for each object 
                                     // in the tested pair
-                                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                                    InvokeAction(pOdeAction, 
                                         pBuffer, displayMetaData, pFrameMeta, iterA);
-                                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                                    InvokeAction(pOdeAction, 
                                         pBuffer, displayMetaData, pFrameMeta, iterB);
                                 }
                                 if (m_eventLimit and m_triggered >= m_eventLimit)
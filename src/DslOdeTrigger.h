@@ -29,7 +29,9 @@ THE SOFTWARE.
 #include "DslApi.h"
 #include "DslOdeBase.h"
 #include "DslOdeTrackedObject.h"
+#include "DslOdeStats.h"
 #include "DslDisplayTypes.h"
+#include "DslGeometry.h"
 
 namespace DSL
 {
@@ -68,6 +70,18 @@ namespace DSL
         std::shared_ptr<CustomOdeTrigger>(new CustomOdeTrigger(name, \
             source, classId, limit, clientChecker, clientPostProcessor, clientData))
 
+    #define DSL_ODE_TRIGGER_CUSTOM_BATCH_PTR std::shared_ptr<CustomBatchOdeTrigger>
+    #define DSL_ODE_TRIGGER_CUSTOM_BATCH_NEW(name, \
+    source, classId, limit, clientChecker, clientData) \
+        std::shared_ptr<CustomBatchOdeTrigger>(new CustomBatchOdeTrigger(name, \
+            source, classId, limit, clientChecker, clientData))
+
+    #define DSL_ODE_TRIGGER_COMPOSITE_PTR std::shared_ptr<CompositeOdeTrigger>
+    #define DSL_ODE_TRIGGER_COMPOSITE_NEW(name, \
+    source, classId, limit, compositeOperator) \
+        std::shared_ptr<CompositeOdeTrigger>(new CompositeOdeTrigger(name, \
+            source, classId, limit, compositeOperator))
+
     #define DSL_ODE_TRIGGER_COUNT_PTR std::shared_ptr<CountOdeTrigger>
     #define DSL_ODE_TRIGGER_COUNT_NEW(name, source, classId, limit, minimum, maximum) \
         std::shared_ptr<CountOdeTrigger> (new CountOdeTrigger(name, \
@@ -138,6 +152,168 @@ namespace DSL
 
     // *****************************************************************************
 
+    // forward declarations - see DslOdeAction.h and DslOdeArea.h
+    class OdeAction;
+    class OdeArea;
+
+    /**
+     * @struct OdeTriggerCriteria
+     * @brief Immutable snapshot of a Trigger's object criteria. A new snapshot
+     * is published by the client API on each property change, while the 
+     * streaming thread reads the current snapshot without locking.
+     */
+    struct OdeTriggerCriteria
+    {
+        /**
+         * @brief class id filter, DSL_ODE_ANY_CLASS to disable.
+         */
+        uint classId;
+        
+        /**
+         * @brief minimum and maximum inference confidence, 0 to disable.
+         */
+        float minConfidence;
+        float maxConfidence;
+        
+        /**
+         * @brief minimum and maximum tracker confidence, 0 to disable.
+         */
+        float minTrackerConfidence;
+        float maxTrackerConfidence;
+        
+        /**
+         * @brief minimum and maximum bbox dimensions, 0 to disable.
+         */
+        float minWidth;
+        float minHeight;
+        float maxWidth;
+        float maxHeight;
+        
+        /**
+         * @brief if true, only frames with bInferDone set are processed.
+         */
+        bool inferDoneOnly;
+        
+        /**
+         * @brief the Trigger's Areas in add-order.
+         */
+        std::vector<std::shared_ptr<OdeArea>> areas;
+    };
+
+    /**
+     * @struct OdeTriggerSourceState
+     * @brief Frame and event counting state for a single source, used by
+     * Triggers with per-source state enabled.
+     */
+    struct OdeTriggerSourceState
+    {
+        /**
+         * @brief trigger count for the source.
+         */
+        uint64_t triggered = 0;
+        
+        /**
+         * @brief number of frames processed for the source.
+         */
+        uint64_t frameCount = 0;
+        
+        /**
+         * @brief number of occurrences in the source's current frame.
+         */
+        uint occurrences = 0;
+        
+        /**
+         * @brief current number of the source's frames in the current interval.
+         */
+        uint intervalCounter = 0;
+        
+        /**
+         * @brief true if the source's current frame is to be skipped.
+         */
+        bool skipFrame = false;
+    };
+
+    /**
+     * @brief number of tracked objects remembered for debounce before stale
+     * entries - older than the debounce window - are purged.
+     */
+    #define DSL_ODE_TRIGGER_DEBOUNCE_PURGE_SIZE 1024
+
+    /**
+     * @struct OdeTriggerRateLimitState
+     * @brief Token-bucket and debounce state for a single source, used by 
+     * Triggers with a rate limit or debounce window set.
+     */
+    struct OdeTriggerRateLimitState
+    {
+        /**
+         * @brief tokens currently available in the source's bucket.
+         */
+        double tokens = 0;
+        
+        /**
+         * @brief monotonic time of the last bucket refill in microseconds,
+         * 0 if the bucket has yet to be used.
+         */
+        int64_t refillTime = 0;
+        
+        /**
+         * @brief monotonic time in microseconds of the last event for each 
+         * tracking id of the source.
+         */
+        std::unordered_map<uint64_t, int64_t> lastEventTimes;
+        
+        /**
+         * @brief size of lastEventTimes that will trigger the next purge.
+         */
+        size_t purgeSize = DSL_ODE_TRIGGER_DEBOUNCE_PURGE_SIZE;
+    };
+
+    /**
+     * @struct OdePredicateContext
+     * @brief Per-object state shared by all predicates of a Composite Trigger
+     * while a single object is evaluated. Area membership is computed once per
+     * Area for the object, and reused by every predicate that shares the Area.
+     */
+    struct OdePredicateContext
+    {
+        /**
+         * @brief Frame that holds the object under test.
+         */
+        NvDsFrameMeta* pFrameMeta = nullptr;
+        
+        /**
+         * @brief object under test.
+         */
+        NvDsObjectMeta* pObjectMeta = nullptr;
+        
+        /**
+         * @brief all objects in the frame from the Composite's source, used
+         * by predicates that test the object against others, e.g. Distance.
+         */
+        const std::vector<NvDsObjectMeta*>* pFrameObjects = nullptr;
+        
+        /**
+         * @brief cached Area membership for pObjectMeta, one entry per Area
+         * tested. Cleared by Reset for each new object.
+         */
+        std::vector<std::pair<const OdeArea*, bool>> areaResults;
+        
+        /**
+         * @brief Resets the context for a new object under test.
+         * @param[in] pObjectMeta the new object to test.
+         */
+        void Reset(NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief Checks if the bbox of the object under test is inside a given
+         * Area, computing the result only on first use for the object.
+         * @param[in] pArea Area to test against.
+         * @return true if the bbox is inside the Area, false otherwise.
+         */
+        bool IsBboxInside(const std::shared_ptr<OdeArea>& pArea);
+    };
+
     /**
      * @class OdeTrigger
      * @brief Implements a super/abstract class for all ODE Triggers
@@ -151,10 +327,58 @@ namespace DSL
         ~OdeTrigger();
 
         /**
-         * @brief total count of all events
+         * @brief total count of all events. Atomic as Triggers may be 
+         * processed concurrently by an ODE Pad Probe Handler in parallel mode.
          */
-        static uint64_t s_eventCount;
-        
+        static std::atomic<uint64_t> s_eventCount;
+
+        /**
+         * @brief version counter incremented each time a Trigger's class-id or
+         * source-id filter changes. ODE Pad Probe Handlers compare against this
+         * value to know when to re-compile their Trigger dispatch tables.
+         */
+        static std::atomic<uint64_t> s_dispatchVersion;
+
+        /**
+         * @brief Gets the class-id filters for this Trigger, used by the parent
+         * ODE Pad Probe Handler to bucket the Trigger by class-id.
+         * @param[out] classIds vector to append the Trigger's class-ids to.
+         * DSL_ODE_ANY_CLASS is returned if the Trigger has no class filter.
+         */
+        virtual void GetDispatchClassIds(std::vector<uint>& classIds);
+
+        /**
+         * @brief Gets the source-id filter for this Trigger, used by the parent
+         * ODE Pad Probe Handler to bucket the Trigger by source-id.
+         * @return the resolved source-id filter, or -1 if the Trigger has no
+         * source filter or the filter has yet to be resolved.
+         */
+        int GetDispatchSourceId();
+
+        /**
+         * @brief Gets the Actions owned by this Trigger that require ordered
+         * or serial execution, used by the parent ODE Pad Probe Handler to 
+         * serialize frames when in parallel mode.
+         * @param[out] actions vector to append the ordered/serial Actions to.
+         */
+        void GetOrderedActions(std::vector<OdeAction*>& actions);
+
+        /**
+         * @brief Query to determine if this Trigger tracks objects, i.e. uses
+         * the parent ODE Pad Probe Handler's Tracked Object Store.
+         * @return true if the Trigger tracks objects, false otherwise.
+         */
+        virtual bool IsTracking(){return false;};
+
+        /**
+         * @brief Sets the Tracked Object Store for this Trigger, called by the 
+         * parent ODE Pad Probe Handler so that all of its Tracking Triggers 
+         * share a single store updated once per object per frame.
+         * @param[in] pTrackStore shared store to use, or nullptr to use a 
+         * store owned by this Trigger.
+         */
+        virtual void SetTrackStore(std::shared_ptr<TrackedObjectStore> pTrackStore){};
+
         /**
          * @brief Function to check a given Object Meta data structure for the 
          * occurence of an event and to invoke all Event Actions owned by the event
@@ -165,9 +389,42 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         virtual bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta){return false;};
 
+        /**
+         * @brief Function to evaluate this Trigger as a predicate of a Composite
+         * Trigger. The default checks the Trigger's criteria, Areas, source-id
+         * and inference-id filters. Actions, limits and intervals are not used.
+         * @param[in] context shared context for the object under test.
+         * @return true if the object satisfies the predicate, false otherwise.
+         */
+        virtual bool CheckForPredicate(OdePredicateContext& context);
+
+        /**
+         * @brief Query to determine if this Trigger keeps state when evaluated
+         * as a predicate, in which case it must be evaluated for every object
+         * and never short-circuited by the Composite Trigger.
+         * @return true if the predicate is stateful, false otherwise.
+         */
+        virtual bool IsStatefulPredicate(){return false;};
+
+        /**
+         * @brief Function called by the parent Composite Trigger once the 
+         * current frame has been evaluated, to allow a stateful predicate 
+         * to update its state.
+         * @param[in] pFrameMeta pointer to NvDsFrameMeta data for post processing
+         */
+        virtual void PostProcessPredicate(NvDsFrameMeta* pFrameMeta){};
+
+        /**
+         * @brief Gets all predicates, direct and nested, evaluated by this 
+         * Trigger, used by the parent ODE Pad Probe Handler to serialize frames
+         * that share a predicate when in parallel mode.
+         * @param[out] predicates vector to append the predicates to.
+         */
+        virtual void GetPredicates(std::vector<OdeTrigger*>& predicates){};
+
         /**
          * @brief Function called to pre process the current frame data prior to 
          * checking for Occurrences
@@ -176,7 +433,7 @@ namespace DSL
          * @param[in] pFrameMeta pointer to NvDsFrameMeta data for pre processing
          */
         virtual void PreProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta);
         
         /**
@@ -187,9 +444,17 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         virtual uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta);
 
+        /**
+         * @brief Function called by the parent ODE Pad Probe Handler once all
+         * Triggers have post-processed the current frame. Calls PostProcessFrame
+         * for each child ODE Action that requires it, e.g. to complete a batch.
+         * @param[in] pFrameMeta pointer to NvDsFrameMeta data just processed.
+         */
+        void PostProcessFrameActions(NvDsFrameMeta* pFrameMeta);
+
         /**
          * @brief Adds an ODE Action as a child to this OdeTrigger
          * @param[in] pChild pointer to ODE Action to add
@@ -497,11 +762,182 @@ namespace DSL
          */
         void SetInterval(uint interval);
         
+        /**
+         * @brief Gets the current rate limit for this Trigger.
+         * @param[out] rate maximum sustained rate of events per second for 
+         * each source, 0 if disabled (default).
+         * @param[out] burst maximum number of events for each source that 
+         * can be triggered at once before the rate applies.
+         */
+        void GetRateLimit(float* rate, uint* burst);
+        
+        /**
+         * @brief Sets the rate limit for this Trigger. Events over the limit 
+         * are suppressed before any ODE Action is invoked. Clears the current
+         * rate limit and debounce state.
+         * @param[in] rate maximum sustained rate of events per second for 
+         * each source, 0 to disable.
+         * @param[in] burst maximum number of events for each source that 
+         * can be triggered at once before the rate applies, must be > 0 if
+         * rate is set.
+         */
+        void SetRateLimit(float rate, uint burst);
+        
+        /**
+         * @brief Gets the current debounce window for this Trigger.
+         * @return minimum time between events for the same tracking id in 
+         * milliseconds, 0 if disabled (default).
+         */
+        uint GetDebounce();
+        
+        /**
+         * @brief Sets the debounce window for this Trigger. Events for a 
+         * tracked object within the window of its previous event are 
+         * suppressed before any ODE Action is invoked. Clears the current
+         * rate limit and debounce state.
+         * @param[in] window minimum time between events for the same 
+         * tracking id in milliseconds, 0 to disable.
+         */
+        void SetDebounce(uint window);
+        
+        /**
+         * @brief Gets the current per-source state setting for this Trigger.
+         * @return true if frame and event counts are maintained per source, 
+         * false if shared by all sources (default).
+         */
+        bool GetPerSourceStateEnabled();
+        
+        /**
+         * @brief Sets the per-source state setting for this Trigger. 
+         * Changing the setting clears all frame and event counts.
+         * @param[in] enabled set to true to maintain the interval counter, frame
+         * count, and event count for each source separately, false to share 
+         * the counts for all sources.
+         */
+        void SetPerSourceStateEnabled(bool enabled);
+        
+        /**
+         * @brief Gets the current stats enabled setting for this Trigger.
+         * @return true if stats collection is enabled, false otherwise.
+         */
+        bool GetStatsEnabled();
+        
+        /**
+         * @brief Sets the stats enabled setting for this Trigger. Called by
+         * the parent ODE Handler. Enabling stats clears all previous stats.
+         * @param[in] enabled set to true to enable and clear stats, false
+         * to disable.
+         */
+        void SetStatsEnabled(bool enabled);
+        
+        /**
+         * @brief Gets the latency histogram for one of the Trigger's operations.
+         * Lock-free, called by the parent ODE Handler on each operation.
+         * @param[in] operation one of the DSL_ODE_STATS_* operation constants.
+         * @return histogram to record to, NULL if stats are disabled.
+         */
+        OdeLatencyHistogram* GetLatencyHistogram(uint operation)
+        {
+            return (m_statsEnabled.load(std::memory_order_acquire))
+                ? &m_pStats->latencies[operation] : NULL;
+        };
+        
+        /**
+         * @brief Gets the current stats for this Trigger.
+         * @param[out] stats current latency and occurrence statistics, 
+         * all zero if stats have never been enabled.
+         */
+        void GetStats(dsl_ode_trigger_stats* stats);
+        
     protected:
     
         /**
-         * @brief Common function to check if an Object's meta data meets the 
-         * min criteria for ODE occurrence.
+         * @brief Calls on an ODE Action to handle an occurrence, timing the 
+         * call if stats are enabled.
+         * @param[in] pOdeAction ODE Action to handle the occurrence.
+         * @param[in] pBuffer pointer to the batched stream buffer.
+         * @param[in] displayMetaData vector of display meta for the frame.
+         * @param[in] pFrameMeta pointer to the Frame Meta for the occurrence.
+         * @param[in] pObjectMeta pointer to the Object Meta for the occurrence,
+         * NULL for frame level occurrences.
+         */
+        void InvokeAction(const std::shared_ptr<OdeAction>& pOdeAction,
+            GstBuffer* pBuffer, DisplayMetaAllocator& displayMetaData,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+    
+        /**
+         * @brief Loads the per-source state for a given source-id into the 
+         * Trigger's working state, saving the working state for the previous
+         * source-id. Does nothing if per-source state is disabled. Called
+         * on the start of each frame.
+         * @param[in] sourceId source-id of the frame to process.
+         */
+        void LoadSourceState(uint sourceId);
+    
+        /**
+         * @brief Publishes a new criteria snapshot from the Trigger's current
+         * property values. Must be called with the m_propertyMutex locked on 
+         * any change to the criteria properties or Areas.
+         */
+        void PublishCriteria();
+        
+        /**
+         * @brief Rebuilds the list of child ODE Actions that require 
+         * PostProcessFrame. Must be called with the m_propertyMutex locked 
+         * on any change to the child Actions.
+         */
+        void updateFrameActions();
+        
+        /**
+         * @brief Frees all criteria snapshots retired since the last call. 
+         * Called on the start of each frame, once no object checks using a
+         * retired snapshot can be in progress.
+         */
+        void ReleaseRetiredCriteria();
+        
+        /**
+         * @brief Common lock-free function to check if an Object's meta data 
+         * meets the Trigger's criteria snapshot - class-id, confidence, 
+         * dimensions, and infer-done-only. Areas are checked separately.
+         * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data - 
+         * the frame that holds the Object Meta
+         * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to test 
+         * @return true if the criteria is met, false otherwise
+         */
+        bool CheckForCriteria(NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Common lock-free function to check if an Object's meta data 
+         * meets the Trigger's criteria snapshot for a given class-id.
+         * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data - 
+         * the frame that holds the Object Meta
+         * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to test 
+         * @param[in] classId class-id filter to use in place of the snapshot's.
+         * @return true if the criteria is met, false otherwise
+         */
+        bool CheckForCriteria(NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta, uint classId);
+
+        /**
+         * @brief Common lock-free function to check if an Object's meta data 
+         * meets a given criteria snapshot for a given class-id.
+         * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data - 
+         * the frame that holds the Object Meta
+         * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to test 
+         * @param[in] pCriteria criteria snapshot, loaded once by the caller.
+         * @param[in] classId class-id filter to use in place of the snapshot's.
+         * @return true if the criteria is met, false otherwise
+         */
+        bool CheckForCriteria(NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta, const OdeTriggerCriteria* pCriteria,
+            uint classId);
+
+        /**
+         * @brief Common function to check if the Trigger's state meets the 
+         * min criteria for ODE occurrence - enabled, interval, limits, 
+         * source-id and inference-id. Must be called with the m_propertyMutex
+         * locked. The object criteria is checked with CheckForCriteria.
          * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data - 
          * the frame that holds the Object Meta
          * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to test 
@@ -512,14 +948,23 @@ namespace DSL
             NvDsObjectMeta* pObjectMeta);
 
         /**
-         * @brief Common function to check if an Object's bbox fails within
-         * one of the Triggers Areas
+         * @brief Common lock-free function to check if an Object's bbox fails 
+         * within one of the Triggers Areas, using the criteria snapshot
          * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to test 
          * for within
          * @return true if the bbox is within one of the trigger's area, false otherwise
          */
         bool CheckForInside(NvDsObjectMeta* pObjectMeta);
         
+        /**
+         * @brief Common lock-free function to check if the object under test 
+         * is within one of the Trigger's Areas, using the context's cached 
+         * Area membership.
+         * @param[in] context shared context for the object under test.
+         * @return true if the bbox is within one of the trigger's area, false otherwise
+         */
+        bool CheckForInside(OdePredicateContext& context);
+        
         /**
          * @brief Common function to check if a Frame's source id meets the 
          * criteria for ODE occurrence.
@@ -538,12 +983,32 @@ namespace DSL
          */
         bool CheckForInferId(int inferId);
         
+        /**
+         * @brief Common function to check if an event for a given Frame and 
+         * Object is within the Trigger's rate limit and debounce window. 
+         * Consumes a token and records the event time if so. 
+         * Must be called with the m_propertyMutex locked.
+         * @param[in] pFrameMeta pointer to the Frame Meta for the event.
+         * @param[in] pObjectMeta pointer to the Object Meta for the event,
+         * NULL for frame level events which are not debounced.
+         * @return true if the event is allowed, false if suppressed.
+         */
+        bool CheckForRateLimit(NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta);
+        
         /**
          * @brief Increments the Trigger Occurrence counter and checks to see
          * if the count has been exceeded. If so, starts the reset timer if a 
-         * timeout value is set/enabled.
-         */
-        void IncrementAndCheckTriggerCount();
+         * timeout value is set/enabled. If the event fails the rate limit or
+         * debounce window, the count is left unchanged.
+         * @param[in] pFrameMeta pointer to the Frame Meta for the event.
+         * @param[in] pObjectMeta pointer to the Object Meta for the event,
+         * NULL for frame level events.
+         * @return true if the event is counted, false if suppressed. Callers
+         * must skip all occurrence bookkeeping and Actions when false.
+         */
+        bool IncrementAndCheckTriggerCount(NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta);
 
         /**
          * @brief Index variable to incremment/assign on ODE Area add.
@@ -575,6 +1040,12 @@ namespace DSL
          */
         std::map <uint, DSL_BASE_PTR> m_pOdeActionsIndexed;
         
+        /**
+         * @brief child ODE Actions that require PostProcessFrame, in add-order.
+         * Non-owning pointers.
+         */
+        std::vector<OdeAction*> m_pFrameActions;
+        
         /**
          * @brief optional metric accumulator owned by the ODE Trigger.
          */
@@ -617,6 +1088,77 @@ namespace DSL
          */
          bool m_skipFrame;
          
+        /**
+         * @brief true if the counting state is maintained per source.
+         */
+        bool m_perSourceStateEnabled;
+        
+        /**
+         * @brief per-source state keyed by source-id, only used when
+         * m_perSourceStateEnabled is true. Source-ids are sparse, i.e. the
+         * unique Pipeline id in the upper bits, so can't be used as an index.
+         */
+        std::unordered_map<uint, OdeTriggerSourceState> m_sourceStates;
+        
+        /**
+         * @brief source-id of the state currently loaded into the working 
+         * state, -1 if none.
+         */
+        int m_loadedSourceId;
+        
+        /**
+         * @brief maximum sustained rate of events per second per source, 
+         * 0 if disabled.
+         */
+        float m_rateLimit;
+        
+        /**
+         * @brief token-bucket size - maximum burst of events - per source.
+         */
+        uint m_rateLimitBurst;
+        
+        /**
+         * @brief minimum time between events for the same tracking id in 
+         * milliseconds, 0 if disabled.
+         */
+        uint m_debounceWindow;
+        
+        /**
+         * @brief rate limit and debounce state keyed by sparse source-id.
+         */
+        std::unordered_map<uint, OdeTriggerRateLimitState> m_rateLimitStates;
+        
+        /**
+         * @brief current criteria snapshot, read by the streaming thread 
+         * without locking. Owned by this Trigger.
+         */
+        std::atomic<const OdeTriggerCriteria*> m_pCriteria;
+        
+        /**
+         * @brief criteria snapshots replaced since the start of the last frame.
+         * Protected by the m_propertyMutex.
+         */
+        std::vector<std::unique_ptr<const OdeTriggerCriteria>> m_retiredCriteria;
+        
+        /**
+         * @brief true if m_retiredCriteria is not empty. Checked on the start
+         * of each frame without locking.
+         */
+        std::atomic<bool> m_criteriaRetired;
+        
+        /**
+         * @brief latency and occurrence stats, created on first enable and
+         * kept for the life of the Trigger so that the streaming thread
+         * never records to a deleted object.
+         */
+        std::unique_ptr<OdeTriggerStats> m_pStats;
+        
+        /**
+         * @brief true if stats collection is enabled. Checked on each 
+         * operation without locking.
+         */
+        std::atomic<bool> m_statsEnabled;
+         
     public:
     
         // access made public for performance reasons
@@ -768,7 +1310,7 @@ namespace DSL
          * @param[in] pFrameMeta pointer to NvDsFrameMeta data for pre-processing
          */
         void PreProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta);
 
         /**
@@ -778,7 +1320,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, NvDsFrameMeta* pFrameMeta);
+            DisplayMetaAllocator& displayMetaData, NvDsFrameMeta* pFrameMeta);
         
     private:
     
@@ -807,7 +1349,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
     private:
@@ -830,7 +1372,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -840,7 +1382,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -860,11 +1402,24 @@ namespace DSL
          * @brief Overrides the base Reset in order to clear m_trackedObjectsPerSource
          */
         void Reset();
+        
+        /**
+         * @brief Overrides the base IsTracking to return true.
+         */
+        bool IsTracking(){return true;};
+        
+        /**
+         * @brief Overrides the base SetTrackStore to set the store for 
+         * m_trackedObjectsPerSource. All currently tracked objects are cleared.
+         * @param[in] pTrackStore shared store to use, or nullptr to use a 
+         * store owned by this Trigger.
+         */
+        void SetTrackStore(std::shared_ptr<TrackedObjectStore> pTrackStore);
 
     protected:
 
         /**
-         * @brief map of tracked objects per source - Key = source Id
+         * @brief tracked objects for all sources - Key = source Id and tracking Id
          */
         std::shared_ptr<TrackedObjects> m_pTrackedObjectsPerSource;
     
@@ -889,7 +1444,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -899,7 +1454,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, NvDsFrameMeta* pFrameMeta);
+            DisplayMetaAllocator& displayMetaData, NvDsFrameMeta* pFrameMeta);
 
         /**
          * @brief Gets the current max-trace-point setting for this CrossOdeTrigger.
@@ -1046,7 +1601,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
         /**
@@ -1057,7 +1612,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
             
     private:
@@ -1099,7 +1654,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1109,7 +1664,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1140,7 +1695,7 @@ namespace DSL
          */
 
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         /**
          * @brief Function to call the client provided callback to post process the frame 
@@ -1149,7 +1704,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
         
     private:
@@ -1171,6 +1726,259 @@ namespace DSL
     
     };    
 
+    /**
+     * @class CustomBatchOdeTrigger
+     * @brief Collects the frame's objects that meet the Trigger's criteria and
+     * calls the client once per frame with a packed array of the objects.
+     */
+    class CustomBatchOdeTrigger : public OdeTrigger
+    {
+    public:
+    
+        CustomBatchOdeTrigger(const char* name, const char* source, 
+            uint classId, uint limit, 
+            dsl_ode_check_for_occurrences_cb clientChecker, void* clientData);
+        
+        ~CustomBatchOdeTrigger();
+
+        /**
+         * @brief Function to check a given Object Meta data structure for the 
+         * Trigger's min criteria. Objects that pass are packed for the client's
+         * check on PostProcessFrame.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame 
+         * Meta - that holds the Object Meta
+         * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data - the frame 
+         * that holds the Object Meta
+         * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to check
+         * @return true if the Object was added to the frame's batch, false otherwise
+         */
+        bool CheckForOccurrence(GstBuffer* pBuffer, 
+            DisplayMetaAllocator& displayMetaData,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Function to call the client provided callback with the frame's
+         * batch of objects, and to invoke all ODE Actions for each object the
+         * client flags as an occurrence.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta
+         * @param[in] pFrameMeta Frame meta data to post process.
+         * @return the number of ODE Occurrences triggered on post process
+         */
+        uint PostProcessFrame(GstBuffer* pBuffer, 
+            DisplayMetaAllocator& displayMetaData, 
+            NvDsFrameMeta* pFrameMeta);
+        
+    private:
+    
+        /**
+         * @brief client provided Check for Occurrences callback
+         */
+        dsl_ode_check_for_occurrences_cb m_clientChecker;
+        
+        /**
+         * @brief client data to be returned to the client on callback
+         */
+        void* m_clientData;
+        
+        /**
+         * @brief packed data for the current frame's objects, capacity is 
+         * kept from frame to frame.
+         */
+        std::vector<dsl_ode_batch_object> m_batchObjects;
+        
+        /**
+         * @brief Object Meta for each entry in m_batchObjects.
+         */
+        std::vector<NvDsObjectMeta*> m_batchObjectMeta;
+        
+        /**
+         * @brief occurrence bitmask written by the client.
+         */
+        std::vector<uint64_t> m_batchOccurrences;
+    };
+
+    /**
+     * @struct OdeCompositePredicate
+     * @brief A child predicate of a Composite Trigger.
+     */
+    struct OdeCompositePredicate
+    {
+        /**
+         * @brief the Trigger evaluated as a predicate.
+         */
+        DSL_ODE_TRIGGER_PTR pTrigger;
+        
+        /**
+         * @brief if true, the predicate's result is inverted.
+         */
+        bool negate;
+        
+        /**
+         * @brief if true, the predicate is never short-circuited.
+         */
+        bool stateful;
+    };
+
+    /**
+     * @class CompositeOdeTrigger
+     * @brief Combines child Triggers, used as predicates only, with an AND/OR
+     * operator. All predicates are evaluated for each object in a single pass 
+     * on PostProcessFrame, and the combined result is resolved before any of 
+     * the Composite's Actions are invoked.
+     */
+    class CompositeOdeTrigger : public OdeTrigger
+    {
+    public:
+    
+        CompositeOdeTrigger(const char* name, const char* source, 
+            uint classId, uint limit, uint compositeOperator);
+        
+        ~CompositeOdeTrigger();
+
+        /**
+         * @brief Adds a Trigger as a child predicate of this Composite.
+         * @param[in] pChild pointer to the ODE Trigger to add.
+         * @param[in] negate if true, the predicate's result is inverted.
+         * @return true if successful, false otherwise
+         */
+        bool AddPredicate(DSL_BASE_PTR pChild, bool negate);
+        
+        /**
+         * @brief Removes a child predicate from this Composite.
+         * @param[in] pChild pointer to the ODE Trigger to remove.
+         * @return true if successful, false otherwise
+         */
+        bool RemovePredicate(DSL_BASE_PTR pChild);
+
+        /**
+         * @brief Overrides the base GetDispatchClassIds to add the class-ids
+         * of all child predicates.
+         * @param[out] classIds vector to append the Trigger's class-ids to.
+         */
+        void GetDispatchClassIds(std::vector<uint>& classIds);
+
+        /**
+         * @brief Overrides the base GetPredicates to add all child predicates
+         * and their nested predicates.
+         * @param[out] predicates vector to append the predicates to.
+         */
+        void GetPredicates(std::vector<OdeTrigger*>& predicates);
+
+        /**
+         * @brief Overrides the base CheckForPredicate to evaluate the combined
+         * expression of this Composite's predicates when the Composite is 
+         * itself a predicate of another Composite.
+         * @param[in] context shared context for the object under test.
+         * @return true if the object satisfies the Composite's own criteria 
+         * and its combined expression, false otherwise.
+         */
+        bool CheckForPredicate(OdePredicateContext& context);
+
+        /**
+         * @brief A nested Composite is stateful if any of its predicates are.
+         * @return true if any predicate is stateful, false otherwise.
+         */
+        bool IsStatefulPredicate();
+
+        /**
+         * @brief Forwards the end of frame to all stateful predicates.
+         * @param[in] pFrameMeta pointer to NvDsFrameMeta data for post processing
+         */
+        void PostProcessPredicate(NvDsFrameMeta* pFrameMeta);
+
+        /**
+         * @brief Function to collect the frame's objects for evaluation on 
+         * PostProcessFrame. All objects from the Composite's source are kept 
+         * for predicates that test against other objects.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame 
+         * Meta - that holds the Object Meta
+         * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data - the frame 
+         * that holds the Object Meta
+         * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to check
+         * @return true if the Object meets the Composite's own criteria.
+         */
+        bool CheckForOccurrence(GstBuffer* pBuffer, 
+            DisplayMetaAllocator& displayMetaData,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Function to evaluate the child predicates for each candidate 
+         * object and to invoke all ODE Actions for each object that satisfies
+         * the combined expression.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta
+         * @param[in] pFrameMeta Frame meta data to post process.
+         * @return the number of ODE Occurrences triggered on post process
+         */
+        uint PostProcessFrame(GstBuffer* pBuffer, 
+            DisplayMetaAllocator& displayMetaData, 
+            NvDsFrameMeta* pFrameMeta);
+        
+    private:
+    
+        /**
+         * @brief Takes a snapshot of the child predicates under the property
+         * mutex, and updates each predicate's stateful flag with the mutex 
+         * released, as nested predicates can change after they are added.
+         * @param[out] snapshot vector to copy the predicates into.
+         */
+        void snapshotPredicates(std::vector<OdeCompositePredicate>& snapshot);
+    
+        /**
+         * @brief Evaluates the combined expression for the object under test.
+         * Called with the property mutex released, as each predicate locks 
+         * its own property mutex.
+         * @param[in] predicates snapshot of the child predicates to evaluate.
+         * @param[in] context shared context for the object under test.
+         * @return the combined result of all child predicates.
+         */
+        bool EvaluatePredicates(
+            const std::vector<OdeCompositePredicate>& predicates,
+            OdePredicateContext& context);
+    
+        /**
+         * @brief one of the DSL_ODE_COMPOSITE_OPERATOR constants.
+         */
+        uint m_operator;
+        
+        /**
+         * @brief map of child predicates by name.
+         */
+        std::map<std::string, DSL_BASE_PTR> m_pPredicates;
+        
+        /**
+         * @brief child predicates in add-order.
+         */
+        std::vector<OdeCompositePredicate> m_predicatesIndexed;
+        
+        /**
+         * @brief snapshot of the child predicates taken on PostProcessFrame,
+         * reused from frame to frame.
+         */
+        std::vector<OdeCompositePredicate> m_predicatesSnapshot;
+        
+        /**
+         * @brief snapshot of the child predicates taken when this Composite 
+         * is evaluated as a predicate of another Composite.
+         */
+        std::vector<OdeCompositePredicate> m_nestedSnapshot;
+        
+        /**
+         * @brief all objects in the current frame from the Composite's source.
+         */
+        std::vector<NvDsObjectMeta*> m_frameObjects;
+        
+        /**
+         * @brief objects in the current frame that meet the Composite's own
+         * criteria.
+         */
+        std::vector<NvDsObjectMeta*> m_candidates;
+        
+        /**
+         * @brief reusable context for the object under test.
+         */
+        OdePredicateContext m_context;
+    };
+
     class MinimumOdeTrigger : public OdeTrigger
     {
     public:
@@ -1190,7 +1998,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1201,7 +2009,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1232,7 +2040,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1243,7 +2051,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaAllocator& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1290,7 +2098,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1302,9 +2110,30 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaAllocator& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
 
+        /**
+         * @brief Overrides the base CheckForPredicate to also track the object 
+         * and test its duration against the Trigger's minimum and maximum.
+         * @param[in] context shared context for the object under test.
+         * @return true if the object has been tracked for a duration within 
+         * range, false otherwise.
+         */
+        bool CheckForPredicate(OdePredicateContext& context);
+
+        /**
+         * @brief Persistence predicates track objects from frame to frame.
+         * @return true always.
+         */
+        bool IsStatefulPredicate(){return true;};
+
+        /**
+         * @brief Purges all tracked objects not in the current frame.
+         * @param[in] pFrameMeta pointer to NvDsFrameMeta data for post processing
+         */
+        void PostProcessPredicate(NvDsFrameMeta* pFrameMeta);
+
     private:
 
         /**
@@ -1354,7 +2183,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1365,7 +2194,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaAllocator& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1401,7 +2230,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1412,7 +2241,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaAllocator& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1445,7 +2274,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1456,7 +2285,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaAllocator& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1489,7 +2318,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1500,7 +2329,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaAllocator& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1535,7 +2364,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1546,7 +2375,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaAllocator& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1586,7 +2415,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1597,7 +2426,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1639,7 +2468,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1650,7 +2479,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1674,6 +2503,13 @@ namespace DSL
     
     };
 
+    /**
+     * @brief minimum number of object pairs to test in a frame before an AB 
+     * Trigger uses its GeometryGrid broad phase. Brute force is faster for 
+     * fewer pairs.
+     */
+    #define DSL_ODE_TRIGGER_BROAD_PHASE_MIN_PAIRS                       256
+
     class ABOdeTrigger : public OdeTrigger
     {
     public:
@@ -1693,7 +2529,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaAllocator& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1703,7 +2539,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         virtual uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
         /**
@@ -1722,6 +2558,13 @@ namespace DSL
          */
         void SetClassIdAB(uint classIdA, uint classIdB);
 
+        /**
+         * @brief Overrides the base GetDispatchClassIds to return both the
+         * Class A and Class B class-ids.
+         * @param[out] classIds vector to append the Trigger's class-ids to.
+         */
+        void GetDispatchClassIds(std::vector<uint>& classIds);
+
     protected:
 
         /**
@@ -1731,7 +2574,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         virtual uint PostProcessFrameA(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta) = 0;
 
         /**
@@ -1741,8 +2584,37 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         virtual uint PostProcessFrameAB(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta) = 0;
+            
+        /**
+         * @brief Gets the box used to index and query an object in the
+         * broad phase. Defaults to the object's rectangle.
+         * @param[in] pObjectMeta object to get the box for.
+         * @param[out] box the object's box.
+         */
+        virtual void GetBroadPhaseBox(NvDsObjectMeta* pObjectMeta, 
+            GeometryBox& box);
+        
+        /**
+         * @brief Builds the broad phase for the current frame if there are
+         * enough pairs to test, disables it otherwise.
+         * @param[in] objects list of objects to index.
+         * @param[in] numQueryObjects number of objects to be tested against
+         * the indexed objects.
+         * @param[in] margin distance to expand each query box by.
+         */
+        void BuildBroadPhase(const std::vector<NvDsObjectMeta*>& objects,
+            size_t numQueryObjects, double margin);
+            
+        /**
+         * @brief Gets the indices of the indexed objects that may pair with
+         * a given object, in ascending order, into m_pairCandidates. Gets 
+         * all indices if the broad phase is disabled.
+         * @param[in] pObjectMeta object to get the pair candidates for.
+         * @param[in] numObjects number of indexed objects.
+         */
+        void GetPairCandidates(NvDsObjectMeta* pObjectMeta, size_t numObjects);
 
         /**
          * @brief list of pointers to NvDsObjectMeta data for Class A
@@ -1772,6 +2644,31 @@ namespace DSL
          * @brief Class ID to for A objects for A-B distance calculation
          */
         uint m_classIdB;
+        
+        /**
+         * @brief true if the broad phase has been built for the current frame.
+         */
+        bool m_broadPhaseEnabled;
+        
+        /**
+         * @brief distance to expand each query box by for the current frame.
+         */
+        double m_broadPhaseMargin;
+        
+        /**
+         * @brief uniform grid of indexed objects, rebuilt for each frame.
+         */
+        GeometryGrid m_broadPhase;
+        
+        /**
+         * @brief reusable list of boxes for the indexed objects.
+         */
+        std::vector<GeometryBox> m_broadPhaseBoxes;
+        
+        /**
+         * @brief reusable list of pair candidates from GetPairCandidates.
+         */
+        std::vector<uint> m_pairCandidates;
     };
 
     class DistanceOdeTrigger : public ABOdeTrigger
@@ -1814,6 +2711,14 @@ namespace DSL
          */
         void SetTestParams(uint testPoint, uint testMethod);
         
+        /**
+         * @brief Overrides the base CheckForPredicate to test the object under
+         * test - as Class A - against all Class B objects in the frame.
+         * @param[in] context shared context for the object under test.
+         * @return true if the distance to any Class B object triggers, 
+         * false otherwise.
+         */
+        bool CheckForPredicate(OdePredicateContext& context);
 
     private:
 
@@ -1824,7 +2729,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrameA(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
         /**
@@ -1834,7 +2739,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrameAB(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     
@@ -1848,6 +2753,33 @@ namespace DSL
          */
         bool CheckDistance(NvDsObjectMeta* pObjectMetaA, 
             NvDsObjectMeta* pObjectMetaB);
+            
+        /**
+         * @brief Gets the minimum and maximum distance for a pair of objects
+         * based on the current m_testMethod setting.
+         * @param pObjectMetaA[in] pointer to Object A's meta data
+         * @param pObjectMetaB[in] pointer to Object B's meta data
+         * @param minimum[out] minimum distance in pixels.
+         * @param maximum[out] maximum distance in pixels.
+         */
+        void GetRangeInPixels(NvDsObjectMeta* pObjectMetaA, 
+            NvDsObjectMeta* pObjectMetaB, uint& minimum, uint& maximum);
+            
+        /**
+         * @brief Overrides the base GetBroadPhaseBox to return the test-point
+         * if the distance is measured point-to-point.
+         */
+        void GetBroadPhaseBox(NvDsObjectMeta* pObjectMeta, GeometryBox& box);
+        
+        /**
+         * @brief Builds the broad phase for the current frame, if the distance
+         * range is such that only pairs closer than the minimum can trigger.
+         * @param[in] objects list of objects to index.
+         * @param[in] queryObjects list of objects to be tested against the 
+         * indexed objects.
+         */
+        void BuildDistanceBroadPhase(const std::vector<NvDsObjectMeta*>& objects,
+            const std::vector<NvDsObjectMeta*>& queryObjects);
     
         
         /**
@@ -1889,7 +2821,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrameA(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
     
         /**
@@ -1899,7 +2831,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrameAB(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaAllocator& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
     };
 
@@ -25,7 +25,9 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslPadProbeHandler.h"
 #include "DslOdeTrigger.h"
+#include "DslOdeAction.h"
 #include "DslBintr.h"
+#include "DslTimerWheel.h"
 #include <gst-nvevent.h>
 
 namespace DSL
@@ -286,13 +288,128 @@ namespace DSL
 
     //--------------------------------------------------------------------------------
 
+    OdeFrameWorkerPool::OdeFrameWorkerPool(uint numWorkers)
+        : m_pTask(NULL)
+        , m_taskCount(0)
+        , m_nextTask(0)
+        , m_jobId(0)
+        , m_busyWorkers(0)
+        , m_stop(false)
+    {
+        LOG_FUNC();
+        
+        for (uint i = 0; i < numWorkers; i++)
+        {
+            m_workers.push_back(g_thread_new("ode-frame-worker", 
+                ode_frame_worker_thread, this));
+        }
+    }
+    
+    OdeFrameWorkerPool::~OdeFrameWorkerPool()
+    {
+        LOG_FUNC();
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+            m_stop = true;
+            g_cond_broadcast(&m_jobReadyCond);
+        }
+        for (const auto &ivec: m_workers)
+        {
+            g_thread_join(ivec);
+        }
+    }
+    
+    void OdeFrameWorkerPool::Run(uint count, const std::function<void(uint)>& task)
+    {
+        if (!count)
+        {
+            return;
+        }
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+            m_pTask = &task;
+            m_taskCount = count;
+            m_nextTask = 0;
+            m_jobId++;
+            g_cond_broadcast(&m_jobReadyCond);
+        }
+        
+        // The calling thread claims tasks as well, so the job completes even
+        // if no worker wakes in time.
+        ClaimTasks(count, task);
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+        
+        // Clearing the task stops late workers from joining this job. Then 
+        // wait for the workers still running a claimed task to finish.
+        m_pTask = NULL;
+        while (m_busyWorkers)
+        {
+            g_cond_wait(&m_workerIdleCond, &m_poolMutex);
+        }
+    }
+    
+    void OdeFrameWorkerPool::ClaimTasks(uint count, 
+        const std::function<void(uint)>& task)
+    {
+        for (uint i = m_nextTask++; i < count; i = m_nextTask++)
+        {
+            task(i);
+        }
+    }
+    
+    void OdeFrameWorkerPool::WorkerThread()
+    {
+        uint64_t lastJobId(0);
+        
+        g_mutex_lock(&m_poolMutex);
+        while (true)
+        {
+            while (!m_stop and (m_pTask == NULL or m_jobId == lastJobId))
+            {
+                g_cond_wait(&m_jobReadyCond, &m_poolMutex);
+            }
+            if (m_stop)
+            {
+                break;
+            }
+            lastJobId = m_jobId;
+            const std::function<void(uint)>* pTask = m_pTask;
+            uint count = m_taskCount;
+            m_busyWorkers++;
+            g_mutex_unlock(&m_poolMutex);
+            
+            ClaimTasks(count, *pTask);
+            
+            g_mutex_lock(&m_poolMutex);
+            m_busyWorkers--;
+            g_cond_signal(&m_workerIdleCond);
+        }
+        g_mutex_unlock(&m_poolMutex);
+    }
+
+    static gpointer ode_frame_worker_thread(gpointer pPool)
+    {
+        static_cast<OdeFrameWorkerPool*>(pPool)->WorkerThread();
+        
+        return NULL;
+    }
+
+    //--------------------------------------------------------------------------------
+
     OdePadProbeHandler::OdePadProbeHandler(const char* name)
         : PadProbeBufferHandler(name)
         , m_nextTriggerIndex(0)
         , m_displayMetaAllocSize(1)
+        , m_dispatchVersion(0)
+        , m_maxParallelWorkers(0)
+        , m_statsEnabled(false)
     {
         LOG_FUNC();
         
+        m_pTrackStore = std::shared_ptr<TrackedObjectStore>(
+            new TrackedObjectStore(DSL_ODE_TRACKED_OBJECT_MISSING_FROM_FRAME_MAX));
+        
         // Enable now
         if (!SetEnabled(true))
         {
@@ -321,6 +438,16 @@ namespace DSL
         // Add the child to the Indexed map 
         m_pChildrenIndexed[m_nextTriggerIndex] = pChild;
         
+        // new Triggers collect stats if enabled for this Handler
+        std::dynamic_pointer_cast<OdeTrigger>(pChild)->SetStatsEnabled(
+            m_statsEnabled);
+        
+        // Tracking Triggers share this Handler's Tracked Object Store
+        std::dynamic_pointer_cast<OdeTrigger>(pChild)->SetTrackStore(
+            m_pTrackStore);
+        
+        CompileDispatchTable();
+        
         return true;
     }
 
@@ -337,6 +464,11 @@ namespace DSL
         // Remove the the child from Indexed map
         m_pChildrenIndexed.erase(pChild->GetIndex());
         
+        // Tracking Triggers revert to a store of their own
+        std::dynamic_pointer_cast<OdeTrigger>(pChild)->SetTrackStore(nullptr);
+        
+        CompileDispatchTable();
+        
         return true;
     }
 
@@ -347,8 +479,16 @@ namespace DSL
         Base::RemoveAllChildren();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
         
+        // Tracking Triggers revert to a store of their own
+        for (const auto &imap: m_pChildrenIndexed)
+        {
+            std::dynamic_pointer_cast<OdeTrigger>(imap.second)->SetTrackStore(
+                nullptr);
+        }
         // Remove all children from Indexed map
         m_pChildrenIndexed.clear();
+        
+        CompileDispatchTable();
     }
 
     uint OdePadProbeHandler::GetDisplayMetaAllocSize()
@@ -366,6 +506,422 @@ namespace DSL
         m_displayMetaAllocSize = size;
     }
     
+    void OdePadProbeHandler::GetParallelMode(bool* enabled, uint* maxWorkers)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        *enabled = (m_pWorkerPool != NULL);
+        *maxWorkers = m_maxParallelWorkers;
+    }
+    
+    void OdePadProbeHandler::SetParallelMode(bool enabled, uint maxWorkers)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        m_maxParallelWorkers = maxWorkers;
+        
+        // stop and join the current workers, if any.
+        m_pWorkerPool.reset();
+
+        if (enabled)
+        {
+            uint numThreads = (maxWorkers) ? maxWorkers : g_get_num_processors();
+            
+            // the streaming thread is one of the threads used.
+            m_pWorkerPool = std::unique_ptr<OdeFrameWorkerPool>(
+                new OdeFrameWorkerPool(std::max(numThreads, 1u) - 1));
+
+            LOG_INFO("Parallel mode enabled with " << std::max(numThreads, 1u)
+                << " threads for ODE Handler '" << GetName() << "'");
+        }
+    }
+    
+    bool OdePadProbeHandler::GetStatsEnabled()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        return m_statsEnabled;
+    }
+    
+    void OdePadProbeHandler::SetStatsEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        if (enabled)
+        {
+            if (m_pStats)
+            {
+                m_pStats->Reset();
+            }
+            else
+            {
+                m_pStats = std::unique_ptr<OdeHandlerStats>(new OdeHandlerStats());
+            }
+        }
+        m_statsEnabled = enabled;
+        
+        for (const auto &ivec: m_triggers)
+        {
+            ivec->SetStatsEnabled(enabled);
+        }
+    }
+    
+    void OdePadProbeHandler::GetStats(dsl_pph_ode_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        *stats = {0};
+        
+        if (!m_pStats)
+        {
+            return;
+        }
+        m_pStats->batches.GetStats(&stats->batch);
+        stats->frames = m_pStats->frames;
+        
+        // total occurrences for all child Triggers
+        for (const auto &ivec: m_triggers)
+        {
+            dsl_ode_trigger_stats triggerStats;
+            ivec->GetStats(&triggerStats);
+            stats->occurrences += triggerStats.occurrences;
+        }
+        double seconds = GetSecondsSince(m_pStats->startTime);
+        stats->occurrences_per_sec = (seconds > 0) 
+            ? stats->occurrences/seconds : 0;
+    }
+    
+    void OdePadProbeHandler::CompileDispatchTable()
+    {
+        LOG_FUNC();
+        // internal - m_padHandlerMutex must be locked by the caller
+        
+        // read the version first so that any change made while compiling 
+        // will cause a re-compile on the next frame.
+        m_dispatchVersion = OdeTrigger::s_dispatchVersion;
+        
+        m_triggers.clear();
+        m_triggers.reserve(m_pChildrenIndexed.size());
+        
+        for (const auto &imap: m_pChildrenIndexed)
+        {
+            m_triggers.push_back(
+                std::dynamic_pointer_cast<OdeTrigger>(imap.second).get());
+        }
+        
+        // per-source tables will be rebuilt on first use
+        m_dispatchTables.clear();
+    }
+    
+    const OdeTriggerDispatchTable& OdePadProbeHandler::GetDispatchTable(
+        uint sourceId)
+    {
+        // internal - m_padHandlerMutex must be locked by the caller
+
+        auto ientry = m_dispatchTables.find(sourceId);
+        if (ientry != m_dispatchTables.end())
+        {
+            return ientry->second;
+        }
+        
+        LOG_INFO("Compiling ODE Trigger dispatch table for source-id = " 
+            << sourceId << " for ODE Handler '" << GetName() << "'");
+
+        OdeTriggerDispatchTable& table = m_dispatchTables[sourceId];
+
+        // Triggers that can match this source-id, with their class-ids,
+        // in add-order
+        std::vector<std::pair<OdeTrigger*, std::vector<uint>>> candidates;
+        
+        // unique set of class-ids filtered on by at least one candidate.
+        std::vector<uint> classIds;
+        
+        for (const auto &ivec: m_triggers)
+        {
+            int triggerSourceId = ivec->GetDispatchSourceId();
+            if (triggerSourceId != -1 and (uint)triggerSourceId != sourceId)
+            {
+                continue;
+            }
+            table.sourceTriggers.push_back(ivec);
+            table.tracking |= ivec->IsTracking();
+            candidates.push_back(std::make_pair(ivec, std::vector<uint>()));
+            ivec->GetDispatchClassIds(candidates.back().second);
+            
+            for (const auto &classId: candidates.back().second)
+            {
+                if (classId != DSL_ODE_ANY_CLASS and std::find(classIds.begin(),
+                    classIds.end(), classId) == classIds.end())
+                {
+                    classIds.push_back(classId);
+                }
+            }
+        }
+        
+        // Appends all candidates that match classId, or any class, to the 
+        // contiguous trigger vector and returns the [begin, end) range.
+        auto appendBucket = [&](uint classId) -> std::pair<uint, uint>
+        {
+            uint begin = table.triggers.size();
+            for (const auto &ivec: candidates)
+            {
+                const std::vector<uint>& ids = ivec.second;
+                if (std::find(ids.begin(), ids.end(), DSL_ODE_ANY_CLASS) != ids.end() or
+                    std::find(ids.begin(), ids.end(), classId) != ids.end())
+                {
+                    table.triggers.push_back(ivec.first);
+                }
+            }
+            return std::make_pair(begin, (uint)table.triggers.size());
+        };
+        
+        table.anyClassRange = appendBucket(DSL_ODE_ANY_CLASS);
+        
+        for (const auto &classId: classIds)
+        {
+            table.classRanges[classId] = appendBucket(classId);
+        }
+        return table;
+    }
+    
+    void OdePadProbeHandler::CheckFrameObjects(GstBuffer* pBuffer, 
+        DisplayMetaAllocator& displayMetaData, 
+        NvDsFrameMeta* pFrameMeta, const OdeTriggerDispatchTable& dispatchTable)
+    {
+        NvDsMetaList* pNextMeta = pFrameMeta->obj_meta_list;
+        
+        // For each detected object in the frame.
+        while (pNextMeta != NULL)
+        {
+            NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*) (pNextMeta->data);
+
+            // We need to advance the pointer now in case the object is removed
+            // from the frame meta by an action which will null the pObjectMeta 
+            // making pNextMeta in an invalid state an unable to increment. 
+            pNextMeta = pNextMeta->next;
+            
+            // check for valid object meta as it may have be nulled by
+            // a trigger with a remove action
+            if (pObjectMeta == NULL)
+            {
+                continue;
+            }
+            
+            // Only the Triggers that can match the object's class-id
+            const std::pair<uint, uint>& range = 
+                dispatchTable.GetRange(pObjectMeta->class_id);
+
+            // For each ODE Trigger owned by this ODE Manager, check for ODE
+            for (uint i = range.first; i < range.second; i++)
+            {
+                OdeTrigger* pOdeTrigger = dispatchTable.triggers[i];
+                try
+                {
+                    OdeLatencyTimer timer(pOdeTrigger->GetLatencyHistogram(
+                        DSL_ODE_STATS_CHECK_FOR_OCCURRENCE));
+                        
+                    pOdeTrigger->CheckForOccurrence(pBuffer, 
+                        displayMetaData, pFrameMeta, pObjectMeta);
+                }
+                catch(...)
+                {
+                    LOG_ERROR("Trigger '" << pOdeTrigger->GetName() 
+                        << "' threw exception");
+                }
+            }
+        }
+    }
+    
+    void OdePadProbeHandler::ProcessBatchInParallel(GstBuffer* pBuffer, 
+        NvDsBatchMeta* pBatchMeta)
+    {
+        // internal - m_padHandlerMutex must be locked by the caller
+        
+        // Re-compile if a Trigger's class or source filter has changed. A filter
+        // resolved while processing this batch is picked up on the next batch.
+        if (m_dispatchVersion != OdeTrigger::s_dispatchVersion)
+        {
+            CompileDispatchTable();
+        }
+        
+        // All dispatch tables are built up front on the streaming thread. 
+        // The workers only read the tables.
+        std::vector<NvDsFrameMeta*> frames;
+        std::vector<const OdeTriggerDispatchTable*> dispatchTables;
+        std::vector<std::unique_ptr<DisplayMetaAllocator>> displayMetaData;
+        
+        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*) (pFrameMetaList->data);
+            if (pFrameMeta != NULL)
+            {
+                frames.push_back(pFrameMeta);
+                dispatchTables.push_back(&GetDispatchTable(pFrameMeta->source_id));
+                
+                // The Tracked Object Store's per-source tables are created up
+                // front as well. Frames from the same source with Tracking 
+                // Triggers are in the same group, so each table has one writer.
+                if (dispatchTables.back()->tracking)
+                {
+                    m_pTrackStore->PrepareSource(pFrameMeta->source_id);
+                }
+                
+                // Display meta is acquired on demand by the workers, with
+                // access to the batch-meta pool serialized.
+                displayMetaData.push_back(std::unique_ptr<DisplayMetaAllocator>(
+                    new DisplayMetaAllocator(pBatchMeta, m_displayMetaAllocSize,
+                        &m_displayMetaPoolMutex)));
+            }
+        }
+        
+        // Group the frames so that all frames sharing a Trigger, a Composite
+        // Trigger predicate, or an Action that requires ordered execution, are
+        // in the same group. All frames with an Action that requires serial 
+        // execution are in one group. 
+        // Disjoint-set of frame indices with the lowest frame index as the root.
+        std::vector<uint> parents(frames.size());
+        for (uint i = 0; i < parents.size(); i++)
+        {
+            parents[i] = i;
+        }
+        auto findRoot = [&](uint i) -> uint
+        {
+            while (parents[i] != i)
+            {
+                parents[i] = parents[parents[i]];
+                i = parents[i];
+            }
+            return i;
+        };
+        
+        // first frame to use each Trigger or ordered Action
+        std::unordered_map<const void*, uint> firstUsers;
+        auto linkFrame = [&](const void* pUsed, uint frame)
+        {
+            auto ientry = firstUsers.find(pUsed);
+            if (ientry == firstUsers.end())
+            {
+                firstUsers[pUsed] = frame;
+                return;
+            }
+            uint rootA = findRoot(ientry->second);
+            uint rootB = findRoot(frame);
+            parents[std::max(rootA, rootB)] = std::min(rootA, rootB);
+        };
+        
+        // ordered Actions can be added or removed at any time, so must be 
+        // queried for each batch.
+        // The same goes for the predicates of Composite Triggers, which can
+        // be shared with other Composites or be children of this Handler.
+        std::unordered_map<OdeTrigger*, std::vector<OdeAction*>> orderedActions;
+        std::unordered_map<OdeTrigger*, std::vector<OdeTrigger*>> predicates;
+        for (const auto &ivec: m_triggers)
+        {
+            ivec->GetOrderedActions(orderedActions[ivec]);
+            ivec->GetPredicates(predicates[ivec]);
+        }
+        
+        for (uint i = 0; i < frames.size(); i++)
+        {
+            for (const auto &ivec: dispatchTables[i]->sourceTriggers)
+            {
+                linkFrame(ivec, i);
+                for (const auto &jvec: predicates[ivec])
+                {
+                    linkFrame(jvec, i);
+                }
+                for (const auto &jvec: orderedActions[ivec])
+                {
+                    // All serial Actions share this Handler as a common key
+                    linkFrame((jvec->RequiresSerialExecution()) ? 
+                        (const void*)this : (const void*)jvec, i);
+                }
+            }
+        }
+        
+        // Each group maintains the batch order of its frames.
+        std::vector<std::vector<uint>> groups;
+        std::unordered_map<uint, uint> groupIndices;
+        for (uint i = 0; i < frames.size(); i++)
+        {
+            uint root = findRoot(i);
+            if (groupIndices.find(root) == groupIndices.end())
+            {
+                groupIndices[root] = groups.size();
+                groups.push_back(std::vector<uint>());
+            }
+            groups[groupIndices[root]].push_back(i);
+        }
+        
+        m_pWorkerPool->Run(groups.size(), [&](uint group)
+        {
+            for (const auto &frame: groups[group])
+            {
+                NvDsFrameMeta* pFrameMeta = frames[frame];
+                const OdeTriggerDispatchTable& dispatchTable = 
+                    *dispatchTables[frame];
+                try
+                {
+                    // Only the Triggers that can match the frame's source-id
+                    // are processed, so that frames from other sources remain
+                    // independent.
+                    for (const auto &ivec: dispatchTable.sourceTriggers)
+                    {
+                        OdeLatencyTimer timer(ivec->GetLatencyHistogram(
+                            DSL_ODE_STATS_PRE_PROCESS_FRAME));
+                            
+                        ivec->PreProcessFrame(pBuffer, 
+                            *displayMetaData[frame], pFrameMeta);
+                    }
+                    if (dispatchTable.tracking)
+                    {
+                        m_pTrackStore->UpdateFrame(pFrameMeta);
+                    }
+                    CheckFrameObjects(pBuffer, *displayMetaData[frame], 
+                        pFrameMeta, dispatchTable);
+
+                    for (const auto &ivec: dispatchTable.sourceTriggers)
+                    {
+                        OdeLatencyTimer timer(ivec->GetLatencyHistogram(
+                            DSL_ODE_STATS_POST_PROCESS_FRAME));
+                            
+                        ivec->PostProcessFrame(pBuffer, 
+                            *displayMetaData[frame], pFrameMeta);
+                    }
+                    // Actions with per-frame work, e.g. batching, complete
+                    // once all Triggers have post-processed the frame.
+                    for (const auto &ivec: dispatchTable.sourceTriggers)
+                    {
+                        ivec->PostProcessFrameActions(pFrameMeta);
+                    }
+                    if (dispatchTable.tracking)
+                    {
+                        m_pTrackStore->Purge(pFrameMeta->source_id, 
+                            pFrameMeta->frame_num);
+                    }
+                }
+                catch(...)
+                {
+                    LOG_ERROR("ODE Handler '" << GetName() 
+                        << "' threw exception processing frame for source-id = "
+                        << pFrameMeta->source_id);
+                }
+            }
+        });
+        
+        for (uint i = 0; i < frames.size(); i++)
+        {
+            // Add the updated display data, if any, to the frame
+            displayMetaData[i]->AddToFrame(frames[i]);
+        }
+    }
+    
     GstPadProbeReturn OdePadProbeHandler::HandlePadData(GstPadProbeInfo* pInfo)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
@@ -378,6 +934,19 @@ namespace DSL
         
         NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
         
+        // times the full batch, on return, if stats are enabled.
+        OdeLatencyTimer timer((m_statsEnabled) ? &m_pStats->batches : NULL);
+        if (m_statsEnabled)
+        {
+            m_pStats->frames += pBatchMeta->num_frames_in_batch;
+        }
+        
+        if (m_pWorkerPool != NULL)
+        {
+            ProcessBatchInParallel(pBuffer, pBatchMeta);
+            return GST_PAD_PROBE_OK;
+        }
+        
         // For each frame in the batched meta data
         for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
             pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
@@ -386,75 +955,62 @@ namespace DSL
             NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*) (pFrameMetaList->data);
             if (pFrameMeta != NULL)
             {
-                std::vector<NvDsDisplayMeta*> displayMetaData;
-                displayMetaData.reserve(m_displayMetaAllocSize);
+                // Display meta is acquired on demand for this frame, as each
+                // Trigger/Action(s) adds meta, up to the max alloc size.
+                DisplayMetaAllocator displayMetaData(pBatchMeta, 
+                    m_displayMetaAllocSize);
                 
-                for (auto i=0; i<m_displayMetaAllocSize; i++)
+                // Preprocess the frame
+                for (const auto &ivec: m_triggers)
                 {
-                    // Acquire new Display meta for this frame, with each 
-                    // Trigger/Action(s) adding meta as needed.
-                    NvDsDisplayMeta* pDisplayMeta = 
-                        nvds_acquire_display_meta_from_pool(pBatchMeta);
-                    displayMetaData.push_back(pDisplayMeta);
+                    OdeLatencyTimer timer(ivec->GetLatencyHistogram(
+                        DSL_ODE_STATS_PRE_PROCESS_FRAME));
+                        
+                    ivec->PreProcessFrame(pBuffer, displayMetaData, pFrameMeta);
                 }
-                // Preprocess the frame
-                for (const auto &imap: m_pChildrenIndexed)
+                
+                // Re-compile if a Trigger's class or source filter has changed,
+                // or a source filter was resolved during pre-processing.
+                if (m_dispatchVersion != OdeTrigger::s_dispatchVersion)
                 {
-                    DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                        std::dynamic_pointer_cast<OdeTrigger>(imap.second);
-                    pOdeTrigger->PreProcessFrame(pBuffer, displayMetaData, pFrameMeta);
+                    CompileDispatchTable();
                 }
-
-                NvDsMetaList* pNextMeta = pFrameMeta->obj_meta_list;
+                const OdeTriggerDispatchTable& dispatchTable = 
+                    GetDispatchTable(pFrameMeta->source_id);
+                bool tracking(dispatchTable.tracking);
                 
-                // For each detected object in the frame.
-                while (pNextMeta != NULL)
+                // Update the shared Tracked Object Store once for each object
+                // before the Tracking Triggers check for occurrence.
+                if (tracking)
                 {
-                    NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*) (pNextMeta->data);
-
-                    // We need to advance the pointer now in case the object is removed
-                    // from the frame meta by an action which will null the pObjectMeta 
-                    // making pNextMeta in an invalid state an unable to increment. 
-                    pNextMeta = pNextMeta->next;
-
-                    // For each ODE Trigger owned by this ODE Manager, check for ODE
-                    for (const auto &imap: m_pChildrenIndexed)
-                    {
-                        // check for valid object meta as it may have be nulled by
-                        // a trigger with a remove action
-                        if (pObjectMeta != NULL)
-                        {
-                            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                                std::dynamic_pointer_cast<OdeTrigger>(imap.second);
-                            try
-                            {
-                                pOdeTrigger->CheckForOccurrence(pBuffer, 
-                                    displayMetaData, pFrameMeta, pObjectMeta);
-                            }
-                            catch(...)
-                            {
-                                LOG_ERROR("Trigger '" << pOdeTrigger->GetName() 
-                                    << "' threw exception");
-                            }
-                        }
-                    }
+                    m_pTrackStore->UpdateFrame(pFrameMeta);
                 }
+                CheckFrameObjects(pBuffer, displayMetaData, pFrameMeta,
+                    dispatchTable);
                 
                 // After each detected object is checked for ODE individually, post 
                 // process each frame for Absence events, Limit events, etc. (i.e. frame 
                 // level events).
-                for (const auto &imap: m_pChildrenIndexed)
+                for (const auto &ivec: m_triggers)
                 {
-                    DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                        std::dynamic_pointer_cast<OdeTrigger>(imap.second);
-                    pOdeTrigger->PostProcessFrame(pBuffer, displayMetaData, pFrameMeta);
+                    OdeLatencyTimer timer(ivec->GetLatencyHistogram(
+                        DSL_ODE_STATS_POST_PROCESS_FRAME));
+                        
+                    ivec->PostProcessFrame(pBuffer, displayMetaData, pFrameMeta);
                 }
-                
-                for (const auto & ivec: displayMetaData)
+                // Actions with per-frame work, e.g. batching, complete once 
+                // all Triggers have post-processed the frame.
+                for (const auto &ivec: m_triggers)
+                {
+                    ivec->PostProcessFrameActions(pFrameMeta);
+                }
+                if (tracking)
                 {
-                    // Add the updated display data to the frame
-                    nvds_add_display_meta_to_frame(pFrameMeta, ivec);
+                    m_pTrackStore->Purge(pFrameMeta->source_id, 
+                        pFrameMeta->frame_num);
                 }
+                // Add the updated display data, if any, to the frame
+                displayMetaData.AddToFrame(pFrameMeta);
             }
         }
         return GST_PAD_PROBE_OK;
@@ -762,7 +1318,7 @@ namespace DSL
         if (m_bufferTimerId)
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
-            g_source_remove(m_bufferTimerId);
+            TimerWheel::GetTimerWheel()->Remove(m_bufferTimerId);
         }
     }
     
@@ -779,12 +1335,12 @@ namespace DSL
 
         if (m_isEnabled)
         {
-            m_bufferTimerId = g_timeout_add(10, 
+            m_bufferTimerId = TimerWheel::GetTimerWheel()->Add(10, 
                 buffer_timer_cb, this);
         }
         else if (m_bufferTimerId)
         {
-            g_source_remove(m_bufferTimerId);
+            TimerWheel::GetTimerWheel()->Remove(m_bufferTimerId);
             m_bufferTimerId = 0;
         }
         return true;
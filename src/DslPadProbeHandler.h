@@ -28,7 +28,9 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslApi.h"
 #include "DslBase.h"
+#include "DslDisplayMetaAllocator.h"
 #include "DslSourceMeter.h"
+#include "DslOdeStats.h"
 
 
 namespace DSL
@@ -509,6 +511,161 @@ namespace DSL
     
     //--------------------------------------------------------------------------------
 
+    // forward declaration - see DslOdeTrigger.h
+    class OdeTrigger;
+    class TrackedObjectStore;
+    
+    /**
+     * @class OdeFrameWorkerPool
+     * @brief Fixed pool of worker threads used by an ODE Pad Probe Handler
+     * to process groups of frames from the same batch concurrently. The 
+     * calling thread joins the workers in claiming tasks and Run() returns
+     * only once every task has completed.
+     */
+    class OdeFrameWorkerPool
+    {
+    public:
+    
+        /**
+         * @brief ctor for the ODE Frame Worker Pool
+         * @param[in] numWorkers number of worker threads to create.
+         */
+        OdeFrameWorkerPool(uint numWorkers);
+        
+        /**
+         * @brief dtor for the ODE Frame Worker Pool, stops and joins all workers.
+         */
+        ~OdeFrameWorkerPool();
+        
+        /**
+         * @brief Runs task(i) for all i in [0, count) on the calling thread
+         * and the worker threads. Blocks until all tasks have completed.
+         * @param[in] count number of tasks to run.
+         * @param[in] task function to call with each task index.
+         */
+        void Run(uint count, const std::function<void(uint)>& task);
+        
+        /**
+         * @brief Worker thread function. ** To be called by the worker threads only **.
+         */
+        void WorkerThread();
+        
+    private:
+    
+        /**
+         * @brief Claims and runs tasks from the current job until none remain.
+         * @param[in] count number of tasks in the current job.
+         * @param[in] task function to call with each claimed task index.
+         */
+        void ClaimTasks(uint count, const std::function<void(uint)>& task);
+    
+        /**
+         * @brief worker threads created on construction.
+         */
+        std::vector<GThread*> m_workers;
+        
+        /**
+         * @brief mutex to protect mutual access to the job and worker states.
+         */
+        DslMutex m_poolMutex;
+        
+        /**
+         * @brief condition to signal the workers that a new job is ready.
+         */
+        DslCond m_jobReadyCond;
+        
+        /**
+         * @brief condition to signal Run() that a worker has gone idle.
+         */
+        DslCond m_workerIdleCond;
+        
+        /**
+         * @brief current job's task function, NULL between jobs.
+         */
+        const std::function<void(uint)>* m_pTask;
+        
+        /**
+         * @brief current job's task count.
+         */
+        uint m_taskCount;
+        
+        /**
+         * @brief index of the next task to claim for the current job.
+         */
+        std::atomic<uint> m_nextTask;
+        
+        /**
+         * @brief incremented on each new job so workers only join a job once.
+         */
+        uint64_t m_jobId;
+        
+        /**
+         * @brief number of workers currently claiming tasks from the current job.
+         */
+        uint m_busyWorkers;
+        
+        /**
+         * @brief set on destruction to stop all workers.
+         */
+        bool m_stop;
+    };
+    
+    /**
+     * @brief Thread function to run an ODE Frame Worker Pool's worker loop.
+     * @param[in] pPool pointer to the ODE Frame Worker Pool.
+     * @return NULL always.
+     */
+    static gpointer ode_frame_worker_thread(gpointer pPool);
+    
+    /**
+     * @struct OdeTriggerDispatchTable
+     * @brief Flat, pre-compiled table of ODE Triggers for a single source-id.
+     * Triggers are bucketed by class-id into contiguous ranges of a single
+     * vector so that each object only visits the Triggers that can match it.
+     * Each bucket maintains the Triggers' add-order for execution.
+     */
+    struct OdeTriggerDispatchTable
+    {
+        /**
+         * @brief contiguous storage for all buckets, non-owning pointers.
+         */
+        std::vector<OdeTrigger*> triggers;
+        
+        /**
+         * @brief all Triggers that can match the source-id, in add-order.
+         * Non-owning pointers.
+         */
+        std::vector<OdeTrigger*> sourceTriggers;
+        
+        /**
+         * @brief [begin, end) range into triggers for each class-id that at 
+         * least one Trigger filters on. Each range includes the any-class Triggers.
+         */
+        std::unordered_map<uint, std::pair<uint, uint>> classRanges;
+
+        /**
+         * @brief [begin, end) range into triggers for objects with a class-id
+         * that no Trigger filters on, i.e. the any-class Triggers only.
+         */
+        std::pair<uint, uint> anyClassRange;
+        
+        /**
+         * @brief true if at least one of the sourceTriggers tracks objects.
+         */
+        bool tracking = false;
+        
+        /**
+         * @brief Gets the range of Triggers to check for a given class-id.
+         * @param[in] classId class-id of the object to check.
+         * @return [begin, end) range into triggers.
+         */
+        const std::pair<uint, uint>& GetRange(uint classId) const
+        {
+            auto ientry = classRanges.find(classId);
+            return (ientry == classRanges.end()) ? anyClassRange : ientry->second;
+        }
+    };
+    
     /**
      * @class OdePadProbeHandler
      * @brief Pad Probe Handler to Handle a collection ODE triggers
@@ -557,6 +714,45 @@ namespace DSL
          */
         void SetDisplayMetaAllocSize(uint count);
 
+        /**
+         * @brief Gets the current parallel mode settings for this ODE Handler.
+         * @param[out] enabled true if the frames of each batch are processed
+         * in parallel, false if processed one after another.
+         * @param[out] maxWorkers maximum number of threads, including the 
+         * streaming thread, used to process each batch. 0 = one per processor.
+         */
+        void GetParallelMode(bool* enabled, uint* maxWorkers);
+        
+        /**
+         * @brief Sets the parallel mode settings for this ODE Handler.
+         * @param[in] enabled set to true to process the frames of each batch
+         * in parallel, false to process one after another (default).
+         * @param[in] maxWorkers maximum number of threads, including the 
+         * streaming thread, used to process each batch. 0 = one per processor.
+         */
+        void SetParallelMode(bool enabled, uint maxWorkers);
+
+        /**
+         * @brief Gets the current stats enabled setting for this ODE Handler.
+         * @return true if stats collection is enabled, false otherwise (default).
+         */
+        bool GetStatsEnabled();
+        
+        /**
+         * @brief Sets the stats enabled setting for this ODE Handler and all
+         * of its child Triggers. Enabling stats clears all previous stats.
+         * @param[in] enabled set to true to enable and clear stats, false
+         * to disable.
+         */
+        void SetStatsEnabled(bool enabled);
+        
+        /**
+         * @brief Gets the current stats for this ODE Handler.
+         * @param[out] stats current latency, frame, and occurrence statistics, 
+         * all zero if stats have never been enabled.
+         */
+        void GetStats(dsl_pph_ode_stats* stats);
+
         /**
          * @brief ODE Pad Probe Handler
          * @param[in] pBuffer Pad buffer
@@ -569,10 +765,54 @@ namespace DSL
     private:
     
         /**
-         * @brief specifies how many Display Meta structures are allocated for each frame
+         * @brief Compiles the flat vector of child ODE Triggers in add-order
+         * and clears all per-source dispatch tables so they are rebuilt on
+         * next use. Must be called with the m_padHandlerMutex locked.
+         */
+        void CompileDispatchTable();
+        
+        /**
+         * @brief Gets the dispatch table for a given source-id, building the
+         * table on first use. Must be called with the m_padHandlerMutex locked.
+         * @param[in] sourceId source-id of the frame to process.
+         * @return the dispatch table for sourceId.
+         */
+        const OdeTriggerDispatchTable& GetDispatchTable(uint sourceId);
+        
+        /**
+         * @brief Checks each object in a frame against the Triggers that can
+         * match the object's class-id. 
+         * @param[in] pBuffer batched buffer containing the frame.
+         * @param[in] displayMetaData display meta acquired for the frame.
+         * @param[in] pFrameMeta frame to check.
+         * @param[in] dispatchTable dispatch table for the frame's source-id.
+         */
+        void CheckFrameObjects(GstBuffer* pBuffer, 
+            DisplayMetaAllocator& displayMetaData, 
+            NvDsFrameMeta* pFrameMeta, const OdeTriggerDispatchTable& dispatchTable);
+            
+        /**
+         * @brief Processes all frames in a batch using the worker pool. Frames
+         * that share a Trigger, or an ordered Action, are processed serially
+         * in batch order by the same worker. Must be called with the 
+         * m_padHandlerMutex locked.
+         * @param[in] pBuffer batched buffer to process.
+         * @param[in] pBatchMeta batch meta from pBuffer.
+         */
+        void ProcessBatchInParallel(GstBuffer* pBuffer, NvDsBatchMeta* pBatchMeta);
+    
+        /**
+         * @brief specifies the maximum number of Display Meta structures 
+         * acquired, on demand, for each frame
          */
         uint m_displayMetaAllocSize;
         
+        /**
+         * @brief mutex to serialize Display Meta acquisition from the 
+         * batch-meta pool when frames are processed in parallel.
+         */
+        DslMutex m_displayMetaPoolMutex;
+        
         /**
          * @brief Index variable to incremment/assign on ODE Trigger add.
          */
@@ -583,6 +823,51 @@ namespace DSL
          */
         std::map <uint, DSL_BASE_PTR> m_pChildrenIndexed; 
         
+        /**
+         * @brief Flat vector of child ODE Triggers in add-order, compiled from
+         * m_pChildrenIndexed to avoid casting on each frame. Non-owning pointers.
+         */
+        std::vector<OdeTrigger*> m_triggers;
+        
+        /**
+         * @brief Map of dispatch tables, one per source-id, built on first use.
+         */
+        std::unordered_map<uint, OdeTriggerDispatchTable> m_dispatchTables;
+        
+        /**
+         * @brief Tracked Object Store shared by all child Tracking Triggers,
+         * updated once per object per frame.
+         */
+        std::shared_ptr<TrackedObjectStore> m_pTrackStore;
+        
+        /**
+         * @brief value of OdeTrigger::s_dispatchVersion when the dispatch
+         * tables were last compiled.
+         */
+        uint64_t m_dispatchVersion;
+        
+        /**
+         * @brief maximum number of threads to use in parallel mode, 0 = one
+         * per processor.
+         */
+        uint m_maxParallelWorkers;
+        
+        /**
+         * @brief worker pool for parallel mode, NULL when parallel mode is disabled.
+         */
+        std::unique_ptr<OdeFrameWorkerPool> m_pWorkerPool;
+        
+        /**
+         * @brief true if stats collection is enabled for this ODE Handler
+         * and its child Triggers.
+         */
+        bool m_statsEnabled;
+        
+        /**
+         * @brief latency and frame stats, created on first enable.
+         */
+        std::unique_ptr<OdeHandlerStats> m_pStats;
+        
     };
     
     //--------------------------------------------------------------------------------
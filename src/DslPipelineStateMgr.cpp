@@ -25,6 +25,7 @@ THE SOFTWARE.
 
 #include "Dsl.h"
 #include "DslPipelineStateMgr.h"
+#include "DslRtspReconnectScheduler.h"
 
 namespace DSL
 {
@@ -403,9 +404,11 @@ namespace DSL
             HandleEosMessage(pMessage);
             break;
         case GST_MESSAGE_ERROR:
+            RtspReconnectScheduler::GetScheduler()->HandleBusMessage(pMessage);
             HandleErrorMessage(pMessage);            
             break;
         case GST_MESSAGE_STATE_CHANGED:
+            RtspReconnectScheduler::GetScheduler()->HandleBusMessage(pMessage);
             HandleStateChanged(pMessage);
             break;
         case GST_MESSAGE_APPLICATION:
@@ -0,0 +1,313 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "Dsl.h"
+#include "DslRtspReconnectScheduler.h"
+#include "DslSourceBintr.h"
+#include "DslTimerWheel.h"
+
+namespace DSL
+{
+    RtspReconnectScheduler* RtspReconnectScheduler::GetScheduler()
+    {
+        static RtspReconnectScheduler scheduler(DSL_RTSP_RECONNECT_MAX_CONCURRENT);
+        
+        return &scheduler;
+    }
+    
+    RtspReconnectScheduler::RtspReconnectScheduler(uint maxConcurrent)
+        : m_maxConcurrent(maxConcurrent)
+        , m_activeCount(0)
+        , m_timerId(0)
+        , m_randomGenerator(std::random_device()())
+    {
+        LOG_FUNC();
+        
+        // Construct the Timer Wheel first so that it outlives the scheduler.
+        TimerWheel::GetTimerWheel();
+    }
+    
+    RtspReconnectScheduler::~RtspReconnectScheduler()
+    {
+        LOG_FUNC();
+        
+        if (m_timerId)
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+            TimerWheel::GetTimerWheel()->Remove(m_timerId);
+        }
+    }
+    
+    bool RtspReconnectScheduler::Schedule(RtspSourceBintr* pSource)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+        
+        if (findEntry(pSource) != m_entries.end())
+        {
+            LOG_ERROR("RTSP Source '" << pSource->GetName() 
+                << "' is already scheduled for reconnection");
+            return false;
+        }
+        m_entries.push_back(RtspReconnectEntry(pSource, 
+            pSource->GetGstElement()));
+        m_entries.back().nextAttemptTime = g_get_monotonic_time();
+        
+        LOG_INFO("RTSP Source '" << pSource->GetName() 
+            << "' scheduled for reconnection with " << m_entries.size() 
+            << " Source(s) in reconnection");
+        
+        if (!m_timerId)
+        {
+            m_timerId = TimerWheel::GetTimerWheel()->Add(
+                DSL_RTSP_RECONNECT_SCHEDULER_PERIOD_MS,
+                RtspReconnectSchedulerHandler, this);
+        }
+        return true;
+    }
+    
+    bool RtspReconnectScheduler::Cancel(RtspSourceBintr* pSource)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+        
+        auto ientry = findEntry(pSource);
+        if (ientry == m_entries.end())
+        {
+            return false;
+        }
+        if (ientry->state == DSL_RTSP_RECONNECT_STATE_CONNECTING)
+        {
+            m_activeCount--;
+        }
+        m_entries.erase(ientry);
+
+        LOG_INFO("Reconnection cancelled for RTSP Source '" 
+            << pSource->GetName() << "'");
+        return true;
+    }
+    
+    bool RtspReconnectScheduler::IsScheduled(RtspSourceBintr* pSource)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+        
+        return (findEntry(pSource) != m_entries.end());
+    }
+    
+    uint RtspReconnectScheduler::GetActiveCount()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+        
+        return m_activeCount;
+    }
+    
+    uint RtspReconnectScheduler::GetScheduledCount()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+        
+        return m_entries.size();
+    }
+    
+    void RtspReconnectScheduler::HandleBusMessage(GstMessage* pMessage)
+    {
+        // No function log - avoid overhead.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+        
+        if (m_entries.empty())
+        {
+            return;
+        }
+        for (auto& entry: m_entries)
+        {
+            if (GST_MESSAGE_TYPE(pMessage) == GST_MESSAGE_STATE_CHANGED)
+            {
+                // Only the Source's bin reports the Source's state.
+                if (GST_MESSAGE_SRC(pMessage) != GST_OBJECT(entry.pGstElement))
+                {
+                    continue;
+                }
+                gst_message_parse_state_changed(pMessage, NULL, 
+                    &entry.lastState, NULL);
+                entry.stateChanged = true;
+                return;
+            }
+            if (GST_MESSAGE_TYPE(pMessage) == GST_MESSAGE_ERROR)
+            {
+                // Errors are reported by the Source's children.
+                if (!gst_object_has_as_ancestor(GST_MESSAGE_SRC(pMessage),
+                    GST_OBJECT(entry.pGstElement)))
+                {
+                    continue;
+                }
+                if (entry.state == DSL_RTSP_RECONNECT_STATE_CONNECTING)
+                {
+                    entry.failed = true;
+                }
+                return;
+            }
+        }
+    }
+    
+    int RtspReconnectScheduler::HandleTimerTick()
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_schedulerMutex);
+
+        int64_t currentTime = g_get_monotonic_time();
+        
+        // First, advance all attempts in progress to free up slots.
+        for (auto ientry = m_entries.begin(); ientry != m_entries.end(); )
+        {
+            RtspReconnectEntry& entry = *ientry;
+
+            if (entry.state != DSL_RTSP_RECONNECT_STATE_CONNECTING)
+            {
+                ientry++;
+                continue;
+            }
+            // update the Source's state variable to notify all client listeners 
+            if (entry.stateChanged)
+            {
+                entry.pSource->SetCurrentState(entry.lastState);
+                entry.stateChanged = false;
+            }
+            if (entry.pSource->IsReconnected())
+            {
+                entry.pSource->CompleteReconnect();
+                m_activeCount--;
+                ientry = m_entries.erase(ientry);
+                continue;
+            }
+            if (entry.failed)
+            {
+                LOG_ERROR("Reconnection attempt failed for RTSP Source '" 
+                    << entry.pSource->GetName() << "'");
+                failAttempt(entry, currentTime);
+            }
+            else if (currentTime > entry.deadline)
+            {
+                LOG_ERROR("Reconnection attempt timed out for RTSP Source '" 
+                    << entry.pSource->GetName() << "'");
+                failAttempt(entry, currentTime);
+            }
+            ientry++;
+        }
+
+        // Then, start the attempts that are due, oldest first, while there
+        // are free slots.
+        for (auto& entry: m_entries)
+        {
+            if (m_activeCount >= m_maxConcurrent)
+            {
+                break;
+            }
+            if (entry.state != DSL_RTSP_RECONNECT_STATE_WAITING or
+                entry.nextAttemptTime > currentTime)
+            {
+                continue;
+            }
+            uint sleep(0), timeout(0);
+            entry.pSource->GetConnectionParams(&sleep, &timeout);
+            
+            entry.state = DSL_RTSP_RECONNECT_STATE_CONNECTING;
+            entry.deadline = currentTime + (int64_t)timeout*G_USEC_PER_SEC;
+            entry.failed = false;
+            m_activeCount++;
+            
+            if (!entry.pSource->StartReconnectAttempt())
+            {
+                failAttempt(entry, currentTime);
+            }
+        }
+        
+        if (m_entries.empty())
+        {
+            LOG_INFO("All RTSP Sources have completed reconnection");
+
+            // clear the timer id and return false to self remove
+            m_timerId = 0;
+            return false;
+        }
+        return true;
+    }
+    
+    int64_t RtspReconnectScheduler::GetBackoffTime(uint sleep, uint failures, 
+        double jitter)
+    {
+        LOG_FUNC();
+        
+        int64_t maxBackoff = (int64_t)std::max(sleep, 
+            (uint)DSL_RTSP_RECONNECT_MAX_BACKOFF_S)*G_USEC_PER_SEC;
+        
+        // Double the sleep time for each consecutive failure, up to the max.
+        int64_t backoff = (int64_t)sleep*G_USEC_PER_SEC;
+        for (uint i = 1; i < failures and backoff < maxBackoff; i++)
+        {
+            backoff *= 2;
+        }
+        backoff = std::min(backoff, maxBackoff);
+        
+        // Equal jitter - keep half and randomize the other half so that
+        // Sources that failed together do not retry together.
+        return backoff/2 + (int64_t)(jitter*(backoff/2));
+    }
+    
+    std::list<RtspReconnectEntry>::iterator RtspReconnectScheduler::findEntry(
+        RtspSourceBintr* pSource)
+    {
+        return std::find_if(m_entries.begin(), m_entries.end(), 
+            [pSource](const RtspReconnectEntry& entry)
+            {
+                return entry.pSource == pSource;
+            });
+    }
+    
+    void RtspReconnectScheduler::failAttempt(RtspReconnectEntry& entry, 
+        int64_t currentTime)
+    {
+        uint sleep(0), timeout(0);
+        entry.pSource->GetConnectionParams(&sleep, &timeout);
+        
+        entry.failures++;
+        int64_t backoff = GetBackoffTime(sleep, entry.failures,
+            std::uniform_real_distribution<double>(0.0, 1.0)(m_randomGenerator));
+            
+        entry.state = DSL_RTSP_RECONNECT_STATE_WAITING;
+        entry.nextAttemptTime = currentTime + backoff;
+        m_activeCount--;
+        
+        LOG_INFO("Sleeping for " << backoff/1000 
+            << " ms after failed reconnection attempt " << entry.failures 
+            << " for RTSP Source '" << entry.pSource->GetName() << "'");
+    }
+
+    static int RtspReconnectSchedulerHandler(gpointer pScheduler)
+    {
+        return static_cast<RtspReconnectScheduler*>(pScheduler)->
+            HandleTimerTick();
+    }
+}
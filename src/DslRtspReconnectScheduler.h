@@ -0,0 +1,261 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_RTSP_RECONNECT_SCHEDULER_H
+#define _DSL_RTSP_RECONNECT_SCHEDULER_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @brief period of the scheduler's main-loop timer while there are
+     * RTSP Sources in reconnection. In units of milliseconds.
+     */
+    #define DSL_RTSP_RECONNECT_SCHEDULER_PERIOD_MS                      100
+    
+    /**
+     * @brief maximum number of RTSP Sources with a reconnection attempt in
+     * progress at any one time. Sources due an attempt wait for a free slot.
+     */
+    #define DSL_RTSP_RECONNECT_MAX_CONCURRENT                           8
+    
+    /**
+     * @brief upper limit for the exponential backoff between failed 
+     * reconnection attempts. In units of seconds. 
+     */
+    #define DSL_RTSP_RECONNECT_MAX_BACKOFF_S                            300
+    
+    /**
+     * @brief reconnection states for a scheduled RTSP Source.
+     */
+    #define DSL_RTSP_RECONNECT_STATE_WAITING                            0
+    #define DSL_RTSP_RECONNECT_STATE_CONNECTING                         1
+    
+    // forward declaration - see DslSourceBintr.h
+    class RtspSourceBintr;
+    
+    /**
+     * @struct RtspReconnectEntry
+     * @brief Reconnection state for a single RTSP Source scheduled 
+     * with the RTSP Reconnect Scheduler.
+     */
+    struct RtspReconnectEntry
+    {
+        RtspReconnectEntry(RtspSourceBintr* pSource, GstElement* pGstElement)
+            : pSource(pSource)
+            , pGstElement(pGstElement)
+            , state(DSL_RTSP_RECONNECT_STATE_WAITING)
+            , failures(0)
+            , nextAttemptTime(0)
+            , deadline(0)
+            , lastState(GST_STATE_VOID_PENDING)
+            , stateChanged(false)
+            , failed(false)
+        {};
+        
+        /**
+         * @brief RTSP Source to reconnect.
+         */
+        RtspSourceBintr* pSource;
+        
+        /**
+         * @brief the Source's bin, used to match bus messages to the Source.
+         */
+        GstElement* pGstElement;
+        
+        /**
+         * @brief one of the DSL_RTSP_RECONNECT_STATE constants.
+         */
+        uint state;
+        
+        /**
+         * @brief number of consecutive failed attempts in this cycle.
+         */
+        uint failures;
+        
+        /**
+         * @brief monotonic time for the next attempt when waiting, and the
+         * time to give up on the current attempt when connecting, in us.
+         */
+        int64_t nextAttemptTime;
+        int64_t deadline;
+        
+        /**
+         * @brief most recent state reported by the Source's bus messages
+         * and true if not yet applied to the Source.
+         */
+        GstState lastState;
+        bool stateChanged;
+        
+        /**
+         * @brief set on an error message from the Source, or any of its
+         * children, while connecting.
+         */
+        bool failed;
+    };
+    
+    /**
+     * @class RtspReconnectScheduler
+     * @brief Process-wide scheduler for all RTSP Sources in a reconnection 
+     * cycle. A single main-loop timer starts each attempt without waiting 
+     * on the state change, caps the number of concurrent attempts, and 
+     * spaces out failed attempts with jittered exponential backoff. State
+     * changes and errors are tracked through the Pipeline's bus messages.
+     */
+    class RtspReconnectScheduler
+    {
+    public:
+    
+        /**
+         * @brief Gets the process-wide scheduler.
+         */
+        static RtspReconnectScheduler* GetScheduler();
+        
+        /**
+         * @brief ctor for the RtspReconnectScheduler class.
+         * @param[in] maxConcurrent maximum number of concurrent attempts.
+         */
+        RtspReconnectScheduler(uint maxConcurrent);
+        
+        ~RtspReconnectScheduler();
+        
+        /**
+         * @brief Schedules an RTSP Source for reconnection. The first attempt
+         * is started on the next timer tick with a free slot.
+         * @param[in] pSource RTSP Source to reconnect.
+         * @return true on success, false if the Source is already scheduled.
+         */
+        bool Schedule(RtspSourceBintr* pSource);
+        
+        /**
+         * @brief Removes an RTSP Source from the scheduler, ending its 
+         * reconnection cycle. Must not be called with the Source's 
+         * reconnection mutex held.
+         * @param[in] pSource RTSP Source to remove.
+         * @return true if the Source was scheduled, false otherwise.
+         */
+        bool Cancel(RtspSourceBintr* pSource);
+        
+        /**
+         * @brief Checks if an RTSP Source is currently scheduled.
+         * @param[in] pSource RTSP Source to check.
+         * @return true if scheduled, false otherwise.
+         */
+        bool IsScheduled(RtspSourceBintr* pSource);
+        
+        /**
+         * @brief Gets the number of Sources with an attempt in progress.
+         */
+        uint GetActiveCount();
+        
+        /**
+         * @brief Gets the number of Sources in a reconnection cycle.
+         */
+        uint GetScheduledCount();
+        
+        /**
+         * @brief Handles a bus message for all scheduled Sources. Called by
+         * the Pipeline's bus-watch for state-changed and error messages.
+         * @param[in] pMessage bus message to handle.
+         */
+        void HandleBusMessage(GstMessage* pMessage);
+        
+        /**
+         * @brief Advances all scheduled Sources. Called by the main-loop 
+         * timer, and left public for the purposes of test.
+         * @return true to continue, false to self remove when there are no
+         * Sources scheduled.
+         */
+        int HandleTimerTick();
+        
+        /**
+         * @brief Gets the backoff time following a failed attempt.
+         * @param[in] sleep base time to sleep after a failed attempt in seconds.
+         * @param[in] failures number of consecutive failed attempts, >= 1.
+         * @param[in] jitter random value in the range [0.0, 1.0].
+         * @return time to wait before the next attempt in microseconds, 
+         * between half and all of sleep*2^(failures-1), capped at 
+         * DSL_RTSP_RECONNECT_MAX_BACKOFF_S or sleep, whichever is greater.
+         */
+        static int64_t GetBackoffTime(uint sleep, uint failures, double jitter);
+        
+    private:
+    
+        /**
+         * @brief finds the entry for a Source.
+         * @return iterator to the entry, or m_entries.end() if not found.
+         */
+        std::list<RtspReconnectEntry>::iterator findEntry(
+            RtspSourceBintr* pSource);
+        
+        /**
+         * @brief ends the current attempt for an entry with a failure and
+         * schedules the next attempt after backoff.
+         */
+        void failAttempt(RtspReconnectEntry& entry, int64_t currentTime);
+        
+        /**
+         * @brief maximum number of Sources with an attempt in progress.
+         */
+        uint m_maxConcurrent;
+        
+        /**
+         * @brief number of Sources with an attempt in progress.
+         */
+        uint m_activeCount;
+        
+        /**
+         * @brief all scheduled Sources in the order they were scheduled
+         * - oldest first.
+         */
+        std::list<RtspReconnectEntry> m_entries;
+        
+        /**
+         * @brief gnome timer Id for the scheduler's main-loop timer, 
+         * 0 when no Sources are scheduled.
+         */
+        uint m_timerId;
+        
+        /**
+         * @brief random generator for the backoff jitter.
+         */
+        std::mt19937 m_randomGenerator;
+        
+        /**
+         * @brief mutex to guard the scheduler's read/write attributes.
+         */
+        DslMutex m_schedulerMutex;
+    };
+    
+    /**
+     * @brief Timer callback handler to invoke the RTSP Reconnect Scheduler.
+     * @param[in] pScheduler pointer to the RtspReconnectScheduler to invoke.
+     * @return int true to continue, 0 to self remove
+     */
+    static int RtspReconnectSchedulerHandler(gpointer pScheduler);
+}
+
+#endif // _DSL_RTSP_RECONNECT_SCHEDULER_H
@@ -185,6 +185,9 @@ namespace DSL {
         DslReturnType OdeActionCaptureMailerRemove(const char* name,
             const char* mailer);
 
+        DslReturnType OdeActionCaptureQueueStatsGet(const char* name,
+            uint* queueDepth, uint64_t* dropped);
+
         DslReturnType OdeActionDisplayNew(const char* name, 
             const char* formatString, uint offsetX, uint offsetY, 
             const char* font, boolean hasBgColor, const char* bgColor);
@@ -235,6 +238,10 @@ namespace DSL {
             
         DslReturnType OdeActionMonitorNew(const char* name,
             dsl_ode_monitor_occurrence_cb clientMonitor, void* clientData);
+
+        DslReturnType OdeActionMonitorBatchNew(const char* name,
+            dsl_ode_monitor_occurrence_batch_cb clientMonitor, 
+            uint maxSize, uint window, void* clientData);
             
         DslReturnType OdeActionObjectRemoveNew(const char* name);
 
@@ -244,6 +251,16 @@ namespace DSL {
         DslReturnType OdeActionFileNew(const char* name, 
             const char* filePath, uint mode, uint format, boolean forceFlush);
         
+        DslReturnType OdeActionFileRotationGet(const char* name, 
+            uint* maxSize, uint* maxAge);
+        
+        DslReturnType OdeActionFileRotationSet(const char* name, 
+            uint maxSize, uint maxAge);
+        
+        DslReturnType OdeActionFileSyncPolicyGet(const char* name, uint* policy);
+        
+        DslReturnType OdeActionFileSyncPolicySet(const char* name, uint policy);
+        
         DslReturnType OdeActionFillSurroundingsNew(const char* name, const char* color);
         
         DslReturnType OdeActionFillFrameNew(const char* name, const char* color);
@@ -341,6 +358,13 @@ namespace DSL {
         DslReturnType OdeActionEnabledStateChangeListenerRemove(const char* name,
             dsl_ode_enabled_state_change_listener_cb listener);
 
+        DslReturnType OdeActionAsyncEnabledGet(const char* name, boolean* enabled);
+
+        DslReturnType OdeActionAsyncEnabledSet(const char* name, boolean enabled);
+
+        DslReturnType OdeActionAsyncStatsGet(const char* name, 
+            uint64_t* queued, uint64_t* dropped);
+
         DslReturnType OdeActionDelete(const char* name);
         
         DslReturnType OdeActionDeleteAll();
@@ -393,6 +417,19 @@ namespace DSL {
             uint classId, uint limit,  dsl_ode_check_for_occurrence_cb client_checker, 
             dsl_ode_post_process_frame_cb client_post_processor, void* client_data);
 
+        DslReturnType OdeTriggerCustomBatchNew(const char* name, const char* source, 
+            uint classId, uint limit, dsl_ode_check_for_occurrences_cb client_checker, 
+            void* client_data);
+
+        DslReturnType OdeTriggerCompositeNew(const char* name, const char* source, 
+            uint classId, uint limit, uint compositeOperator);
+
+        DslReturnType OdeTriggerCompositePredicateAdd(const char* name, 
+            const char* predicate, boolean negate);
+
+        DslReturnType OdeTriggerCompositePredicateRemove(const char* name, 
+            const char* predicate);
+
         DslReturnType OdeTriggerCountNew(const char* name, const char* source, 
             uint classId, uint limit, uint minimum, uint maximum);
 
@@ -560,6 +597,23 @@ namespace DSL {
         DslReturnType OdeTriggerIntervalGet(const char* name, uint* interval);
         
         DslReturnType OdeTriggerIntervalSet(const char* name, uint interval);
+
+        DslReturnType OdeTriggerPerSourceStateGet(const char* name, boolean* enabled);
+
+        DslReturnType OdeTriggerPerSourceStateSet(const char* name, boolean enabled);
+        
+        DslReturnType OdeTriggerRateLimitGet(const char* name, 
+            float* rate, uint* burst);
+        
+        DslReturnType OdeTriggerRateLimitSet(const char* name, 
+            float rate, uint burst);
+        
+        DslReturnType OdeTriggerDebounceGet(const char* name, uint* window);
+        
+        DslReturnType OdeTriggerDebounceSet(const char* name, uint window);
+        
+        DslReturnType OdeTriggerStatsGet(const char* name, 
+            dsl_ode_trigger_stats* stats);
         
         DslReturnType OdeTriggerActionAdd(const char* name, const char* action);
 
@@ -618,6 +672,16 @@ namespace DSL {
         DslReturnType OdeHeatMapperLegendSettingsSet(const char* name,
             boolean enabled, uint location, uint width, uint height);
 
+        DslReturnType OdeHeatMapperDecayGet(const char* name, uint* halfLife);
+
+        DslReturnType OdeHeatMapperDecaySet(const char* name, uint halfLife);
+
+        DslReturnType OdeHeatMapperWindowGet(const char* name,
+            uint* interval, uint* intervals);
+
+        DslReturnType OdeHeatMapperWindowSet(const char* name,
+            uint interval, uint intervals);
+
         DslReturnType OdeHeatMapperMetricsClear(const char* name);
 
         DslReturnType OdeHeatMapperMetricsGet(const char* name,
@@ -658,6 +722,18 @@ namespace DSL {
 
         DslReturnType PphOdeDisplayMetaAllocSizeSet(const char* name, uint size);
 
+        DslReturnType PphOdeParallelModeGet(const char* name, 
+            boolean* enabled, uint* maxWorkers);
+
+        DslReturnType PphOdeParallelModeSet(const char* name, 
+            boolean enabled, uint maxWorkers);
+
+        DslReturnType PphOdeStatsEnabledGet(const char* name, boolean* enabled);
+
+        DslReturnType PphOdeStatsEnabledSet(const char* name, boolean enabled);
+
+        DslReturnType PphOdeStatsGet(const char* name, dsl_pph_ode_stats* stats);
+
         DslReturnType PphBufferTimeoutNew(const char* name,
             uint timeout, dsl_pph_buffer_timeout_handler_cb handler, void* clientData);
     
@@ -299,6 +299,35 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::OdeActionCaptureQueueStatsGet(const char* name, 
+        uint* queueDepth, uint64_t* dropped)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+    
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            DSL_RETURN_IF_ODE_ACTION_IS_NOT_CAPTURE_TYPE(m_odeActions, name);
+
+            DSL_ODE_ACTION_CATPURE_PTR pOdeAction = 
+                std::dynamic_pointer_cast<CaptureOdeAction>(m_odeActions[name]);
+
+            pOdeAction->GetQueueStats(queueDepth, dropped);
+
+            LOG_INFO("ODE Capture Action '" << name << "' returned Queue Depth = " 
+                << *queueDepth << " and Dropped = " << *dropped << " successfully");
+                
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Capture Action '" << name 
+                << "' threw an exception getting Queue stats");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::OdeActionCustomNew(const char* name,
         dsl_ode_handle_occurrence_cb clientHandler, void* clientData)
     {
@@ -861,6 +890,11 @@ namespace DSL
                 m_odeActions[name] = DSL_ODE_ACTION_FILE_MOTC_NEW(name, 
                     filePath, mode, forceFlush);
                 break;
+            case DSL_EVENT_FILE_FORMAT_BINARY :
+                // records are visible to readers once written, forceFlush is not used.
+                m_odeActions[name] = DSL_ODE_ACTION_FILE_BINARY_NEW(name, 
+                    filePath, mode);
+                break;
             default :
                 LOG_ERROR("File format " << format 
                     << " is invalid for ODE Action '" << name << "'");
@@ -878,6 +912,130 @@ namespace DSL
             return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
         }
     }
+
+    DslReturnType Services::OdeActionFileRotationGet(const char* name, 
+        uint* maxSize, uint* maxAge)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            DSL_RETURN_IF_ODE_ACTION_IS_NOT_FILE_TYPE(m_odeActions, name);
+            
+            DSL_ODE_ACTION_FILE_PTR pOdeAction = 
+                std::dynamic_pointer_cast<FileOdeAction>(m_odeActions[name]);
+         
+            pOdeAction->GetRotation(maxSize, maxAge);
+
+            LOG_INFO("ODE File Action '" << name << "' returned Max Size = " 
+                << *maxSize << "KB and Max Age = " << *maxAge 
+                << "s successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE File Action '" << name 
+                << "' threw exception getting rotation settings");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeActionFileRotationSet(const char* name, 
+        uint maxSize, uint maxAge)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            DSL_RETURN_IF_ODE_ACTION_IS_NOT_FILE_TYPE(m_odeActions, name);
+            
+            DSL_ODE_ACTION_FILE_PTR pOdeAction = 
+                std::dynamic_pointer_cast<FileOdeAction>(m_odeActions[name]);
+         
+            pOdeAction->SetRotation(maxSize, maxAge);
+
+            LOG_INFO("ODE File Action '" << name << "' set Max Size = " 
+                << maxSize << "KB and Max Age = " << maxAge 
+                << "s successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE File Action '" << name 
+                << "' threw exception setting rotation settings");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeActionFileSyncPolicyGet(const char* name, 
+        uint* policy)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            DSL_RETURN_IF_ODE_ACTION_IS_NOT_FILE_TYPE(m_odeActions, name);
+            
+            DSL_ODE_ACTION_FILE_PTR pOdeAction = 
+                std::dynamic_pointer_cast<FileOdeAction>(m_odeActions[name]);
+         
+            *policy = pOdeAction->GetSyncPolicy();
+
+            LOG_INFO("ODE File Action '" << name << "' returned Sync Policy = " 
+                << *policy << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE File Action '" << name 
+                << "' threw exception getting Sync Policy");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeActionFileSyncPolicySet(const char* name, 
+        uint policy)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            DSL_RETURN_IF_ODE_ACTION_IS_NOT_FILE_TYPE(m_odeActions, name);
+            
+            if (policy > DSL_FILE_SYNC_POLICY_ON_WRITE)
+            {
+                LOG_ERROR("Sync Policy " << policy 
+                    << " is invalid for ODE File Action '" << name << "'");
+                return DSL_RESULT_ODE_ACTION_PARAMETER_INVALID;
+            }
+            DSL_ODE_ACTION_FILE_PTR pOdeAction = 
+                std::dynamic_pointer_cast<FileOdeAction>(m_odeActions[name]);
+         
+            pOdeAction->SetSyncPolicy(policy);
+
+            LOG_INFO("ODE File Action '" << name << "' set Sync Policy = " 
+                << policy << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE File Action '" << name 
+                << "' threw exception setting Sync Policy");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }                
     
     DslReturnType Services::OdeActionFillSurroundingsNew(const char* 
         name, const char* color)
@@ -1310,6 +1468,43 @@ namespace DSL
         }
     }
     
+    DslReturnType Services::OdeActionMonitorBatchNew(const char* name,
+        dsl_ode_monitor_occurrence_batch_cb clientMonitor, 
+        uint maxSize, uint window, void* clientData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure action name uniqueness 
+            if (m_odeActions.find(name) != m_odeActions.end())
+            {   
+                LOG_ERROR("ODE Action name '" << name << "' is not unique");
+                return DSL_RESULT_ODE_ACTION_NAME_NOT_UNIQUE;
+            }
+            if (maxSize == 0)
+            {
+                LOG_ERROR("Invalid max_size = 0 for Monitor Batch ODE Action '"
+                    << name << "'");
+                return DSL_RESULT_ODE_ACTION_PARAMETER_INVALID;
+            }
+            m_odeActions[name] = DSL_ODE_ACTION_MONITOR_BATCH_NEW(name, 
+                clientMonitor, maxSize, window, clientData);
+
+            LOG_INFO("New ODE Monitor Batch Action '" << name 
+                << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New ODE Monitor Batch Action '" << name 
+                << "' threw exception on create");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }
+    
     DslReturnType Services::OdeActionObjectRemoveNew(const char* name)
     {
         LOG_FUNC();
@@ -2259,6 +2454,93 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::OdeActionAsyncEnabledGet(const char* name, 
+        boolean* enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            DSL_RETURN_IF_ODE_ACTION_IS_NOT_DEFERRABLE_TYPE(m_odeActions, name);
+            
+            std::shared_ptr<DeferrableOdeAction> pOdeAction = 
+                std::dynamic_pointer_cast<DeferrableOdeAction>(m_odeActions[name]);
+         
+            *enabled = pOdeAction->GetAsyncEnabled();
+
+            LOG_INFO("ODE Action '" << name << "' returned Async Enabled = " 
+                << *enabled  << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << name 
+                << "' threw exception getting Async Enabled setting");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeActionAsyncEnabledSet(const char* name, 
+        boolean enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            DSL_RETURN_IF_ODE_ACTION_IS_NOT_DEFERRABLE_TYPE(m_odeActions, name);
+            
+            std::shared_ptr<DeferrableOdeAction> pOdeAction = 
+                std::dynamic_pointer_cast<DeferrableOdeAction>(m_odeActions[name]);
+         
+            pOdeAction->SetAsyncEnabled(enabled);
+
+            LOG_INFO("ODE Action '" << name << "' set Async Enabled = " 
+                << enabled  << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << name 
+                << "' threw exception setting Async Enabled");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeActionAsyncStatsGet(const char* name, 
+        uint64_t* queued, uint64_t* dropped)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            DSL_RETURN_IF_ODE_ACTION_IS_NOT_DEFERRABLE_TYPE(m_odeActions, name);
+            
+            std::shared_ptr<DeferrableOdeAction> pOdeAction = 
+                std::dynamic_pointer_cast<DeferrableOdeAction>(m_odeActions[name]);
+         
+            pOdeAction->GetAsyncStats(queued, dropped);
+
+            LOG_INFO("ODE Action '" << name << "' returned Async Queued = " 
+                << *queued << " and Dropped = " << *dropped << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << name 
+                << "' threw exception getting Async stats");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }                
+
     DslReturnType Services::OdeActionDelete(const char* name)
     {
         LOG_FUNC();
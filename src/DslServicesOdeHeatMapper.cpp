@@ -192,6 +192,117 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::OdeHeatMapperDecayGet(const char* name, 
+        uint* halfLife)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_HEAT_MAPPER_NAME_NOT_FOUND(m_odeHeatMappers, name);
+            
+            *halfLife = m_odeHeatMappers[name]->GetDecay();
+
+            LOG_INFO("ODE Heat-Mapper '" << name 
+                << "' returned decay half-life = " << *halfLife 
+                << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE HeatMapper '" << name 
+                << "' threw an exception getting decay half-life");
+            return DSL_RESULT_ODE_HEAT_MAPPER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeHeatMapperDecaySet(const char* name, 
+        uint halfLife)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_HEAT_MAPPER_NAME_NOT_FOUND(m_odeHeatMappers, name);
+            
+            if (!m_odeHeatMappers[name]->SetDecay(halfLife))
+            {
+                LOG_ERROR("ODE HeatMapper '" << name 
+                    << "' failed to set decay half-life");
+                return DSL_RESULT_ODE_HEAT_MAPPER_SET_FAILED;
+            }
+
+            LOG_INFO("ODE Heat-Mapper '" << name 
+                << "' set decay half-life = " << halfLife << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE HeatMapper '" << name 
+                << "' threw an exception setting decay half-life");
+            return DSL_RESULT_ODE_HEAT_MAPPER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeHeatMapperWindowGet(const char* name,
+        uint* interval, uint* intervals)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_HEAT_MAPPER_NAME_NOT_FOUND(m_odeHeatMappers, name);
+            
+            m_odeHeatMappers[name]->GetWindow(interval, intervals);
+
+            LOG_INFO("ODE Heat-Mapper '" << name 
+                << "' returned Window Settings successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE HeatMapper '" << name 
+                << "' threw an exception getting Window Settings");
+            return DSL_RESULT_ODE_HEAT_MAPPER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeHeatMapperWindowSet(const char* name,
+        uint interval, uint intervals)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_HEAT_MAPPER_NAME_NOT_FOUND(m_odeHeatMappers, name);
+            
+            if (!m_odeHeatMappers[name]->SetWindow(interval, intervals))
+            {
+                LOG_ERROR("ODE HeatMapper '" << name 
+                    << "' failed to set Window Settings");
+                return DSL_RESULT_ODE_HEAT_MAPPER_SET_FAILED;
+            }
+
+            LOG_INFO("ODE Heat-Mapper '" << name 
+                << "' set Window Settings successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE HeatMapper '" << name 
+                << "' threw an exception setting Window Settings");
+            return DSL_RESULT_ODE_HEAT_MAPPER_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::OdeHeatMapperMetricsClear(const char* name)
     {
         LOG_FUNC();
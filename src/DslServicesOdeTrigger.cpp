@@ -306,6 +306,156 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::OdeTriggerCustomBatchNew(const char* name, 
+        const char* source, uint classId, uint limit, 
+        dsl_ode_check_for_occurrences_cb client_checker, void* client_data)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure event name uniqueness 
+            if (m_odeTriggers.find(name) != m_odeTriggers.end())
+            {   
+                LOG_ERROR("ODE Trigger name '" << name << "' is not unique");
+                return DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE;
+            }
+            
+            m_odeTriggers[name] = DSL_ODE_TRIGGER_CUSTOM_BATCH_NEW(name, source,
+                classId, limit, client_checker, client_data);
+            
+            LOG_INFO("New Custom Batch ODE Trigger '" << name 
+                << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Custom Batch ODE Trigger '" << name 
+                << "' threw exception on create");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerCompositeNew(const char* name, 
+        const char* source, uint classId, uint limit, uint compositeOperator)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure event name uniqueness 
+            if (m_odeTriggers.find(name) != m_odeTriggers.end())
+            {   
+                LOG_ERROR("ODE Trigger name '" << name << "' is not unique");
+                return DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE;
+            }
+            if (compositeOperator > DSL_ODE_COMPOSITE_OPERATOR_OR)
+            {
+                LOG_ERROR("Invalid operator = " << compositeOperator 
+                    << " for Composite ODE Trigger '" << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            
+            m_odeTriggers[name] = DSL_ODE_TRIGGER_COMPOSITE_NEW(name, source,
+                classId, limit, compositeOperator);
+            
+            LOG_INFO("New Composite ODE Trigger '" << name 
+                << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Composite ODE Trigger '" << name 
+                << "' threw exception on create");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerCompositePredicateAdd(const char* name, 
+        const char* predicate, boolean negate)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, predicate);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
+                CompositeOdeTrigger);
+
+            if (std::string(name) == predicate)
+            {
+                LOG_ERROR("Composite ODE Trigger '" << name 
+                    << "' can not be added as a predicate of itself");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            
+            // Note: predicates can be added when in use, i.e. shared between
+            // multiple Composite ODE Triggers
+
+            DSL_ODE_TRIGGER_COMPOSITE_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<CompositeOdeTrigger>(m_odeTriggers[name]);
+
+            if (!pOdeTrigger->AddPredicate(m_odeTriggers[predicate], negate))
+            {
+                LOG_ERROR("Composite ODE Trigger '" << name
+                    << "' failed to add predicate '" << predicate << "'");
+                return DSL_RESULT_ODE_TRIGGER_SET_FAILED;
+            }
+            LOG_INFO("ODE Trigger '" << predicate
+                << "' was added to Composite ODE Trigger '" << name 
+                << "' successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Composite ODE Trigger '" << name
+                << "' threw exception adding predicate '" << predicate << "'");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerCompositePredicateRemove(const char* name, 
+        const char* predicate)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, predicate);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
+                CompositeOdeTrigger);
+
+            DSL_ODE_TRIGGER_COMPOSITE_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<CompositeOdeTrigger>(m_odeTriggers[name]);
+
+            if (!pOdeTrigger->RemovePredicate(m_odeTriggers[predicate]))
+            {
+                LOG_ERROR("ODE Trigger '" << predicate
+                    << "' is not a predicate of Composite ODE Trigger '" 
+                    << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_SET_FAILED;
+            }
+            LOG_INFO("ODE Trigger '" << predicate
+                << "' was removed from Composite ODE Trigger '" << name 
+                << "' successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Composite ODE Trigger '" << name
+                << "' threw exception removing predicate '" << predicate << "'");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::OdeTriggerCountNew(const char* name, const char* source, 
         uint classId, uint limit, uint minimum, uint maximum)
     {
@@ -2090,6 +2240,208 @@ namespace DSL
         }
     }                
     
+    DslReturnType Services::OdeTriggerPerSourceStateGet(const char* name, 
+        boolean* enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            *enabled = pOdeTrigger->GetPerSourceStateEnabled();
+            
+            LOG_INFO("Trigger '" << name << "' returned Per-Source State = " 
+                << *enabled << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name 
+                << "' threw exception getting Per-Source State");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+    
+    DslReturnType Services::OdeTriggerPerSourceStateSet(const char* name, 
+        boolean enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            pOdeTrigger->SetPerSourceStateEnabled(enabled);
+
+            LOG_INFO("Trigger '" << name << "' set Per-Source State = " 
+                << enabled << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name 
+                << "' threw exception setting Per-Source State");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+    
+    DslReturnType Services::OdeTriggerRateLimitGet(const char* name, 
+        float* rate, uint* burst)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            pOdeTrigger->GetRateLimit(rate, burst);
+            
+            LOG_INFO("Trigger '" << name << "' returned Rate Limit = " 
+                << *rate << " and Burst = " << *burst << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name 
+                << "' threw exception getting Rate Limit");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+    
+    DslReturnType Services::OdeTriggerRateLimitSet(const char* name, 
+        float rate, uint burst)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            if (rate < 0 or (rate > 0 and !burst))
+            {
+                LOG_ERROR("Invalid Rate Limit = " << rate << " and Burst = "
+                    << burst << " for ODE Trigger '" << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            pOdeTrigger->SetRateLimit(rate, burst);
+
+            LOG_INFO("Trigger '" << name << "' set Rate Limit = " 
+                << rate << " and Burst = " << burst << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name 
+                << "' threw exception setting Rate Limit");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+    
+    DslReturnType Services::OdeTriggerDebounceGet(const char* name, 
+        uint* window)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            *window = pOdeTrigger->GetDebounce();
+            
+            LOG_INFO("Trigger '" << name << "' returned Debounce window = " 
+                << *window << " ms successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name 
+                << "' threw exception getting Debounce window");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+    
+    DslReturnType Services::OdeTriggerDebounceSet(const char* name, 
+        uint window)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            pOdeTrigger->SetDebounce(window);
+
+            LOG_INFO("Trigger '" << name << "' set Debounce window = " 
+                << window << " ms successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name 
+                << "' threw exception setting Debounce window");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+    
+    DslReturnType Services::OdeTriggerStatsGet(const char* name, 
+        dsl_ode_trigger_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            pOdeTrigger->GetStats(stats);
+
+            LOG_INFO("Trigger '" << name << "' returned Stats with occurrences = " 
+                << stats->occurrences << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name 
+                << "' threw exception getting Stats");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+    
     DslReturnType Services::OdeTriggerActionAdd(const char* name, const char* action)
     {
         LOG_FUNC();
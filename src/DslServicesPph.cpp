@@ -372,6 +372,166 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::PphOdeParallelModeGet(const char* name, 
+        boolean* enabled, uint* maxWorkers)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                OdePadProbeHandler);
+
+            DSL_PPH_ODE_PTR pOde = 
+                std::dynamic_pointer_cast<OdePadProbeHandler>(
+                    m_padProbeHandlers[name]);
+            
+            bool bEnabled(false);
+            pOde->GetParallelMode(&bEnabled, maxWorkers);
+            *enabled = bEnabled;
+
+            LOG_INFO("ODE Pad Probe Handler '" << name 
+                << "' returned parallel mode enabled = " << *enabled
+                << " and max-workers = " << *maxWorkers << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' threw an exception getting parallel mode");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphOdeParallelModeSet(const char* name, 
+        boolean enabled, uint maxWorkers)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                OdePadProbeHandler);
+            
+            DSL_PPH_ODE_PTR pOde = 
+                std::dynamic_pointer_cast<OdePadProbeHandler>(
+                    m_padProbeHandlers[name]); 
+
+            pOde->SetParallelMode(enabled, maxWorkers);
+
+            LOG_INFO("ODE Pad Probe Handler '" << name 
+                << "' set parallel mode enabled = " << enabled 
+                << " and max-workers = " << maxWorkers << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' threw an exception setting parallel mode");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphOdeStatsEnabledGet(const char* name, 
+        boolean* enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                OdePadProbeHandler);
+
+            DSL_PPH_ODE_PTR pOde = 
+                std::dynamic_pointer_cast<OdePadProbeHandler>(
+                    m_padProbeHandlers[name]);
+            
+            *enabled = pOde->GetStatsEnabled();
+
+            LOG_INFO("ODE Pad Probe Handler '" << name 
+                << "' returned stats enabled = " << *enabled << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' threw an exception getting stats enabled");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphOdeStatsEnabledSet(const char* name, 
+        boolean enabled)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                OdePadProbeHandler);
+
+            DSL_PPH_ODE_PTR pOde = 
+                std::dynamic_pointer_cast<OdePadProbeHandler>(
+                    m_padProbeHandlers[name]);
+            
+            pOde->SetStatsEnabled(enabled);
+
+            LOG_INFO("ODE Pad Probe Handler '" << name 
+                << "' set stats enabled = " << enabled << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' threw an exception setting stats enabled");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphOdeStatsGet(const char* name, 
+        dsl_pph_ode_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, 
+                OdePadProbeHandler);
+
+            DSL_PPH_ODE_PTR pOde = 
+                std::dynamic_pointer_cast<OdePadProbeHandler>(
+                    m_padProbeHandlers[name]);
+            
+            pOde->GetStats(stats);
+
+            LOG_INFO("ODE Pad Probe Handler '" << name 
+                << "' returned stats with frames = " << stats->frames 
+                << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' threw an exception getting stats");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::PphBufferTimeoutNew(const char* name,
         uint timeout, dsl_pph_buffer_timeout_handler_cb handler, void* clientData)
     {
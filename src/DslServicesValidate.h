@@ -64,6 +64,26 @@ THE SOFTWARE.
     } \
 }while(0); 
 
+#define DSL_RETURN_IF_ODE_ACTION_IS_NOT_FILE_TYPE(actions, name) do \
+{ \
+    if (!actions[name]->IsType(typeid(FileTextOdeAction)) and \
+        !actions[name]->IsType(typeid(FileCsvOdeAction)) and \
+        !actions[name]->IsType(typeid(FileMotcOdeAction)))\
+    { \
+        LOG_ERROR("ODE Action '" << name << "' is not the correct type"); \
+        return DSL_RESULT_ODE_ACTION_NOT_THE_CORRECT_TYPE; \
+    } \
+}while(0); 
+
+#define DSL_RETURN_IF_ODE_ACTION_IS_NOT_DEFERRABLE_TYPE(actions, name) do \
+{ \
+    if (!std::dynamic_pointer_cast<DeferrableOdeAction>(actions[name]))\
+    { \
+        LOG_ERROR("ODE Action '" << name << "' is not the correct type"); \
+        return DSL_RESULT_ODE_ACTION_NOT_THE_CORRECT_TYPE; \
+    } \
+}while(0); 
+
 #define DSL_RETURN_IF_ODE_ACCUMULATOR_NAME_NOT_FOUND(events, name) do \
 { \
     if (events.find(name) == events.end()) \
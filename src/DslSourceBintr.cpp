@@ -28,6 +28,8 @@ THE SOFTWARE.
 #include "DslServices.h"
 #include "DslSourceBintr.h"
 #include "DslPipelineBintr.h"
+#include "DslRtspReconnectScheduler.h"
+#include "DslTimerWheel.h"
 #include "DslSurfaceTransform.h"
 #include <nvdsgstutils.h>
 #include <gst/app/gstappsrc.h>
@@ -3295,10 +3297,7 @@ namespace DSL
         , m_firstConnectTime(0)
         , m_bufferTimeout(timeout)
         , m_streamManagerTimerId(0)
-        , m_reconnectionManagerTimerId(0)
         , m_connectionData{0}
-        , m_reconnectionFailed(false)
-        , m_reconnectionSleep(0)
         , m_reconnectionStartTime{0}
         , m_currentState(GST_STATE_NULL)
         , m_previousState(GST_STATE_NULL)
@@ -3435,13 +3434,17 @@ namespace DSL
     {
         LOG_FUNC();
         
-        if (m_reconnectionManagerTimerId)
+        // End the reconnection cycle if in progress.
+        RtspReconnectScheduler::GetScheduler()->Cancel(this);
+
+        // Stop the one-shot listener notification timer if pending.
         {
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_reconnectionManagerMutex);
-            g_source_remove(m_reconnectionManagerTimerId);
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_stateChangeMutex);
+            if (m_listenerNotifierTimerId)
+            {
+                TimerWheel::GetTimerWheel()->Remove(m_listenerNotifierTimerId);
+            }
         }
-
-        // Note: don't need t worry about stopping the one-shot m_listenerNotifierTimerId
         
         m_pSrcPadBufferProbe->RemovePadProbeHandler(m_TimestampPph);
     }
@@ -3466,7 +3469,7 @@ namespace DSL
             // and playing after a previous play and stop.
             m_firstConnectTime = 0;
             
-            m_streamManagerTimerId = g_timeout_add(
+            m_streamManagerTimerId = TimerWheel::GetTimerWheel()->Add(
                 DSL_RTSP_TEST_FOR_BUFFER_TIMEOUT_PERIOD_MS, 
                 RtspStreamManagerHandler, this);
             LOG_INFO("Starting stream management for RTSP Source '" 
@@ -3492,17 +3495,17 @@ namespace DSL
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_streamManagerMutex);
             
-            g_source_remove(m_streamManagerTimerId);
+            TimerWheel::GetTimerWheel()->Remove(m_streamManagerTimerId);
             m_streamManagerTimerId = 0;
             LOG_INFO("Stream management disabled for RTSP Source '" 
                 << GetName() << "'");
         }
-        if (m_reconnectionManagerTimerId)
+        if (RtspReconnectScheduler::GetScheduler()->Cancel(this))
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_reconnectionManagerMutex);
 
-            g_source_remove(m_reconnectionManagerTimerId);
-            m_reconnectionManagerTimerId = 0;
+            // Clear the reset-state so that stream management restarts on relink. 
+            m_connectionData.is_in_reconnect = false;
             LOG_INFO("Reconnection management disabled for RTSP Source '" 
                 << GetName() << "'");
         }
@@ -3576,7 +3579,7 @@ namespace DSL
             if (m_streamManagerTimerId)
             {
                 // shutdown the current session
-                g_source_remove(m_streamManagerTimerId);
+                TimerWheel::GetTimerWheel()->Remove(m_streamManagerTimerId);
                 m_streamManagerTimerId = 0;
                 LOG_INFO("Stream management disabled for RTSP Source '" << GetName() << "'");
             }
@@ -3584,19 +3587,17 @@ namespace DSL
             if (timeout)
             {
                 // Start up stream mangement
-                m_streamManagerTimerId = g_timeout_add(timeout, 
-                    RtspReconnectionMangerHandler, this);
+                m_streamManagerTimerId = TimerWheel::GetTimerWheel()->Add(
+                    DSL_RTSP_TEST_FOR_BUFFER_TIMEOUT_PERIOD_MS, 
+                    RtspStreamManagerHandler, this);
                 LOG_INFO("Stream management enabled for RTSP Source '" 
                     << GetName() << "' with timeout = " << timeout);
             }
             // Else, the client is disabling stream mangagement. Shut down the 
             // reconnection cycle if running. 
-            else if (m_reconnectionManagerTimerId)
+            else if (RtspReconnectScheduler::GetScheduler()->Cancel(this))
             {
-                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_reconnectionManagerMutex);
-                // shutdown the current reconnection cycle
-                g_source_remove(m_reconnectionManagerTimerId);
-                m_reconnectionManagerTimerId = 0;
+                m_connectionData.is_in_reconnect = false;
                 LOG_INFO("Reconnection management disabled for RTSP Source '" << GetName() << "'");
             }
         }
@@ -4011,8 +4012,8 @@ namespace DSL
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_streamManagerMutex);
 
-        // if currently in a reset cycle then let the ResetStream 
-        // handler continue to handle
+        // if currently in a reset cycle then let the Reconnect 
+        // Scheduler continue to handle
         if (m_connectionData.is_in_reconnect)
         {
             return true;
@@ -4065,123 +4066,86 @@ namespace DSL
             {
                 m_pTapBintr->HandleEos();
             }
+        }
+        
+        // Set the reset-state and hand the Source to the shared Reconnect 
+        // Scheduler, which starts the cycle on its next timer tick.
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_reconnectionManagerMutex);
             
-            // Call the Reconnection Managter directly to start the reconnection cycle,
-            if (!ReconnectionManager())
-            {
-                LOG_INFO("Unable to start re-connection manager for '" << GetName() << "'");
-                return false;
-            }
+            m_connectionData.is_connected = false;
+            m_connectionData.retries = 0;
+            m_connectionData.is_in_reconnect = true;
         }
-        LOG_INFO("Starting Re-connection Manager for source '" << GetName() << "'");
-        m_reconnectionManagerTimerId = g_timeout_add(1000, RtspReconnectionMangerHandler, this);
+        LOG_INFO("Scheduling reconnection for source '" << GetName() << "'");
+        RtspReconnectScheduler::GetScheduler()->Schedule(this);
 
         return true;
     }
     
-    int RtspSourceBintr::ReconnectionManager()
+    bool RtspSourceBintr::StartReconnectAttempt()
     {
+        LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_reconnectionManagerMutex);
-        do
-        {
-            timeval currentTime;
-            gettimeofday(&currentTime, NULL);
-            
-            uint stateResult(0);
-            GstState currentState;
-            
-            if (!m_connectionData.is_in_reconnect or m_reconnectionFailed or 
-                (currentTime.tv_sec - m_reconnectionStartTime.tv_sec) > m_connectionData.timeout)
-            {
-                // set the reset-state,
-                if (!m_connectionData.is_in_reconnect)
-                {
-                    m_connectionData.is_connected = false;
-                    m_connectionData.retries = 0;
-                    m_connectionData.is_in_reconnect = true;
-                }
-                // if the previous attempt failed
-                else if (m_reconnectionFailed == true)
-                {
-                    m_reconnectionSleep-=1;
-                    if (m_reconnectionSleep)
-                    {
-                        return true;
-                    }
-                    m_reconnectionFailed = false;    
-                }
-                m_connectionData.retries++;
 
-                LOG_INFO("Resetting RTSP Source '" << GetName() 
-                    << "' with retry count = " << m_connectionData.retries);
-                
-                m_reconnectionStartTime = currentTime;
+        m_connectionData.retries++;
 
-                if (SetState(GST_STATE_NULL, 0) != GST_STATE_CHANGE_SUCCESS)
-                {
-                    LOG_ERROR("Failed to set RTSP Source '" << GetName() << "' to GST_STATE_NULL");
-                    return false;
-                }
-                // update the internal state variable to notify all client listeners 
-                SetCurrentState(GST_STATE_NULL);
-                return true;
-            }
-            else
-            {   
-                // Waiting for the Source to reconnect, check the state again
-                stateResult = GetState(currentState, GST_SECOND);
-            }
-                
-            // update the internal state variable to notify all client listeners 
-            SetCurrentState(currentState);
-            switch (stateResult) 
-            {
-                case GST_STATE_CHANGE_NO_PREROLL:
-                    LOG_INFO("RTSP Source '" << GetName() 
-                        << "' returned GST_STATE_CHANGE_NO_PREROLL");
-                    // fall through ... do not break
-                case GST_STATE_CHANGE_SUCCESS:
-                    if (currentState == GST_STATE_NULL)
-                    {
-                        // synchronize the source's state with the Pipleine's
-                        SyncStateWithParent(currentState, 1);
-                        return true;
-                    }
-                    if (currentState == GST_STATE_PLAYING)
-                    {
-                        LOG_INFO("Re-connection complete for RTSP Source'" << GetName() << "'");
-                        m_connectionData.is_in_reconnect = false;
-
-                        // update the current buffer timestamp to the current reset time
-                        m_TimestampPph->SetTime(currentTime);
-                        m_reconnectionManagerTimerId = 0;
-                        return false;
-                    }
-                    
-                    // If state change completed succesfully, but not yet playing, set explicitely.
-                    SetState(GST_STATE_PLAYING, 
-                        DSL_DEFAULT_STATE_CHANGE_TIMEOUT_IN_SEC * GST_SECOND);
-                    break;
-                    
-                case GST_STATE_CHANGE_ASYNC:
-                    LOG_INFO("State change will complete asynchronously for RTSP Source '" 
-                        << GetName() << "'");
-                    break;
+        LOG_INFO("Resetting RTSP Source '" << GetName() 
+            << "' with retry count = " << m_connectionData.retries);
+        
+        gettimeofday(&m_reconnectionStartTime, NULL);
 
-                case GST_STATE_CHANGE_FAILURE:
-                    LOG_ERROR("FAILURE occured when trying to sync state for RTSP Source '" 
-                        << GetName() << "'");
-                    m_reconnectionFailed = true;
-                    m_reconnectionSleep = m_connectionData.sleep;
-                    LOG_INFO("Sleeping after failed connection");
-                    return true;
+        if (!SetState(GST_STATE_NULL, 0))
+        {
+            LOG_ERROR("Failed to set RTSP Source '" << GetName() << "' to GST_STATE_NULL");
+            return false;
+        }
+        // update the internal state variable to notify all client listeners 
+        SetCurrentState(GST_STATE_NULL);
+        
+        // Synchronize the source's state with the Pipleine's without waiting. 
+        // Completion and errors are reported through the Pipeline's bus.
+        GstState parentState;
+        if (SyncStateWithParent(parentState, 0) == GST_STATE_CHANGE_FAILURE)
+        {
+            LOG_ERROR("FAILURE occured when trying to sync state for RTSP Source '" 
+                << GetName() << "'");
+            return false;
+        }
+        return true;
+    }
+    
+    bool RtspSourceBintr::IsReconnected()
+    {
+        // No function log - avoid overhead.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_reconnectionManagerMutex);
+        
+        struct timeval lastBufferTime;
+        m_TimestampPph->GetTime(lastBufferTime);
+        
+        return timercmp(&lastBufferTime, &m_reconnectionStartTime, >);
+    }
+    
+    void RtspSourceBintr::CompleteReconnect()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_reconnectionManagerMutex);
 
-                default:
-                    LOG_ERROR("Unknown 'state change result' when trying to sync state for RTSP Source '" 
-                        << GetName() << "'");
-                    return true;
-            }
-        }while(true);
+        LOG_INFO("Re-connection complete for RTSP Source'" << GetName() << "'");
+        
+        struct timeval currentTime;
+        gettimeofday(&currentTime, NULL);
+        
+        // A reconnection is only counted once buffers are flowing again, not
+        // each time an attempt takes the Source to PLAYING.
+        m_connectionData.is_in_reconnect = false;
+        m_connectionData.is_connected = true;
+        if (!m_connectionData.first_connected)
+        {
+            m_connectionData.first_connected = currentTime.tv_sec;
+        }
+        m_connectionData.last_connected = currentTime.tv_sec;
+        m_connectionData.count++;
     }
     
     GstState RtspSourceBintr::GetCurrentState()
@@ -4219,7 +4183,11 @@ namespace DSL
                 m_connectionData.is_connected = false;
                 m_connectionData.last_disconnected = currentTime.tv_sec;
             }
-            if (m_currentState == GST_STATE_PLAYING)
+            // Only the initial connection is counted on PLAYING. Reconnections
+            // are counted by CompleteReconnect.
+            if (m_currentState == GST_STATE_PLAYING and 
+                !m_connectionData.is_in_reconnect and 
+                !m_connectionData.is_connected)
             {
                 m_connectionData.is_connected = true;
                 
@@ -4242,7 +4210,8 @@ namespace DSL
                 // start the asynchronous notification timer if not currently running
                 if (!m_listenerNotifierTimerId)
                 {
-                    m_listenerNotifierTimerId = g_timeout_add(1, RtspListenerNotificationHandler, this);
+                    m_listenerNotifierTimerId = TimerWheel::GetTimerWheel()->Add(1, 
+                        RtspListenerNotificationHandler, this);
                 }
             }
         }
@@ -4333,12 +4302,6 @@ namespace DSL
             StreamManager();
     }
 
-    static int RtspReconnectionMangerHandler(gpointer pSource)
-    {
-        return static_cast<RtspSourceBintr*>(pSource)->
-            ReconnectionManager();
-    }
-
     static int RtspListenerNotificationHandler(gpointer pSource)
     {
         return static_cast<RtspSourceBintr*>(pSource)->
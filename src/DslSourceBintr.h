@@ -1868,9 +1868,27 @@ namespace DSL
         int StreamManager();
         
         /**
-         * @brief Called to manage the reconnection cycle on loss of connection
+         * @brief Called by the RTSP Reconnect Scheduler to start a new 
+         * reconnection attempt. The Source is reset and its state change
+         * back to that of its parent is started without waiting.
+         * @return true if the attempt was started, false on failure.
          */
-        int ReconnectionManager();
+        bool StartReconnectAttempt();
+        
+        /**
+         * @brief Called by the RTSP Reconnect Scheduler to check if the 
+         * current reconnection attempt has completed.
+         * @return true if a new buffer has been received since the start 
+         * of the current attempt, false otherwise.
+         */
+        bool IsReconnected();
+        
+        /**
+         * @brief Called by the RTSP Reconnect Scheduler to end the 
+         * reconnection cycle on successful reconnection. Marks the Source
+         * as connected and updates the connection count and times.
+         */
+        void CompleteReconnect();
         
         /**
          * @brief gets the RTSP Source's current state as maintaned by the component.
@@ -2108,29 +2126,14 @@ namespace DSL
          */
         dsl_rtsp_connection_data m_connectionData;
         
-        /**
-         * @brief gnome timer Id for the RTSP reconnection manager
-         */
-        uint m_reconnectionManagerTimerId;
-
         /**
          * @brief mutux to guard the reconnection managment read/write attributes.
          */
         DslMutex m_reconnectionManagerMutex;
         
         /**
-         * @brief will be set to true on reconnection failure to force a mew reconnection cycle
-         */
-        bool m_reconnectionFailed;
-        
-        /**
-         * @brief remaining time to sleep after a failed reconnection attemp, in seconds. 
-         */
-        uint m_reconnectionSleep;
-        
-        /**
-         * @brief start time of the most recent reconnection cycle, used for maximum timeout 
-         * for async state change completion
+         * @brief start time of the most recent reconnection attempt, used 
+         * to detect the first new buffer received for the attempt.
          */
         timeval m_reconnectionStartTime;
 
@@ -2243,13 +2246,6 @@ namespace DSL
      */
     static int RtspStreamManagerHandler(gpointer pSource);
     
-    /**
-     * @brief Timer callback handler to invoke the RTSP Source's Reconnection Manager.
-     * @param[in] pSource shared pointer to RTSP Source component to invoke.
-     * @return int true to continue, 0 to self remove
-     */
-    static int RtspReconnectionMangerHandler(gpointer pSource);
-    
     /**
      * @brief Timer callback handler to invoke the RTSP Source's Listerner notification.
      * @param[in] pSource shared pointer to RTSP Source component to invoke.
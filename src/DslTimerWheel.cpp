@@ -0,0 +1,300 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "Dsl.h"
+#include "DslTimerWheel.h"
+
+namespace DSL
+{
+    TimerWheel* TimerWheel::GetTimerWheel()
+    {
+        static TimerWheel timerWheel;
+        
+        return &timerWheel;
+    }
+    
+    TimerWheel::TimerWheel()
+        : m_nextTick(0)
+        , m_nextTimerId(1)
+        , m_timerId(0)
+    {
+        LOG_FUNC();
+        
+        m_nextTick = getCurrentTick();
+    }
+    
+    TimerWheel::~TimerWheel()
+    {
+        LOG_FUNC();
+        
+        if (m_timerId)
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_wheelMutex);
+            g_source_remove(m_timerId);
+        }
+    }
+    
+    uint TimerWheel::Add(uint interval, GSourceFunc handler, 
+        gpointer clientData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_wheelMutex);
+        
+        // The wheel falls behind the current time while the main-loop is busy,
+        // or while the main-loop timer is stopped for an empty wheel.
+        uint64_t startTick = std::max(m_nextTick, getCurrentTick() + 1);
+        
+        // An empty wheel has nothing to process - so jump ahead.
+        if (m_timers.empty())
+        {
+            m_nextTick = startTick;
+        }
+        
+        // Round up to whole ticks, counting from the end of the current 
+        // tick so that a timer never expires early, even if the wheel has 
+        // yet to catch up.
+        uint64_t ticks = std::max(1U, 
+            (interval + DSL_TIMER_WHEEL_TICK_MS - 1) / DSL_TIMER_WHEEL_TICK_MS);
+        uint64_t expires = startTick + ticks;
+        
+        uint timerId(0);
+        while (!timerId or m_timers.find(timerId) != m_timers.end())
+        {
+            timerId = m_nextTimerId++;
+        }
+        
+        std::list<TimerWheelEntry> newEntry;
+        newEntry.emplace_back(timerId, ticks, expires, handler, clientData);
+        
+        auto ientry = newEntry.begin();
+        m_timers[timerId] = ientry;
+        placeEntry(ientry, newEntry);
+        
+        if (!m_timerId)
+        {
+            m_timerId = g_timeout_add(DSL_TIMER_WHEEL_TICK_MS, 
+                TimerWheelHandler, this);
+        }
+        return timerId;
+    }
+    
+    bool TimerWheel::Remove(uint timerId)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_wheelMutex);
+        
+        auto imap = m_timers.find(timerId);
+        if (imap == m_timers.end())
+        {
+            LOG_WARN("Timer with id = " << timerId 
+                << " was not found in the Timer Wheel");
+            return false;
+        }
+        imap->second->pSlot->erase(imap->second);
+        m_timers.erase(imap);
+        return true;
+    }
+    
+    uint TimerWheel::GetTimerCount()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_wheelMutex);
+        
+        return m_timers.size();
+    }
+    
+    int TimerWheel::HandleTimerTick()
+    {
+        // No function log - avoid overhead.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_wheelMutex);
+        
+        // Catch up on any ticks missed while the main-loop was busy.
+        uint64_t currentTick = getCurrentTick();
+        while (m_nextTick <= currentTick)
+        {
+            processTick();
+        }
+        
+        if (m_timers.empty())
+        {
+            // clear the timer id and return false to self remove
+            m_timerId = 0;
+            return false;
+        }
+        return true;
+    }
+    
+    void TimerWheel::AdvanceTicks(uint ticks)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_wheelMutex);
+        
+        for (uint i = 0; i < ticks; i++)
+        {
+            processTick();
+        }
+    }
+    
+    void TimerWheel::placeEntry(std::list<TimerWheelEntry>::iterator entry,
+        std::list<TimerWheelEntry>& fromList)
+    {
+        // No function log - avoid overhead.
+        
+        uint64_t expires = entry->expires;
+        
+        // Past due entries go in the next slot to process.
+        if (expires < m_nextTick)
+        {
+            expires = m_nextTick;
+        }
+        
+        // Entries beyond the span of the wheel are placed in the furthest
+        // slot and re-placed when it cascades.
+        uint64_t span = 1ULL << (DSL_TIMER_WHEEL_SLOT_BITS*DSL_TIMER_WHEEL_LEVELS);
+        if (expires - m_nextTick >= span)
+        {
+            expires = m_nextTick + span - 1;
+        }
+        
+        uint64_t delta = expires - m_nextTick;
+        uint level(0);
+        while (delta >= (1ULL << (DSL_TIMER_WHEEL_SLOT_BITS*(level+1))))
+        {
+            level++;
+        }
+        uint slot = (expires >> (DSL_TIMER_WHEEL_SLOT_BITS*level)) & 
+            (DSL_TIMER_WHEEL_SLOTS - 1);
+            
+        std::list<TimerWheelEntry>& toList = m_slots[level][slot];
+        toList.splice(toList.end(), fromList, entry);
+        entry->pSlot = &toList;
+    }
+    
+    uint TimerWheel::cascade(uint level)
+    {
+        // No function log - avoid overhead.
+        
+        uint slot = (m_nextTick >> (DSL_TIMER_WHEEL_SLOT_BITS*level)) & 
+            (DSL_TIMER_WHEEL_SLOTS - 1);
+        
+        std::list<TimerWheelEntry> cascading;
+        cascading.splice(cascading.end(), m_slots[level][slot]);
+        
+        while (cascading.size())
+        {
+            placeEntry(cascading.begin(), cascading);
+        }
+        return slot;
+    }
+    
+    void TimerWheel::processTick()
+    {
+        // No function log - avoid overhead.
+        
+        uint64_t tick = m_nextTick;
+        uint slot = tick & (DSL_TIMER_WHEEL_SLOTS - 1);
+        
+        // Cascade the next slot of each higher level down as the level 
+        // below wraps around.
+        if (!slot)
+        {
+            for (uint level = 1; level < DSL_TIMER_WHEEL_LEVELS; level++)
+            {
+                if (cascade(level))
+                {
+                    break;
+                }
+            }
+        }
+        m_nextTick++;
+        
+        if (m_slots[0][slot].empty())
+        {
+            return;
+        }
+        m_expired.splice(m_expired.end(), m_slots[0][slot]);
+        for (auto& ientry: m_expired)
+        {
+            ientry.pSlot = &m_expired;
+        }
+        
+        while (m_expired.size())
+        {
+            auto ientry = m_expired.begin();
+            
+            // Clamped entries beyond the span of the wheel are re-placed.
+            if (ientry->expires > tick)
+            {
+                placeEntry(ientry, m_expired);
+                continue;
+            }
+            m_dispatching.splice(m_dispatching.end(), m_expired, ientry);
+            ientry->pSlot = &m_dispatching;
+            
+            GSourceFunc handler = ientry->handler;
+            gpointer clientData = ientry->clientData;
+            uint timerId = ientry->timerId;
+            
+            // Release the mutex while calling the handler so that it can
+            // add and remove timers, including itself.
+            g_mutex_unlock(&m_wheelMutex);
+            int result = handler(clientData);
+            g_mutex_lock(&m_wheelMutex);
+            
+            // Removed while the handler was being called.
+            if (m_dispatching.empty())
+            {
+                continue;
+            }
+            if (result)
+            {
+                // Re-arm from the current time, not from the tick being 
+                // processed, so that a repeating timer fires once after a 
+                // stall rather than back-to-back while the wheel catches up.
+                ientry->expires = std::max(tick, getCurrentTick()) + 
+                    ientry->interval;
+                placeEntry(ientry, m_dispatching);
+            }
+            else
+            {
+                m_timers.erase(timerId);
+                m_dispatching.clear();
+            }
+        }
+    }
+
+    uint64_t TimerWheel::getCurrentTick()
+    {
+        // No function log - avoid overhead.
+        
+        return g_get_monotonic_time() / (1000*DSL_TIMER_WHEEL_TICK_MS);
+    }
+    
+    static int TimerWheelHandler(gpointer pTimerWheel)
+    {
+        return static_cast<TimerWheel*>(pTimerWheel)->
+            HandleTimerTick();
+    }
+}
@@ -0,0 +1,228 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#ifndef _DSL_TIMER_WHEEL_H
+#define _DSL_TIMER_WHEEL_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @brief resolution of the timer wheel - the period of its single
+     * main-loop timer. In units of milliseconds.
+     */
+    #define DSL_TIMER_WHEEL_TICK_MS                                     10
+    
+    /**
+     * @brief number of levels in the hierarchical wheel, and slots per level
+     * as a power of 2. Level 0 spans 64 ticks, and each level above spans 
+     * 64 times the level below; 4 levels span over 46 hours.
+     */
+    #define DSL_TIMER_WHEEL_LEVELS                                      4
+    #define DSL_TIMER_WHEEL_SLOT_BITS                                   6
+    #define DSL_TIMER_WHEEL_SLOTS                                       \
+        (1 << DSL_TIMER_WHEEL_SLOT_BITS)
+
+    /**
+     * @struct TimerWheelEntry
+     * @brief A single timer registered with the Timer Wheel.
+     */
+    struct TimerWheelEntry
+    {
+        TimerWheelEntry(uint timerId, uint64_t interval, uint64_t expires,
+            GSourceFunc handler, gpointer clientData)
+            : timerId(timerId)
+            , interval(interval)
+            , expires(expires)
+            , handler(handler)
+            , clientData(clientData)
+            , pSlot(NULL)
+        {};
+        
+        /**
+         * @brief unique id returned to the client on Add.
+         */
+        uint timerId;
+        
+        /**
+         * @brief timer interval, and the absolute tick the timer is due on.
+         * In units of ticks.
+         */
+        uint64_t interval;
+        uint64_t expires;
+        
+        /**
+         * @brief client handler and data. The handler returns true to be 
+         * called again after interval, false to remove the timer.
+         */
+        GSourceFunc handler;
+        gpointer clientData;
+        
+        /**
+         * @brief slot list currently holding the entry.
+         */
+        std::list<TimerWheelEntry>* pSlot;
+    };
+    
+    /**
+     * @class TimerWheel
+     * @brief Process-wide hierarchical timer wheel for all stream-health, 
+     * buffer-timeout and reset timers. A single main-loop timer drives the 
+     * wheel, and each tick only visits the current slot, so the cost per 
+     * tick is independent of the number of timers registered. Handlers are 
+     * called from the main-loop with the same semantics as g_timeout_add.
+     */
+    class TimerWheel
+    {
+    public:
+    
+        /**
+         * @brief Gets the process-wide Timer Wheel.
+         */
+        static TimerWheel* GetTimerWheel();
+        
+        TimerWheel();
+        
+        ~TimerWheel();
+        
+        /**
+         * @brief Adds a new timer to the wheel. Replaces g_timeout_add.
+         * @param[in] interval time between calls in milliseconds, rounded 
+         * up to a whole number of ticks.
+         * @param[in] handler function to call when the timer expires. 
+         * Return true to continue, false to remove the timer.
+         * @param[in] clientData opaque pointer passed back to the handler.
+         * @return unique, non-zero id for the new timer.
+         */
+        uint Add(uint interval, GSourceFunc handler, gpointer clientData);
+        
+        /**
+         * @brief Removes a timer from the wheel. Replaces g_source_remove.
+         * Safe to call from within the timer's own handler.
+         * @param[in] timerId id of the timer to remove.
+         * @return true on success, false if the timer does not exist.
+         */
+        bool Remove(uint timerId);
+        
+        /**
+         * @brief Gets the number of timers currently registered.
+         */
+        uint GetTimerCount();
+        
+        /**
+         * @brief Advances the wheel to the current time, calling the 
+         * handlers of all expired timers. Called by the main-loop timer.
+         * @return true to continue, false to self remove when there are no
+         * timers registered.
+         */
+        int HandleTimerTick();
+        
+        /**
+         * @brief Advances the wheel by a number of ticks independent of the
+         * current time. Used for the purposes of test.
+         * @param[in] ticks number of ticks to advance.
+         */
+        void AdvanceTicks(uint ticks);
+        
+    private:
+    
+        /**
+         * @brief Places an entry in the slot for its expiry tick, relative 
+         * to the next tick to process. Mutex must be held.
+         * @param[in] entry list iterator for the entry to place.
+         * @param[in] fromList list currently holding the entry.
+         */
+        void placeEntry(std::list<TimerWheelEntry>::iterator entry,
+            std::list<TimerWheelEntry>& fromList);
+            
+        /**
+         * @brief Re-places all entries from one slot of a level > 0 into
+         * the levels below. Mutex must be held.
+         * @return index of the slot cascaded.
+         */
+        uint cascade(uint level);
+        
+        /**
+         * @brief Processes the next tick - cascading as required and 
+         * calling the handler for each expired entry. Mutex must be held
+         * and is released while each handler is called.
+         */
+        void processTick();
+        
+        /**
+         * @brief Gets the current absolute tick from the monotonic clock.
+         */
+        uint64_t getCurrentTick();
+
+        /**
+         * @brief slots for each level of the wheel.
+         */
+        std::list<TimerWheelEntry> m_slots[DSL_TIMER_WHEEL_LEVELS]
+            [DSL_TIMER_WHEEL_SLOTS];
+            
+        /**
+         * @brief expired entries for the tick in process, and the single
+         * entry with its handler currently being called.
+         */
+        std::list<TimerWheelEntry> m_expired;
+        std::list<TimerWheelEntry> m_dispatching;
+        
+        /**
+         * @brief map of timer ids to entries for O(1) removal.
+         */
+        std::unordered_map<uint, std::list<TimerWheelEntry>::iterator> m_timers;
+        
+        /**
+         * @brief next absolute tick to process.
+         */
+        uint64_t m_nextTick;
+        
+        /**
+         * @brief next timer id to assign, skipping 0 and ids in use.
+         */
+        uint m_nextTimerId;
+        
+        /**
+         * @brief gnome timer id for the wheel's main-loop timer.
+         */
+        uint m_timerId;
+        
+        /**
+         * @brief mutex to protect mutual access to all wheel data.
+         */
+        DslMutex m_wheelMutex;
+    };
+    
+    /**
+     * @brief Timer callback for the TimerWheel.
+     * @param pTimerWheel pointer to the TimerWheel.
+     * @return true to continue, false to self remove.
+     */
+    static int TimerWheelHandler(gpointer pTimerWheel);
+}
+
+#endif // _DSL_TIMER_WHEEL_H
@@ -99,51 +99,16 @@ namespace DSL
         }
     }
 
-    AvJpgOutputFile::AvJpgOutputFile(
-        std::shared_ptr<DslBufferSurface> pBufferSurface, 
-        const char* filepath)
-        : m_rgbaImage(NULL)
-        , m_outfile(NULL)
+    AvJpgEncoder::AvJpgEncoder(uint width, uint height)
+        : m_width(width)
+        , m_height(height)
         , m_pPkt(NULL)
+        , m_pDstFrame(NULL)
         , m_pMjpegCodecContext(NULL)
         , m_pScaleContext(NULL)
     {
         LOG_FUNC();
 
-        // Get the dimensions of the buffer-surface
-        uint width = (&(*pBufferSurface))->surfaceList[0].width;
-        uint height = (&(*pBufferSurface))->surfaceList[0].height;
-
-        // Allocate and initialize a new array to create a compressed buffer 
-        // of raw RGBA image data - i.e. with the memory alignment padding removed.
-        m_rgbaImage = (uint8_t*)g_malloc0(
-            (&(*pBufferSurface))->surfaceList[0].dataSize);
-        
-        // Initialize the source pointer to the start of the mapped surface
-        uint8_t* pSrcIndex = 
-            (uint8_t*)(&(*pBufferSurface))->surfaceList[0].mappedAddr.addr[0];
-            
-        // Initialize the destination pointer to the start of the RGBA Image buffer
-        uint8_t* pDstIndex = &m_rgbaImage[0];
-        
-        // Get the offset of the plane within the pitch
-        uint offset = 
-            (&(*pBufferSurface))->surfaceList[0].planeParams.offset[0];
-
-        // Size of each line to copy will be the plane width * the bytes/pixel
-        uint copySize = (&(*pBufferSurface))->surfaceList[0].planeParams.width[0] *
-            (&(*pBufferSurface))->surfaceList[0].planeParams.bytesPerPix[0];
-
-        // For each line in the plane/buffer copy over the image data
-        // and advance the source and destination buffer pointers.
-        for (auto line=0; line < height; line++)
-        {
-            memcpy(pDstIndex, pSrcIndex+offset, copySize);
-            pSrcIndex += 
-                (&(*pBufferSurface))->surfaceList[0].planeParams.pitch[0];
-            pDstIndex += copySize;
-        }
-
         // Find the correct codec and 
         const AVCodec* pMjpecCodec = avcodec_find_encoder(AV_CODEC_ID_MJPEG);
         if(!pMjpecCodec)
@@ -172,31 +137,22 @@ namespace DSL
             throw std::system_error();
         }
 
-        // Allocat new source and destination frames for the conversion
-        AVFrame* pSrcFrame = av_frame_alloc();
-        AVFrame* pDstFrame = av_frame_alloc();
-        if (!pSrcFrame or !pDstFrame)
+        // Allocate the destination frame for the conversion, reused for 
+        // every image encoded.
+        m_pDstFrame = av_frame_alloc();
+        if (!m_pDstFrame)
         {
             LOG_ERROR("Failed to allocate frame-buffers");
             throw std::system_error();
         }
-        
-        // Setup the params for the source frame with the input RGBA buffer
-        pSrcFrame->format = AV_PIX_FMT_RGBA;
-        pSrcFrame->width = width;
-        pSrcFrame->height = height;
-        pSrcFrame->pts = 1;
-        pSrcFrame->linesize[0] = width*4;
-        pSrcFrame->data[0] = m_rgbaImage;
-        
-        pDstFrame->format = m_pMjpegCodecContext->pix_fmt;
-        pDstFrame->width  = m_pMjpegCodecContext->width;
-        pDstFrame->height = m_pMjpegCodecContext->height;
-        pDstFrame->pts = 1;
+        m_pDstFrame->format = m_pMjpegCodecContext->pix_fmt;
+        m_pDstFrame->width  = m_pMjpegCodecContext->width;
+        m_pDstFrame->height = m_pMjpegCodecContext->height;
+        m_pDstFrame->pts = 0;
 
         // allocate data for the new destination frame
-        if (av_image_alloc(pDstFrame->data, pDstFrame->linesize, 
-            pDstFrame->width, pDstFrame->height, 
+        if (av_image_alloc(m_pDstFrame->data, m_pDstFrame->linesize, 
+            m_pDstFrame->width, m_pDstFrame->height, 
             AV_PIX_FMT_YUV420P, 32) < 0)
         {
             LOG_ERROR("Failed to allocate new dst-image");
@@ -211,31 +167,78 @@ namespace DSL
             LOG_ERROR("Unable to get context for SwScale");
             throw std::system_error();
         }
+
+        // Allocate a Packet to receive the converted data
+        m_pPkt = av_packet_alloc();
+        if (!m_pPkt)
+        {
+            LOG_ERROR("Failed to allocate Packet");
+            throw std::system_error();
+        }
+    }
+    
+    AvJpgEncoder::~AvJpgEncoder()
+    {
+        LOG_FUNC();
+
+        if (m_pPkt)
+        {
+            av_packet_free(&m_pPkt);
+        }
+        if (m_pDstFrame)
+        {
+            av_freep(&m_pDstFrame->data[0]);
+            av_frame_free(&m_pDstFrame);
+        }
+        if (m_pScaleContext)
+        {
+            sws_freeContext(m_pScaleContext);            
+        }
+        if(m_pMjpegCodecContext)
+        {
+            // We can use the codec-context to close the codec.
+            avcodec_close(m_pMjpegCodecContext);
+            
+            // Then free the context
+            avcodec_free_context(&m_pMjpegCodecContext);
+        }
+    }
+    
+    bool AvJpgEncoder::Encode(const uint8_t* pImage, uint pitch, 
+        const char* filepath)
+    {
+        LOG_FUNC();
         
-        // Convert the image from RGBA to YUV420P using the scale funtion
-        int retHeight = sws_scale(m_pScaleContext, pSrcFrame->data, pSrcFrame->linesize, 0,
-            height, pDstFrame->data, pDstFrame->linesize);
+        // Convert the image from RGBA to YUV420P using the scale funtion. The
+        // source pitch is used as the line size, so the alignment padding 
+        // is skipped without first copying to a packed buffer.
+        const uint8_t* srcData[4] = {pImage, NULL, NULL, NULL};
+        int srcLinesize[4] = {(int)pitch, 0, 0, 0};
+        
+        sws_scale(m_pScaleContext, srcData, srcLinesize, 0,
+            m_height, m_pDstFrame->data, m_pDstFrame->linesize);
+            
+        m_pDstFrame->pts++;
 
         // --------- Start JPEG Encodeing
 
         // Send the converted frame to the MJPEG codec for encoding
-        int retval = avcodec_send_frame(m_pMjpegCodecContext, pDstFrame);
+        int retval = avcodec_send_frame(m_pMjpegCodecContext, m_pDstFrame);
         if ( retval < 0)
         {
             LOG_ERROR("Failed to send frame to codec: AV_CODEC_ID_MJPEG");
-            throw std::system_error();
+            return false;
         }
 
-        // Allocate a Packet to receive the converted data
-        m_pPkt = av_packet_alloc();
-        if (!m_pPkt)
+        // Open the output file using the provided filepath
+        FILE* outfile = fopen(filepath, "wb");
+        if (!outfile)
         {
-            LOG_ERROR("Failed to allocate Packet");
-            throw std::system_error();
+            LOG_ERROR("Failed to open JPEG file '" << filepath << "'");
         }
         
-        // Open the output file using the provided filepath
-        m_outfile = fopen(filepath, "wb");
+        // Always drain the codec, so it is ready for the next image.
+        bool result(outfile != NULL);
         while (retval >= 0)
         {
             retval = avcodec_receive_packet(m_pMjpegCodecContext, m_pPkt);
@@ -245,45 +248,51 @@ namespace DSL
             }
             else if (retval < 0) 
             {
-                LOG_ERROR("Failed to send frame to codec: AV_CODEC_ID_MJPEG");
-                throw std::system_error();
+                LOG_ERROR("Failed to receive packet from codec: AV_CODEC_ID_MJPEG");
+                result = false;
+                break;
+            }
+            if (outfile and 
+                fwrite(m_pPkt->data, 1, m_pPkt->size, outfile) != m_pPkt->size)
+            {
+                LOG_ERROR("Failed to write JPEG file '" << filepath << "'");
+                result = false;
             }
-            fwrite(m_pPkt->data, 1, m_pPkt->size, m_outfile);
+            av_packet_unref(m_pPkt);
         }
-        
-        av_freep(&pDstFrame->data[0]);
-        av_frame_free(&pSrcFrame);
-        av_frame_free(&pDstFrame);
+        if (outfile)
+        {
+            fclose(outfile);
+        }
+        return result;
     }
     
-    AvJpgOutputFile::~AvJpgOutputFile()
+    AvJpgOutputFile::AvJpgOutputFile(
+        std::shared_ptr<DslBufferSurface> pBufferSurface, 
+        const char* filepath)
     {
         LOG_FUNC();
 
-        // close the output file and free all allocated data.   
-        if (m_outfile)
-        {
-            fclose(m_outfile);
-        }
-        if (m_rgbaImage)
-        {
-            g_free(m_rgbaImage);
-        }        
-        if (m_pPkt)
-        {
-            av_packet_free(&m_pPkt);
-        }
-        if (m_pScaleContext)
-        {
-            sws_freeContext(m_pScaleContext);            
-        }
-        if(m_pMjpegCodecContext)
+        // Get the dimensions of the buffer-surface
+        uint width = (&(*pBufferSurface))->surfaceList[0].width;
+        uint height = (&(*pBufferSurface))->surfaceList[0].height;
+
+        // Initialize the source pointer to the start of the plane
+        uint8_t* pImage = 
+            (uint8_t*)(&(*pBufferSurface))->surfaceList[0].mappedAddr.addr[0] +
+            (&(*pBufferSurface))->surfaceList[0].planeParams.offset[0];
+
+        AvJpgEncoder avJpgEncoder(width, height);
+        
+        if (!avJpgEncoder.Encode(pImage, 
+            (&(*pBufferSurface))->surfaceList[0].planeParams.pitch[0], filepath))
         {
-            // We can use the codec-context to close the codec.
-            avcodec_close(m_pMjpegCodecContext);
-            
-            // Then free the context
-            avcodec_free_context(&m_pMjpegCodecContext);
+            throw std::system_error();
         }
     }
+    
+    AvJpgOutputFile::~AvJpgOutputFile()
+    {
+        LOG_FUNC();
+    }
 }
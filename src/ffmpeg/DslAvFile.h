@@ -85,44 +85,68 @@ namespace DSL
     };
 
     /**
-     * @class AvJpgOutputFile
-     * @brief Implements a utility class used to convert an RGBA image-buffer
-     * into a JPEG Image file. 
+     * @class AvJpgEncoder
+     * @brief Implements a long-lived JPEG encoder for RGBA images of a fixed
+     * resolution. The MJPEG codec context, scale context, and destination 
+     * frame are allocated once on construction and reused for each image.
      */
-    class AvJpgOutputFile
+    class AvJpgEncoder
     {
     public:
     
         /**
-         * @brief ctor for the AvJpgOutputFile utility class.
-         * @param[in] pBufferSurface machine aligned surface buffer.
+         * @brief ctor for the AvJpgEncoder utility class.
+         * @param[in] width width of the images to encode in pixels.
+         * @param[in] height height of the images to encode in pixels.
+         * @throws if the codec or scale contexts can not be created.
+         */
+        AvJpgEncoder(uint width, uint height);
+        
+        /**
+         * @brief dtor for the AvJpgEncoder utility class.
+         */
+        ~AvJpgEncoder();
+        
+        /**
+         * @brief Encodes an RGBA image to a JPEG file.
+         * @param[in] pImage pointer to the first pixel of the RGBA image.
+         * @param[in] pitch size of each line of the image in bytes, 
+         * including any alignment padding.
          * @param[in] filepath for the JPEG output file to save.
+         * @return true on success, false otherwise.
          */
-        AvJpgOutputFile(std::shared_ptr<DslBufferSurface> pBufferSurface, 
-            const char* filepath);
+        bool Encode(const uint8_t* pImage, uint pitch, const char* filepath);
         
         /**
-         * @brief ctor for the AvJpgOutputFile utility class.
+         * @brief Gets the width of the images to encode.
+         * @return width in pixels.
          */
-        ~AvJpgOutputFile();
+        uint GetWidth(){return m_width;};
         
-    private:
-    
         /**
-         * @brief buffer for the packed RGBA Image.
+         * @brief Gets the height of the images to encode.
+         * @return height in pixels.
          */
-        uint8_t* m_rgbaImage;
+        uint GetHeight(){return m_height;};
         
+    private:
+    
         /**
-         * @brief Handle to opened output file.
+         * @brief dimensions of the images to encode.
          */
-        FILE* m_outfile;
+        uint m_width;
+        uint m_height;
         
         /**
          * @brief Packet to receive the converted MJPEG data.
          */
         AVPacket* m_pPkt;
         
+        /**
+         * @brief YUV frame to receive the converted image.
+         */
+        AVFrame* m_pDstFrame;
+        
         /**
          * @brief MJPEG codec context pointer to provide context for all Codec calls.
          */
@@ -133,6 +157,30 @@ namespace DSL
          */
         SwsContext* m_pScaleContext;
     };
+
+    /**
+     * @class AvJpgOutputFile
+     * @brief Implements a utility class used to convert an RGBA image-buffer
+     * into a JPEG Image file with a single-use AvJpgEncoder.
+     */
+    class AvJpgOutputFile
+    {
+    public:
+    
+        /**
+         * @brief ctor for the AvJpgOutputFile utility class.
+         * @param[in] pBufferSurface machine aligned surface buffer.
+         * @param[in] filepath for the JPEG output file to save.
+         * @throws if the image can not be encoded.
+         */
+        AvJpgOutputFile(std::shared_ptr<DslBufferSurface> pBufferSurface, 
+            const char* filepath);
+        
+        /**
+         * @brief ctor for the AvJpgOutputFile utility class.
+         */
+        ~AvJpgOutputFile();
+    };
 }
 
-#endif // _DSL_AV_FILE_H
\ No newline at end of file
+#endif // _DSL_AV_FILE_H
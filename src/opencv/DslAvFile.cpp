@@ -60,42 +60,65 @@ namespace DSL
         m_vidCap.release();
     }
 
-    AvJpgOutputFile::AvJpgOutputFile(
-        std::shared_ptr<DslBufferSurface> pBufferSurface, 
+    AvJpgEncoder::AvJpgEncoder(uint width, uint height)
+        : m_width(width)
+        , m_height(height)
+        , m_bgrFrame(cv::Size(width, height), CV_8UC3)
+    {
+        LOG_FUNC();
+    }
+    
+    AvJpgEncoder::~AvJpgEncoder()
+    {
+        LOG_FUNC();
+    }
+    
+    bool AvJpgEncoder::Encode(const uint8_t* pImage, uint pitch, 
         const char* filepath)
-        : m_pBgrFrame(NULL)
     {
         LOG_FUNC();
-
-        // Get the dimensions of the buffer-surface
-        uint width = (&(*pBufferSurface))->surfaceList[0].width;
-        uint height = (&(*pBufferSurface))->surfaceList[0].height;
-
-        // New background Mat for our image
-        m_pBgrFrame = new cv::Mat(cv::Size(width, height), CV_8UC3);
-
-        // Use openCV to remove padding
-        cv::Mat in_mat = cv::Mat(height, width, CV_8UC4, 
-            (&(*pBufferSurface))->surfaceList[0].mappedAddr.addr[0],
-            (&(*pBufferSurface))->surfaceList[0].pitch);
+        
+        // Use openCV to remove padding - wraps the image without copying.
+        cv::Mat in_mat = cv::Mat(m_height, m_width, CV_8UC4, 
+            (void*)pImage, pitch);
 
         // Convert the RGBA buffer to BGR
 #if (CV_MAJOR_VERSION >= 4)
-        cv::cvtColor (in_mat, *m_pBgrFrame, cv::COLOR_RGBA2BGR);
+        cv::cvtColor (in_mat, m_bgrFrame, cv::COLOR_RGBA2BGR);
 #else
-        cv::cvtColor(in_mat, *m_pBgrFrame, CV_RGBA2BGR);
+        cv::cvtColor(in_mat, m_bgrFrame, CV_RGBA2BGR);
 #endif
 
-        cv::imwrite(filepath, *m_pBgrFrame);        
+        if (!cv::imwrite(filepath, m_bgrFrame))
+        {
+            LOG_ERROR("Failed to write JPEG file '" << filepath << "'");
+            return false;
+        }
+        return true;
     }
     
-    AvJpgOutputFile::~AvJpgOutputFile()
+    AvJpgOutputFile::AvJpgOutputFile(
+        std::shared_ptr<DslBufferSurface> pBufferSurface, 
+        const char* filepath)
     {
         LOG_FUNC();
+
+        // Get the dimensions of the buffer-surface
+        uint width = (&(*pBufferSurface))->surfaceList[0].width;
+        uint height = (&(*pBufferSurface))->surfaceList[0].height;
+
+        AvJpgEncoder avJpgEncoder(width, height);
         
-        if (m_pBgrFrame)
+        if (!avJpgEncoder.Encode(
+            (uint8_t*)(&(*pBufferSurface))->surfaceList[0].mappedAddr.addr[0],
+            (&(*pBufferSurface))->surfaceList[0].pitch, filepath))
         {
-            delete m_pBgrFrame;
+            throw std::system_error();
         }
     }
+    
+    AvJpgOutputFile::~AvJpgOutputFile()
+    {
+        LOG_FUNC();
+    }
 }
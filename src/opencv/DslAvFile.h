@@ -80,10 +80,68 @@ namespace DSL
         
     };
 
+    /**
+     * @class AvJpgEncoder
+     * @brief Implements a long-lived JPEG encoder for RGBA images of a fixed
+     * resolution. The BGR conversion Mat is allocated once on construction
+     * and reused for each image.
+     */
+    class AvJpgEncoder
+    {
+    public:
+    
+        /**
+         * @brief ctor for the AvJpgEncoder utility class.
+         * @param[in] width width of the images to encode in pixels.
+         * @param[in] height height of the images to encode in pixels.
+         */
+        AvJpgEncoder(uint width, uint height);
+        
+        /**
+         * @brief dtor for the AvJpgEncoder utility class.
+         */
+        ~AvJpgEncoder();
+        
+        /**
+         * @brief Encodes an RGBA image to a JPEG file.
+         * @param[in] pImage pointer to the first pixel of the RGBA image.
+         * @param[in] pitch size of each line of the image in bytes, 
+         * including any alignment padding.
+         * @param[in] filepath for the JPEG output file to save.
+         * @return true on success, false otherwise.
+         */
+        bool Encode(const uint8_t* pImage, uint pitch, const char* filepath);
+        
+        /**
+         * @brief Gets the width of the images to encode.
+         * @return width in pixels.
+         */
+        uint GetWidth(){return m_width;};
+        
+        /**
+         * @brief Gets the height of the images to encode.
+         * @return height in pixels.
+         */
+        uint GetHeight(){return m_height;};
+        
+    private:
+    
+        /**
+         * @brief dimensions of the images to encode.
+         */
+        uint m_width;
+        uint m_height;
+        
+        /**
+         * @brief BGR Mat to receive the converted image.
+         */
+        cv::Mat m_bgrFrame;
+    };
+
     /**
      * @class AvJpgOutputFile
      * @brief Implements a utility class used to convert an RGBA image-buffer
-     * into a JPEG Image file. 
+     * into a JPEG Image file with a single-use AvJpgEncoder.
      */
     class AvJpgOutputFile
     {
@@ -93,6 +151,7 @@ namespace DSL
          * @brief ctor for the AvJpgOutputFile utility class.
          * @param[in] pBufferSurface machine aligned surface buffer.
          * @param[in] filepath for the JPEG output file to save.
+         * @throws if the image can not be encoded.
          */
         AvJpgOutputFile(std::shared_ptr<DslBufferSurface> pBufferSurface, 
             const char* filepath);
@@ -101,14 +160,7 @@ namespace DSL
          * @brief ctor for the AvJpgOutputFile utility class.
          */
         ~AvJpgOutputFile();
-        
-    private:
-        
-        /**
-         * @brief SW Scale utility context to provide context all Scale/format calls.
-         */
-        cv::Mat* m_pBgrFrame;
     };
 }
 
-#endif // _DSL_AV_FILE_H
\ No newline at end of file
+#endif // _DSL_AV_FILE_H
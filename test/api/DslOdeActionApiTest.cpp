@@ -436,6 +436,90 @@ SCENARIO( "A new Monitor ODE Action can be created and deleted", "[ode-action-ap
     }
 }
 
+SCENARIO( "An ODE Action's async enabled setting can be set and get", "[ode-action-api]" )
+{
+    GIVEN( "A new Log ODE Action" ) 
+    {
+        std::wstring action_name(L"log-action");
+        
+        REQUIRE( dsl_ode_action_log_new(action_name.c_str()) == DSL_RESULT_SUCCESS );
+
+        boolean enabled(true);
+        REQUIRE( dsl_ode_action_async_enabled_get(action_name.c_str(), 
+            &enabled) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == false );
+
+        WHEN( "The Action's async setting is enabled" ) 
+        {
+            REQUIRE( dsl_ode_action_async_enabled_set(action_name.c_str(), 
+                true) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct setting and stats are returned on get" ) 
+            {
+                REQUIRE( dsl_ode_action_async_enabled_get(action_name.c_str(), 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == true );
+                
+                uint64_t queued(99), dropped(99);
+                REQUIRE( dsl_ode_action_async_stats_get(action_name.c_str(), 
+                    &queued, &dropped) == DSL_RESULT_SUCCESS );
+                REQUIRE( queued == 0 );
+                REQUIRE( dropped == 0 );
+                
+                REQUIRE( dsl_ode_action_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+    GIVEN( "A new Object Remove ODE Action" ) 
+    {
+        std::wstring action_name(L"remove-action");
+        
+        REQUIRE( dsl_ode_action_object_remove_new(action_name.c_str()) 
+            == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Action's async setting is enabled" ) 
+        {
+            THEN( "The service fails as the Action can't be deferred" ) 
+            {
+                REQUIRE( dsl_ode_action_async_enabled_set(action_name.c_str(), 
+                    true) == DSL_RESULT_ODE_ACTION_NOT_THE_CORRECT_TYPE );
+                
+                REQUIRE( dsl_ode_action_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new Monitor Batch ODE Action can be created and deleted", "[ode-action-api]" )
+{
+    GIVEN( "Attributes for a new Monitor Batch ODE Action" ) 
+    {
+        std::wstring action_name(L"monitor-action");
+        dsl_ode_monitor_occurrence_batch_cb client_monitor;
+
+        WHEN( "A new Monitor Batch ODE Action is created" ) 
+        {
+            REQUIRE( dsl_ode_action_monitor_batch_new(action_name.c_str(), 
+                client_monitor, 64, 0, NULL) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The Action can be deleted" ) 
+            {
+                REQUIRE( dsl_ode_action_delete(action_name.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+            }
+        }
+        WHEN( "A max-size of 0 is used" ) 
+        {
+            THEN( "The Action fails to create" ) 
+            {
+                REQUIRE( dsl_ode_action_monitor_batch_new(action_name.c_str(), 
+                    client_monitor, 0, 0, NULL) == DSL_RESULT_ODE_ACTION_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new Frame Capture ODE Action can be created and deleted", "[ode-action-api]" )
 {
     GIVEN( "Attributes for a new Frame Capture ODE Action" ) 
@@ -651,6 +735,36 @@ SCENARIO( "A Mailer can be added and removed from a Capture Action", "[ode-actio
     }
 }    
 
+SCENARIO( "The queue stats for a new Capture Action can be queried", "[ode-action-api]" )
+{
+    GIVEN( "A new Capture Action" )
+    {
+        std::wstring action_name(L"capture-action");
+        std::wstring outdir(L"./");
+
+        REQUIRE( dsl_ode_action_capture_frame_new(action_name.c_str(), 
+            outdir.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The queue stats are queried" )
+        {
+            uint queue_depth(99);
+            uint64_t dropped(99);
+            
+            REQUIRE( dsl_ode_action_capture_queue_stats_get(action_name.c_str(),
+                &queue_depth, &dropped) == DSL_RESULT_SUCCESS );
+
+            THEN( "No images are pending or dropped" ) 
+            {
+                REQUIRE( queue_depth == 0 );
+                REQUIRE( dropped == 0 );
+                    
+                REQUIRE( dsl_ode_action_delete(action_name.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+            }
+        }
+    }
+}    
+
 SCENARIO( "A new Customize Label ODE Action can be created and deleted", "[ode-action-api]" )
 {
     GIVEN( "Attributes for a new Customize Lable ODE Action" ) 
@@ -1185,6 +1299,34 @@ SCENARIO( "A new MOT Challenge File ODE Action can be created and deleted", "[od
     }
 }
 
+SCENARIO( "A new Binary File ODE Action can be created and deleted", "[ode-action-api]" )
+{
+    GIVEN( "Attributes for a new File ODE Action" ) 
+    {
+        std::wstring action_name(L"file-action");
+        std::wstring file_path(L"./file-action.bin");
+        uint mode(DSL_WRITE_MODE_TRUNCATE);
+        uint format(DSL_EVENT_FILE_FORMAT_BINARY);
+        boolean force_flush(false);
+
+        WHEN( "A new File Action is created" ) 
+        {
+            REQUIRE( dsl_ode_action_file_new(action_name.c_str(),
+                file_path.c_str(), mode, format, force_flush) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The File Action can be deleted" ) 
+            {
+                uint max_size(0), max_age(0);
+                REQUIRE( dsl_ode_action_file_rotation_get(action_name.c_str(), 
+                    &max_size, &max_age) == DSL_RESULT_ODE_ACTION_NOT_THE_CORRECT_TYPE );
+                    
+                REQUIRE( dsl_ode_action_delete(action_name.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+            }
+        }
+    }
+}
+
 SCENARIO( "Parameters for a new File ODE Action are checked on construction", "[ode-action-api]" )
 {
     GIVEN( "Attributes for a new File ODE Action" ) 
@@ -1209,7 +1351,7 @@ SCENARIO( "Parameters for a new File ODE Action are checked on construction", "[
         WHEN( "The format parameter is out of range" ) 
         {
             uint mode(DSL_WRITE_MODE_TRUNCATE);
-            uint format(DSL_EVENT_FILE_FORMAT_MOTC+1);
+            uint format(DSL_EVENT_FILE_FORMAT_BINARY+1);
             
             THEN( "The File Action fails to create" ) 
             {
@@ -1222,6 +1364,82 @@ SCENARIO( "Parameters for a new File ODE Action are checked on construction", "[
     }
 }
 
+SCENARIO( "A File ODE Action's rotation and sync policy can be set and get", "[ode-action-api]" )
+{
+    GIVEN( "A new CSV File ODE Action" ) 
+    {
+        std::wstring action_name(L"file-action");
+        std::wstring file_path(L"./file-action.csv");
+        uint mode(DSL_WRITE_MODE_TRUNCATE);
+        uint format(DSL_EVENT_FILE_FORMAT_CSV);
+        boolean force_flush(false);
+
+        REQUIRE( dsl_ode_action_file_new(action_name.c_str(),
+            file_path.c_str(), mode, format, force_flush) == DSL_RESULT_SUCCESS );
+
+        uint max_size(99), max_age(99), policy(99);
+        REQUIRE( dsl_ode_action_file_rotation_get(action_name.c_str(), 
+            &max_size, &max_age) == DSL_RESULT_SUCCESS );
+        REQUIRE( max_size == 0 );
+        REQUIRE( max_age == 0 );
+        REQUIRE( dsl_ode_action_file_sync_policy_get(action_name.c_str(), 
+            &policy) == DSL_RESULT_SUCCESS );
+        REQUIRE( policy == DSL_FILE_SYNC_POLICY_NONE );
+
+        WHEN( "The Action's rotation and sync policy are set" ) 
+        {
+            uint new_max_size(1024), new_max_age(3600);
+            uint new_policy(DSL_FILE_SYNC_POLICY_ON_ROTATE);
+            
+            REQUIRE( dsl_ode_action_file_rotation_set(action_name.c_str(), 
+                new_max_size, new_max_age) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_action_file_sync_policy_set(action_name.c_str(), 
+                new_policy) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct values are returned on get" ) 
+            {
+                REQUIRE( dsl_ode_action_file_rotation_get(action_name.c_str(), 
+                    &max_size, &max_age) == DSL_RESULT_SUCCESS );
+                REQUIRE( max_size == new_max_size );
+                REQUIRE( max_age == new_max_age );
+                REQUIRE( dsl_ode_action_file_sync_policy_get(action_name.c_str(), 
+                    &policy) == DSL_RESULT_SUCCESS );
+                REQUIRE( policy == new_policy );
+                
+                REQUIRE( dsl_ode_action_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The sync policy parameter is out of range" ) 
+        {
+            THEN( "The service fails" ) 
+            {
+                REQUIRE( dsl_ode_action_file_sync_policy_set(action_name.c_str(), 
+                    DSL_FILE_SYNC_POLICY_ON_WRITE+1) 
+                        == DSL_RESULT_ODE_ACTION_PARAMETER_INVALID );
+                
+                REQUIRE( dsl_ode_action_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+    GIVEN( "A new Log ODE Action" ) 
+    {
+        std::wstring action_name(L"log-action");
+        
+        REQUIRE( dsl_ode_action_log_new(action_name.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Action's rotation is set" ) 
+        {
+            THEN( "The service fails as the Action is not a File Action" ) 
+            {
+                REQUIRE( dsl_ode_action_file_rotation_set(action_name.c_str(), 
+                    1024, 0) == DSL_RESULT_ODE_ACTION_NOT_THE_CORRECT_TYPE );
+                
+                REQUIRE( dsl_ode_action_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new Fill Frame ODE Action can be created and deleted", "[ode-action-api]" )
 {
     GIVEN( "Attributes for a new Fill Frame ODE Action" ) 
@@ -2381,6 +2599,8 @@ SCENARIO( "The ODE Action API checks for NULL input parameters", "[ode-action-ap
         
         uint interval(0);
         boolean enabled(0);
+        uint64_t queued(0), dropped(0);
+        uint max_size(0), max_age(0), policy(0);
         
         REQUIRE( dsl_component_list_size() == 0 );
 
@@ -2407,6 +2627,12 @@ SCENARIO( "The ODE Action API checks for NULL input parameters", "[ode-action-ap
                     NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_action_capture_object_new(action_name.c_str(), 
                     NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_capture_queue_stats_get(NULL, 
+                    &interval, &dropped) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_capture_queue_stats_get(action_name.c_str(), 
+                    NULL, &dropped) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_capture_queue_stats_get(action_name.c_str(), 
+                    &interval, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_ode_action_label_customize_new(NULL,
                     NULL, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
@@ -2563,6 +2789,36 @@ SCENARIO( "The ODE Action API checks for NULL input parameters", "[ode-action-ap
                     NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_action_enabled_set(NULL, 
                     false) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_monitor_batch_new(NULL, 
+                    NULL, 1, 0, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_monitor_batch_new(action_name.c_str(), 
+                    NULL, 1, 0, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_async_enabled_get(NULL, 
+                    &enabled) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_async_enabled_get(action_name.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_async_enabled_set(NULL, 
+                    false) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_async_stats_get(NULL, 
+                    &queued, &dropped) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_async_stats_get(action_name.c_str(), 
+                    NULL, &dropped) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_async_stats_get(action_name.c_str(), 
+                    &queued, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_file_rotation_get(NULL, 
+                    &max_size, &max_age) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_file_rotation_get(action_name.c_str(), 
+                    NULL, &max_age) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_file_rotation_get(action_name.c_str(), 
+                    &max_size, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_file_rotation_set(NULL, 
+                    0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_file_sync_policy_get(NULL, 
+                    &policy) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_file_sync_policy_get(action_name.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_file_sync_policy_set(NULL, 
+                    0) == DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_ode_action_delete(NULL) 
                     == DSL_RESULT_INVALID_INPUT_PARAM );
@@ -144,6 +144,81 @@ SCENARIO( "A new Heat-Mapper can handle calls to its Metrics services",
     }
 }    
 
+SCENARIO( "A new Heat-Mapper can set and get its decay and window settings", 
+    "[ode-heat-mapper-api]" )
+{
+    GIVEN( "A new Heat-Mapper" ) 
+    {
+        REQUIRE( dsl_display_type_rgba_color_palette_predefined_new(
+            color_palette_name.c_str(), DSL_COLOR_PREDEFINED_PALETTE_SPECTRAL, 
+            0.5) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_ode_heat_mapper_new(ode_heat_mapper_name.c_str(),
+            16, 9, DSL_BBOX_POINT_SOUTH, color_palette_name.c_str()) == 
+                DSL_RESULT_SUCCESS );
+                
+        uint half_life(99), interval(99), intervals(99);
+
+        REQUIRE( dsl_ode_heat_mapper_decay_get(ode_heat_mapper_name.c_str(),
+            &half_life) == DSL_RESULT_SUCCESS );
+        REQUIRE( half_life == 0 );
+        REQUIRE( dsl_ode_heat_mapper_window_get(ode_heat_mapper_name.c_str(),
+            &interval, &intervals) == DSL_RESULT_SUCCESS );
+        REQUIRE( interval == 0 );
+        REQUIRE( intervals == 0 );
+
+        WHEN( "The Heat-Mapper's decay is set" )
+        {
+            uint new_half_life(300);
+            
+            REQUIRE( dsl_ode_heat_mapper_decay_set(ode_heat_mapper_name.c_str(),
+                new_half_life) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct value is returned on get" ) 
+            {
+                REQUIRE( dsl_ode_heat_mapper_decay_get(ode_heat_mapper_name.c_str(),
+                    &half_life) == DSL_RESULT_SUCCESS );
+                REQUIRE( half_life == new_half_life );
+
+                REQUIRE( dsl_ode_heat_mapper_delete(ode_heat_mapper_name.c_str()) == 
+                    DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_display_type_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The Heat-Mapper's window is set" )
+        {
+            uint new_interval(60), new_intervals(10);
+            
+            REQUIRE( dsl_ode_heat_mapper_window_set(ode_heat_mapper_name.c_str(),
+                new_interval, new_intervals) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct values are returned on get" ) 
+            {
+                REQUIRE( dsl_ode_heat_mapper_window_get(ode_heat_mapper_name.c_str(),
+                    &interval, &intervals) == DSL_RESULT_SUCCESS );
+                REQUIRE( interval == new_interval );
+                REQUIRE( intervals == new_intervals );
+
+                REQUIRE( dsl_ode_heat_mapper_delete(ode_heat_mapper_name.c_str()) == 
+                    DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_display_type_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The Heat-Mapper's window is set with 0 intervals" )
+        {
+            THEN( "The service fails" ) 
+            {
+                REQUIRE( dsl_ode_heat_mapper_window_set(ode_heat_mapper_name.c_str(),
+                    60, 0) == DSL_RESULT_ODE_HEAT_MAPPER_SET_FAILED );
+
+                REQUIRE( dsl_ode_heat_mapper_delete(ode_heat_mapper_name.c_str()) == 
+                    DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_display_type_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
 SCENARIO( "The ODE Heat-Mapper API checks for NULL input parameters", "[ode-heat-mapper-api]" )
 {
     GIVEN( "An empty list of Components" ) 
@@ -176,6 +251,20 @@ SCENARIO( "The ODE Heat-Mapper API checks for NULL input parameters", "[ode-heat
                 REQUIRE( dsl_ode_heat_mapper_legend_settings_get(NULL, 
                     0, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
                     
+                REQUIRE( dsl_ode_heat_mapper_decay_get(NULL, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_heat_mapper_decay_get(ode_heat_mapper_name.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_heat_mapper_decay_set(NULL, 
+                    0) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_ode_heat_mapper_window_get(NULL, 
+                    NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_heat_mapper_window_get(ode_heat_mapper_name.c_str(), 
+                    NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_heat_mapper_window_set(NULL, 
+                    0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                    
                 REQUIRE( dsl_ode_heat_mapper_metrics_get(ode_heat_mapper_name.c_str(), 
                     NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_heat_mapper_metrics_get(NULL,
@@ -604,6 +604,131 @@ SCENARIO( "An ODE Trigger's interval can be set/get", "[ode-trigger-api]" )
     }
 }    
 
+SCENARIO( "An ODE Trigger's per-source state setting can be set/get", "[ode-trigger-api]" )
+{
+    GIVEN( "An ODE Trigger" ) 
+    {
+        std::wstring odeTriggerName(L"occurrence");
+        
+        uint class_id(9);
+        uint limit(0);
+
+        REQUIRE( dsl_ode_trigger_occurrence_new(odeTriggerName.c_str(), 
+            NULL, class_id, limit) == DSL_RESULT_SUCCESS );
+
+        boolean ret_enabled(true);
+        REQUIRE( dsl_ode_trigger_per_source_state_get(odeTriggerName.c_str(), 
+            &ret_enabled) == DSL_RESULT_SUCCESS );
+        REQUIRE( ret_enabled == false );
+
+        WHEN( "When the Trigger's per-source state setting is updated" )         
+        {
+            REQUIRE( dsl_ode_trigger_per_source_state_set(odeTriggerName.c_str(), 
+                true) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct value is returned on get" ) 
+            {
+                REQUIRE( dsl_ode_trigger_per_source_state_get(odeTriggerName.c_str(), 
+                    &ret_enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_enabled == true );
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
+SCENARIO( "An ODE Trigger's rate limit and debounce settings can be set/get", "[ode-trigger-api]" )
+{
+    GIVEN( "An ODE Trigger" ) 
+    {
+        std::wstring odeTriggerName(L"occurrence");
+        
+        uint class_id(9);
+        uint limit(0);
+
+        REQUIRE( dsl_ode_trigger_occurrence_new(odeTriggerName.c_str(), 
+            NULL, class_id, limit) == DSL_RESULT_SUCCESS );
+
+        float ret_rate(1.0);
+        uint ret_burst(1), ret_window(1);
+        REQUIRE( dsl_ode_trigger_rate_limit_get(odeTriggerName.c_str(), 
+            &ret_rate, &ret_burst) == DSL_RESULT_SUCCESS );
+        REQUIRE( ret_rate == 0 );
+        REQUIRE( ret_burst == 0 );
+        REQUIRE( dsl_ode_trigger_debounce_get(odeTriggerName.c_str(), 
+            &ret_window) == DSL_RESULT_SUCCESS );
+        REQUIRE( ret_window == 0 );
+
+        WHEN( "When the Trigger's rate limit and debounce window are updated" )         
+        {
+            float new_rate(0.5);
+            uint new_burst(5), new_window(2000);
+            
+            REQUIRE( dsl_ode_trigger_rate_limit_set(odeTriggerName.c_str(), 
+                new_rate, new_burst) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_trigger_debounce_set(odeTriggerName.c_str(), 
+                new_window) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct values are returned on get" ) 
+            {
+                REQUIRE( dsl_ode_trigger_rate_limit_get(odeTriggerName.c_str(), 
+                    &ret_rate, &ret_burst) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_rate == new_rate );
+                REQUIRE( ret_burst == new_burst );
+                REQUIRE( dsl_ode_trigger_debounce_get(odeTriggerName.c_str(), 
+                    &ret_window) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_window == new_window );
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "When a rate limit is set without a burst size" )         
+        {
+            THEN( "The set service fails" ) 
+            {
+                REQUIRE( dsl_ode_trigger_rate_limit_set(odeTriggerName.c_str(), 
+                    1.0, 0) == DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_trigger_rate_limit_set(odeTriggerName.c_str(), 
+                    -1.0, 1) == DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
+SCENARIO( "An ODE Trigger's stats are cleared until enabled", "[ode-trigger-api]" )
+{
+    GIVEN( "An ODE Trigger" ) 
+    {
+        std::wstring odeTriggerName(L"occurrence");
+        
+        uint class_id(9);
+        uint limit(0);
+
+        REQUIRE( dsl_ode_trigger_occurrence_new(odeTriggerName.c_str(), 
+            NULL, class_id, limit) == DSL_RESULT_SUCCESS );
+
+        WHEN( "When the Trigger's stats are queried" )         
+        {
+            dsl_ode_trigger_stats stats;
+            stats.occurrences = 99;
+            stats.handle_occurrence.count = 99;
+            
+            THEN( "All values are returned as 0" ) 
+            {
+                REQUIRE( dsl_ode_trigger_stats_get(odeTriggerName.c_str(), 
+                    &stats) == DSL_RESULT_SUCCESS );
+                REQUIRE( stats.occurrences == 0 );
+                REQUIRE( stats.handle_occurrence.count == 0 );
+                REQUIRE( stats.occurrences_per_sec == 0 );
+
+                REQUIRE( dsl_ode_trigger_stats_get(odeTriggerName.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
 SCENARIO( "A new Absence Trigger can be created and deleted correctly", 
     "[ode-trigger-api]" )
 {
@@ -1666,6 +1791,74 @@ static void limit_event_listener(uint event, uint limit, void* client_data)
 }
 
 
+SCENARIO( "A Composite Trigger can add/remove predicates correctly", 
+    "[ode-trigger-api]" )
+{
+    GIVEN( "A new Composite Trigger and a Distance Trigger" ) 
+    {
+        std::wstring odeTriggerName(L"composite");
+        std::wstring predicateName(L"distance");
+        uint class_id(0);
+        uint limit(0);
+
+        REQUIRE( dsl_ode_trigger_composite_new(odeTriggerName.c_str(), 
+            NULL, class_id, limit, DSL_ODE_COMPOSITE_OPERATOR_AND) == 
+                DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_ode_trigger_distance_new(predicateName.c_str(), 
+            NULL, 0, 1, limit, 10, 30, DSL_BBOX_POINT_ANY, 
+            DSL_DISTANCE_METHOD_FIXED_PIXELS) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Distance Trigger is added as a predicate" )         
+        {
+            REQUIRE( dsl_ode_trigger_composite_predicate_add(
+                odeTriggerName.c_str(), predicateName.c_str(), true) == 
+                    DSL_RESULT_SUCCESS );
+            
+            THEN( "The predicate can be removed only once" ) 
+            {
+                REQUIRE( dsl_ode_trigger_composite_predicate_add(
+                    odeTriggerName.c_str(), predicateName.c_str(), true) == 
+                        DSL_RESULT_ODE_TRIGGER_SET_FAILED );
+                REQUIRE( dsl_ode_trigger_composite_predicate_remove(
+                    odeTriggerName.c_str(), predicateName.c_str()) == 
+                        DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_composite_predicate_remove(
+                    odeTriggerName.c_str(), predicateName.c_str()) == 
+                        DSL_RESULT_ODE_TRIGGER_SET_FAILED );
+
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_list_size() == 0 );
+            }
+        }
+        WHEN( "The Composite Trigger is used as a predicate of itself" )         
+        {
+            THEN( "The add fails" ) 
+            {
+                REQUIRE( dsl_ode_trigger_composite_predicate_add(
+                    odeTriggerName.c_str(), odeTriggerName.c_str(), false) == 
+                        DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_list_size() == 0 );
+            }
+        }
+        WHEN( "An invalid operator is used" )         
+        {
+            std::wstring badTriggerName(L"bad-composite");
+            
+            THEN( "The Composite Trigger fails to create" ) 
+            {
+                REQUIRE( dsl_ode_trigger_composite_new(badTriggerName.c_str(), 
+                    NULL, class_id, limit, DSL_ODE_COMPOSITE_OPERATOR_OR+1) == 
+                        DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_list_size() == 0 );
+            }
+        }
+    }
+}    
+
 SCENARIO( "An ODE Trigger can add/remove a limit-state-change-listener", 
     "[ode-trigger-api]" )
 {
@@ -1865,6 +2058,13 @@ SCENARIO( "The ODE Trigger API checks for NULL input parameters", "[ode-trigger-
                 REQUIRE( dsl_ode_trigger_custom_new(NULL, NULL, 0, 0, NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_trigger_custom_new(triggerName.c_str(), NULL, 0, 0, NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_trigger_custom_new(triggerName.c_str(), NULL, 0, 0, callback, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_custom_batch_new(NULL, NULL, 0, 0, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_custom_batch_new(triggerName.c_str(), NULL, 0, 0, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_composite_new(NULL, NULL, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_composite_predicate_add(NULL, NULL, false) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_composite_predicate_add(triggerName.c_str(), NULL, false) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_composite_predicate_remove(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_composite_predicate_remove(triggerName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_ode_trigger_count_new(NULL, NULL, 0, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_trigger_count_range_get(NULL, &minimum, &maximum)  == DSL_RESULT_INVALID_INPUT_PARAM );
@@ -1890,6 +2090,17 @@ SCENARIO( "The ODE Trigger API checks for NULL input parameters", "[ode-trigger-
                 REQUIRE( dsl_ode_trigger_limit_state_change_listener_add(NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_trigger_limit_state_change_listener_remove(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
 
+                REQUIRE( dsl_ode_trigger_rate_limit_get(NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_rate_limit_get(triggerName.c_str(), 
+                    NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_rate_limit_get(triggerName.c_str(), 
+                    &confidence, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_rate_limit_set(NULL, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_debounce_get(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_debounce_get(triggerName.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_debounce_set(NULL, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+
                 REQUIRE( dsl_ode_trigger_limit_event_get(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_trigger_limit_event_get(triggerName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_trigger_limit_event_set(NULL, 1) == DSL_RESULT_INVALID_INPUT_PARAM );
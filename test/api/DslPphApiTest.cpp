@@ -108,6 +108,87 @@ SCENARIO( "A ODE Handler's Enabled Setting can be disabled and re-enabled", "[pp
     }
 }
 
+SCENARIO( "A ODE Handler's Parallel Mode can be enabled and disabled", "[pph-api]" )
+{
+    GIVEN( "A new ODE Handler with Parallel Mode disabled by default" ) 
+    {
+        std::wstring odePphName(L"pph");
+
+        REQUIRE( dsl_pph_ode_new(odePphName.c_str()) == DSL_RESULT_SUCCESS );
+
+        boolean enabled(true);
+        uint maxWorkers(99);
+        REQUIRE( dsl_pph_ode_parallel_mode_get(odePphName.c_str(), 
+            &enabled, &maxWorkers) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == false );
+        REQUIRE( maxWorkers == 0 );
+        
+        WHEN( "Parallel Mode is enabled" ) 
+        {
+            REQUIRE( dsl_pph_ode_parallel_mode_set(odePphName.c_str(), 
+                true, 4) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pph_ode_parallel_mode_get(odePphName.c_str(), 
+                &enabled, &maxWorkers) == DSL_RESULT_SUCCESS );
+            REQUIRE( enabled == true );
+            REQUIRE( maxWorkers == 4 );
+            
+            THEN( "Parallel Mode can be disabled" ) 
+            {
+                REQUIRE( dsl_pph_ode_parallel_mode_set(odePphName.c_str(), 
+                    false, 0) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pph_ode_parallel_mode_get(odePphName.c_str(), 
+                    &enabled, &maxWorkers) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == false );
+                REQUIRE( maxWorkers == 0 );
+
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A ODE Handler's Stats collection can be enabled and disabled", "[pph-api]" )
+{
+    GIVEN( "A new ODE Handler with Stats disabled by default" ) 
+    {
+        std::wstring odePphName(L"pph");
+
+        REQUIRE( dsl_pph_ode_new(odePphName.c_str()) == DSL_RESULT_SUCCESS );
+
+        boolean enabled(true);
+        REQUIRE( dsl_pph_ode_stats_enabled_get(odePphName.c_str(), 
+            &enabled) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == false );
+
+        dsl_pph_ode_stats stats{0};
+        stats.frames = 99;
+        REQUIRE( dsl_pph_ode_stats_get(odePphName.c_str(), 
+            &stats) == DSL_RESULT_SUCCESS );
+        REQUIRE( stats.frames == 0 );
+        REQUIRE( stats.batch.count == 0 );
+        
+        WHEN( "Stats are enabled" ) 
+        {
+            REQUIRE( dsl_pph_ode_stats_enabled_set(odePphName.c_str(), 
+                true) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pph_ode_stats_enabled_get(odePphName.c_str(), 
+                &enabled) == DSL_RESULT_SUCCESS );
+            REQUIRE( enabled == true );
+            
+            THEN( "Stats can be disabled" ) 
+            {
+                REQUIRE( dsl_pph_ode_stats_enabled_set(odePphName.c_str(), 
+                    false) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pph_ode_stats_enabled_get(odePphName.c_str(), 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == false );
+
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new ODE Handler can Add and Remove a ODE Trigger", "[pph-api]" )
 {
     GIVEN( "A new ODE Handler and new ODE Trigger" ) 
@@ -370,6 +451,24 @@ SCENARIO( "The Pad Probe Handler API checks for NULL input parameters", "[pph-ap
                 REQUIRE( dsl_pph_ode_trigger_remove_many(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_pph_ode_trigger_remove_many(pphName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_pph_ode_trigger_remove_all(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_parallel_mode_get(NULL, &enabled, &interval) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_parallel_mode_get(pphName.c_str(), NULL, &interval) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_parallel_mode_get(pphName.c_str(), &enabled, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_parallel_mode_set(NULL, true, 0) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_stats_enabled_get(NULL, &enabled) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_stats_enabled_get(pphName.c_str(), NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_stats_enabled_set(NULL, true) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_stats_get(NULL, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_stats_get(pphName.c_str(), NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_pph_custom_new(NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_pph_custom_new(pphName.c_str(), NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
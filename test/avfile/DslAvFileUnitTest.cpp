@@ -122,3 +122,40 @@ SCENARIO( "An AvInputFile utility can read a MJPG file correctly",  "[AvFile]" )
     }
 }
 
+
+SCENARIO( "An AvJpgEncoder can encode a system-memory RGBA image to file",  "[AvFile]" )
+{
+    GIVEN( "A synthetic RGBA image with padded lines" ) 
+    {
+        uint width(320), height(240), pitch(320*4 + 64);
+        
+        std::vector<uint8_t> image(pitch*height);
+        for (uint i = 0; i < image.size(); i++)
+        {
+            image[i] = (uint8_t)(i % 251);
+        }
+        std::string filepath("./av-jpg-encoder-test.jpeg");
+        std::remove(filepath.c_str());
+    
+        WHEN( "When the AvJpgEncoder object is created" )
+        {
+            AvJpgEncoder avJpgEncoder(width, height);
+            
+            REQUIRE( avJpgEncoder.GetWidth() == width );
+            REQUIRE( avJpgEncoder.GetHeight() == height );
+            
+            THEN( "The same encoder can write the image more than once" )
+            {
+                REQUIRE( avJpgEncoder.Encode(image.data(), 
+                    pitch, filepath.c_str()) == true );
+                REQUIRE( std::ifstream(filepath).good() );
+                std::remove(filepath.c_str());
+
+                REQUIRE( avJpgEncoder.Encode(image.data(), 
+                    pitch, filepath.c_str()) == true );
+                REQUIRE( std::ifstream(filepath).good() );
+                std::remove(filepath.c_str());
+            }
+        }
+    }
+}
@@ -0,0 +1,154 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "catch.hpp"
+#include "DslJpegEncoderPool.h"
+
+using namespace DSL;
+
+/**
+ * @struct TestEncodeJob
+ * @brief JPEG Encode Job for a synthetic system-memory RGBA image. Counts
+ * completions, and can block the worker thread until released.
+ */
+struct TestEncodeJob : public JpegEncodeJob
+{
+    TestEncodeJob(std::vector<uint8_t>& image, uint width, uint height,
+        uint pitch, const std::string& filespec, 
+        std::atomic<uint>& succeededCount, std::atomic<bool>* pGate)
+        : JpegEncodeJob(image.data(), width, height, pitch, filespec)
+        , succeededCount(succeededCount)
+        , pGate(pGate)
+    {};
+
+    void HandleEncodeComplete()
+    {
+        if (succeeded)
+        {
+            succeededCount++;
+        }
+        while (pGate and !pGate->load())
+        {
+            g_usleep(1000);
+        }
+    };
+
+    std::atomic<uint>& succeededCount;
+    std::atomic<bool>* pGate;
+};
+
+SCENARIO( "A JpegEncoderPool encodes queued images of different resolutions",  "[JpegEncoderPool]" )
+{
+    GIVEN( "A new JpegEncoderPool and two synthetic RGBA images" ) 
+    {
+        JpegEncoderPool jpegEncoderPool(2, 16);
+        
+        std::vector<uint8_t> image1(320*4*240, 0x40);
+        std::vector<uint8_t> image2(64*4*48, 0xC0);
+        
+        std::atomic<uint> succeededCount(0);
+
+        WHEN( "Images are queued to the pool" )
+        {
+            for (uint i = 0; i < 8; i++)
+            {
+                std::string filespec("./jpeg-encoder-pool-test-" 
+                    + std::to_string(i) + ".jpeg");
+                    
+                TestEncodeJob* pJob = (i % 2)
+                    ? new TestEncodeJob(image1, 320, 240, 320*4, filespec, 
+                        succeededCount, NULL)
+                    : new TestEncodeJob(image2, 64, 48, 64*4, filespec, 
+                        succeededCount, NULL);
+                REQUIRE( jpegEncoderPool.Queue(pJob) == true );
+            }
+            jpegEncoderPool.Flush();
+            
+            THEN( "All images are encoded to file" )
+            {
+                REQUIRE( succeededCount == 8 );
+                REQUIRE( jpegEncoderPool.GetQueueDepth() == 0 );
+                REQUIRE( jpegEncoderPool.GetEncoded() == 8 );
+                REQUIRE( jpegEncoderPool.GetFailed() == 0 );
+                REQUIRE( jpegEncoderPool.GetDropped() == 0 );
+                
+                for (uint i = 0; i < 8; i++)
+                {
+                    std::string filespec("./jpeg-encoder-pool-test-" 
+                        + std::to_string(i) + ".jpeg");
+                    REQUIRE( std::ifstream(filespec).good() );
+                    std::remove(filespec.c_str());
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "A JpegEncoderPool drops images when its queue is full",  "[JpegEncoderPool]" )
+{
+    GIVEN( "A new JpegEncoderPool with one worker and a small queue" ) 
+    {
+        JpegEncoderPool jpegEncoderPool(1, 2);
+        
+        std::vector<uint8_t> image(64*4*48, 0x80);
+        std::string filespec("./jpeg-encoder-pool-test.jpeg");
+        
+        std::atomic<uint> succeededCount(0);
+        std::atomic<bool> gate(false);
+
+        WHEN( "More images are queued than the blocked worker can hold" )
+        {
+            // At most one job is being handled and two are queued.
+            uint queued(0);
+            for (uint i = 0; i < 4; i++)
+            {
+                TestEncodeJob* pJob = new TestEncodeJob(image, 64, 48, 64*4,
+                    filespec, succeededCount, &gate);
+                if (jpegEncoderPool.Queue(pJob))
+                {
+                    queued++;
+                }
+                else
+                {
+                    delete pJob;
+                }
+            }
+            REQUIRE( jpegEncoderPool.GetQueueDepth() == queued );
+            
+            gate = true;
+            jpegEncoderPool.Flush();
+            
+            THEN( "The extra images are dropped and counted" )
+            {
+                REQUIRE( queued < 4 );
+                REQUIRE( jpegEncoderPool.GetDropped() == 4 - queued );
+                REQUIRE( succeededCount == queued );
+                REQUIRE( jpegEncoderPool.GetQueueDepth() == 0 );
+                
+                std::remove(filespec.c_str());
+            }
+        }
+    }
+}
@@ -0,0 +1,161 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "catch.hpp"
+#include "Dsl.h"
+#include "DslApi.h"
+
+// ---------------------------------------------------------------------------
+// Shared Test Inputs 
+
+static const std::wstring server_pipeline_name(L"server-pipeline");
+static const std::wstring client_pipeline_name(L"client-pipeline");
+
+static const std::wstring uri_source_name(L"uri-source");
+static const std::wstring uri(L"/opt/nvidia/deepstream/deepstream/samples/streams/sample_1080p_h265.mp4");
+
+static const std::wstring rtsp_sink_name(L"rtsp-sink");
+static const std::wstring host(L"localhost");
+static const uint udp_port(5400);
+static const uint rtsp_port(8554);
+static const uint encoder(DSL_ENCODER_HW_H264);
+static const uint bitrate(4000000);
+static const uint interval(0);
+
+static const std::wstring rtsp_source_name(L"rtsp-source");
+static const std::wstring rtsp_uri(L"rtsp://localhost:8554/rtsp-sink");
+static const uint latency(100);
+static const uint timeout(2);
+static const uint reconnection_sleep(1);
+static const uint reconnection_timeout(5);
+
+static const std::wstring fake_sink_name(L"fake-sink");
+
+static GThread* main_loop_thread(NULL);
+
+static void* main_loop_thread_func(void *data)
+{
+    dsl_main_loop_run();
+    
+    return NULL;
+}
+
+// Polls the RTSP Source's connection data until the Source is connected and
+// not in a reconnection cycle, or until the timeout expires.
+static bool wait_for_connection(dsl_rtsp_connection_data& data, uint timeoutMs)
+{
+    for (uint waitedMs = 0; waitedMs <= timeoutMs; waitedMs += 100)
+    {
+        if (dsl_source_rtsp_connection_data_get(rtsp_source_name.c_str(),
+            &data) == DSL_RESULT_SUCCESS and data.is_connected and 
+                !data.is_in_reconnect)
+        {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    return false;
+}
+
+SCENARIO( "An RTSP Source reconnects after its RTSP Server is restarted", 
+    "[rtsp-reconnect]" )
+{
+    GIVEN( "A Server Pipeline with an RTSP Sink and a Client Pipeline with an RTSP Source" ) 
+    {
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_uri_new(uri_source_name.c_str(), uri.c_str(), 
+            false, 0, 0) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_sink_rtsp_server_new(rtsp_sink_name.c_str(), host.c_str(),
+            udp_port, rtsp_port, encoder, bitrate, interval) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_source_rtsp_new(rtsp_source_name.c_str(), rtsp_uri.c_str(),
+            DSL_RTP_ALL, 0, 0, latency, timeout) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_source_rtsp_connection_params_set(rtsp_source_name.c_str(),
+            reconnection_sleep, reconnection_timeout) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_sink_fake_new(fake_sink_name.c_str()) == DSL_RESULT_SUCCESS );
+        
+        const wchar_t* server_components[] = {L"uri-source", L"rtsp-sink", NULL};
+        const wchar_t* client_components[] = {L"rtsp-source", L"fake-sink", NULL};
+        
+        REQUIRE( dsl_pipeline_new_component_add_many(server_pipeline_name.c_str(), 
+            server_components) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_new_component_add_many(client_pipeline_name.c_str(), 
+            client_components) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Server is stopped and restarted while the Client is playing" ) 
+        {
+            REQUIRE( dsl_pipeline_play(server_pipeline_name.c_str()) 
+                == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_play(client_pipeline_name.c_str()) 
+                == DSL_RESULT_SUCCESS );
+            
+            main_loop_thread = g_thread_new("main-loop", 
+                main_loop_thread_func, NULL);
+            
+            dsl_rtsp_connection_data data{0};
+            REQUIRE( wait_for_connection(data, 10000) == true );
+            REQUIRE( data.count == 1 );
+            
+            REQUIRE( dsl_pipeline_stop(server_pipeline_name.c_str()) 
+                == DSL_RESULT_SUCCESS );
+            
+            // wait for the buffer timeout and at least one failed attempt
+            std::this_thread::sleep_for(std::chrono::milliseconds(6000));
+
+            REQUIRE( dsl_source_rtsp_connection_data_get(rtsp_source_name.c_str(),
+                &data) == DSL_RESULT_SUCCESS );
+            REQUIRE( data.is_in_reconnect == true );
+            REQUIRE( data.retries >= 1 );
+
+            REQUIRE( dsl_pipeline_play(server_pipeline_name.c_str()) 
+                == DSL_RESULT_SUCCESS );
+
+            // allow for the maximum jittered backoff after the failed attempts
+            bool reconnected = wait_for_connection(data, 30000);
+            
+            THEN( "The RTSP Source is reconnected and counted once" )
+            {
+                REQUIRE( reconnected == true );
+                REQUIRE( data.count == 2 );
+                
+                REQUIRE( dsl_pipeline_stop(client_pipeline_name.c_str()) 
+                    == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_stop(server_pipeline_name.c_str()) 
+                    == DSL_RESULT_SUCCESS );
+
+                dsl_main_loop_quit();
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
@@ -0,0 +1,570 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/**
+ * ODE engine micro-benchmark - drives OdePadProbeHandler::HandlePadData
+ * with a synthetic NvDsBatchMeta, one ODE Trigger type at a time, and
+ * reports the cost of the ODE hot loop in ns/frame and ns/object.
+ *
+ * No pipeline, decoder, or inference is used, only the (CPU) NvDs meta
+ * pools, so the benchmark can run on a CPU-only Linux box.
+ *
+ * Build with "make bench" and run "./dsl-ode-bench.exe --help" for options.
+ */
+
+#include <getopt.h>
+#include "DslServices.h"
+#include "DslPadProbeHandler.h"
+#include "DslOdeTrigger.h"
+#include "DslOdeAction.h"
+#include "DslOdeArea.h"
+#include "DslDisplayTypes.h"
+
+using namespace DSL;
+
+/**
+ * @struct BenchParams
+ * @brief synthetic batch and run parameters, settable from the command line.
+ */
+struct BenchParams
+{
+    uint sources = 4;
+    uint objects = 20;
+    uint classes = 4;
+    uint speed = 4;
+    uint width = 1920;
+    uint height = 1080;
+    uint frames = 1000;
+    uint warmup = 100;
+    uint seed = 1;
+    bool parallel = false;
+    uint workers = 0;
+    bool withActions = true;
+    std::string trigger;
+};
+
+/**
+ * @struct SyntheticObject
+ * @brief state of one synthetic object - position, velocity and class -
+ * used to regenerate the object meta on each batch.
+ */
+struct SyntheticObject
+{
+    uint64_t objectId;
+    uint classId;
+    float left, top, width, height;
+    float dx, dy;
+    float confidence;
+};
+
+/**
+ * @class SyntheticBatch
+ * @brief GstBuffer with a synthetic NvDsBatchMeta of a fixed number of frames
+ * (one per source), each with a fixed number of moving objects.
+ */
+class SyntheticBatch
+{
+public:
+
+    SyntheticBatch(const BenchParams& params)
+        : m_params(params)
+        , m_frameNum(0)
+    {
+        m_pBatchMeta = nvds_create_batch_meta(params.sources);
+
+        m_pBuffer = gst_buffer_new();
+        NvDsMeta* pMeta = gst_buffer_add_nvds_meta(m_pBuffer, m_pBatchMeta,
+            NULL, nvds_batch_meta_copy_func, nvds_batch_meta_release_func);
+        pMeta->meta_type = NVDS_BATCH_GST_META;
+
+        std::mt19937 rng(params.seed);
+        std::uniform_real_distribution<float> unit(0.0, 1.0);
+
+        for (uint i=0; i<params.sources; i++)
+        {
+            NvDsFrameMeta* pFrameMeta =
+                nvds_acquire_frame_meta_from_pool(m_pBatchMeta);
+            pFrameMeta->source_id = i;
+            pFrameMeta->batch_id = i;
+            pFrameMeta->pad_index = i;
+            pFrameMeta->bInferDone = true;
+            pFrameMeta->source_frame_width = params.width;
+            pFrameMeta->source_frame_height = params.height;
+            nvds_add_frame_meta_to_batch(m_pBatchMeta, pFrameMeta);
+            m_frames.push_back(pFrameMeta);
+
+            m_objects.push_back(std::vector<SyntheticObject>());
+            for (uint j=0; j<params.objects; j++)
+            {
+                SyntheticObject object;
+                object.objectId = (uint64_t)i*params.objects + j;
+                object.classId = (params.classes)
+                    ? (uint)(unit(rng)*params.classes) % params.classes : 0;
+                object.width = 20 + unit(rng)*180;
+                object.height = 20 + unit(rng)*180;
+                object.left = unit(rng)*(params.width - object.width);
+                object.top = unit(rng)*(params.height - object.height);
+                object.dx = (unit(rng)*2 - 1)*params.speed;
+                object.dy = (unit(rng)*2 - 1)*params.speed;
+                object.confidence = 0.3 + unit(rng)*0.7;
+                m_objects[i].push_back(object);
+            }
+        }
+    }
+
+    ~SyntheticBatch()
+    {
+        // releases the batch meta as well
+        gst_buffer_unref(m_pBuffer);
+    }
+
+    /**
+     * @brief Moves all objects one step and regenerates the object meta for
+     * each frame. Display meta added while handling the last batch is cleared.
+     */
+    void NextBatch()
+    {
+        m_frameNum++;
+
+        for (uint i=0; i<m_frames.size(); i++)
+        {
+            NvDsFrameMeta* pFrameMeta = m_frames[i];
+            pFrameMeta->frame_num = m_frameNum;
+            pFrameMeta->ntp_timestamp = m_frameNum*33333333;
+
+            nvds_clear_display_meta_list(pFrameMeta,
+                pFrameMeta->display_meta_list);
+            nvds_clear_obj_meta_list(pFrameMeta, pFrameMeta->obj_meta_list);
+
+            for (auto& object: m_objects[i])
+            {
+                Move(object);
+
+                NvDsObjectMeta* pObjectMeta =
+                    nvds_acquire_obj_meta_from_pool(m_pBatchMeta);
+                pObjectMeta->unique_component_id = 1;
+                pObjectMeta->class_id = object.classId;
+                pObjectMeta->object_id = object.objectId;
+                pObjectMeta->confidence = object.confidence;
+                pObjectMeta->tracker_confidence = object.confidence;
+                pObjectMeta->rect_params.left = object.left;
+                pObjectMeta->rect_params.top = object.top;
+                pObjectMeta->rect_params.width = object.width;
+                pObjectMeta->rect_params.height = object.height;
+                nvds_add_obj_meta_to_frame(pFrameMeta, pObjectMeta, NULL);
+            }
+        }
+    }
+
+    GstBuffer* GetBuffer(){return m_pBuffer;};
+
+private:
+
+    /**
+     * @brief moves an object one step, bouncing it off the frame edges.
+     */
+    void Move(SyntheticObject& object)
+    {
+        object.left += object.dx;
+        object.top += object.dy;
+
+        if (object.left < 0 or object.left + object.width > m_params.width)
+        {
+            object.dx = -object.dx;
+            object.left = std::max(0.0f,
+                std::min(object.left, m_params.width - object.width));
+        }
+        if (object.top < 0 or object.top + object.height > m_params.height)
+        {
+            object.dy = -object.dy;
+            object.top = std::max(0.0f,
+                std::min(object.top, m_params.height - object.height));
+        }
+    }
+
+    const BenchParams& m_params;
+
+    uint64_t m_frameNum;
+
+    GstBuffer* m_pBuffer;
+
+    NvDsBatchMeta* m_pBatchMeta;
+
+    std::vector<NvDsFrameMeta*> m_frames;
+
+    std::vector<std::vector<SyntheticObject>> m_objects;
+};
+
+static boolean custom_check_for_occurrence(void* buffer,
+    void* frame_meta, void* object_meta, void* client_data)
+{
+    return ((NvDsObjectMeta*)object_meta)->confidence > 0.5;
+}
+
+static boolean custom_post_process_frame(void* buffer,
+    void* frame_meta, void* client_data)
+{
+    return false;
+}
+
+static void monitor_occurrence(dsl_ode_occurrence_info* occurrence_info,
+    void* client_data)
+{
+    (*(uint64_t*)client_data)++;
+}
+
+/**
+ * @brief Creates a new instance of the named ODE Trigger type.
+ * @return new Trigger or nullptr if the name is unknown.
+ */
+static DSL_ODE_TRIGGER_PTR NewTrigger(const std::string& type)
+{
+    const char* source("");
+    uint classId(0);
+    uint limit(DSL_ODE_TRIGGER_LIMIT_NONE);
+
+    static DSL_RGBA_COLOR_PTR pColor =
+        DSL_RGBA_COLOR_NEW("bench-color", 1.0, 1.0, 1.0, 1.0);
+
+    if (type == "always")
+    {
+        return DSL_ODE_TRIGGER_ALWAYS_NEW(type.c_str(), source,
+            DSL_ODE_PRE_OCCURRENCE_CHECK);
+    }
+    if (type == "absence")
+    {
+        return DSL_ODE_TRIGGER_ABSENCE_NEW(type.c_str(), source, classId, limit);
+    }
+    if (type == "occurrence")
+    {
+        return DSL_ODE_TRIGGER_OCCURRENCE_NEW(type.c_str(),
+            source, classId, limit);
+    }
+    if (type == "instance")
+    {
+        return DSL_ODE_TRIGGER_INSTANCE_NEW(type.c_str(),
+            source, classId, limit);
+    }
+    if (type == "summation")
+    {
+        return DSL_ODE_TRIGGER_SUMMATION_NEW(type.c_str(),
+            source, classId, limit);
+    }
+    if (type == "custom")
+    {
+        return DSL_ODE_TRIGGER_CUSTOM_NEW(type.c_str(), source, classId, limit,
+            custom_check_for_occurrence, custom_post_process_frame, NULL);
+    }
+    if (type == "count")
+    {
+        return DSL_ODE_TRIGGER_COUNT_NEW(type.c_str(),
+            source, classId, limit, 2, 10);
+    }
+    if (type == "smallest")
+    {
+        return DSL_ODE_TRIGGER_SMALLEST_NEW(type.c_str(),
+            source, classId, limit);
+    }
+    if (type == "largest")
+    {
+        return DSL_ODE_TRIGGER_LARGEST_NEW(type.c_str(),
+            source, classId, limit);
+    }
+    if (type == "new-low")
+    {
+        return DSL_ODE_TRIGGER_NEW_LOW_NEW(type.c_str(),
+            source, classId, limit, 5);
+    }
+    if (type == "new-high")
+    {
+        return DSL_ODE_TRIGGER_NEW_HIGH_NEW(type.c_str(),
+            source, classId, limit, 5);
+    }
+    if (type == "cross")
+    {
+        DSL_ODE_TRIGGER_CROSS_PTR pTrigger = DSL_ODE_TRIGGER_CROSS_NEW(
+            type.c_str(), source, classId, limit, 5, 10,
+            DSL_OBJECT_TRACE_TEST_METHOD_END_POINTS, pColor);
+
+        static DSL_RGBA_LINE_PTR pLine = DSL_RGBA_LINE_NEW("bench-line",
+            960, 0, 960, 1080, 4, pColor);
+        DSL_ODE_AREA_LINE_PTR pArea = DSL_ODE_AREA_LINE_NEW("bench-line-area",
+            pLine, false, DSL_BBOX_POINT_SOUTH);
+        pTrigger->AddArea(pArea);
+        return pTrigger;
+    }
+    if (type == "persistence")
+    {
+        return DSL_ODE_TRIGGER_PERSISTENCE_NEW(type.c_str(),
+            source, classId, limit, 1, 10);
+    }
+    if (type == "latest")
+    {
+        return DSL_ODE_TRIGGER_LATEST_NEW(type.c_str(),
+            source, classId, limit);
+    }
+    if (type == "earliest")
+    {
+        return DSL_ODE_TRIGGER_EARLIEST_NEW(type.c_str(),
+            source, classId, limit);
+    }
+    if (type == "distance")
+    {
+        return DSL_ODE_TRIGGER_DISTANCE_NEW(type.c_str(), source, 0, 1, limit,
+            0, 200, DSL_BBOX_POINT_ANY, DSL_DISTANCE_METHOD_FIXED_PIXELS);
+    }
+    if (type == "intersection")
+    {
+        return DSL_ODE_TRIGGER_INTERSECTION_NEW(type.c_str(),
+            source, 0, 1, limit);
+    }
+    if (type == "inclusion")
+    {
+        // Occurrence Trigger filtered by an Inclusion Area
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger =
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(type.c_str(), source, classId, limit);
+
+        static dsl_coordinate coordinates[4] =
+            {{400,200},{1500,200},{1700,900},{200,900}};
+        static DSL_RGBA_POLYGON_PTR pPolygon = DSL_RGBA_POLYGON_NEW(
+            "bench-polygon", coordinates, 4, 4, pColor);
+        DSL_ODE_AREA_INCLUSION_PTR pArea = DSL_ODE_AREA_INCLUSION_NEW(
+            "bench-inclusion-area", pPolygon, false, DSL_BBOX_POINT_SOUTH);
+        pTrigger->AddArea(pArea);
+        return pTrigger;
+    }
+    return nullptr;
+}
+
+static const std::vector<std::string> triggerTypes =
+{
+    "always", "absence", "occurrence", "instance", "summation", "custom",
+    "count", "smallest", "largest", "new-low", "new-high", "cross",
+    "persistence", "latest", "earliest", "distance", "intersection",
+    "inclusion"
+};
+
+/**
+ * @brief Runs the benchmark for a single Trigger type, or for all Trigger types
+ * added to the same ODE Handler if type == "all".
+ * @return total nanoseconds spent in HandlePadData for the timed batches.
+ */
+static uint64_t RunBenchmark(const BenchParams& params, const std::string& type,
+    uint64_t& occurrences)
+{
+    DSL_PPH_ODE_PTR pOdeHandler = DSL_PPH_ODE_NEW("bench-ode-handler");
+
+    if (params.parallel)
+    {
+        pOdeHandler->SetParallelMode(true, params.workers);
+    }
+
+    // Common, in-memory only, actions - file and console IO is excluded
+    // as it would dominate the measurement.
+    static DSL_RGBA_COLOR_PTR pColor =
+        DSL_RGBA_COLOR_NEW("bench-action-color", 1.0, 0.0, 0.0, 1.0);
+    static DSL_RGBA_FONT_PTR pFont =
+        DSL_RGBA_FONT_NEW("bench-font", "arial", 12, pColor);
+
+    DSL_ODE_ACTION_BBOX_FORMAT_PTR pFormatAction =
+        DSL_ODE_ACTION_BBOX_FORMAT_NEW("bench-format-bbox",
+            4, pColor, false, pColor);
+    DSL_ODE_ACTION_DISPLAY_PTR pDisplayAction =
+        DSL_ODE_ACTION_DISPLAY_NEW("bench-display",
+            "%0 %1", 10, 10, pFont, false, pColor);
+    DSL_ODE_ACTION_MONITOR_PTR pMonitorAction =
+        DSL_ODE_ACTION_MONITOR_NEW("bench-monitor",
+            monitor_occurrence, &occurrences);
+
+    std::vector<DSL_ODE_TRIGGER_PTR> triggers;
+    if (type == "all")
+    {
+        for (const auto& ivec: triggerTypes)
+        {
+            triggers.push_back(NewTrigger(ivec));
+        }
+    }
+    else
+    {
+        triggers.push_back(NewTrigger(type));
+    }
+    for (const auto& ivec: triggers)
+    {
+        if (params.withActions)
+        {
+            ivec->AddAction(pFormatAction);
+            ivec->AddAction(pDisplayAction);
+            ivec->AddAction(pMonitorAction);
+        }
+        pOdeHandler->AddChild(ivec);
+    }
+
+    SyntheticBatch batch(params);
+
+    GstPadProbeInfo info = {(GstPadProbeType)0};
+    info.type = GST_PAD_PROBE_TYPE_BUFFER;
+    info.data = batch.GetBuffer();
+
+    for (uint i=0; i<params.warmup; i++)
+    {
+        batch.NextBatch();
+        pOdeHandler->HandlePadData(&info);
+    }
+    occurrences = 0;
+
+    uint64_t totalNs(0);
+    for (uint i=0; i<params.frames; i++)
+    {
+        // regenerating the batch meta is not part of the measurement
+        batch.NextBatch();
+
+        auto start = std::chrono::steady_clock::now();
+        pOdeHandler->HandlePadData(&info);
+        auto end = std::chrono::steady_clock::now();
+
+        totalNs += std::chrono::duration_cast<std::chrono::nanoseconds>(
+            end - start).count();
+    }
+    pOdeHandler->RemoveAllChildren();
+
+    return totalNs;
+}
+
+static void PrintUsage(const char* app)
+{
+    std::cout
+        << "usage: " << app << " [options]\n"
+        << "  --sources=N     frames (sources) per batch, default 4\n"
+        << "  --objects=N     objects per frame, default 20\n"
+        << "  --classes=N     number of classes in the object mix, default 4\n"
+        << "  --speed=N       max object motion in pixels/frame, default 4\n"
+        << "  --frames=N      number of timed batches, default 1000\n"
+        << "  --warmup=N      number of untimed batches, default 100\n"
+        << "  --seed=N        random seed for the object mix, default 1\n"
+        << "  --trigger=TYPE  run a single Trigger type, or 'all' for all\n"
+        << "                  Trigger types on a single ODE Handler\n"
+        << "  --parallel[=N]  enable parallel mode with N max workers\n"
+        << "  --no-actions    run the Triggers without any Actions\n"
+        << "Trigger types:";
+    for (const auto& ivec: triggerTypes)
+    {
+        std::cout << " " << ivec;
+    }
+    std::cout << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    BenchParams params;
+
+    static struct option longOptions[] =
+    {
+        {"sources", required_argument, 0, 's'},
+        {"objects", required_argument, 0, 'o'},
+        {"classes", required_argument, 0, 'c'},
+        {"speed", required_argument, 0, 'v'},
+        {"frames", required_argument, 0, 'f'},
+        {"warmup", required_argument, 0, 'w'},
+        {"seed", required_argument, 0, 'r'},
+        {"trigger", required_argument, 0, 't'},
+        {"parallel", optional_argument, 0, 'p'},
+        {"no-actions", no_argument, 0, 'n'},
+        {"help", no_argument, 0, 'h'},
+        {0, 0, 0, 0}
+    };
+    int opt;
+    while ((opt = getopt_long(argc, argv, "h", longOptions, NULL)) != -1)
+    {
+        switch (opt)
+        {
+        case 's': params.sources = std::max(1, atoi(optarg)); break;
+        case 'o': params.objects = atoi(optarg); break;
+        case 'c': params.classes = std::max(1, atoi(optarg)); break;
+        case 'v': params.speed = atoi(optarg); break;
+        case 'f': params.frames = std::max(1, atoi(optarg)); break;
+        case 'w': params.warmup = atoi(optarg); break;
+        case 'r': params.seed = atoi(optarg); break;
+        case 't': params.trigger = optarg; break;
+        case 'p':
+            params.parallel = true;
+            params.workers = (optarg) ? atoi(optarg) : 0;
+            break;
+        case 'n': params.withActions = false; break;
+        default:
+            PrintUsage(argv[0]);
+            return (opt == 'h') ? 0 : 1;
+        }
+    }
+
+    // Initializes the GStreamer Lib and GST Debug category used for logging.
+    Services::GetServices();
+
+    if (params.trigger.size() and params.trigger != "all" and
+        !NewTrigger(params.trigger))
+    {
+        std::cerr << "unknown Trigger type '" << params.trigger << "'\n";
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::vector<std::string> runs;
+    if (params.trigger.size())
+    {
+        runs.push_back(params.trigger);
+    }
+    else
+    {
+        runs = triggerTypes;
+        runs.push_back("all");
+    }
+
+    uint64_t frames = (uint64_t)params.frames*params.sources;
+    uint64_t objects = frames*params.objects;
+
+    std::cout << "sources=" << params.sources
+        << " objects/frame=" << params.objects
+        << " classes=" << params.classes
+        << " speed=" << params.speed
+        << " batches=" << params.frames
+        << " parallel=" << (params.parallel ? "on" : "off")
+        << " actions=" << (params.withActions ? "on" : "off") << "\n\n";
+
+    std::cout << std::left << std::setw(16) << "trigger"
+        << std::right << std::setw(14) << "ns/frame"
+        << std::setw(14) << "ns/object"
+        << std::setw(14) << "events" << "\n";
+
+    for (const auto& ivec: runs)
+    {
+        uint64_t occurrences(0);
+        uint64_t totalNs = RunBenchmark(params, ivec, occurrences);
+
+        std::cout << std::left << std::setw(16) << ivec << std::right
+            << std::fixed << std::setprecision(1)
+            << std::setw(14) << (double)totalNs/frames
+            << std::setw(14) << ((objects) ? (double)totalNs/objects : 0.0)
+            << std::setw(14) << occurrences << std::endl;
+    }
+    return 0;
+}
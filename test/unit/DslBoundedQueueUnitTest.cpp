@@ -0,0 +1,80 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "catch.hpp"
+#include "DslBoundedQueue.h"
+
+using namespace DSL;
+
+SCENARIO( "A new BoundedQueue is created correctly", "[BoundedQueue]" )
+{
+    GIVEN( "A capacity that is not a power of two" ) 
+    {
+        uint capacity(100);
+
+        WHEN( "A new BoundedQueue is created" )
+        {
+            BoundedQueue<uint> queue(capacity);
+
+            THEN( "The capacity is rounded up and the queue is empty" )
+            {
+                uint value(0);
+                REQUIRE( queue.GetCapacity() == 128 );
+                REQUIRE( queue.GetSize() == 0 );
+                REQUIRE( queue.Pop(value) == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A BoundedQueue pushes and pops in FIFO order until full", "[BoundedQueue]" )
+{
+    GIVEN( "A new BoundedQueue" ) 
+    {
+        BoundedQueue<uint> queue(4);
+
+        WHEN( "The queue is filled to capacity" )
+        {
+            for (uint i = 0; i < 4; i++)
+            {
+                REQUIRE( queue.Push(i) == true );
+            }
+            THEN( "Further pushes fail and all values are popped in order" )
+            {
+                REQUIRE( queue.Push(4) == false );
+                REQUIRE( queue.GetSize() == 4 );
+                
+                uint value(0);
+                for (uint i = 0; i < 4; i++)
+                {
+                    REQUIRE( queue.Pop(value) == true );
+                    REQUIRE( value == i );
+                }
+                REQUIRE( queue.Pop(value) == false );
+                REQUIRE( queue.Push(5) == true );
+            }
+        }
+    }
+}
@@ -545,3 +545,81 @@ SCENARIO( "A Source Frame Rate Display is constructed correctly", "[DisplayTypes
         }
     }
 }
+
+SCENARIO( "A Display Meta Allocator acquires Display Meta on demand", "[DisplayTypes]" )
+{
+    GIVEN( "A new Display Meta Allocator for a frame" )
+    {
+        NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(1);
+        NvDsFrameMeta* pFrameMeta = nvds_acquire_frame_meta_from_pool(pBatchMeta);
+        nvds_add_frame_meta_to_batch(pBatchMeta, pFrameMeta);
+
+        std::string colorName("my-custom-color");
+        DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW(colorName.c_str(), 
+            0.12, 0.34, 0.56, 0.78);
+        DSL_RGBA_RECTANGLE_PTR pRectangle = DSL_RGBA_RECTANGLE_NEW("my-rectangle", 
+            10, 10, 100, 100, 2, pColor, false, pColor);
+
+        WHEN( "No display elements are added to the frame" )
+        {
+            DisplayMetaAllocator displayMetaData(pBatchMeta, 2);
+            displayMetaData.AddToFrame(pFrameMeta);
+            
+            THEN( "No Display Meta is acquired or added" )
+            {
+                REQUIRE( displayMetaData.IsEnabled() == true );
+                REQUIRE( pFrameMeta->display_meta_list == NULL );
+            }
+        }
+        WHEN( "More elements are added than a single Display Meta can hold" )
+        {
+            DisplayMetaAllocator displayMetaData(pBatchMeta, 2);
+            for (uint i = 0; i < MAX_ELEMENTS_IN_DISPLAY_META+1; i++)
+            {
+                pRectangle->AddMeta(displayMetaData, pFrameMeta);
+            }
+            
+            THEN( "A second Display Meta is acquired for the overflow only" )
+            {
+                REQUIRE( displayMetaData.GetSize() == 2 );
+                REQUIRE( displayMetaData.GetFirst()->num_rects == 
+                    MAX_ELEMENTS_IN_DISPLAY_META );
+                REQUIRE( displayMetaData.AcquireLine() != NULL );
+                REQUIRE( displayMetaData.GetSize() == 2 );
+                
+                displayMetaData.AddToFrame(pFrameMeta);
+                REQUIRE( g_list_length(pFrameMeta->display_meta_list) == 2 );
+            }
+        }
+        WHEN( "The max size is reached" )
+        {
+            DisplayMetaAllocator displayMetaData(pBatchMeta, 1);
+            for (uint i = 0; i < MAX_ELEMENTS_IN_DISPLAY_META; i++)
+            {
+                REQUIRE( displayMetaData.AcquireRect() != NULL );
+            }
+            
+            THEN( "No further elements of the same kind can be acquired" )
+            {
+                REQUIRE( displayMetaData.AcquireRect() == NULL );
+                REQUIRE( displayMetaData.AcquireLabel() != NULL );
+                REQUIRE( displayMetaData.GetSize() == 1 );
+                
+                displayMetaData.AddToFrame(pFrameMeta);
+            }
+        }
+        WHEN( "The max size is 0" )
+        {
+            DisplayMetaAllocator displayMetaData(pBatchMeta, 0);
+            pRectangle->AddMeta(displayMetaData, pFrameMeta);
+            
+            THEN( "No Display Meta is acquired" )
+            {
+                REQUIRE( displayMetaData.IsEnabled() == false );
+                REQUIRE( displayMetaData.GetFirst() == NULL );
+                REQUIRE( displayMetaData.GetSize() == 0 );
+            }
+        }
+        nvds_destroy_batch_meta(pBatchMeta);
+    }
+}
@@ -0,0 +1,210 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslFileWriter.h"
+
+using namespace DSL;
+
+static std::string read_file(const std::string& filePath)
+{
+    std::ifstream file(filePath);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+SCENARIO( "A new FileWriter writes its header correctly", "[FileWriter]" )
+{
+    GIVEN( "Attributes for a new FileWriter" ) 
+    {
+        std::string filePath("./file-writer-header.csv");
+        std::string header("Column A,Column B\n");
+
+        WHEN( "A new FileWriter is created in TRUNCATE mode" )
+        {
+            {
+                FileWriter fileWriter(filePath.c_str(), 
+                    DSL_WRITE_MODE_TRUNCATE, header, false);
+            }
+            THEN( "The header is written to the new file" )
+            {
+                REQUIRE( read_file(filePath) == header );
+            }
+        }
+        WHEN( "A second FileWriter is created in APPEND mode" )
+        {
+            {
+                FileWriter fileWriter(filePath.c_str(), 
+                    DSL_WRITE_MODE_TRUNCATE, header, false);
+            }
+            {
+                FileWriter fileWriter(filePath.c_str(), 
+                    DSL_WRITE_MODE_APPEND, header, false);
+                REQUIRE( fileWriter.Write("1,2\n", false) == true );
+            }
+            THEN( "The header is only written once" )
+            {
+                REQUIRE( read_file(filePath) == header + "1,2\n" );
+            }
+        }
+    }
+}
+
+SCENARIO( "A FileWriter writes all data on Sync", "[FileWriter]" )
+{
+    GIVEN( "A new FileWriter" ) 
+    {
+        std::string filePath("./file-writer-sync.txt");
+
+        FileWriter fileWriter(filePath.c_str(), DSL_WRITE_MODE_TRUNCATE, "", false);
+
+        WHEN( "Data is written from multiple threads" )
+        {
+            std::vector<std::thread> writers;
+            for (uint i = 0; i < 4; i++)
+            {
+                writers.push_back(std::thread([&fileWriter]()
+                {
+                    for (uint j = 0; j < 1000; j++)
+                    {
+                        fileWriter.Write("0123456789\n", false);
+                    }
+                }));
+            }
+            for (auto &ivec: writers)
+            {
+                ivec.join();
+            }
+            fileWriter.Sync();
+            
+            THEN( "All data is in the file after Sync returns" )
+            {
+                REQUIRE( read_file(filePath).size() == 4*1000*11 );
+                REQUIRE( fileWriter.GetDroppedBytes() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A FileWriter rotates its file by size correctly", "[FileWriter]" )
+{
+    GIVEN( "A new FileWriter with a max size" ) 
+    {
+        std::string filePath("./file-writer-rotate.csv");
+        std::string header("Column A,Column B\n");
+
+        FileWriter fileWriter(filePath.c_str(), 
+            DSL_WRITE_MODE_TRUNCATE, header, false);
+        fileWriter.SetRotation(1024, 0);
+        fileWriter.SetSyncPolicy(DSL_FILE_SYNC_POLICY_ON_ROTATE);
+        
+        uint64_t maxSize(0);
+        uint maxAge(99);
+        fileWriter.GetRotation(&maxSize, &maxAge);
+        REQUIRE( maxSize == 1024 );
+        REQUIRE( maxAge == 0 );
+        REQUIRE( fileWriter.GetSyncPolicy() == DSL_FILE_SYNC_POLICY_ON_ROTATE );
+
+        WHEN( "More than the max size is written" )
+        {
+            fileWriter.Write(std::string(2048, 'x') + "\n", false);
+            fileWriter.Sync();
+            
+            THEN( "The file is rotated and the new file starts with the header" )
+            {
+                REQUIRE( read_file(filePath) == header );
+            }
+        }
+    }
+}
+
+SCENARIO( "A FileWriter writes a timestamped header to each new file", "[FileWriter]" )
+{
+    GIVEN( "A new FileWriter with a timestamped header and a max size" ) 
+    {
+        std::string filePath("./file-writer-timestamp.txt");
+        std::string header("File opened: %Y\n");
+        
+        char year[8] = {0};
+        time_t seconds = time(NULL);
+        struct tm currentTm;
+        localtime_r(&seconds, &currentTm);
+        strftime(year, sizeof(year), "%Y", &currentTm);
+        std::string expectedHeader = "File opened: " + std::string(year) + "\n";
+
+        WHEN( "The file is rotated" )
+        {
+            {
+                FileWriter fileWriter(filePath.c_str(), 
+                    DSL_WRITE_MODE_TRUNCATE, header, true);
+                fileWriter.SetRotation(1024, 0);
+                fileWriter.Write(std::string(2048, 'x') + "\n", false);
+                fileWriter.Sync();
+                
+                REQUIRE( read_file(filePath) == expectedHeader );
+            }
+            THEN( "A second session appended to the file is marked as well" )
+            {
+                {
+                    FileWriter fileWriter(filePath.c_str(), 
+                        DSL_WRITE_MODE_APPEND, header, true);
+                }
+                REQUIRE( read_file(filePath) == expectedHeader + expectedHeader );
+            }
+        }
+    }
+}
+
+SCENARIO( "A FileWriter keeps its file when rotation fails", "[FileWriter]" )
+{
+    GIVEN( "A new FileWriter with a file name too long to rotate" ) 
+    {
+        // the timestamp suffix takes the rotated name past NAME_MAX
+        std::string filePath("./" + std::string(240, 'f') + ".csv");
+        std::string header("Column A,Column B\n");
+        std::string data(std::string(2048, 'x') + "\n");
+
+        FileWriter fileWriter(filePath.c_str(), 
+            DSL_WRITE_MODE_TRUNCATE, header, false);
+        fileWriter.SetRotation(1024, 0);
+
+        WHEN( "More than the max size is written" )
+        {
+            fileWriter.Write(data, false);
+            fileWriter.Sync();
+            
+            THEN( "The file is re-opened for append and its contents are kept" )
+            {
+                REQUIRE( read_file(filePath) == header + data );
+                
+                fileWriter.Write(data, false);
+                fileWriter.Sync();
+                REQUIRE( read_file(filePath) == header + data + data );
+                
+                std::remove(filePath.c_str());
+            }
+        }
+    }
+}
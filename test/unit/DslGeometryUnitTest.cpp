@@ -0,0 +1,214 @@
+/*
+The MIT License
+
+Copyright (c) 2021-2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslGeometry.h"
+#include "DslGeosTypes.h"
+
+using namespace DSL;
+
+SCENARIO( "The distance from a point to a Geometry Path matches GEOS", "[Geometry]" )
+{
+    GIVEN( "A new Geometry Path and GEOS Line from the same two points" ) 
+    {
+        GeometryPath testPath(100, 100, 300, 200);
+        GeosLine testGeosLine(100, 100, 300, 200);
+
+        WHEN( "The distance from a set of points to the Path is calculated" )
+        {
+            THEN( "The distance is the same as returned by GEOS" )
+            {
+                for (uint x = 0; x <= 400; x += 7)
+                {
+                    for (uint y = 0; y <= 300; y += 7)
+                    {
+                        GeosPoint testGeosPoint(x, y);
+                        REQUIRE( GeometryPointToPathDistance(testPath, x, y) == 
+                            testGeosLine.Distance(testGeosPoint) );
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "The location of a point relative to a Geometry Path ring matches GEOS", 
+    "[Geometry]" )
+{
+    GIVEN( "A new Geometry Path ring and GEOS Polygon from the same coordinates" ) 
+    {
+        // concave polygon with more edges than the widest vector
+        dsl_coordinate coordinates[7] = 
+            {{100,100},{300,100},{300,300},{200,150},{150,300},{100,300},{120,200}};
+        uint numCoordinates(7);
+
+        dsl_polygon_params polygon{coordinates, numCoordinates};
+        
+        GeometryPath testRing(coordinates, numCoordinates, true);
+        GeosPolygon testGeosPolygon(polygon);
+ 
+        REQUIRE( testRing.GetNumSegments() == numCoordinates );
+
+        WHEN( "Points inside, outside, and on the border of the ring are checked" )
+        {
+            THEN( "Only points contained by the GEOS Polygon are interior" )
+            {
+                for (uint x = 90; x <= 310; x += 5)
+                {
+                    for (uint y = 90; y <= 310; y += 5)
+                    {
+                        GeosPoint testGeosPoint(x, y);
+                        REQUIRE( (GeometryPointLocation(testRing, x, y) ==
+                            DSL_GEOMETRY_INTERIOR) == 
+                            testGeosPolygon.Contains(testGeosPoint) );
+                    }
+                }
+            }
+        }
+        WHEN( "Vertices and edge points of the ring are checked" )
+        {
+            THEN( "The points are on the boundary" )
+            {
+                REQUIRE( GeometryPointLocation(testRing, 100, 100) == 
+                    DSL_GEOMETRY_BOUNDARY );
+                REQUIRE( GeometryPointLocation(testRing, 200, 100) == 
+                    DSL_GEOMETRY_BOUNDARY );
+                REQUIRE( GeometryPointLocation(testRing, 300, 250) == 
+                    DSL_GEOMETRY_BOUNDARY );
+                REQUIRE( GeometryPointLocation(testRing, 400, 250) == 
+                    DSL_GEOMETRY_EXTERIOR );
+            }
+        }
+    }
+}
+
+SCENARIO( "The intersection of a segment with a Geometry Path matches GEOS", 
+    "[Geometry]" )
+{
+    GIVEN( "A new Geometry Path and GEOS Line from the same two points" ) 
+    {
+        GeometryPath testPath(100, 100, 300, 200);
+        GeosLine testGeosLine(100, 100, 300, 200);
+
+        WHEN( "A set of segments are checked for intersection with the Path" )
+        {
+            THEN( "The result is the same as returned by GEOS" )
+            {
+                for (uint x = 0; x <= 400; x += 20)
+                {
+                    for (uint y = 0; y <= 300; y += 20)
+                    {
+                        GeosLine testSegment(200, 150, x, y);
+                        GeosLine testOffsetSegment(210, 140, x, y);
+                        REQUIRE( GeometrySegmentIntersectsPath(testPath, 
+                            200, 150, x, y) == 
+                            testGeosLine.Intersects(testSegment) );
+                        REQUIRE( GeometrySegmentIntersectsPath(testPath, 
+                            210, 140, x, y) == 
+                            testGeosLine.Intersects(testOffsetSegment) );
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "The distance and overlap of two rectangles matches GEOS", "[Geometry]" )
+{
+    GIVEN( "A fixed rectangle" ) 
+    {
+        NvOSD_RectParams rectA{100, 100, 100, 100};
+        GeosRectangle testGeosRectA(rectA);
+
+        WHEN( "A second rectangle is moved across and around the first" )
+        {
+            THEN( "The distance and overlap are the same as returned by GEOS" )
+            {
+                for (uint left = 0; left <= 300; left += 25)
+                {
+                    for (uint top = 0; top <= 300; top += 25)
+                    {
+                        for (uint size = 25; size <= 200; size *= 2)
+                        {
+                            NvOSD_RectParams rectB{(float)left, (float)top,
+                                (float)size, (float)size};
+                            GeosRectangle testGeosRectB(rectB);
+                            
+                            REQUIRE( GeometryRectDistance(rectA, rectB) ==
+                                testGeosRectA.Distance(testGeosRectB) );
+                            REQUIRE( GeometryRectsOverlap(rectA, rectB) ==
+                                testGeosRectA.Overlaps(testGeosRectB) );
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "A GeometryGrid query returns the same boxes as a brute force search", 
+    "[Geometry]" )
+{
+    GIVEN( "A GeometryGrid built from a scene of boxes" ) 
+    {
+        std::vector<GeometryBox> boxes;
+        
+        // a crowded scene of boxes with varying sizes, and a few points.
+        for (uint i = 0; i < 250; i++)
+        {
+            double left((i*137)%1920), top((i*71)%1080);
+            double size((i%7)*20);
+            boxes.push_back({left, top, left+size, top+size*2});
+        }
+        GeometryGrid grid;
+        grid.Build(boxes);
+
+        WHEN( "The grid is queried with boxes across and outside the scene" )
+        {
+            THEN( "The indices found are the same and in ascending order" )
+            {
+                std::vector<uint> indices;
+                for (int left = -200; left <= 2000; left += 150)
+                {
+                    for (int top = -200; top <= 1200; top += 150)
+                    {
+                        GeometryBox box{(double)left, (double)top, 
+                            (double)left+120, (double)top+240};
+                        grid.Query(box, indices);
+                        
+                        std::vector<uint> expectedIndices;
+                        for (uint i = 0; i < boxes.size(); i++)
+                        {
+                            if (GeometryBoxesIntersect(box, boxes[i]))
+                            {
+                                expectedIndices.push_back(i);
+                            }
+                        }
+                        REQUIRE( indices == expectedIndices );
+                    }
+                }
+            }
+        }
+    }
+}
@@ -358,3 +358,63 @@ SCENARIO( "A GEOS Polygon can determine if a point is within correctly", "[GeosT
         }
     }
 }
+
+SCENARIO( "A Prepared Polygon tests points the same as a GEOS Polygon", "[GeosTypes]" )
+{
+    GIVEN( "A new Prepared Polygon and GEOS Polygon from the same Polygon Display Type" ) 
+    {
+        std::string polygonName  = "my-polygon";
+        dsl_coordinate coordinates[4] = {{100,100},{210,110},{220, 300},{110,330}};
+        uint numCoordinates(4);
+        uint lineWidth(4);
+
+        std::string colorName  = "my-custom-color";
+        double red(0.12), green(0.34), blue(0.56), alpha(0.78);
+
+        DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW(colorName.c_str(), red, green, blue, alpha);
+        
+        DSL_RGBA_POLYGON_PTR pPolygon = DSL_RGBA_POLYGON_NEW(polygonName.c_str(), 
+            coordinates, numCoordinates, lineWidth, pColor);
+        
+        PreparedPolygon testPreparedPolygon(*pPolygon);
+        GeosPolygon testGeosPolygon(*pPolygon);
+ 
+        WHEN( "Points inside, outside, and on the border of the Polygon are checked" )
+        {
+            THEN( "The Prepared Polygon's Contains function returns the same result" )
+            {
+                for (uint x = 90; x <= 230; x += 5)
+                {
+                    for (uint y = 90; y <= 340; y += 5)
+                    {
+                        GeosPoint testGeosPoint(x, y);
+                        REQUIRE( testPreparedPolygon.Contains(x, y) == 
+                            testGeosPolygon.Contains(testGeosPoint) );
+                    }
+                }
+            }
+        }
+        WHEN( "Points near the first edge of the Polygon are checked" )
+        {
+            THEN( "The Prepared Polygon's IsNearEdge function returns the correct result" )
+            {
+                REQUIRE( testPreparedPolygon.IsNearEdge(155, 105, 0) == true );
+                REQUIRE( testPreparedPolygon.IsNearEdge(155, 107, 2) == true );
+                REQUIRE( testPreparedPolygon.IsNearEdge(155, 109, 2) == false );
+                REQUIRE( testPreparedPolygon.IsOutsideBounds(155, 109, 2) == false );
+                REQUIRE( testPreparedPolygon.IsOutsideBounds(96, 96, 2) == true );
+            }
+        }
+        WHEN( "Rectangles clear of and overlapping the Polygon's bounds are checked" )
+        {
+            NvOSD_RectParams clearRect{0, 0, 50, 50};
+            NvOSD_RectParams overlappingRect{80, 80, 50, 50};
+            
+            THEN( "The Prepared Polygon's IsOutsideBounds function returns the correct result" )
+            {
+                REQUIRE( testPreparedPolygon.IsOutsideBounds(clearRect) == true );
+                REQUIRE( testPreparedPolygon.IsOutsideBounds(overlappingRect) == false );
+            }
+        }
+    }
+}
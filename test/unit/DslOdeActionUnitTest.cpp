@@ -25,12 +25,13 @@ THE SOFTWARE.
 #include "catch.hpp"
 #include "DslOdeTrigger.h"
 #include "DslOdeAction.h"
+#include "DslOdeActionExecutor.h"
 #include "DslDisplayTypes.h"
 #include "DslMailer.h"
 
 using namespace DSL;
 
-static std::vector<NvDsDisplayMeta*> displayMetaData;
+static DisplayMetaAllocator displayMetaData(NULL, 0);
 
 static void ode_occurrence_handler_cb(uint64_t event_id, const wchar_t* name,
     void* buffer, void* display_meta, void* frame_meta, void* object_meta, void* client_data)
@@ -499,6 +500,86 @@ SCENARIO( "A CustomOdeAction handles an ODE Occurence correctly", "[OdeAction]"
     }
 }
 
+struct AsyncOccurrenceData
+{
+    uint count;
+    uint64_t eventId;
+    void* buffer;
+    uint64_t frameNum;
+    std::string label;
+};
+
+static void ode_async_occurrence_handler_cb(uint64_t event_id, const wchar_t* name,
+    void* buffer, void* display_meta, void* frame_meta, void* object_meta, void* client_data)
+{
+    AsyncOccurrenceData* pData = (AsyncOccurrenceData*)client_data;
+    
+    pData->count++;
+    pData->eventId = event_id;
+    pData->buffer = buffer;
+    pData->frameNum = ((NvDsFrameMeta*)frame_meta)->frame_num;
+    pData->label = ((NvDsObjectMeta*)object_meta)->obj_label;
+}    
+
+SCENARIO( "A CustomOdeAction handles an ODE Occurence asynchronously", "[OdeAction]" )
+{
+    GIVEN( "A new CustomOdeAction with async enabled" ) 
+    {
+        std::string odeTriggerName("first-occurence");
+        std::string source;
+        uint classId(1);
+        uint limit(1);
+
+        std::string actionName("ode-action");
+        
+        AsyncOccurrenceData data{0};
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), source.c_str(), classId, limit);
+
+        DSL_ODE_ACTION_CUSTOM_PTR pAction = DSL_ODE_ACTION_CUSTOM_NEW(
+            actionName.c_str(), ode_async_occurrence_handler_cb, &data);
+            
+        REQUIRE( pAction->GetAsyncEnabled() == false );
+        pAction->SetAsyncEnabled(true);
+        REQUIRE( pAction->GetAsyncEnabled() == true );
+
+        WHEN( "An ODE occurs and the metadata is released before it is handled" )
+        {
+            NvDsFrameMeta* pFrameMeta = new NvDsFrameMeta{0};
+            pFrameMeta->bInferDone = true;
+            pFrameMeta->frame_num = 444;
+            pFrameMeta->source_id = 2;
+
+            NvDsObjectMeta* pObjectMeta = new NvDsObjectMeta{0};
+            pObjectMeta->class_id = classId;
+            std::string objectLabel("detected-object");
+            pObjectMeta->obj_label[objectLabel.copy(pObjectMeta->obj_label, 127)] = 0;
+            
+            pAction->HandleOccurrence(pTrigger, (GstBuffer*)pFrameMeta, 
+                displayMetaData, pFrameMeta, pObjectMeta);
+                
+            delete pFrameMeta;
+            delete pObjectMeta;
+            
+            THEN( "The client handler is called with a copy of the metadata" )
+            {
+                OdeActionExecutor::GetExecutor()->Flush();
+                
+                REQUIRE( data.count == 1 );
+                REQUIRE( data.buffer == NULL );
+                REQUIRE( data.frameNum == 444 );
+                REQUIRE( data.label == objectLabel );
+                
+                uint64_t queued(0), dropped(0);
+                pAction->GetAsyncStats(&queued, &dropped);
+                REQUIRE( queued == 1 );
+                REQUIRE( dropped == 0 );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new MonitorOdeAction is created correctly", "[OdeAction]" )
 {
     GIVEN( "Attributes for a new MonitorOdeAction" ) 
@@ -587,6 +668,122 @@ SCENARIO( "A MonitorOdeAction handles an ODE Occurence correctly", "[OdeAction]"
     }
 }
 
+struct MonitorBatchData
+{
+    uint calls;
+    uint lastCount;
+    uint64_t lastFrameNum;
+    std::wstring lastTriggerName;
+};
+
+static void ode_occurrence_batch_monitor_cb(dsl_ode_occurrence_info* pInfo, 
+    uint count, void* client_data)
+{
+    MonitorBatchData* pData = (MonitorBatchData*)client_data;
+    
+    pData->calls++;
+    pData->lastCount = count;
+    pData->lastFrameNum = pInfo[count-1].source_info.frame_num;
+    pData->lastTriggerName = pInfo[count-1].trigger_name;
+}
+
+SCENARIO( "A MonitorBatchOdeAction delivers ODE Occurrences in batches", "[OdeAction]" )
+{
+    GIVEN( "A new MonitorBatchOdeAction in per-frame mode" ) 
+    {
+        std::string odeTriggerName("occurrence");
+        std::wstring wstrOdeTriggerName(L"occurrence");
+        std::string source;
+        uint classId(1);
+        uint limit(0);
+
+        std::string actionName("ode-action");
+        
+        MonitorBatchData data{0};
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), source.c_str(), classId, limit);
+
+        DSL_ODE_ACTION_MONITOR_BATCH_PTR pAction = DSL_ODE_ACTION_MONITOR_BATCH_NEW(
+            actionName.c_str(), ode_occurrence_batch_monitor_cb, 4, 0, &data);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;
+        frameMeta.frame_num = 1;
+        frameMeta.source_id = 2;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId;
+
+        WHEN( "Several occurrences are handled for the same frame" )
+        {
+            for (uint i = 0; i < 3; i++)
+            {
+                pAction->HandleOccurrence(pTrigger, NULL, 
+                    displayMetaData, &frameMeta, &objectMeta);
+            }
+            THEN( "The batch is delivered on the first occurrence of the next frame" )
+            {
+                REQUIRE( data.calls == 0 );
+                
+                frameMeta.frame_num = 2;
+                pAction->HandleOccurrence(pTrigger, NULL, 
+                    displayMetaData, &frameMeta, &objectMeta);
+                    
+                REQUIRE( data.calls == 1 );
+                REQUIRE( data.lastCount == 3 );
+                REQUIRE( data.lastFrameNum == 1 );
+                REQUIRE( data.lastTriggerName == wstrOdeTriggerName );
+                
+                pAction->Flush();
+                REQUIRE( data.calls == 2 );
+                REQUIRE( data.lastCount == 1 );
+                REQUIRE( data.lastFrameNum == 2 );
+            }
+        }
+        WHEN( "The frame is post-processed by the parent Trigger" )
+        {
+            REQUIRE( pTrigger->AddAction(pAction) == true );
+            
+            for (uint i = 0; i < 3; i++)
+            {
+                pAction->HandleOccurrence(pTrigger, NULL, 
+                    displayMetaData, &frameMeta, &objectMeta);
+            }
+            THEN( "The batch is delivered at the end of the frame" )
+            {
+                REQUIRE( data.calls == 0 );
+                
+                pTrigger->PostProcessFrameActions(&frameMeta);
+                REQUIRE( data.calls == 1 );
+                REQUIRE( data.lastCount == 3 );
+                REQUIRE( data.lastFrameNum == 1 );
+                
+                // nothing left to deliver for the frame.
+                pTrigger->PostProcessFrameActions(&frameMeta);
+                REQUIRE( data.calls == 1 );
+            }
+        }
+        WHEN( "More occurrences than the max-size are handled for a frame" )
+        {
+            for (uint i = 0; i < 5; i++)
+            {
+                pAction->HandleOccurrence(pTrigger, NULL, 
+                    displayMetaData, &frameMeta, &objectMeta);
+            }
+            THEN( "The batch is delivered when full" )
+            {
+                REQUIRE( data.calls == 1 );
+                REQUIRE( data.lastCount == 4 );
+                
+                pAction->Flush();
+                REQUIRE( data.calls == 2 );
+                REQUIRE( data.lastCount == 1 );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new CaptureFrameOdeAction is created correctly", "[OdeAction]" )
 {
     GIVEN( "Attributes for a new CaptureFrameOdeAction" ) 
@@ -1341,6 +1538,89 @@ SCENARIO( "A MotcOdeAction handles an ODE Occurence correctly", "[OdeAction]" )
     }
 }
 
+SCENARIO( "A FileBinaryOdeAction writes ODE Occurrences that can be read back", "[OdeAction]" )
+{
+    GIVEN( "A new FileBinaryOdeAction" ) 
+    {
+        std::string triggerName("first-occurence");
+        std::string source;
+        uint classId(1);
+        uint limit(0);
+        
+        std::string actionName("action");
+        std::string filePath("./event-log.bin");
+        uint mode(DSL_WRITE_MODE_TRUNCATE);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(triggerName.c_str(), 
+                source.c_str(), classId, limit);
+
+        WHEN( "The Action handles an Object and a Frame occurrence" )
+        {
+            {
+                DSL_ODE_ACTION_FILE_BINARY_PTR pAction = 
+                    DSL_ODE_ACTION_FILE_BINARY_NEW(actionName.c_str(), 
+                        filePath.c_str(), mode);
+
+                NvDsFrameMeta frameMeta = {0};
+                frameMeta.source_id = 2;
+                frameMeta.frame_num = 123;
+                frameMeta.ntp_timestamp = 456;
+                frameMeta.bInferDone = true;
+                
+                NvDsObjectMeta objectMeta = {0};
+                objectMeta.class_id = classId;
+                objectMeta.object_id = 789;
+                objectMeta.rect_params.left = 10;
+                objectMeta.rect_params.top = 20;
+                objectMeta.rect_params.width = 30;
+                objectMeta.rect_params.height = 40;
+                objectMeta.confidence = 0.5;
+                strcpy(objectMeta.obj_label, "person");
+                
+                pAction->HandleOccurrence(pTrigger, NULL, 
+                    displayMetaData, &frameMeta, &objectMeta);
+                pAction->HandleOccurrence(pTrigger, NULL, 
+                    displayMetaData, &frameMeta, NULL);
+            }
+            THEN( "The records are read back correctly from the first segment" )
+            {
+                OdeEventLogReader reader(
+                    OdeEventLogSegmentPath(filePath, 0).c_str());
+                REQUIRE( reader.IsOpen() == true );
+                
+                // two events plus strings for the trigger name and label
+                REQUIRE( reader.GetHeader()->recordCount == 4 );
+                
+                const OdeEventLogEventRecord* pEvent(NULL);
+                REQUIRE( reader.Next(&pEvent) == true );
+                REQUIRE( reader.GetString(pEvent->triggerId) == triggerName );
+                REQUIRE( reader.GetString(pEvent->labelId) == "person" );
+                REQUIRE( pEvent->flags == (DSL_ODE_EVENT_LOG_FLAG_OBJECT |
+                    DSL_ODE_EVENT_LOG_FLAG_INFER_DONE) );
+                REQUIRE( pEvent->sourceId == 2 );
+                REQUIRE( pEvent->frameNum == 123 );
+                REQUIRE( pEvent->ntpTimestamp == 456 );
+                REQUIRE( pEvent->classId == (int32_t)classId );
+                REQUIRE( pEvent->trackingId == 789 );
+                REQUIRE( pEvent->left == 10 );
+                REQUIRE( pEvent->height == 40 );
+                REQUIRE( pEvent->inferConfidence == 0.5 );
+                
+                REQUIRE( reader.Next(&pEvent) == true );
+                REQUIRE( pEvent->flags == DSL_ODE_EVENT_LOG_FLAG_INFER_DONE );
+                REQUIRE( pEvent->labelId == 0 );
+                
+                REQUIRE( reader.Next(&pEvent) == false );
+                
+                // the unused, pre-allocated next segment is removed on close.
+                REQUIRE( access(OdeEventLogSegmentPath(filePath, 1).c_str(), 
+                    F_OK) != 0 );
+            }
+        }
+    }
+}
+
 SCENARIO( "A FileOdeAction with forceFlush set flushes the stream correctly", "[OdeAction]" )
 {
     GIVEN( "A new FileOdeAction" ) 
@@ -1368,13 +1648,16 @@ SCENARIO( "A FileOdeAction with forceFlush set flushes the stream correctly", "[
             
             THEN( "The OdeAction can Handle the Occurrence" )
             {
-                // NOTE:: verification requires visual post inspection of the file.
                 pAction->HandleOccurrence(pTrigger, NULL, 
                     displayMetaData, &frameMeta, &objectMeta);
                 
-                // Simulate the idle thread callback
-                // Flush must return false to unschedule, self remove
-                REQUIRE( pAction->Flush() == false );
+                // Flush must block until the writer thread has written the event
+                pAction->Flush();
+                
+                std::ifstream file(filePath);
+                std::stringstream contents;
+                contents << file.rdbuf();
+                REQUIRE( contents.str().find(triggerName) != std::string::npos );
             }
         }
     }
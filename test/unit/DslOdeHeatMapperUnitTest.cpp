@@ -28,7 +28,7 @@ THE SOFTWARE.
 
 using namespace DSL;
 
-static std::vector<NvDsDisplayMeta*> displayMetaData;
+static DisplayMetaAllocator displayMetaData(NULL, 0);
 
 SCENARIO( "A new OdeHeatMapper is created correctly", "[OdeHeatMapper]" )
 {
@@ -333,3 +333,352 @@ SCENARIO( "A new OdeHeatMapper can File metrics correctly", "[OdeHeatMapper]" )
     }
 }
 
+
+SCENARIO( "A new OdeHeatMapper adds Display Meta for each source correctly", 
+    "[OdeHeatMapper]" )
+{
+    GIVEN( "A new HeatMapper in memory" ) 
+    {
+        std::string colorPaletteName("color-palette");
+        std::string odeHeatMapperName("accumulator");
+        uint cols(16), rows(9);
+        
+        std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>> pColorPalette = 
+            std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>>{
+                new std::vector<DSL_RGBA_COLOR_PTR>};
+        
+        for (auto const& ivec: RgbaPredefinedColor::s_predefinedColorPalettes[
+            DSL_COLOR_PREDEFINED_PALETTE_SPECTRAL])
+        {
+            pColorPalette->push_back(std::shared_ptr<RgbaColor>
+                (new RgbaColor("", ivec)));
+        }
+        
+        DSL_RGBA_COLOR_PALETTE_PTR pPredefinedColorPalette = 
+            DSL_RGBA_COLOR_PALETTE_NEW(colorPaletteName.c_str(), pColorPalette);
+
+        DSL_ODE_HEAT_MAPPER_PTR pOdeHeatMapper = 
+            DSL_ODE_HEAT_MAPPER_NEW(odeHeatMapperName.c_str(), 
+                cols, rows, DSL_BBOX_POINT_SOUTH, pPredefinedColorPalette);
+
+        NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(2);
+        NvDsFrameMeta* pFrameMeta0 = nvds_acquire_frame_meta_from_pool(pBatchMeta);
+        nvds_add_frame_meta_to_batch(pBatchMeta, pFrameMeta0);
+        NvDsFrameMeta* pFrameMeta1 = nvds_acquire_frame_meta_from_pool(pBatchMeta);
+        nvds_add_frame_meta_to_batch(pBatchMeta, pFrameMeta1);
+        
+        pFrameMeta0->source_id = 0;
+        pFrameMeta0->source_frame_width = DSL_1K_HD_WIDTH;
+        pFrameMeta0->source_frame_height = DSL_1K_HD_HEIGHT;
+        // source-id offset by the unique Pipeline id in the upper bits
+        pFrameMeta1->source_id = (1 << 16) | 1;
+        pFrameMeta1->source_frame_width = DSL_1K_HD_WIDTH;
+        pFrameMeta1->source_frame_height = DSL_1K_HD_HEIGHT;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.rect_params.left = 10;
+        objectMeta.rect_params.top = 10;
+        objectMeta.rect_params.width = 20;
+        objectMeta.rect_params.height = 20;
+        
+        WHEN( "Occurrences are added for the first source only" )
+        {
+            pOdeHeatMapper->HandleOccurrence(pFrameMeta0, &objectMeta);
+            pOdeHeatMapper->HandleOccurrence(pFrameMeta0, &objectMeta);
+
+            objectMeta.rect_params.left = DSL_1K_HD_WIDTH - 30;
+            objectMeta.rect_params.top = DSL_1K_HD_HEIGHT - 30;
+            pOdeHeatMapper->HandleOccurrence(pFrameMeta0, &objectMeta);
+
+            THEN( "Display meta is added to the first source's frames only" )
+            {
+                DisplayMetaAllocator displayMetaData0(pBatchMeta, 1);
+                pOdeHeatMapper->AddDisplayMeta(displayMetaData0, pFrameMeta0);
+                
+                REQUIRE( displayMetaData0.GetSize() == 1 );
+                REQUIRE( displayMetaData0.GetFirst()->num_rects == 2 );
+                
+                // most occurrences gets the last palette color, half of
+                // the most occurrences rounds up to the middle color.
+                NvOSD_RectParams* pRectParams = 
+                    displayMetaData0.GetFirst()->rect_params;
+                REQUIRE( pRectParams[0].left == 0 );
+                REQUIRE( pRectParams[0].top == 0 );
+                REQUIRE( pRectParams[0].bg_color.red == 
+                    pColorPalette->back()->red );
+                REQUIRE( pRectParams[1].left == (cols-1)*(DSL_1K_HD_WIDTH/cols) );
+                REQUIRE( pRectParams[1].bg_color.red == 
+                    pColorPalette->at(round((pColorPalette->size()-1)/2.0))->red );
+
+                DisplayMetaAllocator displayMetaData1(pBatchMeta, 1);
+                pOdeHeatMapper->AddDisplayMeta(displayMetaData1, pFrameMeta1);
+                
+                REQUIRE( displayMetaData1.GetSize() == 0 );
+                
+                displayMetaData0.AddToFrame(pFrameMeta0);
+            }
+        }
+        WHEN( "Occurrences are added for both sources" )
+        {
+            pOdeHeatMapper->HandleOccurrence(pFrameMeta0, &objectMeta);
+            pOdeHeatMapper->HandleOccurrence(pFrameMeta1, &objectMeta);
+
+            THEN( "The metrics are totaled over both sources" )
+            {
+                const uint64_t* outBuffer;
+                uint size;
+                
+                pOdeHeatMapper->GetMetrics(&outBuffer, &size);
+                
+                REQUIRE( size == cols*rows );
+                REQUIRE( outBuffer[0] == 2 );
+                REQUIRE( outBuffer[1] == 0 );
+            }
+        }
+        nvds_destroy_batch_meta(pBatchMeta);
+    }
+}
+
+SCENARIO( "An OdeHeatMapper with decay enabled decays its metrics correctly", 
+    "[OdeHeatMapper]" )
+{
+    GIVEN( "A new HeatMapper with a decay half-life of 10 seconds" ) 
+    {
+        std::string colorPaletteName("color-palette");
+        std::string odeHeatMapperName("accumulator");
+        uint cols(16), rows(9);
+        uint halfLife(10);
+        
+        std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>> pColorPalette = 
+            std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>>{
+                new std::vector<DSL_RGBA_COLOR_PTR>};
+        
+        for (auto const& ivec: RgbaPredefinedColor::s_predefinedColorPalettes[
+            DSL_COLOR_PREDEFINED_PALETTE_SPECTRAL])
+        {
+            pColorPalette->push_back(std::shared_ptr<RgbaColor>
+                (new RgbaColor("", ivec)));
+        }
+        
+        DSL_RGBA_COLOR_PALETTE_PTR pPredefinedColorPalette = 
+            DSL_RGBA_COLOR_PALETTE_NEW(colorPaletteName.c_str(), pColorPalette);
+
+        DSL_ODE_HEAT_MAPPER_PTR pOdeHeatMapper = 
+            DSL_ODE_HEAT_MAPPER_NEW(odeHeatMapperName.c_str(), 
+                cols, rows, DSL_BBOX_POINT_SOUTH, pPredefinedColorPalette);
+                
+        REQUIRE( pOdeHeatMapper->GetDecay() == 0 );
+        REQUIRE( pOdeHeatMapper->SetDecay(halfLife) == true );
+        REQUIRE( pOdeHeatMapper->GetDecay() == halfLife );
+
+        NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(1);
+        NvDsFrameMeta* pFrameMeta = nvds_acquire_frame_meta_from_pool(pBatchMeta);
+        nvds_add_frame_meta_to_batch(pBatchMeta, pFrameMeta);
+        
+        pFrameMeta->source_frame_width = DSL_1K_HD_WIDTH;
+        pFrameMeta->source_frame_height = DSL_1K_HD_HEIGHT;
+        pFrameMeta->buf_pts = 0;
+
+        NvDsObjectMeta objectMeta0 = {0};
+        objectMeta0.rect_params.left = 10;
+        objectMeta0.rect_params.top = 10;
+        objectMeta0.rect_params.width = 20;
+        objectMeta0.rect_params.height = 20;
+
+        NvDsObjectMeta objectMeta1 = {0};
+        objectMeta1.rect_params.left = DSL_1K_HD_WIDTH - 30;
+        objectMeta1.rect_params.top = DSL_1K_HD_HEIGHT - 30;
+        objectMeta1.rect_params.width = 20;
+        objectMeta1.rect_params.height = 20;
+        
+        const uint64_t* outBuffer;
+        uint size;
+        
+        for (auto i = 0; i < 4; i++)
+        {
+            pOdeHeatMapper->HandleOccurrence(pFrameMeta, &objectMeta0);
+        }
+        pOdeHeatMapper->GetMetrics(&outBuffer, &size);
+        REQUIRE( outBuffer[0] == 4 );
+        
+        WHEN( "One half-life of stream time has passed" )
+        {
+            pFrameMeta->buf_pts = (uint64_t)halfLife*GST_SECOND;
+            pOdeHeatMapper->HandleOccurrence(pFrameMeta, &objectMeta1);
+            
+            THEN( "The metrics are decayed by half" )
+            {
+                pOdeHeatMapper->GetMetrics(&outBuffer, &size);
+                REQUIRE( outBuffer[0] == 2 );
+                REQUIRE( outBuffer[cols*rows-1] == 1 );
+            }
+        }
+        WHEN( "A position is updated after the map has been displayed" )
+        {
+            DisplayMetaAllocator displayMetaData0(pBatchMeta, 1);
+            pOdeHeatMapper->AddDisplayMeta(displayMetaData0, pFrameMeta);
+            REQUIRE( displayMetaData0.GetFirst()->num_rects == 1 );
+            displayMetaData0.AddToFrame(pFrameMeta);
+            
+            // one occurrence vs. the four occurrences decayed by half.
+            pFrameMeta->buf_pts = (uint64_t)halfLife*GST_SECOND;
+            pOdeHeatMapper->HandleOccurrence(pFrameMeta, &objectMeta1);
+            
+            THEN( "The updated position is colored relative to the decayed most occurrences" )
+            {
+                DisplayMetaAllocator displayMetaData1(pBatchMeta, 1);
+                pOdeHeatMapper->AddDisplayMeta(displayMetaData1, pFrameMeta);
+                
+                REQUIRE( displayMetaData1.GetFirst()->num_rects == 2 );
+                
+                NvOSD_RectParams* pRectParams = 
+                    displayMetaData1.GetFirst()->rect_params;
+                REQUIRE( pRectParams[0].left == 0 );
+                REQUIRE( pRectParams[0].bg_color.red == 
+                    pColorPalette->back()->red );
+                REQUIRE( pRectParams[1].left == (cols-1)*(DSL_1K_HD_WIDTH/cols) );
+                REQUIRE( pRectParams[1].bg_color.red == 
+                    pColorPalette->at(round((pColorPalette->size()-1)/2.0))->red );
+                    
+                displayMetaData1.AddToFrame(pFrameMeta);
+            }
+        }
+        WHEN( "Four half-lives of stream time have passed" )
+        {
+            pFrameMeta->buf_pts = (uint64_t)halfLife*GST_SECOND;
+            pOdeHeatMapper->HandleOccurrence(pFrameMeta, &objectMeta1);
+            pFrameMeta->buf_pts = (uint64_t)halfLife*4*GST_SECOND;
+            pOdeHeatMapper->HandleOccurrence(pFrameMeta, &objectMeta1);
+            
+            THEN( "Positions that have decayed below one half are removed" )
+            {
+                pOdeHeatMapper->GetMetrics(&outBuffer, &size);
+                REQUIRE( outBuffer[0] == 0 );
+                REQUIRE( outBuffer[cols*rows-1] == 1 );
+
+                DisplayMetaAllocator displayMetaData(pBatchMeta, 1);
+                pOdeHeatMapper->AddDisplayMeta(displayMetaData, pFrameMeta);
+                
+                REQUIRE( displayMetaData.GetFirst()->num_rects == 1 );
+                REQUIRE( displayMetaData.GetFirst()->rect_params[0].left == 
+                    (cols-1)*(DSL_1K_HD_WIDTH/cols) );
+                    
+                displayMetaData.AddToFrame(pFrameMeta);
+            }
+        }
+        nvds_destroy_batch_meta(pBatchMeta);
+    }
+}
+
+SCENARIO( "An OdeHeatMapper with a sliding-window drops expired intervals correctly", 
+    "[OdeHeatMapper]" )
+{
+    GIVEN( "A new HeatMapper with a window of three 10 second intervals" ) 
+    {
+        std::string colorPaletteName("color-palette");
+        std::string odeHeatMapperName("accumulator");
+        uint cols(16), rows(9);
+        uint interval(10), intervals(3);
+        
+        std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>> pColorPalette = 
+            std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>>{
+                new std::vector<DSL_RGBA_COLOR_PTR>};
+        
+        for (auto const& ivec: RgbaPredefinedColor::s_predefinedColorPalettes[
+            DSL_COLOR_PREDEFINED_PALETTE_SPECTRAL])
+        {
+            pColorPalette->push_back(std::shared_ptr<RgbaColor>
+                (new RgbaColor("", ivec)));
+        }
+        
+        DSL_RGBA_COLOR_PALETTE_PTR pPredefinedColorPalette = 
+            DSL_RGBA_COLOR_PALETTE_NEW(colorPaletteName.c_str(), pColorPalette);
+
+        DSL_ODE_HEAT_MAPPER_PTR pOdeHeatMapper = 
+            DSL_ODE_HEAT_MAPPER_NEW(odeHeatMapperName.c_str(), 
+                cols, rows, DSL_BBOX_POINT_SOUTH, pPredefinedColorPalette);
+                
+        uint retInterval(99), retIntervals(99);
+        pOdeHeatMapper->GetWindow(&retInterval, &retIntervals);
+        REQUIRE( retInterval == 0 );
+        REQUIRE( retIntervals == 0 );
+        
+        // intervals must be greater than 0 
+        REQUIRE( pOdeHeatMapper->SetWindow(interval, 0) == false );
+        REQUIRE( pOdeHeatMapper->SetWindow(interval, intervals) == true );
+        pOdeHeatMapper->GetWindow(&retInterval, &retIntervals);
+        REQUIRE( retInterval == interval );
+        REQUIRE( retIntervals == intervals );
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.source_frame_width = DSL_1K_HD_WIDTH;
+        frameMeta.source_frame_height = DSL_1K_HD_HEIGHT;
+        frameMeta.buf_pts = 0;
+
+        NvDsObjectMeta objectMeta0 = {0};
+        objectMeta0.rect_params.left = 10;
+        objectMeta0.rect_params.top = 10;
+        objectMeta0.rect_params.width = 20;
+        objectMeta0.rect_params.height = 20;
+
+        NvDsObjectMeta objectMeta1 = {0};
+        objectMeta1.rect_params.left = DSL_1K_HD_WIDTH - 30;
+        objectMeta1.rect_params.top = DSL_1K_HD_HEIGHT - 30;
+        objectMeta1.rect_params.width = 20;
+        objectMeta1.rect_params.height = 20;
+        
+        const uint64_t* outBuffer;
+        uint size;
+        
+        pOdeHeatMapper->HandleOccurrence(&frameMeta, &objectMeta0);
+        pOdeHeatMapper->HandleOccurrence(&frameMeta, &objectMeta0);
+        frameMeta.buf_pts = (uint64_t)interval*GST_SECOND;
+        pOdeHeatMapper->HandleOccurrence(&frameMeta, &objectMeta0);
+        frameMeta.buf_pts = (uint64_t)25*GST_SECOND;
+        pOdeHeatMapper->HandleOccurrence(&frameMeta, &objectMeta1);
+        
+        pOdeHeatMapper->GetMetrics(&outBuffer, &size);
+        REQUIRE( outBuffer[0] == 3 );
+        REQUIRE( outBuffer[cols*rows-1] == 1 );
+        
+        WHEN( "The first interval expires" )
+        {
+            frameMeta.buf_pts = (uint64_t)30*GST_SECOND;
+            pOdeHeatMapper->HandleOccurrence(&frameMeta, &objectMeta1);
+            
+            THEN( "Only the first interval's counts are dropped" )
+            {
+                pOdeHeatMapper->GetMetrics(&outBuffer, &size);
+                REQUIRE( outBuffer[0] == 1 );
+                REQUIRE( outBuffer[cols*rows-1] == 2 );
+            }
+        }
+        WHEN( "The entire window expires" )
+        {
+            frameMeta.buf_pts = (uint64_t)100*GST_SECOND;
+            pOdeHeatMapper->HandleOccurrence(&frameMeta, &objectMeta1);
+            
+            THEN( "All previous counts are dropped" )
+            {
+                pOdeHeatMapper->GetMetrics(&outBuffer, &size);
+                REQUIRE( outBuffer[0] == 0 );
+                REQUIRE( outBuffer[cols*rows-1] == 1 );
+            }
+        }
+        WHEN( "Decay is enabled" )
+        {
+            REQUIRE( pOdeHeatMapper->SetDecay(10) == true );
+            
+            THEN( "The sliding-window is disabled and the metrics cleared" )
+            {
+                pOdeHeatMapper->GetWindow(&retInterval, &retIntervals);
+                REQUIRE( retInterval == 0 );
+                REQUIRE( retIntervals == 0 );
+                
+                pOdeHeatMapper->GetMetrics(&outBuffer, &size);
+                REQUIRE( outBuffer[0] == 0 );
+                REQUIRE( outBuffer[cols*rows-1] == 0 );
+            }
+        }
+    }
+}
@@ -50,9 +50,13 @@ SCENARIO( "A TrackedObject is created correctly", "[TrackedObject]" )
         
         WHEN( "A TrackedObject is created" )
         {
+            TrackedObjectHistory history(objectMeta.object_id, frame_num, 
+                (NvBbox_Coords*)&objectMeta.rect_params, 
+                DSL_DEFAULT_TRACKING_TRIGGER_MAX_TRACE_POINTS);
+                
             std::shared_ptr<TrackedObject> pTrackedObject = std::shared_ptr<TrackedObject>
                 (new TrackedObject(objectMeta.object_id, frame_num, 
-                    (NvBbox_Coords*)&objectMeta.rect_params, pColor, 
+                    &history, pColor, 
                     DSL_DEFAULT_TRACKING_TRIGGER_MAX_TRACE_POINTS));
                 
             THEN( "All attributes are setup correctly" )
@@ -92,9 +96,12 @@ SCENARIO( "A TrackedObject generates the correct trace", "[TrackedObject]" )
 
         uint maxHistory(10);
         
+        TrackedObjectHistory history(objectMeta.object_id, frame_num, 
+            (NvBbox_Coords*)&objectMeta.rect_params, maxHistory);
+            
         std::shared_ptr<TrackedObject> pTrackedObject = std::shared_ptr<TrackedObject>
             (new TrackedObject(objectMeta.object_id, frame_num, 
-                (NvBbox_Coords*)&objectMeta.rect_params, pColor, maxHistory));
+                &history, pColor, maxHistory));
         
         WHEN( "A TrackedObject is updated" )
         {
@@ -103,28 +110,32 @@ SCENARIO( "A TrackedObject generates the correct trace", "[TrackedObject]" )
             objectMeta.rect_params.width = 210;
             objectMeta.rect_params.height = 110;
             
-            pTrackedObject->Update(1, (NvBbox_Coords*)&objectMeta.rect_params);
+            history.Update(1, (NvBbox_Coords*)&objectMeta.rect_params);
+            pTrackedObject->Update(1, &history);
 
             objectMeta.rect_params.left = 30;
             objectMeta.rect_params.top = 30;
             objectMeta.rect_params.width = 220;
             objectMeta.rect_params.height = 120;
             
-            pTrackedObject->Update(2, (NvBbox_Coords*)&objectMeta.rect_params);
+            history.Update(2, (NvBbox_Coords*)&objectMeta.rect_params);
+            pTrackedObject->Update(2, &history);
 
             objectMeta.rect_params.left = 40;
             objectMeta.rect_params.top = 40;
             objectMeta.rect_params.width = 230;
             objectMeta.rect_params.height = 130;
             
-            pTrackedObject->Update(3, (NvBbox_Coords*)&objectMeta.rect_params);
+            history.Update(3, (NvBbox_Coords*)&objectMeta.rect_params);
+            pTrackedObject->Update(3, &history);
 
             objectMeta.rect_params.left = 50;
             objectMeta.rect_params.top = 50;
             objectMeta.rect_params.width = 240;
             objectMeta.rect_params.height = 140;
             
-            pTrackedObject->Update(4, (NvBbox_Coords*)&objectMeta.rect_params);
+            history.Update(4, (NvBbox_Coords*)&objectMeta.rect_params);
+            pTrackedObject->Update(4, &history);
 
             THEN( "All attributes are updated correctly" )
             {
@@ -163,7 +174,7 @@ SCENARIO( "A TrackedObjects Container is created correctly", "[TrackedObject]" )
             THEN( "All attributes are setup correctly" )
             {
                 // Empty container should fail to find or update a source
-                REQUIRE( pTrackedObjectsPerSource->GetObject(0,0) == nullptr );
+                REQUIRE( pTrackedObjectsPerSource->GetObject(0,0) == NULL );
                 REQUIRE( pTrackedObjectsPerSource->IsTracked(0,0) == false );
             }
         }
@@ -201,18 +212,18 @@ SCENARIO( "A TrackedObjects Container adds a Tracked Object correctly", "[Tracke
         WHEN( "An Object is added to be container" )
         {
             REQUIRE( pTrackedObjectsPerSource->Track(&frameMeta, 
-                &objectMeta, pColor) != nullptr );
+                &objectMeta, pColor) != NULL );
 
             // Second call for the same object must fail
             REQUIRE( pTrackedObjectsPerSource->Track(&frameMeta, 
-                &objectMeta, pColor) == nullptr );
+                &objectMeta, pColor) == NULL );
             
             THEN( "It's correctly returned on GetObject" )
             {
                 REQUIRE( pTrackedObjectsPerSource->IsTracked(frameMeta.source_id,
                         objectMeta.object_id) == true );
                         
-                std::shared_ptr<TrackedObject> pTrackedObject = 
+                TrackedObject* pTrackedObject = 
                     pTrackedObjectsPerSource->GetObject(frameMeta.source_id,
                         objectMeta.object_id);
                         
@@ -256,7 +267,7 @@ SCENARIO( "A TrackedObjects Container manages multiple Tracked Objects correctly
             objectMeta.object_id = 1;
 
             REQUIRE( pTrackedObjectsPerSource->Track(&frameMeta, 
-                &objectMeta, pColor) != nullptr );
+                &objectMeta, pColor) != NULL );
             REQUIRE( pTrackedObjectsPerSource->IsTracked(frameMeta.source_id,
                 objectMeta.object_id) == true );
 
@@ -264,7 +275,7 @@ SCENARIO( "A TrackedObjects Container manages multiple Tracked Objects correctly
             objectMeta.object_id = 2;
 
             REQUIRE( pTrackedObjectsPerSource->Track(&frameMeta, 
-                &objectMeta, pColor) != nullptr );
+                &objectMeta, pColor) != NULL );
             REQUIRE( pTrackedObjectsPerSource->IsTracked(frameMeta.source_id,
                 objectMeta.object_id) == true );
 
@@ -272,7 +283,7 @@ SCENARIO( "A TrackedObjects Container manages multiple Tracked Objects correctly
             objectMeta.object_id = 3;
 
             REQUIRE( pTrackedObjectsPerSource->Track(&frameMeta, 
-                &objectMeta, pColor) != nullptr );
+                &objectMeta, pColor) != NULL );
             REQUIRE( pTrackedObjectsPerSource->IsTracked(frameMeta.source_id,
                 objectMeta.object_id) == true );
 
@@ -281,34 +292,25 @@ SCENARIO( "A TrackedObjects Container manages multiple Tracked Objects correctly
             {
                         
                 uint newFrameNumber = 2;
+                frameMeta.frame_num = newFrameNumber;
 
                 frameMeta.source_id = 1;
                 objectMeta.object_id = 1;
                 
-                std::shared_ptr<TrackedObject> pTrackedObject = 
-                    pTrackedObjectsPerSource->GetObject(frameMeta.source_id,
-                        objectMeta.object_id);
-                        
-                pTrackedObject->Update(newFrameNumber, 
-                    (NvBbox_Coords*)&objectMeta.rect_params); 
+                REQUIRE( pTrackedObjectsPerSource->Update(&frameMeta, 
+                    &objectMeta) != NULL );
 
                 frameMeta.source_id = 2;
                 objectMeta.object_id = 2;
 
-                pTrackedObject = pTrackedObjectsPerSource->GetObject(frameMeta.source_id,
-                        objectMeta.object_id);
-                        
-                pTrackedObject->Update(newFrameNumber, 
-                    (NvBbox_Coords*)&objectMeta.rect_params);
+                REQUIRE( pTrackedObjectsPerSource->Update(&frameMeta, 
+                    &objectMeta) != NULL );
                     
                 frameMeta.source_id = 3;
                 objectMeta.object_id = 3;
 
-                pTrackedObject = pTrackedObjectsPerSource->GetObject(frameMeta.source_id,
-                    objectMeta.object_id);
-                        
-                pTrackedObject->Update(newFrameNumber, 
-                    (NvBbox_Coords*)&objectMeta.rect_params);
+                REQUIRE( pTrackedObjectsPerSource->Update(&frameMeta, 
+                    &objectMeta) != NULL );
 
                 // All should still be tracked after purging with the current frame number
                 
@@ -352,3 +354,326 @@ SCENARIO( "A TrackedObjects Container manages multiple Tracked Objects correctly
     }
 }
 
+SCENARIO( "A TrackedObjectTable finds all values after inserts and erases", 
+    "[TrackedObject]" )
+{
+    GIVEN( "A new TrackedObjectTable" ) 
+    {
+        TrackedObjectTable<uint64_t> table;
+        
+        WHEN( "Many values are inserted and every other value is erased" )
+        {
+            for (uint64_t i = 0; i < 1000; i++)
+            {
+                REQUIRE( table.Insert(i%4, i, i*10) != NULL );
+            }
+            for (uint64_t i = 0; i < 1000; i += 2)
+            {
+                REQUIRE( table.Erase(i%4, i) == true );
+            }
+            THEN( "Only the remaining values are found" )
+            {
+                REQUIRE( table.Size() == 500 );
+                
+                for (uint64_t i = 0; i < 1000; i++)
+                {
+                    uint64_t* pValue = table.Find(i%4, i);
+                    if (i%2)
+                    {
+                        REQUIRE( pValue != NULL );
+                        REQUIRE( *pValue == i*10 );
+                    }
+                    else
+                    {
+                        REQUIRE( pValue == NULL );
+                    }
+                }
+                // same tracking-id for a different source is not found
+                REQUIRE( table.Find(0, 1) == NULL );
+                REQUIRE( table.Erase(0, 1) == false );
+            }
+        }
+        WHEN( "Values are erased with a predicate" )
+        {
+            for (uint64_t i = 0; i < 100; i++)
+            {
+                table.Insert(1, i, i);
+            }
+            table.EraseIf([](uint sourceId, uint64_t value)
+            {
+                return value >= 50;
+            });
+            
+            THEN( "Only the remaining values are found" )
+            {
+                REQUIRE( table.Size() == 50 );
+                for (uint64_t i = 0; i < 100; i++)
+                {
+                    REQUIRE( (table.Find(1, i) != NULL) == (i < 50) );
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "Two TrackedObjects Containers share a TrackedObjectStore correctly", 
+    "[TrackedObject]" )
+{
+    GIVEN( "Two TrackedObjects containers using the same store" ) 
+    {
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.frame_num = 1;
+        frameMeta.source_id = 1;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.object_id = 123;
+        objectMeta.rect_params.left = 10;
+        objectMeta.rect_params.top = 10;
+        objectMeta.rect_params.width = 200;
+        objectMeta.rect_params.height = 100;
+
+        uint maxTracePoints(10);
+
+        std::shared_ptr<TrackedObjectStore> pTrackStore = 
+            std::shared_ptr<TrackedObjectStore>(new TrackedObjectStore(
+                DSL_ODE_TRACKED_OBJECT_MISSING_FROM_FRAME_MAX));
+
+        TrackedObjects trackedObjectsA(maxTracePoints, 
+            DSL_ODE_TRACKED_OBJECT_MISSING_FROM_FRAME_MAX);
+        TrackedObjects trackedObjectsB(maxTracePoints, 
+            DSL_ODE_TRACKED_OBJECT_MISSING_FROM_FRAME_MAX);
+            
+        trackedObjectsA.SetTrackStore(pTrackStore);
+        trackedObjectsB.SetTrackStore(pTrackStore);
+        
+        REQUIRE( trackedObjectsA.Track(&frameMeta, &objectMeta, nullptr) != NULL );
+        
+        WHEN( "The object is updated by both containers for the same frames" )
+        {
+            for (uint i = 2; i <= 4; i++)
+            {
+                frameMeta.frame_num = i;
+                objectMeta.rect_params.left += 10;
+                objectMeta.rect_params.top += 10;
+                
+                // container B starts tracking the object on the second frame
+                if (!trackedObjectsB.IsTracked(frameMeta.source_id, 
+                    objectMeta.object_id))
+                {
+                    REQUIRE( trackedObjectsB.Track(&frameMeta, 
+                        &objectMeta, nullptr) != NULL );
+                }
+                else
+                {
+                    REQUIRE( trackedObjectsB.Update(&frameMeta, &objectMeta) != NULL );
+                }
+                REQUIRE( trackedObjectsA.Update(&frameMeta, &objectMeta) != NULL );
+            }
+            
+            THEN( "The history is updated once per frame and each trace starts when tracked" )
+            {
+                DSL_RGBA_MULTI_LINE_PTR pTraceA = trackedObjectsA.GetObject(
+                    frameMeta.source_id, objectMeta.object_id)->GetTrace(
+                        DSL_BBOX_POINT_NORTH_WEST, 
+                        DSL_OBJECT_TRACE_TEST_METHOD_ALL_POINTS, 5);
+                DSL_RGBA_MULTI_LINE_PTR pTraceB = trackedObjectsB.GetObject(
+                    frameMeta.source_id, objectMeta.object_id)->GetTrace(
+                        DSL_BBOX_POINT_NORTH_WEST, 
+                        DSL_OBJECT_TRACE_TEST_METHOD_ALL_POINTS, 5);
+                    
+                std::vector<dsl_coordinate> expectedTrace = 
+                    {{10,10},{20,20},{30,30},{40,40}};
+
+                REQUIRE( pTraceA->num_coordinates == 4 );
+                for (auto i = 0; i < pTraceA->num_coordinates; i++)
+                {
+                    REQUIRE( pTraceA->coordinates[i].x == expectedTrace.at(i).x );
+                    REQUIRE( pTraceA->coordinates[i].y == expectedTrace.at(i).y );
+                }
+                REQUIRE( pTraceB->num_coordinates == 3 );
+                for (auto i = 0; i < pTraceB->num_coordinates; i++)
+                {
+                    REQUIRE( pTraceB->coordinates[i].x == expectedTrace.at(i+1).x );
+                    REQUIRE( pTraceB->coordinates[i].y == expectedTrace.at(i+1).y );
+                }
+            }
+        }
+        WHEN( "An occurrence is handled for the object" )
+        {
+            for (uint i = 2; i <= 4; i++)
+            {
+                frameMeta.frame_num = i;
+                objectMeta.rect_params.left += 10;
+                objectMeta.rect_params.top += 10;
+                trackedObjectsA.Update(&frameMeta, &objectMeta);
+            }
+            TrackedObject* pTrackedObject = trackedObjectsA.GetObject(
+                frameMeta.source_id, objectMeta.object_id);
+                
+            REQUIRE( pTrackedObject->HasPreviousTrace() == false );
+            
+            pTrackedObject->HandleOccurrence();
+            
+            frameMeta.frame_num = 5;
+            objectMeta.rect_params.left += 10;
+            objectMeta.rect_params.top += 10;
+            pTrackedObject = trackedObjectsA.Update(&frameMeta, &objectMeta);
+            
+            THEN( "The previous trace ends where the current trace starts" )
+            {
+                REQUIRE( pTrackedObject->HasPreviousTrace() == true );
+                
+                DSL_RGBA_MULTI_LINE_PTR pPreviousTrace = 
+                    pTrackedObject->GetPreviousTrace(DSL_BBOX_POINT_NORTH_WEST, 
+                        DSL_OBJECT_TRACE_TEST_METHOD_ALL_POINTS, 5);
+                DSL_RGBA_MULTI_LINE_PTR pTrace = 
+                    pTrackedObject->GetTrace(DSL_BBOX_POINT_NORTH_WEST, 
+                        DSL_OBJECT_TRACE_TEST_METHOD_ALL_POINTS, 5);
+                        
+                REQUIRE( pPreviousTrace->num_coordinates == 4 );
+                REQUIRE( pPreviousTrace->coordinates[0].x == 10 );
+                REQUIRE( pPreviousTrace->coordinates[3].x == 40 );
+                REQUIRE( pTrace->num_coordinates == 2 );
+                REQUIRE( pTrace->coordinates[0].x == 40 );
+                REQUIRE( pTrace->coordinates[1].x == 50 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A TrackedObjectStore tracks and purges sparse source-ids correctly", 
+    "[TrackedObject]" )
+{
+    GIVEN( "A TrackedObjectStore and a source from a second Pipeline" ) 
+    {
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.frame_num = 1;
+        
+        // source-id offset by the unique Pipeline id in the upper bits
+        frameMeta.source_id = (1 << 16) | 1;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.object_id = 123;
+
+        TrackedObjectStore trackStore(0);
+        
+        WHEN( "An object is updated for the source" )
+        {
+            TrackedObjectHistory* pHistory = trackStore.Update(&frameMeta, 
+                &objectMeta);
+            REQUIRE( pHistory != NULL );
+            
+            THEN( "The object's history is found until it is purged" )
+            {
+                frameMeta.frame_num = 2;
+                REQUIRE( trackStore.Update(&frameMeta, &objectMeta) == pHistory );
+                REQUIRE( pHistory->GetNextIndex() == 2 );
+                
+                trackStore.Purge(2);
+                REQUIRE( trackStore.Update(&frameMeta, &objectMeta) == pHistory );
+                REQUIRE( pHistory->GetNextIndex() == 2 );
+                
+                // a purged object starts a new history when detected again
+                trackStore.Purge(frameMeta.source_id, 3);
+                frameMeta.frame_num = 3;
+                pHistory = trackStore.Update(&frameMeta, &objectMeta);
+                REQUIRE( pHistory != NULL );
+                REQUIRE( pHistory->GetNextIndex() == 1 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A TrackedObjectHistory keeps the most recent bboxes in its ring", 
+    "[TrackedObject]" )
+{
+    GIVEN( "A new TrackedObjectHistory" ) 
+    {
+        NvBbox_Coords coords = {10, 10, 100, 100};
+        
+        TrackedObjectHistory history(1, 0, &coords, 3);
+        
+        WHEN( "The history is updated beyond its max history" )
+        {
+            for (uint i = 1; i < 5; i++)
+            {
+                coords.left += 10;
+                history.Update(i, &coords);
+            }
+            THEN( "Only the most recent bboxes are kept" )
+            {
+                REQUIRE( history.GetNextIndex() == 5 );
+                REQUIRE( history.GetFirstIndex() == 2 );
+                REQUIRE( history.GetBbox(2).left == 30 );
+                REQUIRE( history.GetBbox(3).left == 40 );
+                REQUIRE( history.GetBbox(4).left == 50 );
+            }
+        }
+        WHEN( "The max history is increased after the ring has wrapped" )
+        {
+            for (uint i = 1; i < 5; i++)
+            {
+                coords.left += 10;
+                history.Update(i, &coords);
+            }
+            history.SetMaxHistory(6);
+            
+            for (uint i = 5; i < 8; i++)
+            {
+                coords.left += 10;
+                history.Update(i, &coords);
+            }
+            THEN( "The existing bboxes are preserved" )
+            {
+                REQUIRE( history.GetFirstIndex() == 2 );
+                for (uint64_t i = 2; i < 8; i++)
+                {
+                    REQUIRE( history.GetBbox(i).left == 10 + i*10 );
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "A TrackedObject reuses its trace", "[TrackedObject]" )
+{
+    GIVEN( "A new TrackedObject" ) 
+    {
+        NvBbox_Coords coords = {10, 10, 100, 100};
+        
+        TrackedObjectHistory history(1, 0, &coords, 10);
+        TrackedObject trackedObject(1, 0, &history, nullptr, 10);
+        
+        DSL_RGBA_MULTI_LINE_PTR pFirstTrace = trackedObject.GetTrace(
+            DSL_BBOX_POINT_NORTH_WEST, DSL_OBJECT_TRACE_TEST_METHOD_ALL_POINTS, 4);
+        REQUIRE( pFirstTrace->num_coordinates == 1 );
+
+        WHEN( "The TrackedObject is updated" )
+        {
+            for (uint i = 1; i < 4; i++)
+            {
+                coords.left += 10;
+                history.Update(i, &coords);
+                trackedObject.Update(i, &history);
+            }
+            THEN( "The same trace is returned with the updated coordinates" )
+            {
+                DSL_RGBA_MULTI_LINE_PTR pTrace = trackedObject.GetTrace(
+                    DSL_BBOX_POINT_NORTH_WEST, 
+                    DSL_OBJECT_TRACE_TEST_METHOD_ALL_POINTS, 4);
+                    
+                REQUIRE( pTrace == pFirstTrace );
+                REQUIRE( pTrace->num_coordinates == 4 );
+                REQUIRE( pTrace->coordinates[3].x == 40 );
+                
+                pTrace = trackedObject.GetTrace(DSL_BBOX_POINT_NORTH_WEST, 
+                    DSL_OBJECT_TRACE_TEST_METHOD_END_POINTS, 4);
+
+                REQUIRE( pTrace == pFirstTrace );
+                REQUIRE( pTrace->num_coordinates == 2 );
+                REQUIRE( pTrace->coordinates[0].x == 10 );
+                REQUIRE( pTrace->coordinates[1].x == 40 );
+            }
+        }
+    }
+}
@@ -32,7 +32,7 @@ using namespace DSL;
 
 static std::wstring w_file_path(L"/opt/nvidia/deepstream/deepstream/samples/streams/sample_1080p_h265.mp4");
 
-static std::vector<NvDsDisplayMeta*> displayMetaData;
+static DisplayMetaAllocator displayMetaData(NULL, 0);
 
 static boolean ode_check_for_occurrence_cb(void* buffer,
     void* frame_meta, void* object_meta, void* client_data)
@@ -46,6 +46,19 @@ static boolean ode_post_process_frame_cb(void* buffer,
     return true;
 }
 
+// flags every other object - the first, third, fifth ...
+static boolean ode_check_for_occurrences_cb(void* buffer,
+    void* frame_meta, const dsl_ode_batch_object* objects, uint count, 
+    uint64_t* occurrences, void* client_data)
+{
+    *(uint*)client_data = count;
+    for (uint i = 0; i < count; i+=2)
+    {
+        occurrences[i/64] |= 1ULL << (i%64);
+    }
+    return true;
+}
+
 static void ode_occurrence_handler_cb_1(uint64_t event_id, const wchar_t* name,
     void* buffer, void* display_meta, void* frame_meta, void* object_meta, void* client_data)
 {
@@ -644,6 +657,66 @@ SCENARIO( "An ODE Occurrence Trigger checks its minimum inference confidence cor
     }
 }
 
+SCENARIO( "An ODE Occurrence Trigger applies criteria updates between frames", 
+    "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger with default criteria" ) 
+    {
+        std::string odeTriggerName("occurence");
+        std::string source;
+        uint classId(1);
+        uint limit(0); // not limit
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), 
+                source.c_str(), classId, limit);
+
+        // Frame Meta test data
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;  
+        frameMeta.frame_num = 1;
+        frameMeta.ntp_timestamp = INT64_MAX;
+        frameMeta.source_id = 2;
+
+        // Object Meta test data
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId; // must match ODE Trigger's classId
+        objectMeta.object_id = INT64_MAX; 
+        objectMeta.rect_params.left = 10;
+        objectMeta.rect_params.top = 10;
+        objectMeta.rect_params.width = 200;
+        objectMeta.rect_params.height = 100;
+        objectMeta.confidence = 0.5;
+        
+        pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta);
+        REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+            displayMetaData, &frameMeta, &objectMeta) == true );
+        
+        WHEN( "The ODE Trigger's criteria is updated repeatedly between frames" )
+        {
+            pOdeTrigger->SetClassId(classId+1);
+            pOdeTrigger->SetMinConfidence(0.6);
+            
+            THEN( "The latest criteria is used for the current and next frames" )
+            {
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == false );
+
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == false );
+
+                pOdeTrigger->SetClassId(classId);
+                pOdeTrigger->SetMinConfidence(0.4);
+
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == true );
+            }
+        }
+    }
+}
+
 SCENARIO( "An ODE Occurrence Trigger checks its maximum inference confidence correctly", 
     "[OdeTrigger]" )
 {
@@ -1364,6 +1437,257 @@ SCENARIO( "An OdeOccurrenceTrigger checks its interval setting ", "[OdeTrigger]"
     }
 }
 
+SCENARIO( "An OdeOccurrenceTrigger with per-source state checks its interval and limit per source", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger with a non-zero skip-frame interval and event limit" ) 
+    {
+        std::string odeTriggerName("occurence");
+        uint classId(1);
+        uint limit(1);
+
+        std::string source;
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), source.c_str(), classId, limit);
+
+        pOdeTrigger->SetInterval(2);
+
+        // Frame Meta test data for two sources
+        NvDsFrameMeta frameMeta0 =  {0};
+        frameMeta0.bInferDone = true;  
+        frameMeta0.frame_num = 1;
+        frameMeta0.ntp_timestamp = INT64_MAX;
+        frameMeta0.source_id = 0;
+
+        NvDsFrameMeta frameMeta1 =  {0};
+        frameMeta1.bInferDone = true;  
+        frameMeta1.frame_num = 1;
+        frameMeta1.ntp_timestamp = INT64_MAX;
+        // source from a second Pipeline - unique Pipeline id in the upper bits
+        frameMeta1.source_id = (1 << 16) | 1;
+
+        // Object Meta test data
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId; // must match ODE Trigger's classId
+        objectMeta.object_id = INT64_MAX; 
+        objectMeta.rect_params.left = 10;
+        objectMeta.rect_params.top = 10;
+        objectMeta.rect_params.width = 200;
+        objectMeta.rect_params.height = 100;
+        
+        WHEN( "Per-source state is disabled" )
+        {
+            REQUIRE( pOdeTrigger->GetPerSourceStateEnabled() == false );
+            
+            THEN( "The interval and limit are shared by all sources" )
+            {
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta0);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta0, &objectMeta) == false );
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta1);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta1, &objectMeta) == true );
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta0);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta0, &objectMeta) == false );
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta1);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta1, &objectMeta) == false );
+            }
+        }
+        WHEN( "Per-source state is enabled" )
+        {
+            pOdeTrigger->SetPerSourceStateEnabled(true);
+            REQUIRE( pOdeTrigger->GetPerSourceStateEnabled() == true );
+            
+            THEN( "The interval and limit are applied to each source separately" )
+            {
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta0);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta0, &objectMeta) == false );
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta1);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta1, &objectMeta) == false );
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta0);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta0, &objectMeta) == true );
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta1);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta1, &objectMeta) == true );
+                    
+                // event limit of one now reached for both sources
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta0);
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta0);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta0, &objectMeta) == false );
+                    
+                // reset clears the counts for all sources
+                pOdeTrigger->Reset();
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta1);
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta1);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta1, &objectMeta) == true );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeOccurrenceTrigger with a rate limit suppresses events per source", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger with a rate limit" ) 
+    {
+        std::string odeTriggerName("occurence");
+        uint classId(1);
+        uint limit(0);
+
+        std::string source;
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), source.c_str(), classId, limit);
+
+        // burst of 2 events with a refill rate too slow to matter for the test
+        pOdeTrigger->SetRateLimit(0.001, 2);
+
+        NvDsFrameMeta frameMeta0 =  {0};
+        frameMeta0.bInferDone = true;  
+        frameMeta0.source_id = 0;
+
+        NvDsFrameMeta frameMeta1 =  {0};
+        frameMeta1.bInferDone = true;  
+        // source from a second Pipeline - unique Pipeline id in the upper bits
+        frameMeta1.source_id = (1 << 16) | 1;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId;
+        objectMeta.object_id = UNTRACKED_OBJECT_ID; 
+        
+        WHEN( "Events are triggered for a source beyond the burst size" )
+        {
+            pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta0);
+            uint occurrences(0);
+            for (auto i = 0; i < 5; i++)
+            {
+                if (pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta0, &objectMeta))
+                {
+                    occurrences++;
+                }
+            }
+            
+            THEN( "Only the burst size is counted and other sources are unaffected" )
+            {
+                REQUIRE( pOdeTrigger->m_triggered == 2 );
+                
+                // suppressed events must not be counted as occurrences
+                REQUIRE( occurrences == 2 );
+                REQUIRE( pOdeTrigger->m_occurrences == 2 );
+                
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta1);
+                pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta1, &objectMeta);
+                REQUIRE( pOdeTrigger->m_triggered == 3 );
+                
+                // disabling the rate limit restores all events
+                pOdeTrigger->SetRateLimit(0, 0);
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta0);
+                pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta0, &objectMeta);
+                REQUIRE( pOdeTrigger->m_triggered == 4 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An AlwaysOdeTrigger with a rate limit suppresses events per source", "[OdeTrigger]" )
+{
+    GIVEN( "A new AlwaysOdeTrigger with a rate limit" ) 
+    {
+        std::string odeTriggerName("always");
+        std::string source;
+
+        DSL_ODE_TRIGGER_ALWAYS_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_ALWAYS_NEW(odeTriggerName.c_str(), 
+                source.c_str(), DSL_ODE_POST_OCCURRENCE_CHECK);
+
+        // burst of 1 event with a refill rate too slow to matter for the test
+        pOdeTrigger->SetRateLimit(0.001, 1);
+
+        NvDsFrameMeta frameMeta0 =  {0};
+        frameMeta0.bInferDone = true;  
+        frameMeta0.source_id = 0;
+
+        NvDsFrameMeta frameMeta1 =  {0};
+        frameMeta1.bInferDone = true;  
+        frameMeta1.source_id = 1;
+
+        WHEN( "Frames are post-processed for a source beyond the burst size" )
+        {
+            REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                displayMetaData, &frameMeta0) == 1 );
+            
+            THEN( "The events are suppressed and other sources are unaffected" )
+            {
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &frameMeta0) == 0 );
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &frameMeta1) == 1 );
+                
+                // disabling the rate limit restores all events
+                pOdeTrigger->SetRateLimit(0, 0);
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &frameMeta0) == 1 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeOccurrenceTrigger with a debounce window suppresses repeat events per object", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger with a debounce window" ) 
+    {
+        std::string odeTriggerName("occurence");
+        uint classId(1);
+        uint limit(0);
+
+        std::string source;
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), source.c_str(), classId, limit);
+
+        pOdeTrigger->SetDebounce(60000);
+        REQUIRE( pOdeTrigger->GetDebounce() == 60000 );
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;  
+        frameMeta.source_id = 0;
+
+        NvDsObjectMeta objectMeta1 = {0};
+        objectMeta1.class_id = classId;
+        objectMeta1.object_id = 1; 
+
+        NvDsObjectMeta objectMeta2 = {0};
+        objectMeta2.class_id = classId;
+        objectMeta2.object_id = 2; 
+        
+        WHEN( "The same tracked objects are detected in consecutive frames" )
+        {
+            for (auto i = 0; i < 3; i++)
+            {
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta);
+                pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta1);
+                pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta2);
+            }
+            
+            THEN( "Only the first event for each object is counted" )
+            {
+                REQUIRE( pOdeTrigger->m_triggered == 2 );
+            }
+        }
+    }
+}
+
 SCENARIO( "An OdeOccurrenceTrigger checks for Area overlap correctly", "[OdeTrigger]" )
 {
     GIVEN( "A new OdeOccurenceTrigger with criteria" ) 
@@ -2842,6 +3166,52 @@ SCENARIO( "An Intersection OdeTrigger checks for intersection correctly", "[OdeT
 }
 
 
+SCENARIO( "An Intersection OdeTrigger checks a crowded scene correctly", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeIntersectionTrigger and enough objects to use the broad phase" ) 
+    {
+        std::string odeTriggerName("intersection");
+        std::string source;
+        uint classIdA(1);
+        uint classIdB(1);
+        uint limit(0);
+
+        DSL_ODE_TRIGGER_INTERSECTION_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_INTERSECTION_NEW(odeTriggerName.c_str(), 
+                source.c_str(), classIdA, classIdB, limit);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;  
+        frameMeta.frame_num = 444;
+        frameMeta.ntp_timestamp = INT64_MAX;
+        frameMeta.source_id = 2;
+
+        // 900 pairs of objects, well over the broad phase minimum
+        std::vector<NvDsObjectMeta> objectMetas(30);
+        
+        WHEN( "A row of objects occur, each overlapping its neighbors only" )
+        {
+            for (uint i = 0; i < objectMetas.size(); i++)
+            {
+                objectMetas[i] = {0};
+                objectMetas[i].class_id = classIdA;
+                objectMetas[i].rect_params.left = i*99;
+                objectMetas[i].rect_params.top = (i%2)*50;
+                objectMetas[i].rect_params.width = 100;
+                objectMetas[i].rect_params.height = 100;
+
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMetas[i]) == true );
+            }
+            THEN( "An ODE occurrence is detected for each neighboring pair" )
+            {
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &frameMeta) == objectMetas.size()-1 );
+            }
+        }
+    }
+}
+
 SCENARIO( "A Custom OdeTrigger checks for and handles Occurrence correctly", "[OdeTrigger]" )
 {
     GIVEN( "A new CustomOdeTrigger with client occurrence checker" ) 
@@ -2888,6 +3258,292 @@ SCENARIO( "A Custom OdeTrigger checks for and handles Occurrence correctly", "[O
     }
 }
 
+SCENARIO( "A Custom Batch OdeTrigger calls the client once per frame and handles flagged Occurrences", "[OdeTrigger]" )
+{
+    GIVEN( "A new CustomBatchOdeTrigger with client occurrences checker" ) 
+    {
+        std::string odeTriggerName("custom-batch");
+        std::string source;
+        uint classId(1);
+        uint limit(0);
+        uint clientCount(0);
+
+        DSL_ODE_TRIGGER_CUSTOM_BATCH_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_CUSTOM_BATCH_NEW(odeTriggerName.c_str(), 
+                source.c_str(), classId, limit, ode_check_for_occurrences_cb, 
+                &clientCount);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;  
+        frameMeta.frame_num = 444;
+        frameMeta.ntp_timestamp = INT64_MAX;
+        frameMeta.source_id = 2;
+
+        // enough objects to span two words of the bitmask
+        std::vector<NvDsObjectMeta> objectMetas(100);
+        
+        WHEN( "A frame of objects, all meeting the criteria, is checked" )
+        {
+            for (auto &ivec: objectMetas)
+            {
+                ivec = {0};
+                ivec.class_id = classId;
+                ivec.rect_params.width = 100;
+                ivec.rect_params.height = 100;
+
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &ivec) == true );
+            }
+            THEN( "The client is called once with all objects and each flagged object is an Occurrence" )
+            {
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &frameMeta) == objectMetas.size()/2 );
+                REQUIRE( clientCount == objectMetas.size() );
+                REQUIRE( pOdeTrigger->m_triggered == objectMetas.size()/2 );
+                
+                // the batch is cleared for the next frame
+                clientCount = 0;
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &frameMeta) == 0 );
+                REQUIRE( clientCount == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A CompositeOdeTrigger adds and removes predicates correctly", "[OdeTrigger]" )
+{
+    GIVEN( "A new CompositeOdeTrigger and an OccurrenceOdeTrigger" ) 
+    {
+        std::string source;
+        uint classId(1);
+        uint limit(0);
+
+        DSL_ODE_TRIGGER_COMPOSITE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_COMPOSITE_NEW("composite", source.c_str(), 
+                classId, limit, DSL_ODE_COMPOSITE_OPERATOR_AND);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pPredicate = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("occurrence", source.c_str(), 
+                classId, limit);
+        
+        WHEN( "The predicate is added" )
+        {
+            REQUIRE( pOdeTrigger->AddPredicate(pPredicate, false) == true );
+            
+            THEN( "The predicate can be removed only once" )
+            {
+                REQUIRE( pOdeTrigger->AddPredicate(pPredicate, true) == false );
+                REQUIRE( pOdeTrigger->RemovePredicate(pPredicate) == true );
+                REQUIRE( pOdeTrigger->RemovePredicate(pPredicate) == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A CompositeOdeTrigger rejects predicates that create a cycle", "[OdeTrigger]" )
+{
+    GIVEN( "Two new CompositeOdeTriggers and an OccurrenceOdeTrigger" ) 
+    {
+        std::string source;
+        uint classId(1);
+        uint limit(0);
+
+        DSL_ODE_TRIGGER_COMPOSITE_PTR pCompositeA = 
+            DSL_ODE_TRIGGER_COMPOSITE_NEW("composite-a", source.c_str(), 
+                classId, limit, DSL_ODE_COMPOSITE_OPERATOR_AND);
+
+        DSL_ODE_TRIGGER_COMPOSITE_PTR pCompositeB = 
+            DSL_ODE_TRIGGER_COMPOSITE_NEW("composite-b", source.c_str(), 
+                classId, limit, DSL_ODE_COMPOSITE_OPERATOR_OR);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pPredicate = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("occurrence", source.c_str(), 
+                classId, limit);
+        
+        WHEN( "Composite B is added as a predicate of Composite A" )
+        {
+            REQUIRE( pCompositeB->AddPredicate(pPredicate, false) == true );
+            REQUIRE( pCompositeA->AddPredicate(pCompositeB, false) == true );
+            
+            THEN( "All nested predicates are returned and a cycle is rejected" )
+            {
+                std::vector<OdeTrigger*> predicates;
+                pCompositeA->GetPredicates(predicates);
+                REQUIRE( predicates.size() == 2 );
+                REQUIRE( predicates[0] == pCompositeB.get() );
+                REQUIRE( predicates[1] == pPredicate.get() );
+                
+                REQUIRE( pCompositeA->AddPredicate(pCompositeA, false) == false );
+                REQUIRE( pCompositeB->AddPredicate(pCompositeA, false) == false );
+                
+                // no longer a cycle once B is removed from A
+                REQUIRE( pCompositeA->RemovePredicate(pCompositeB) == true );
+                REQUIRE( pCompositeB->AddPredicate(pCompositeA, false) == true );
+            }
+        }
+    }
+}
+
+SCENARIO( "A CompositeOdeTrigger combines its predicates correctly", "[OdeTrigger]" )
+{
+    GIVEN( "An Area predicate and a Distance predicate" ) 
+    {
+        std::string source;
+        uint personClassId(1);
+        uint vehicleClassId(2);
+        uint limit(0);
+
+        std::string polygonName  = "my-polygon";
+        dsl_coordinate coordinates[4] = {{0,0},{500,0},{500, 500},{0,500}};
+        uint numCoordinates(4);
+        uint lineWidth(4);
+
+        DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW("my-color", 
+            0.12, 0.34, 0.56, 0.78);
+        DSL_RGBA_POLYGON_PTR pPolygon = DSL_RGBA_POLYGON_NEW(polygonName.c_str(), 
+            coordinates, numCoordinates, lineWidth, pColor);
+        DSL_ODE_AREA_INCLUSION_PTR pOdeArea =
+            DSL_ODE_AREA_INCLUSION_NEW("area", pPolygon, false, 
+                DSL_BBOX_POINT_CENTER);
+
+        // Person in the Area
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pInArea = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("in-area", source.c_str(), 
+                personClassId, limit);
+        REQUIRE( pInArea->AddArea(pOdeArea) == true );
+        
+        // Person within 50 pixels of a Vehicle
+        DSL_ODE_TRIGGER_DISTANCE_PTR pNearVehicle = 
+            DSL_ODE_TRIGGER_DISTANCE_NEW("near-vehicle", source.c_str(), 
+                personClassId, vehicleClassId, limit, 50, UINT32_MAX, 
+                DSL_BBOX_POINT_ANY, DSL_DISTANCE_METHOD_FIXED_PIXELS);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;  
+        frameMeta.frame_num = 444;
+        frameMeta.ntp_timestamp = INT64_MAX;
+        frameMeta.source_id = 2;
+
+        // in the Area, far from the Vehicle
+        NvDsObjectMeta personMeta1 = {0};
+        personMeta1.class_id = personClassId;
+        personMeta1.rect_params.left = 100;
+        personMeta1.rect_params.top = 100;
+        personMeta1.rect_params.width = 20;
+        personMeta1.rect_params.height = 20;
+
+        // in the Area, 10 pixels from the Vehicle
+        NvDsObjectMeta personMeta2 = {0};
+        personMeta2.class_id = personClassId;
+        personMeta2.rect_params.left = 300;
+        personMeta2.rect_params.top = 100;
+        personMeta2.rect_params.width = 20;
+        personMeta2.rect_params.height = 20;
+
+        // outside of the Area, far from the Vehicle
+        NvDsObjectMeta personMeta3 = {0};
+        personMeta3.class_id = personClassId;
+        personMeta3.rect_params.left = 600;
+        personMeta3.rect_params.top = 600;
+        personMeta3.rect_params.width = 20;
+        personMeta3.rect_params.height = 20;
+
+        NvDsObjectMeta vehicleMeta = {0};
+        vehicleMeta.class_id = vehicleClassId;
+        vehicleMeta.rect_params.left = 330;
+        vehicleMeta.rect_params.top = 100;
+        vehicleMeta.rect_params.width = 50;
+        vehicleMeta.rect_params.height = 50;
+
+        WHEN( "The predicates are combined with AND and the Distance is negated" )
+        {
+            DSL_ODE_TRIGGER_COMPOSITE_PTR pOdeTrigger = 
+                DSL_ODE_TRIGGER_COMPOSITE_NEW("composite", source.c_str(), 
+                    personClassId, limit, DSL_ODE_COMPOSITE_OPERATOR_AND);
+                    
+            REQUIRE( pOdeTrigger->AddPredicate(pInArea, false) == true );
+            REQUIRE( pOdeTrigger->AddPredicate(pNearVehicle, true) == true );
+
+            THEN( "Only the Person in the Area and away from the Vehicle triggers" )
+            {
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &personMeta1) == true );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &personMeta2) == true );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &personMeta3) == true );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &vehicleMeta) == false );
+                    
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &frameMeta) == 1 );
+                REQUIRE( personMeta1.misc_obj_info[
+                    DSL_OBJECT_INFO_PRIMARY_METRIC] == 1 );
+                REQUIRE( personMeta2.misc_obj_info[
+                    DSL_OBJECT_INFO_PRIMARY_METRIC] == 0 );
+            }
+        }
+        WHEN( "The predicates are combined with OR" )
+        {
+            DSL_ODE_TRIGGER_COMPOSITE_PTR pOdeTrigger = 
+                DSL_ODE_TRIGGER_COMPOSITE_NEW("composite", source.c_str(), 
+                    personClassId, limit, DSL_ODE_COMPOSITE_OPERATOR_OR);
+                    
+            REQUIRE( pOdeTrigger->AddPredicate(pInArea, false) == true );
+            REQUIRE( pOdeTrigger->AddPredicate(pNearVehicle, false) == true );
+
+            THEN( "Both Persons in the Area trigger" )
+            {
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &personMeta1) == true );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &personMeta2) == true );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &personMeta3) == true );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &vehicleMeta) == false );
+                    
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &frameMeta) == 2 );
+                REQUIRE( personMeta3.misc_obj_info[
+                    DSL_OBJECT_INFO_PRIMARY_METRIC] == 0 );
+            }
+        }
+        WHEN( "A nested Composite is negated as a predicate" )
+        {
+            // the nested Composite's own criteria are met by all Persons, 
+            // its Area predicate only by the two Persons in the Area.
+            DSL_ODE_TRIGGER_COMPOSITE_PTR pNested = 
+                DSL_ODE_TRIGGER_COMPOSITE_NEW("nested", source.c_str(), 
+                    personClassId, limit, DSL_ODE_COMPOSITE_OPERATOR_OR);
+            REQUIRE( pNested->AddPredicate(pInArea, false) == true );
+
+            DSL_ODE_TRIGGER_COMPOSITE_PTR pOdeTrigger = 
+                DSL_ODE_TRIGGER_COMPOSITE_NEW("composite", source.c_str(), 
+                    personClassId, limit, DSL_ODE_COMPOSITE_OPERATOR_AND);
+            REQUIRE( pOdeTrigger->AddPredicate(pNested, true) == true );
+
+            THEN( "The nested Composite's predicates are evaluated" )
+            {
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &personMeta1) == true );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &personMeta2) == true );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &personMeta3) == true );
+                    
+                // only the Person outside of the Area triggers
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &frameMeta) == 1 );
+                REQUIRE( personMeta3.misc_obj_info[
+                    DSL_OBJECT_INFO_PRIMARY_METRIC] == 1 );
+                REQUIRE( pOdeTrigger->IsStatefulPredicate() == false );
+            }
+        }
+    }
+}
+
 SCENARIO( "A CountOdeTrigger handles ODE Occurrence correctly", "[OdeTrigger]" )
 {
     GIVEN( "A new CountOdeTrigger with Maximum criteria" ) 
@@ -4513,4 +5169,110 @@ SCENARIO( "A new Ralational OdeDistanceTrigger handles occurrence correctly", "[
             }
         }
     }
-}    
\ No newline at end of file
+}    
+SCENARIO( "A Fixed-Pixel OdeDistanceTrigger checks a crowded scene correctly", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeDistanceTrigger and enough objects to use the broad phase" ) 
+    {
+        std::string odeTriggerName("distance");
+        std::string source;
+        uint classIdA(1);
+        uint classIdB(1);
+        uint limit(0);
+        uint minimum(60);
+        
+        // no maximum, as set by the services layer
+        uint maximum(UINT32_MAX);
+
+        DSL_ODE_TRIGGER_DISTANCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_DISTANCE_NEW(odeTriggerName.c_str(), source.c_str(), 
+                classIdA, classIdB, limit, minimum, maximum, 
+                DSL_BBOX_POINT_SOUTH, DSL_DISTANCE_METHOD_FIXED_PIXELS);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;  
+        frameMeta.frame_num = 444;
+        frameMeta.ntp_timestamp = INT64_MAX;
+        frameMeta.source_id = 2;
+
+        std::vector<NvDsObjectMeta> objectMetas(30);
+        
+        WHEN( "A row of objects occur, each within the minimum of its neighbors only" )
+        {
+            for (uint i = 0; i < objectMetas.size(); i++)
+            {
+                objectMetas[i] = {0};
+                objectMetas[i].class_id = classIdA;
+                objectMetas[i].rect_params.left = i*50;
+                objectMetas[i].rect_params.top = 100;
+                objectMetas[i].rect_params.width = 40;
+                objectMetas[i].rect_params.height = 100;
+
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMetas[i]) == true );
+            }
+            THEN( "An ODE occurrence is detected for each neighboring pair" )
+            {
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &frameMeta) == objectMetas.size()-1 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeTrigger returns its class-id and source-id filters for dispatch", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeOccurrenceTrigger and a new OdeDistanceTrigger" ) 
+    {
+        std::string odeTriggerName("occurrence");
+        std::string odeDistanceTriggerName("distance");
+        uint classId(1), classIdA(2), classIdB(3);
+        uint limit(0);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), "", classId, limit);
+
+        DSL_ODE_TRIGGER_DISTANCE_PTR pOdeDistanceTrigger = 
+            DSL_ODE_TRIGGER_DISTANCE_NEW(odeDistanceTriggerName.c_str(), "", 
+                classIdA, classIdB, limit, 0, 0, 
+                DSL_BBOX_POINT_ANY, DSL_DISTANCE_METHOD_FIXED_PIXELS);
+
+        WHEN( "The dispatch class-ids and source-id are queried" )
+        {
+            std::vector<uint> classIds, classIdsAB;
+            pOdeTrigger->GetDispatchClassIds(classIds);
+            pOdeDistanceTrigger->GetDispatchClassIds(classIdsAB);
+            
+            THEN( "The correct values are returned" )
+            {
+                REQUIRE( classIds.size() == 1 );
+                REQUIRE( classIds[0] == classId );
+                REQUIRE( classIdsAB.size() == 2 );
+                REQUIRE( classIdsAB[0] == classIdA );
+                REQUIRE( classIdsAB[1] == classIdB );
+                REQUIRE( pOdeTrigger->GetDispatchSourceId() == -1 );
+            }
+        }
+        WHEN( "The class-id and source-id filters are updated" )
+        {
+            uint64_t dispatchVersion = OdeTrigger::s_dispatchVersion;
+            
+            pOdeTrigger->SetClassId(DSL_ODE_ANY_CLASS);
+            pOdeTrigger->SetSource("source-1");
+            
+            REQUIRE( pOdeTrigger->GetDispatchSourceId() == -1 );
+            pOdeTrigger->_setSourceId(4);
+            
+            std::vector<uint> classIds;
+            pOdeTrigger->GetDispatchClassIds(classIds);
+            
+            THEN( "The dispatch version is updated and the new values are returned" )
+            {
+                REQUIRE( OdeTrigger::s_dispatchVersion == dispatchVersion+3 );
+                REQUIRE( classIds.size() == 1 );
+                REQUIRE( classIds[0] == DSL_ODE_ANY_CLASS );
+                REQUIRE( pOdeTrigger->GetDispatchSourceId() == 4 );
+            }
+        }
+    }
+}    
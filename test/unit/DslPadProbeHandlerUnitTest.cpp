@@ -26,6 +26,7 @@ THE SOFTWARE.
 #include "DslPadProbeHandler.h"
 #include "DslTrackerBintr.h"
 #include "DslOdeTrigger.h"
+#include "DslOdeAction.h"
 
 using namespace DSL;
 
@@ -168,6 +169,87 @@ SCENARIO( "A OdePadProbeHandler can add and remove an OdeTrigger", "[PadProbeHan
     }
 }
 
+SCENARIO( "A OdePadProbeHandler in parallel mode serializes Actions that use the batch-meta pools",
+    "[PadProbeHandler]" )
+{
+    GIVEN( "A new OdePadProbeHandler with two Triggers, each filtering on a different Source" ) 
+    {
+        uint numFrames(2);
+
+        DSL_PPH_ODE_PTR pPadProbeHandler = DSL_PPH_ODE_NEW("ode-handler");
+        pPadProbeHandler->SetParallelMode(true, numFrames);
+
+        // Each Trigger has its own Message Meta Action so that the two frames
+        // would be in separate groups if not for the serial execution.
+        std::vector<DSL_ODE_TRIGGER_ALWAYS_PTR> triggers;
+        std::vector<DSL_ODE_ACTION_MESSAGE_META_ADD_PTR> actions;
+        for (uint i = 0; i < numFrames; i++)
+        {
+            triggers.push_back(DSL_ODE_TRIGGER_ALWAYS_NEW(
+                ("always-" + std::to_string(i)).c_str(), 
+                ("source-" + std::to_string(i)).c_str(), 
+                DSL_ODE_PRE_OCCURRENCE_CHECK));
+            triggers.back()->_setSourceId(i);
+            
+            actions.push_back(DSL_ODE_ACTION_MESSAGE_META_ADD_NEW(
+                ("message-meta-" + std::to_string(i)).c_str()));
+            REQUIRE( actions.back()->RequiresSerialExecution() == true );
+            
+            REQUIRE( triggers.back()->AddAction(actions.back()) == true );
+            REQUIRE( pPadProbeHandler->AddChild(triggers.back()) == true );
+        }
+        
+        NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(numFrames);
+        GstBuffer* pBuffer = gst_buffer_new();
+        NvDsMeta* pMeta = gst_buffer_add_nvds_meta(pBuffer, pBatchMeta,
+            NULL, nvds_batch_meta_copy_func, nvds_batch_meta_release_func);
+        pMeta->meta_type = NVDS_BATCH_GST_META;
+        
+        std::vector<NvDsFrameMeta*> frames;
+        for (uint i = 0; i < numFrames; i++)
+        {
+            NvDsFrameMeta* pFrameMeta = nvds_acquire_frame_meta_from_pool(pBatchMeta);
+            pFrameMeta->source_id = i;
+            pFrameMeta->batch_id = i;
+            nvds_add_frame_meta_to_batch(pBatchMeta, pFrameMeta);
+            frames.push_back(pFrameMeta);
+        }
+        
+        GstPadProbeInfo info = {(GstPadProbeType)0};
+        info.type = GST_PAD_PROBE_TYPE_BUFFER;
+        info.data = pBuffer;
+
+        WHEN( "The batch is handled repeatedly" )
+        {
+            THEN( "Each frame has exactly one Message Meta added for each batch" )
+            {
+                for (uint batch = 0; batch < 100; batch++)
+                {
+                    for (auto const& pFrameMeta: frames)
+                    {
+                        pFrameMeta->frame_num = batch;
+                        nvds_clear_frame_user_meta_list(pFrameMeta,
+                            pFrameMeta->frame_user_meta_list);
+                    }
+                    pPadProbeHandler->HandlePadData(&info);
+                    
+                    for (auto const& pFrameMeta: frames)
+                    {
+                        REQUIRE( g_list_length(pFrameMeta->frame_user_meta_list) == 1 );
+                        NvDsUserMeta* pUserMeta = 
+                            (NvDsUserMeta*)pFrameMeta->frame_user_meta_list->data;
+                        REQUIRE( pUserMeta->base_meta.meta_type == NVDS_EVENT_MSG_META );
+                        REQUIRE( ((NvDsEventMsgMeta*)pUserMeta->user_meta_data)->
+                            sensorId == (gint)pFrameMeta->source_id );
+                    }
+                }
+                // releases the batch meta as well
+                gst_buffer_unref(pBuffer);
+            }
+        }
+    }
+}
+
 SCENARIO( "A new MeterPadProbeHandler is created correctly", "[PadProbeHandler]" )
 {
     GIVEN( "Attributes for a new MeterPadProbeHandler" ) 
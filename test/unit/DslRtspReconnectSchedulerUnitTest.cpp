@@ -0,0 +1,173 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "catch.hpp"
+#include "DslSourceBintr.h"
+#include "DslPipelineSourcesBintr.h"
+#include "DslRtspReconnectScheduler.h"
+
+using namespace DSL;
+
+static std::string sourceName("rtsp-source");
+static std::string rtspUri("rtsp://127.0.0.1:8554/rtsp-sink");
+static uint latency(100);
+static uint timeout(2);
+
+SCENARIO( "The RTSP Reconnect Scheduler's backoff time is calculated correctly", 
+    "[RtspReconnectScheduler]" )
+{
+    GIVEN( "A reconnection sleep time" ) 
+    {
+        uint sleep(10);
+
+        WHEN( "The backoff time is calculated for consecutive failures" )
+        {
+            THEN( "The backoff doubles with each failure, within the jitter range" )
+            {
+                REQUIRE( RtspReconnectScheduler::GetBackoffTime(sleep, 1, 0.0) == 
+                    5*G_USEC_PER_SEC );
+                REQUIRE( RtspReconnectScheduler::GetBackoffTime(sleep, 1, 1.0) == 
+                    10*G_USEC_PER_SEC );
+                REQUIRE( RtspReconnectScheduler::GetBackoffTime(sleep, 3, 0.0) == 
+                    20*G_USEC_PER_SEC );
+                REQUIRE( RtspReconnectScheduler::GetBackoffTime(sleep, 3, 1.0) == 
+                    40*G_USEC_PER_SEC );
+            }
+            THEN( "The backoff is capped at the maximum" )
+            {
+                REQUIRE( RtspReconnectScheduler::GetBackoffTime(sleep, 64, 1.0) == 
+                    (int64_t)DSL_RTSP_RECONNECT_MAX_BACKOFF_S*G_USEC_PER_SEC );
+                    
+                // a sleep time greater than the max is never reduced. 
+                REQUIRE( RtspReconnectScheduler::GetBackoffTime(
+                    DSL_RTSP_RECONNECT_MAX_BACKOFF_S*2, 4, 1.0) == 
+                    (int64_t)DSL_RTSP_RECONNECT_MAX_BACKOFF_S*2*G_USEC_PER_SEC );
+            }
+        }
+    }
+}
+
+SCENARIO( "The RTSP Reconnect Scheduler caps the number of concurrent attempts", 
+    "[RtspReconnectScheduler]" )
+{
+    GIVEN( "A new RTSP Reconnect Scheduler and three RTSP Sources with a parent" ) 
+    {
+        RtspReconnectScheduler rtspReconnectScheduler(2);
+        
+        DSL_PIPELINE_SOURCES_PTR pPipelineSourcesBintr = 
+            DSL_PIPELINE_SOURCES_NEW("pipeline-sources", 0);
+
+        std::vector<DSL_RTSP_SOURCE_PTR> rtspSources;
+        for (uint i = 0; i < 3; i++)
+        {
+            rtspSources.push_back(DSL_RTSP_SOURCE_NEW(
+                (sourceName + std::to_string(i)).c_str(), rtspUri.c_str(), 
+                DSL_RTP_ALL, false, 0, latency, timeout));
+                
+            // Source needs a parent to sync its state with
+            REQUIRE( pPipelineSourcesBintr->AddChild(
+                std::dynamic_pointer_cast<SourceBintr>(rtspSources[i])) == true );
+        }
+
+        WHEN( "All Sources are scheduled for reconnection" )
+        {
+            for (auto const& ivec: rtspSources)
+            {
+                REQUIRE( rtspReconnectScheduler.Schedule(ivec.get()) == true );
+            }
+            // scheduling a second time must fail
+            REQUIRE( rtspReconnectScheduler.Schedule(
+                rtspSources[0].get()) == false );
+            
+            THEN( "Only the maximum number of attempts are started" )
+            {
+                REQUIRE( rtspReconnectScheduler.HandleTimerTick() == true );
+                
+                REQUIRE( rtspReconnectScheduler.GetScheduledCount() == 3 );
+                REQUIRE( rtspReconnectScheduler.GetActiveCount() == 2 );
+
+                dsl_rtsp_connection_data data{0};
+                rtspSources[2]->GetConnectionData(&data);
+                REQUIRE( data.retries == 0 );
+                
+                REQUIRE( rtspReconnectScheduler.Cancel(
+                    rtspSources[0].get()) == true );
+                REQUIRE( rtspReconnectScheduler.IsScheduled(
+                    rtspSources[0].get()) == false );
+                REQUIRE( rtspReconnectScheduler.GetActiveCount() == 1 );
+                
+                // The freed slot is taken by the waiting Source.
+                REQUIRE( rtspReconnectScheduler.HandleTimerTick() == true );
+                REQUIRE( rtspReconnectScheduler.GetActiveCount() == 2 );
+                rtspSources[2]->GetConnectionData(&data);
+                REQUIRE( data.retries == 1 );
+                
+                REQUIRE( rtspReconnectScheduler.Cancel(
+                    rtspSources[1].get()) == true );
+                REQUIRE( rtspReconnectScheduler.Cancel(
+                    rtspSources[2].get()) == true );
+                REQUIRE( rtspReconnectScheduler.GetScheduledCount() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "The RTSP Reconnect Scheduler backs off after a failed attempt", 
+    "[RtspReconnectScheduler]" )
+{
+    GIVEN( "A new RTSP Reconnect Scheduler and an RTSP Source without a parent" ) 
+    {
+        RtspReconnectScheduler rtspReconnectScheduler(2);
+
+        DSL_RTSP_SOURCE_PTR pRtspSourceBintr = DSL_RTSP_SOURCE_NEW(
+            sourceName.c_str(), rtspUri.c_str(), DSL_RTP_ALL, false, 0, 
+            latency, timeout);
+
+        WHEN( "The Source is scheduled for reconnection" )
+        {
+            REQUIRE( rtspReconnectScheduler.Schedule(
+                pRtspSourceBintr.get()) == true );
+            
+            THEN( "The attempt fails to sync with the parent and the Source waits" )
+            {
+                REQUIRE( rtspReconnectScheduler.HandleTimerTick() == true );
+                
+                REQUIRE( rtspReconnectScheduler.IsScheduled(
+                    pRtspSourceBintr.get()) == true );
+                REQUIRE( rtspReconnectScheduler.GetActiveCount() == 0 );
+
+                // The next attempt is not started before the backoff time.
+                REQUIRE( rtspReconnectScheduler.HandleTimerTick() == true );
+
+                dsl_rtsp_connection_data data{0};
+                pRtspSourceBintr->GetConnectionData(&data);
+                REQUIRE( data.retries == 1 );
+                
+                REQUIRE( rtspReconnectScheduler.Cancel(
+                    pRtspSourceBintr.get()) == true );
+            }
+        }
+    }
+}
@@ -27,6 +27,7 @@ THE SOFTWARE.
 #include "DslSinkBintr.h"
 #include "DslSourceBintr.h"
 #include "DslPipelineSourcesBintr.h"
+#include "DslRtspReconnectScheduler.h"
 
 static std::string sourceName("test-source");
 static std::string uri("/opt/nvidia/deepstream/deepstream/samples/streams/sample_1080p_h265.mp4");
@@ -1086,8 +1087,20 @@ SCENARIO( "An RtspSourceBintr's Stream Management callback behaves correctly", "
                 // simulate timer callback
                 REQUIRE( pRtspSourceBintr->NotifyClientListeners() == FALSE );
 
-                // simulate a reconnection timer - 
-                REQUIRE( pRtspSourceBintr->ReconnectionManager() == true );
+                // the Source is handed to the shared Reconnect Scheduler
+                REQUIRE( RtspReconnectScheduler::GetScheduler()->IsScheduled(
+                    pRtspSourceBintr.get()) == true );
+                    
+                // simulate a scheduler timer tick to start the first attempt
+                REQUIRE( RtspReconnectScheduler::GetScheduler()->HandleTimerTick() == true );
+                
+                dsl_rtsp_connection_data data{0};
+                pRtspSourceBintr->GetConnectionData(&data);
+                REQUIRE( data.is_in_reconnect == true );
+                REQUIRE( data.retries == 1 );
+
+                REQUIRE( RtspReconnectScheduler::GetScheduler()->Cancel(
+                    pRtspSourceBintr.get()) == true );
             }
         }
     }
@@ -0,0 +1,242 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2024, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "catch.hpp"
+#include "DslTimerWheel.h"
+
+using namespace DSL;
+
+struct TestTimer
+{
+    TestTimer(uint repeat)
+        : repeat(repeat)
+        , count(0)
+        , pTimerWheel(NULL)
+        , timerId(0)
+    {};
+    
+    uint repeat;
+    uint count;
+    TimerWheel* pTimerWheel;
+    uint timerId;
+};
+
+static int test_timer_cb(gpointer pTestTimer)
+{
+    TestTimer* pTimer = (TestTimer*)pTestTimer;
+    
+    return (++pTimer->count < pTimer->repeat);
+}
+
+static int test_timer_remove_cb(gpointer pTestTimer)
+{
+    TestTimer* pTimer = (TestTimer*)pTestTimer;
+    
+    pTimer->count++;
+    pTimer->pTimerWheel->Remove(pTimer->timerId);
+    
+    // return true - the timer must still be removed.
+    return true;
+}
+
+SCENARIO( "A Timer Wheel assigns unique ids and removes Timers", "[TimerWheel]" )
+{
+    GIVEN( "A new Timer Wheel" ) 
+    {
+        TimerWheel timerWheel;
+        TestTimer testTimer(1);
+        
+        REQUIRE( timerWheel.GetTimerCount() == 0 );
+
+        WHEN( "Two Timers are added" )
+        {
+            uint timerId1 = timerWheel.Add(100, test_timer_cb, &testTimer);
+            uint timerId2 = timerWheel.Add(100, test_timer_cb, &testTimer);
+            
+            THEN( "Each Timer has a unique non-zero id and can be removed once" )
+            {
+                REQUIRE( timerId1 != 0 );
+                REQUIRE( timerId2 != 0 );
+                REQUIRE( timerId1 != timerId2 );
+                REQUIRE( timerWheel.GetTimerCount() == 2 );
+                
+                REQUIRE( timerWheel.Remove(timerId1) == true );
+                REQUIRE( timerWheel.Remove(timerId1) == false );
+                REQUIRE( timerWheel.GetTimerCount() == 1 );
+                REQUIRE( timerWheel.Remove(timerId2) == true );
+                REQUIRE( timerWheel.GetTimerCount() == 0 );
+                
+                // The removed Timers must never be called.
+                timerWheel.AdvanceTicks(100);
+                REQUIRE( testTimer.count == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Timer Wheel calls each Timer's handler on expiry", "[TimerWheel]" )
+{
+    GIVEN( "A new Timer Wheel" ) 
+    {
+        TimerWheel timerWheel;
+        uint intervalTicks(5);
+
+        WHEN( "A one-shot Timer is added" )
+        {
+            TestTimer testTimer(1);
+            timerWheel.Add(intervalTicks*DSL_TIMER_WHEEL_TICK_MS, 
+                test_timer_cb, &testTimer);
+            
+            THEN( "The handler is called once, no earlier than the interval" )
+            {
+                timerWheel.AdvanceTicks(intervalTicks);
+                REQUIRE( testTimer.count == 0 );
+                timerWheel.AdvanceTicks(1);
+                REQUIRE( testTimer.count == 1 );
+                REQUIRE( timerWheel.GetTimerCount() == 0 );
+                timerWheel.AdvanceTicks(intervalTicks*4);
+                REQUIRE( testTimer.count == 1 );
+            }
+        }
+        WHEN( "A repeating Timer is added" )
+        {
+            TestTimer testTimer(3);
+            timerWheel.Add(intervalTicks*DSL_TIMER_WHEEL_TICK_MS, 
+                test_timer_cb, &testTimer);
+            
+            THEN( "The handler is called on each interval until it returns false" )
+            {
+                timerWheel.AdvanceTicks(intervalTicks+1);
+                REQUIRE( testTimer.count == 1 );
+                timerWheel.AdvanceTicks(intervalTicks);
+                REQUIRE( testTimer.count == 2 );
+                timerWheel.AdvanceTicks(intervalTicks);
+                REQUIRE( testTimer.count == 3 );
+                REQUIRE( timerWheel.GetTimerCount() == 0 );
+            }
+        }
+        WHEN( "A Timer removes itself from within its handler" )
+        {
+            TestTimer testTimer(0);
+            testTimer.pTimerWheel = &timerWheel;
+            testTimer.timerId = timerWheel.Add(intervalTicks*DSL_TIMER_WHEEL_TICK_MS, 
+                test_timer_remove_cb, &testTimer);
+            
+            THEN( "The Timer is removed regardless of the handler's return value" )
+            {
+                timerWheel.AdvanceTicks(intervalTicks*4);
+                REQUIRE( testTimer.count == 1 );
+                REQUIRE( timerWheel.GetTimerCount() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Timer Wheel re-arms a repeating Timer from the current time", "[TimerWheel]" )
+{
+    GIVEN( "A new Timer Wheel with a repeating Timer" ) 
+    {
+        TimerWheel timerWheel;
+        TestTimer testTimer(100);
+        timerWheel.Add(DSL_TIMER_WHEEL_TICK_MS, test_timer_cb, &testTimer);
+
+        WHEN( "The Timer Wheel is stalled for many intervals" )
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(
+                DSL_TIMER_WHEEL_TICK_MS*20));
+            timerWheel.HandleTimerTick();
+            
+            THEN( "The handler is called once while the wheel catches up" )
+            {
+                REQUIRE( testTimer.count == 1 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Timer Wheel never expires a new Timer early while catching up", "[TimerWheel]" )
+{
+    GIVEN( "A Timer Wheel with a pending Timer that has fallen behind" ) 
+    {
+        TimerWheel timerWheel;
+        TestTimer pendingTimer(1);
+        timerWheel.Add(DSL_TIMER_WHEEL_TICK_MS*1000, test_timer_cb, &pendingTimer);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(
+            DSL_TIMER_WHEEL_TICK_MS*20));
+
+        WHEN( "A new Timer is added before the wheel catches up" )
+        {
+            TestTimer testTimer(1);
+            timerWheel.Add(DSL_TIMER_WHEEL_TICK_MS*5, test_timer_cb, &testTimer);
+            
+            THEN( "The handler is not called by the catch up" )
+            {
+                timerWheel.AdvanceTicks(5);
+                REQUIRE( testTimer.count == 0 );
+                timerWheel.HandleTimerTick();
+                REQUIRE( testTimer.count == 0 );
+                REQUIRE( timerWheel.GetTimerCount() == 2 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Timer Wheel cascades Timers from the upper levels", "[TimerWheel]" )
+{
+    GIVEN( "A new Timer Wheel" ) 
+    {
+        TimerWheel timerWheel;
+        
+        // Intervals spanning the first three levels of the wheel.
+        uint intervalTicks[] = {1, 63, 64, 65, 4095, 4096, 4097, 100000};
+        std::vector<std::shared_ptr<TestTimer>> testTimers;
+
+        WHEN( "One-shot Timers are added with each interval" )
+        {
+            for (auto const& interval: intervalTicks)
+            {
+                testTimers.push_back(std::shared_ptr<TestTimer>(new TestTimer(1)));
+                timerWheel.Add(interval*DSL_TIMER_WHEEL_TICK_MS, 
+                    test_timer_cb, testTimers.back().get());
+            }
+            THEN( "Each handler is called on the tick following its interval" )
+            {
+                uint ticks(0);
+                for (uint i = 0; i < testTimers.size(); i++)
+                {
+                    timerWheel.AdvanceTicks(intervalTicks[i] - ticks);
+                    ticks = intervalTicks[i];
+                    REQUIRE( testTimers[i]->count == 0 );
+                    
+                    timerWheel.AdvanceTicks(1);
+                    ticks++;
+                    REQUIRE( testTimers[i]->count == 1 );
+                }
+                REQUIRE( timerWheel.GetTimerCount() == 0 );
+            }
+        }
+    }
+}